@@ -116,6 +116,7 @@
 #include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
 #include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
 #include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
 
 #include "helper.h"
 
@@ -141,6 +142,8 @@ static constexpr int TP_ = TP{};
 // * All Gather + GEMM:
 //   * AllGather1D_TilingCD_RotatingA
 //   * AllGather1D_TilingCD_RotatingB
+//   * AllGatherHierarchical_TilingCD_RotatingA<DomainSize, NumDomains>  (TP = DomainSize * NumDomains)
+//   * AllGatherHierarchical_TilingCD_RotatingB<DomainSize, NumDomains>
 //
 // * GEMM + Reduce Scatter:
 //   * ReduceScatter1D_TilingA_RotatingC
@@ -35,6 +35,7 @@
 #endif
 
 #include <cute/atom/copy_traits_sm90_tma_swizzle.hpp>
+#include <cute/atom/copy_traits_sm90_tma_cache.hpp>
 #include <cute/atom/copy_traits.hpp>
 #include <cute/atom/copy_atom.hpp>
 
@@ -1038,19 +1039,42 @@ make_tma_copy_desc(Tensor<GEngine,GLayout> const& gtensor,         // The origin
     TMA::SmemSwizzleBits swizzle_bits = get_tma_swizzle_bits(swizzle);
     TMA::SmemSwizzleBase swizzle_base = get_tma_swizzle_base(swizzle);
     CUtensorMapSwizzle smem_swizzle = TMA::to_CUtensorMapSwizzle(swizzle_bits, swizzle_base);
-    CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
-        &tma_desc,
-        tma_format,
-        tma_dim,
-        gmem_address,
-        gmem_prob_shape.data(),
-        gmem_prob_stride.data() + 1,  // gmem_prob_stride[0] implicitly 1
-        smem_box_shape.data(),
-        smem_box_stride.data(),
-        tma_interleave,
-        smem_swizzle,
-        tma_l2Promotion,
-        tma_oobFill);
+
+    // With an active descriptor cache, only the address of a descriptor of known geometry is replaced
+    TmaDescriptorCache* cache = TmaDescriptorCache::active();
+    TmaDescriptorCache::Key cache_key;
+    if (cache != nullptr) {
+      cache_key.data_type      = static_cast<uint32_t>(tma_format);
+      cache_key.rank           = static_cast<uint32_t>(tma_dim);
+      cache_key.interleave     = static_cast<uint32_t>(tma_interleave);
+      cache_key.swizzle        = static_cast<uint32_t>(smem_swizzle);
+      cache_key.l2promotion    = static_cast<uint32_t>(tma_l2Promotion);
+      cache_key.oob_fill       = static_cast<uint32_t>(tma_oobFill);
+      cache_key.global_dim     = gmem_prob_shape;
+      cache_key.global_stride  = gmem_prob_stride;
+      cache_key.box_dim        = smem_box_shape;
+      cache_key.element_stride = smem_box_stride;
+    }
+
+    CUresult result = CUDA_SUCCESS;
+    if (cache == nullptr || !cache->find(cache_key, gmem_address, &tma_desc)) {
+      result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+          &tma_desc,
+          tma_format,
+          tma_dim,
+          gmem_address,
+          gmem_prob_shape.data(),
+          gmem_prob_stride.data() + 1,  // gmem_prob_stride[0] implicitly 1
+          smem_box_shape.data(),
+          smem_box_stride.data(),
+          tma_interleave,
+          smem_swizzle,
+          tma_l2Promotion,
+          tma_oobFill);
+      if (cache != nullptr && result == CUDA_SUCCESS) {
+        cache->insert(cache_key, tma_desc);
+      }
+    }
 
     if (result != CUDA_SUCCESS) {
       std::cerr << "TMA Desc Addr:   " << &tma_desc
@@ -0,0 +1,177 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/// @file copy_traits_sm90_tma_cache.hpp
+/// @brief Host cache of encoded TMA descriptors keyed on everything but the global address
+
+#if !defined(__CUDACC_RTC__)
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+#include <cute/arch/copy_sm90_desc.hpp>
+#include <cute/container/array.hpp>
+
+#include <cutlass/cuda_host_adapter.hpp>
+
+namespace cute
+{
+
+//
+// TmaDescriptorCache
+//   Encoding a TMA descriptor validates and packs the whole tensor geometry, while patching the
+//   global address of an already encoded descriptor is a much cheaper driver call. While a cache is
+//   active on the calling thread (see TmaDescriptorCache::Scope), make_tma_copy and the other
+//   make_tma_* builders look up each descriptor by its geometry and, on a hit, copy the cached
+//   descriptor and replace its address instead of encoding it again.
+//
+//   A cache is not thread-safe; each thread must activate its own.
+//
+
+class TmaDescriptorCache
+{
+public:
+
+  /// Every argument of cuTensorMapEncodeTiled except the tensor map and the global address
+  struct Key {
+    uint32_t data_type   = 0;
+    uint32_t rank        = 0;
+    uint32_t interleave  = 0;
+    uint32_t swizzle     = 0;
+    uint32_t l2promotion = 0;
+    uint32_t oob_fill    = 0;
+    cute::array<uint64_t, 5> global_dim     = {};
+    cute::array<uint64_t, 5> global_stride  = {};   // in bytes, including the implicit leading stride
+    cute::array<uint32_t, 5> box_dim        = {};
+    cute::array<uint32_t, 5> element_stride = {};
+
+    bool operator==(Key const& other) const {
+      return data_type   == other.data_type   && rank     == other.rank     &&
+             interleave  == other.interleave  && swizzle  == other.swizzle  &&
+             l2promotion == other.l2promotion && oob_fill == other.oob_fill &&
+             global_dim  == other.global_dim  && global_stride  == other.global_stride &&
+             box_dim     == other.box_dim     && element_stride == other.element_stride;
+    }
+  };
+
+  /// Caches at most max_entries descriptors; the cache is emptied when it would exceed it
+  explicit TmaDescriptorCache(size_t max_entries = 256) : max_entries_(max_entries) {}
+
+  /// Makes a cache the active one of the calling thread for the lifetime of the scope
+  class Scope {
+  public:
+    explicit Scope(TmaDescriptorCache& cache) : previous_(active()) { active() = &cache; }
+    ~Scope() { active() = previous_; }
+    Scope(Scope const&) = delete;
+    Scope& operator=(Scope const&) = delete;
+  private:
+    TmaDescriptorCache* previous_;
+  };
+
+  /// The cache active on the calling thread, or nullptr
+  static TmaDescriptorCache*& active() {
+    static thread_local TmaDescriptorCache* cache = nullptr;
+    return cache;
+  }
+
+  /// On a hit, writes the cached descriptor for key with its address replaced by global_address
+  /// to desc and returns true
+  bool find(Key const& key, void* global_address, TmaDescriptor* desc) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      ++misses_;
+      return false;
+    }
+    TmaDescriptor patched = it->second;
+#if (__CUDACC_VER_MAJOR__ >= 12)
+    if (CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(&patched, global_address) != CUDA_SUCCESS) {
+      ++misses_;
+      return false;
+    }
+#else
+    (void) global_address;
+#endif
+    *desc = patched;
+    ++hits_;
+    return true;
+  }
+
+  /// Stores a freshly encoded descriptor for key
+  void insert(Key const& key, TmaDescriptor const& desc) {
+    if (entries_.size() >= max_entries_ && entries_.find(key) == entries_.end()) {
+      entries_.clear();
+    }
+    entries_[key] = desc;
+  }
+
+  void clear() {
+    entries_.clear();
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+  size_t size()   const { return entries_.size(); }
+  size_t hits()   const { return hits_; }
+  size_t misses() const { return misses_; }
+
+private:
+
+  struct KeyHash {
+    size_t operator()(Key const& key) const {
+      // FNV-1a over the fields
+      uint64_t hash = 14695981039346656037ull;
+      auto mix = [&](uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ull;
+      };
+      mix(key.data_type); mix(key.rank); mix(key.interleave);
+      mix(key.swizzle); mix(key.l2promotion); mix(key.oob_fill);
+      for (int i = 0; i < 5; ++i) {
+        mix(key.global_dim[i]);
+        mix(key.global_stride[i]);
+        mix(key.box_dim[i]);
+        mix(key.element_stride[i]);
+      }
+      return static_cast<size_t>(hash);
+    }
+  };
+
+  std::unordered_map<Key, TmaDescriptor, KeyHash> entries_;
+  size_t max_entries_;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+};
+
+} // end namespace cute
+
+#endif // !defined(__CUDACC_RTC__)
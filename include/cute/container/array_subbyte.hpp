@@ -439,9 +439,29 @@ public:
 
   CUTE_HOST_DEVICE constexpr
   void fill(T const& value) {
-    CUTE_UNROLL
-    for (size_type i = 0; i < N; ++i) {
-      at(i) = value;
+    if constexpr (sizeof_bits_v<storage_type> % sizeof_bits_v<value_type> == 0) {
+      // Replicate the value across one storage element and assign whole storage elements
+      constexpr size_type ElementsPerStorage = sizeof_bits_v<storage_type> / sizeof_bits_v<value_type>;
+      constexpr size_type FullStorageElements = N / ElementsPerStorage;
+      storage_type pattern = storage_type(0);
+      iterator pattern_it(&pattern);
+      CUTE_UNROLL
+      for (size_type i = 0; i < ElementsPerStorage; ++i) {
+        pattern_it[i] = value;
+      }
+      CUTE_UNROLL
+      for (size_type i = 0; i < FullStorageElements; ++i) {
+        storage[i] = pattern;
+      }
+      CUTE_UNROLL
+      for (size_type i = FullStorageElements * ElementsPerStorage; i < N; ++i) {
+        at(i) = value;
+      }
+    } else {
+      CUTE_UNROLL
+      for (size_type i = 0; i < N; ++i) {
+        at(i) = value;
+      }
     }
   }
 
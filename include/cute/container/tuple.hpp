@@ -134,6 +134,11 @@ struct ESO<false, false, First, Rest...> {
 };
 
 // Get Nth value from ESO
+//
+// The Nth element is reached through N nested rest_ members. These always exist on the path to a
+// non-empty element, so up to eight levels are descended directly per instantiation. This keeps the
+// number of getr instantiations (and the instantiation depth) at N/8 + 1 rather than N + 1 without
+// changing the nested layout of ESO.
 template <class R, size_t N, class S>
 CUTE_HOST_DEVICE constexpr
 R
@@ -141,8 +146,22 @@ getr(S&& s) noexcept
 {
   if constexpr (N == 0) {
     return static_cast<S&&>(s).first_;
+  } else if constexpr (N == 1) {
+    return static_cast<S&&>(s).rest_.first_;
+  } else if constexpr (N == 2) {
+    return static_cast<S&&>(s).rest_.rest_.first_;
+  } else if constexpr (N == 3) {
+    return static_cast<S&&>(s).rest_.rest_.rest_.first_;
+  } else if constexpr (N == 4) {
+    return static_cast<S&&>(s).rest_.rest_.rest_.rest_.first_;
+  } else if constexpr (N == 5) {
+    return static_cast<S&&>(s).rest_.rest_.rest_.rest_.rest_.first_;
+  } else if constexpr (N == 6) {
+    return static_cast<S&&>(s).rest_.rest_.rest_.rest_.rest_.rest_.first_;
+  } else if constexpr (N == 7) {
+    return static_cast<S&&>(s).rest_.rest_.rest_.rest_.rest_.rest_.rest_.first_;
   } else {
-    return getr<R,N-1>(static_cast<S&&>(s).rest_);
+    return getr<R,N-8>(static_cast<S&&>(s).rest_.rest_.rest_.rest_.rest_.rest_.rest_.rest_);
   }
   CUTE_GCC_UNREACHABLE;
 }
@@ -149,6 +149,7 @@ namespace cutlass {
 #if (__CUDACC_VER_MAJOR__ >= 12)
 CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapEncodeTiled, 12000);
 CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapEncodeIm2col, 12000);
+CUTLASS_CUDA_DRIVER_WRAPPER_DECL(cuTensorMapReplaceAddress, 12000);
 #endif
 
 #undef CUTLASS_CUDA_DRIVER_STRINGIFY
@@ -113,6 +113,18 @@ public:
   static constexpr bool HasMemcpy = DistSchedule::HasMemcpy;
   using TP = typename DistSchedule::TP;
   static constexpr int TP_ = TP{};
+
+  // Only the 1-D communication pattern is implemented on device: TP iterations, each gated either
+  // by a single memcpied operand copied from its owner, or by an arrival flag written by the kernel.
+  // Schedules that redefine get_copy_source_iteration (hierarchical all gathers) run correctly, but
+  // copy every slice from its owner instead of forwarding it.
+  static_assert(
+      DistSchedule::Iterations{} == TP{} &&
+      not DistSchedule::LocalReduction &&
+      not (DistSchedule::MemcpyA && DistSchedule::MemcpyB) &&
+      DistSchedule::HasMemcpy != DistSchedule::KernelWritesArrivalFlag,
+      "SUMMA and 2-D AllGather + ReduceScatter schedules are not supported on device yet.");
+
   using ElementFlag = typename GemmKernel::ElementFlag;
   using ElementBarrier = uint32_t;
 
@@ -147,14 +147,14 @@ namespace cutlass::distributed::schedules {
 template <class TP_>
 struct ReduceScatter1D_TilingA_RotatingC: BaseSchedule<
     TP_,
-    /* ProcessorTiler_ = */ cute::Shape<_1, _1, TP_, _1>,
-    /* IterationTiler_ = */ cute::Shape<TP_, _1, _1, _1>,
-    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _0>>,                             // (left neighbor) = (device_idx + ProcessorOffset + TP) % TP, with ProcessorOffset = -1
-    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _m1>>,                            // = (device_idx + ProcessorOffset - iter + TP) % TP, with ProcessorOffset = -1
-    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::N == 1) = 0
-    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::K == 1) = 0
-    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::L == 1) = 0
-    /* ProcessorOffset_ = */ _m1,
+    /* ProcessorTiler_ = */ cute::Shape<cute::_1, cute::_1, TP_, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<TP_, cute::_1, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_0>>,                 // (left neighbor) = (device_idx + ProcessorOffset + TP) % TP, with ProcessorOffset = -1
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_m1>>,                // = (device_idx + ProcessorOffset - iter + TP) % TP, with ProcessorOffset = -1
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::N == 1) = 0
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_m1,
     /* MemcpyA_ = */ false,
     /* MemcpyB_ = */ false,
     /* KernelWritesArrivalFlag_ = */ true,
@@ -168,14 +168,14 @@ struct ReduceScatter1D_TilingA_RotatingC: BaseSchedule<
 template <class TP_>
 struct ReduceScatter1D_TilingB_RotatingC: BaseSchedule<
     TP_,
-    /* ProcessorTiler_ = */ cute::Shape<_1, _1, TP_, _1>,
-    /* IterationTiler_ = */ cute::Shape<_1, TP_, _1, _1>,
-    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _0>>,                             // (left neighbor) = (device_idx + ProcessorOffset + TP) % TP, with ProcessorOffset = -1
-    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::N == 1) = 0
-    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _m1>>,                            // = (device_idx + ProcessorOffset - iter + TP) % TP, with ProcessorOffset = -1
-    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::K == 1) = 0
-    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::L == 1) = 0
-    /* ProcessorOffset_ = */ _m1,
+    /* ProcessorTiler_ = */ cute::Shape<cute::_1, cute::_1, TP_, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<cute::_1, TP_, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_0>>,                 // (left neighbor) = (device_idx + ProcessorOffset + TP) % TP, with ProcessorOffset = -1
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::N == 1) = 0
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_m1>>,                // = (device_idx + ProcessorOffset - iter + TP) % TP, with ProcessorOffset = -1
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_m1,
     /* MemcpyA_ = */ false,
     /* MemcpyB_ = */ false,
     /* KernelWritesArrivalFlag_ = */ true,
@@ -279,14 +279,14 @@ struct ReduceScatter1D_TilingB_RotatingC: BaseSchedule<
 template <class TP_>
 struct AllGather1D_TilingCD_RotatingA: BaseSchedule<
     TP_,
-    /* ProcessorTiler_ = */ cute::Shape<_1, TP_, _1, _1>,
-    /* IterationTiler_ = */ cute::Shape<TP_, _1, _1, _1>,
-    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _1>>,                             // = device_idx + iter
-    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _1>>,                             // = device_idx + iter
-    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::N == 1) = 0
-    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::K == 1) = 0
-    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::L == 1) = 0
-    /* ProcessorOffset_ = */ _0,
+    /* ProcessorTiler_ = */ cute::Shape<cute::_1, TP_, cute::_1, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<TP_, cute::_1, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_1>>,                 // = device_idx + iter
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_1>>,                 // = device_idx + iter
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::N == 1) = 0
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_0,
     /* MemcpyA_ = */ true,
     /* MemcpyB_ = */ false,
     /* KernelWritesArrivalFlag_ = */ false,
@@ -301,14 +301,14 @@ struct AllGather1D_TilingCD_RotatingA: BaseSchedule<
 template <class TP_>
 struct AllGather1D_TilingCD_RotatingB: BaseSchedule<
     TP_,
-    /* ProcessorTiler_ = */ cute::Shape<TP_, _1, _1, _1>,
-    /* IterationTiler_ = */ cute::Shape<_1, TP_, _1, _1>,
-    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _1>>,                             // = device_idx + iter
-    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::M == 1) = 0
-    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _1>>,                             // = device_idx + iter
-    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::K == 1) = 0
-    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::L == 1) = 0
-    /* ProcessorOffset_ = */ _0,
+    /* ProcessorTiler_ = */ cute::Shape<TP_, cute::_1, cute::_1, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<cute::_1, TP_, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_1>>,                 // = device_idx + iter
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::M == 1) = 0
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_1, cute::_1>>,                 // = device_idx + iter
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<cute::_0, cute::_0>>,                 // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_0,
     /* MemcpyA_ = */ false,
     /* MemcpyB_ = */ true,
     /* KernelWritesArrivalFlag_ = */ false,
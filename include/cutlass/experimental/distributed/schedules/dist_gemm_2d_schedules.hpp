@@ -0,0 +1,519 @@
+/***************************************************************************************************
+ * Copyright (c) 2024 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file 2-D and Hierarchical Distributed GEMM Schedules
+
+  NOTE: This API is __experimental__ and will change heavily over time. Please refer to
+  dist_gemm_1d_schedules.hpp for the conventions and pitfalls of defining schedules with CuTe
+  layouts.
+
+  The 1-D schedules rotate a single operand around a single ring of TP devices, so that every
+  device receives (TP - 1) / TP of the rotated operand, most of it over the slowest link of the
+  ring. The schedules in this file arrange the TP devices in a 2-D grid, with device index
+  device_idx = x + y * X, and only communicate along the rows or columns of the grid:
+
+  * SUMMA2D_TilingCD_RotatingAB<P> (TP = P x P) rotates A along the columns and B along the rows
+    of the grid, and reduces over K on each device, in P iterations.
+
+  * AllGatherReduceScatter2D_TilingB_RotatingAC<G, R> (TP = G x R) gathers A among the G devices
+    of a row, and reduce-scatters the output among the R devices of a column.
+
+  * AllGatherHierarchical_TilingCD_Rotating{A,B}<DomainSize, NumDomains> treat the devices as
+    NumDomains NVLink domains of DomainSize consecutive devices each, fetch each slice of a remote
+    domain once per domain, and forward it to the other devices of the domain over local links.
+
+  The device adapter (device/dist_gemm_universal_wrapper.hpp) only implements the communication of
+  the 1-D schedules so far. It rejects the SUMMA and AllGather + ReduceScatter schedules at compile
+  time, and runs the hierarchical ones by copying every slice from its owner instead of forwarding
+  it; all of them are fully modeled by the simulator below.
+
+  With X consecutive devices per domain, the 2-D schedules only send one direction of traffic
+  across domains, and the hierarchical ones send every slice across domains NumDomains - 1 times
+  instead of TP - DomainSize times. The amount of data crossing domains can be compared with
+  cutlass::DistGemmScheduleSimulator (tools/util/include/cutlass/util/dist_gemm_schedule_simulator.hpp),
+  which also validates the schedules in this file on the host.
+
+  Rotations within a row or column of the grid require "wrapping" arithmetic within a sub-ring
+  (e.g. (x + iter) % X), which a linear layout cannot express on its own. These mappings are
+  instead expressed as a ComposedLayout: an inner linear layout of (device_idx, iter) that keeps
+  the sub-ring coordinate from carrying into the outer one, followed by an outer layout whose
+  hierarchical shape reduces the sub-ring coordinate modulo its extent. Whatever a layout can't
+  express (skewed initial slices, sub-tiles of local tensors, and communication in only some of the
+  iterations) is implemented by redefining the corresponding BaseSchedule members.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cute/layout_composed.hpp"
+#include "cute/tensor.hpp"
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/schedules/dist_gemm_base_schedule.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::schedules {
+
+namespace detail {
+
+// Maps (device_idx, iter) to a peer index on a DimX x DimY grid of devices:
+//   device_idx = (x, y),  peer = ((x + dx) % DimX, y + dy)
+// where (dx, dy) is the inner product of iter, as shaped by IterationShape, with IterationStride,
+// in units of (1, 2 * DimX).
+//
+// The inner layout spaces rows 2 * DimX apart so that x + dx never carries into the row, and the
+// outer layout reduces the x coordinate modulo DimX. The reduction of y modulo DimY is the modulo
+// TP applied by BaseSchedule.
+template <class DimX, class DimY, class IterationShape, class IterationStride>
+using GridRing = cute::ComposedLayout<
+    cute::Layout<
+      cute::Shape<DimX, cute::_2, DimY>,
+      cute::Stride<cute::_1, cute::_0, DimX>>,
+    cute::_0,
+    cute::Layout<
+      cute::Shape<cute::Shape<DimX, DimY>, IterationShape>,
+      cute::Stride<cute::Stride<cute::_1, cute::Int<2 * DimX::value>>, IterationStride>>>;
+
+// Maps (device_idx, iter) to a peer (or tile) index on a DomainSize x NumDomains grid of devices:
+//   device_idx = (local_idx, domain),  iter = (local_iter, domain_iter)
+//   peer = ((local_idx + local_iter) % DomainSize, (domain + domain_iter) % NumDomains)
+template <class DomainSize, class NumDomains>
+using HierarchicalRing = GridRing<
+    DomainSize,
+    NumDomains,
+    cute::Shape<DomainSize, NumDomains>,
+    cute::Stride<cute::_1, cute::Int<2 * DomainSize::value>>>;
+
+// Zero mapping, for operands that aren't tiled across iterations.
+template <class TP, class Iterations>
+using ZeroMapping = cute::Layout<cute::Shape<TP, Iterations>, cute::Stride<cute::_0, cute::_0>>;
+
+// Hierarchical all-gather: in iteration (local_iter, domain_iter), devices need the slice of
+// device ((local_idx + local_iter) % DomainSize, (domain + domain_iter) % NumDomains). Slices
+// of the local domain are copied from their owner. Slices of a remote domain are copied from their
+// owner by the device with the same local index in iteration (0, domain_iter), and forwarded by
+// that device to the rest of the domain in the following iterations.
+template <int DomainSize, int NumDomains>
+struct HierarchicalForwarding {
+
+  static int
+  get_peer(int device_idx, int iteration) {
+    int local_idx = device_idx % DomainSize;
+    int domain = device_idx / DomainSize;
+    int local_iter = iteration % DomainSize;
+    int domain_iter = iteration / DomainSize;
+
+    int peer_local_idx = (local_idx + local_iter) % DomainSize;
+    int peer_domain = local_iter == 0 ? (domain + domain_iter) % NumDomains : domain;
+    return peer_local_idx + peer_domain * DomainSize;
+  }
+
+  static int
+  get_source_iteration([[maybe_unused]] int device_idx, int iteration) {
+    int local_iter = iteration % DomainSize;
+    int domain_iter = iteration / DomainSize;
+    return local_iter == 0 ? 0 : domain_iter * DomainSize;
+  }
+};
+
+} // namespace detail
+
+// SUMMA (Cannon-aligned)
+// TP = P x P GPUs form a P x P grid, with device_idx = x + y * P. Each GPU owns the (x, y) tile of
+// C and D, of shape [M / P, N / P], and A and B are tiled along K into P parts as well, so that
+// each GPU starts with an [M / P, K / P] tile of A and an [N / P, K / P] tile of B. The initial
+// tiles are skewed: GPU (x, y) starts with tiles A(x, k) and B(y, k), where k = (x + y) % P.
+//
+// In iteration i, GPU (x, y) copies A from GPU (x, (y + i) % P) and B from GPU ((x + i) % P, y),
+// which both hold K tile (x + y + i) % P, and computes a GEMM of shape [M / P, N / P, K / P] which
+// is accumulated into its own D (the epilogue source is D itself for iterations > 0).
+// The schedule therefore runs P iterations instead of TP, and every GPU receives 2 (P - 1) / P^2
+// of A and B respectively, instead of (TP - 1) / TP of one operand in the 1-D schedules.
+//
+// Below is an illustration of the K tile used by each GPU, in the P = 2 case:
+//
+//            iter 0   iter 1
+//   GPU0        0        1
+//   GPU1        1        0
+//   GPU2        1        0
+//   GPU3        0        1
+//
+// NOTE: the epilogue reads C and writes D in place for iterations > 0, so C and D must have the
+// same element type and layout, and the user-provided beta and C only apply to iteration 0.
+//
+template <class GridSize_>
+struct SUMMA2D_TilingCD_RotatingAB: BaseSchedule<
+    cute::Int<GridSize_::value * GridSize_::value>,
+    /* ProcessorTiler_ = */ cute::Shape<GridSize_, GridSize_, cute::_1, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<cute::_1, cute::_1, GridSize_, cute::_1>,
+    /* PeerDeviceMapping_ = */ detail::GridRing<GridSize_, GridSize_, GridSize_, cute::Int<2 * GridSize_::value>>, // = (x, (y + iter) % P)
+    /* IterationMappingM_ = */ detail::ZeroMapping<cute::Int<GridSize_::value * GridSize_::value>, GridSize_>,    // (IterationTiler::M == 1) = 0
+    /* IterationMappingN_ = */ detail::ZeroMapping<cute::Int<GridSize_::value * GridSize_::value>, GridSize_>,    // (IterationTiler::N == 1) = 0
+    /* IterationMappingK_ = */ detail::ZeroMapping<cute::Int<GridSize_::value * GridSize_::value>, GridSize_>,    // A and B are buffered
+    /* IterationMappingL_ = */ detail::ZeroMapping<cute::Int<GridSize_::value * GridSize_::value>, GridSize_>,    // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_0,
+    /* MemcpyA_ = */ true,
+    /* MemcpyB_ = */ true,
+    /* KernelWritesArrivalFlag_ = */ false,
+    /* NumBuffersA_ = */ GridSize_{} - 1,
+    /* NumBuffersB_ = */ GridSize_{} - 1,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ 0,
+    /* PeerDeviceMappingB_ = */ detail::GridRing<GridSize_, GridSize_, GridSize_, cute::_1>,                     // = ((x + iter) % P, y)
+    /* LocalReduction_ = */ true,
+    /* Iterations_ = */ GridSize_> {
+
+  static constexpr int P = GridSize_::value;
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_A(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::Int<P>{}, cute::Int<P>{}, cute::_1{}));
+    int x = device_idx % P;
+    int y = device_idx / P;
+    return inner_partition(tensor, tiler, cute::make_coord(x, (x + y) % P, 0));
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_B(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::Int<P>{}, cute::Int<P>{}, cute::_1{}));
+    int x = device_idx % P;
+    int y = device_idx / P;
+    return inner_partition(tensor, tiler, cute::make_coord(y, (x + y) % P, 0));
+  }
+};
+
+// 2-D AllGather + GEMM + ReduceScatter
+// TP = G x R GPUs form a G x R grid, with device_idx = x + y * G: the G GPUs of a row (same y)
+// gather A among themselves, and the R GPUs of a column (same x) reduce their partial outputs.
+// A and B are tiled along K into R parts, and GPU (x, y) owns the [M / G, K / R] tile A(x, y), the
+// [N / G, K / R] tile B(x, y), and finally the [M, N / TP] column x * R + y of D.
+//
+// Iterations are grouped into G groups of R iterations, iteration = s * R + u:
+//  * At the start of group s > 0, GPU (x, y) copies tile A((x + s) % G, y) from GPU ((x + s) % G, y)
+//    in its row into A buffer s - 1.
+//  * In step u of the group, it multiplies that tile of A with the N / TP-wide sub-tile
+//    q = (y - 1 - u) % R of its tile of B, and accumulates the partial output of its column peer
+//    (x, y - 1) from the previous step, like ReduceScatter1D_TilingB_RotatingC on a ring of R GPUs.
+//    The result goes to D buffer u, or to its own D in the last step of the group, in the rows of
+//    the M tile (x + s) % G.
+//
+// Every GPU receives (G - 1) / G of its K part of A, and reads R - 1 partial outputs of shape
+// [M, N / TP], so that both collectives run on rings of G and R GPUs instead of TP.
+//
+// Below is an illustration of the (m, n) tile of D computed by each GPU in the G = R = 2 case,
+// where D is tiled into G x TP tiles:
+//
+//                iter 0   iter 1   iter 2   iter 3
+//   GPU0 (0, 0)  (0, 1)   (0, 0)   (1, 1)   (1, 0)
+//   GPU1 (1, 0)  (1, 3)   (1, 2)   (0, 3)   (0, 2)
+//   GPU2 (0, 1)  (0, 0)   (0, 1)   (1, 0)   (1, 1)
+//   GPU3 (1, 1)  (1, 2)   (1, 3)   (0, 2)   (0, 3)
+//
+template <class GatherSize_, class ReduceSize_>
+struct AllGatherReduceScatter2D_TilingB_RotatingAC: BaseSchedule<
+    cute::Int<GatherSize_::value * ReduceSize_::value>,
+    /* ProcessorTiler_ = */ cute::Shape<cute::_1, GatherSize_, ReduceSize_, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<GatherSize_, ReduceSize_, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ detail::GridRing<GatherSize_, ReduceSize_,
+                                                cute::Shape<ReduceSize_, GatherSize_>, cute::Stride<cute::_0, cute::_1>>, // A: ((x + iter / R) % G, y)
+    /* IterationMappingM_ = */ detail::ZeroMapping<cute::Int<GatherSize_::value * ReduceSize_::value>, cute::Int<GatherSize_::value * ReduceSize_::value>>, // see get_tensor_{A,C,D}
+    /* IterationMappingN_ = */ detail::ZeroMapping<cute::Int<GatherSize_::value * ReduceSize_::value>, cute::Int<GatherSize_::value * ReduceSize_::value>>, // see get_tensor_B
+    /* IterationMappingK_ = */ detail::ZeroMapping<cute::Int<GatherSize_::value * ReduceSize_::value>, cute::Int<GatherSize_::value * ReduceSize_::value>>, // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ detail::ZeroMapping<cute::Int<GatherSize_::value * ReduceSize_::value>, cute::Int<GatherSize_::value * ReduceSize_::value>>, // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_0,
+    /* MemcpyA_ = */ true,
+    /* MemcpyB_ = */ false,
+    /* KernelWritesArrivalFlag_ = */ true,
+    /* NumBuffersA_ = */ GatherSize_{} - 1,
+    /* NumBuffersB_ = */ 0,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ ReduceSize_{} - 1> {
+
+  static constexpr int G = GatherSize_::value;
+  static constexpr int R = ReduceSize_::value;
+  static constexpr int NumDevices = G * R;
+
+  static_assert(G > 1 && R > 1, "Use the 1-D schedules for 1 x TP and TP x 1 grids.");
+
+  // The reduction runs on the column of the device
+  static auto
+  get_peers_for_device(int device_idx) {
+    int x = device_idx % G;
+    int y = device_idx / G;
+    auto left_peer_id = x + ((y + R - 1) % R) * G;
+    auto right_peer_id = x + ((y + 1) % R) * G;
+
+    return cute::make_tuple(left_peer_id, right_peer_id);
+  }
+
+  static int
+  get_remote_peer_id(int device_idx, [[maybe_unused]] int iteration) {
+    return cute::get<0>(get_peers_for_device(device_idx));
+  }
+
+  static bool
+  copies_operands(int iteration) {
+    return iteration > 0 && iteration % R == 0;
+  }
+
+  static bool
+  accumulates_peer_output(int iteration) {
+    return iteration % R != 0;
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_c_shape(ProblemShape problem_shape) {
+    auto problem_shape_MNKL = cute::append<4>(problem_shape, 1);
+    return shape_div(
+        cute::select<0,1,3>(problem_shape_MNKL),
+        cute::make_shape(cute::_1{}, cute::Int<NumDevices>{}, cute::_1{}));
+  }
+
+  template <typename ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto
+  get_local_d_shape(ProblemShape problem_shape) {
+    return get_local_c_shape(problem_shape);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_A(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::Int<G>{}, cute::Int<R>{}, cute::_1{}));
+    return inner_partition(tensor, tiler, device_idx);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_C(Tensor tensor, int device_idx) {
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::_1{}, cute::Int<NumDevices>{}, cute::_1{}));
+    int x = device_idx % G;
+    int y = device_idx / G;
+    return inner_partition(tensor, tiler, cute::make_coord(0, x * R + y, 0));
+  }
+
+  template <typename Tensor>
+  static auto
+  get_device_slice_D(Tensor tensor, int device_idx) {
+    return get_device_slice_C(tensor, device_idx);
+  }
+
+  // M tile of A, C and D in an iteration
+  static int
+  get_tile_m(int device_idx, int iteration) {
+    return (device_idx % G + iteration / R) % G;
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_A(Tensor original_tensor, void * tensor_buffer_ptr, [[maybe_unused]] int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    auto layout = original_tensor.layout();
+
+    int group = iteration / R;
+    if (group > 0) {
+      ptr = reinterpret_cast<Element *>(tensor_buffer_ptr) + size(original_tensor.shape()) * (group - 1);
+    }
+    return make_tensor(ptr, layout);
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_B(Tensor original_tensor, [[maybe_unused]] void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    auto tensor = make_tensor(ptr, original_tensor.layout());
+
+    int y = device_idx / G;
+    int tile_n = (y - 1 - iteration % R + 2 * R) % R;
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::Int<R>{}, cute::_1{}, cute::_1{}));
+    return inner_partition(tensor, tiler, cute::make_coord(tile_n, 0, 0));
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_C(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    auto layout = original_tensor.layout();
+
+    // Steps > 0 read the buffer the column peer wrote in the previous step
+    int step = iteration % R;
+    if (step > 0) {
+      ptr = reinterpret_cast<Element *>(tensor_buffer_ptr) + size(original_tensor.shape()) * (step - 1);
+    }
+    auto tensor = make_tensor(ptr, layout);
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::Int<G>{}, cute::_1{}, cute::_1{}));
+    return inner_partition(tensor, tiler, cute::make_coord(get_tile_m(device_idx, iteration), 0, 0));
+  }
+
+  template <typename Tensor>
+  static auto
+  get_tensor_D(Tensor original_tensor, void * tensor_buffer_ptr, int device_idx, int iteration) {
+    static_assert(rank(original_tensor) == 3);
+
+    using Element = typename Tensor::value_type;
+    // Recreate tensor without constness. This is to ensure return types match.
+    Element * ptr = const_cast<Element *>(original_tensor.data());
+    auto layout = original_tensor.layout();
+
+    // last step of each group is the local tensor, the rest are buffers
+    int step = iteration % R;
+    if (step < R - 1) {
+      ptr = reinterpret_cast<Element *>(tensor_buffer_ptr) + size(original_tensor.shape()) * step;
+    }
+    auto tensor = make_tensor(ptr, layout);
+    auto tiler = shape_div(tensor.shape(), cute::make_shape(cute::Int<G>{}, cute::_1{}, cute::_1{}));
+    return inner_partition(tensor, tiler, cute::make_coord(get_tile_m(device_idx, iteration), 0, 0));
+  }
+};
+
+// Hierarchical AllGather + GEMM
+// Tiling and buffering are identical to AllGather1D_TilingCD_RotatingA: each GPU owns an
+// [N / TP, K] slice of B and an [M / TP, K] slice of A, and in every iteration computes the
+// [M / TP, N / TP] tile of D corresponding to the slice of A it is holding, while copying the next
+// slice of A into a local buffer.
+//
+// GPUs are grouped into NumDomains domains of DomainSize GPUs each, and iterations are grouped the
+// same way: in the first DomainSize iterations each GPU gathers the slices of the GPUs in its own
+// domain, and in each following group of DomainSize iterations the slices of the GPUs in the next
+// domain. Slices of a remote domain only cross domains once per domain: in the first iteration of
+// each group, every GPU copies the slice of the GPU with the same local index in the remote domain,
+// and in the remaining iterations of the group, GPUs copy the other slices of that domain from the
+// local GPU that received them instead of from their owner.
+//
+// Below is an illustration of the peer each GPU copies from, in the DomainSize = NumDomains = 2
+// case. Copies from remote domains are marked with *, and forwarded copies with the iteration in
+// which the peer received the slice:
+//
+//                  iter 0   iter 1   iter 2   iter 3
+//   domain 0  GPU0    -        1        2*     1 (2)
+//             GPU1    -        0        3*     0 (2)
+//   domain 1  GPU2    -        3        0*     3 (2)
+//             GPU3    -        2        1*     2 (2)
+//
+// For comparison, the 1-D schedule copies from peer (device_idx + iter) % TP, so that every GPU
+// copies all TP - DomainSize remote slices across domains.
+//
+// NOTE: forwarded copies must wait until the peer has received the slice. The device adapter doesn't
+// implement this wait yet, and copies every slice from its owner (get_remote_peer_id) instead.
+//
+template <class DomainSize_, class NumDomains_>
+struct AllGatherHierarchical_TilingCD_RotatingA: BaseSchedule<
+    cute::Int<DomainSize_::value * NumDomains_::value>,
+    /* ProcessorTiler_ = */ cute::Shape<cute::_1, cute::Int<DomainSize_::value * NumDomains_::value>, cute::_1, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::_1, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ detail::HierarchicalRing<DomainSize_, NumDomains_>,                         // = ((local_idx + local_iter) % DomainSize, (domain + domain_iter) % NumDomains)
+    /* IterationMappingM_ = */ detail::HierarchicalRing<DomainSize_, NumDomains_>,                         // = owner of the slice
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::Int<DomainSize_::value * NumDomains_::value>>,
+                                            cute::Stride<cute::_0, cute::_0>>,                             // (IterationTiler::N == 1) = 0
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::Int<DomainSize_::value * NumDomains_::value>>,
+                                            cute::Stride<cute::_0, cute::_0>>,                             // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::Int<DomainSize_::value * NumDomains_::value>>,
+                                            cute::Stride<cute::_0, cute::_0>>,                             // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_0,
+    /* MemcpyA_ = */ true,
+    /* MemcpyB_ = */ false,
+    /* KernelWritesArrivalFlag_ = */ false,
+    /* NumBuffersA_ = */ DomainSize_{} * NumDomains_{} - 1,
+    /* NumBuffersB_ = */ 0,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ 0>{
+
+  using Forwarding = detail::HierarchicalForwarding<DomainSize_::value, NumDomains_::value>;
+
+  static int
+  get_remote_peer_id_a(int device_idx, int iteration) {
+    return Forwarding::get_peer(device_idx, iteration);
+  }
+
+  static int
+  get_copy_source_iteration(int device_idx, int iteration) {
+    return Forwarding::get_source_iteration(device_idx, iteration);
+  }
+};
+
+// This schedule is similar to AllGatherHierarchical_TilingCD_RotatingA, but rotates slices of B
+// instead of A, like AllGather1D_TilingCD_RotatingB.
+template <class DomainSize_, class NumDomains_>
+struct AllGatherHierarchical_TilingCD_RotatingB: BaseSchedule<
+    cute::Int<DomainSize_::value * NumDomains_::value>,
+    /* ProcessorTiler_ = */ cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::_1, cute::_1, cute::_1>,
+    /* IterationTiler_ = */ cute::Shape<cute::_1, cute::Int<DomainSize_::value * NumDomains_::value>, cute::_1, cute::_1>,
+    /* PeerDeviceMapping_ = */ detail::HierarchicalRing<DomainSize_, NumDomains_>,                         // = ((local_idx + local_iter) % DomainSize, (domain + domain_iter) % NumDomains)
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::Int<DomainSize_::value * NumDomains_::value>>,
+                                            cute::Stride<cute::_0, cute::_0>>,                             // (IterationTiler::M == 1) = 0
+    /* IterationMappingN_ = */ detail::HierarchicalRing<DomainSize_, NumDomains_>,                         // = owner of the slice
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::Int<DomainSize_::value * NumDomains_::value>>,
+                                            cute::Stride<cute::_0, cute::_0>>,                             // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<cute::Int<DomainSize_::value * NumDomains_::value>, cute::Int<DomainSize_::value * NumDomains_::value>>,
+                                            cute::Stride<cute::_0, cute::_0>>,                             // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ cute::_0,
+    /* MemcpyA_ = */ false,
+    /* MemcpyB_ = */ true,
+    /* KernelWritesArrivalFlag_ = */ false,
+    /* NumBuffersA_ = */ 0,
+    /* NumBuffersB_ = */ DomainSize_{} * NumDomains_{} - 1,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ 0>{
+
+  using Forwarding = detail::HierarchicalForwarding<DomainSize_::value, NumDomains_::value>;
+
+  static int
+  get_remote_peer_id_b(int device_idx, int iteration) {
+    return Forwarding::get_peer(device_idx, iteration);
+  }
+
+  static int
+  get_copy_source_iteration(int device_idx, int iteration) {
+    return Forwarding::get_source_iteration(device_idx, iteration);
+  }
+};
+
+
+} // namespace cutlass::distributed::schedules
+
+///////////////////////////////////////////////////////////////////////////////
@@ -76,7 +76,10 @@ template <
   int NumBuffersA_,               // Number of buffers required for tensor A
   int NumBuffersB_,               // Number of buffers required for tensor B
   int NumBuffersC_,               // Number of buffers required for tensor C
-  int NumBuffersD_>               // Number of buffers required for tensor D
+  int NumBuffersD_,               // Number of buffers required for tensor D
+  class PeerDeviceMappingB_ = PeerDeviceMapping_,  // CuTe layout mapping device index and stage/iteration to the peer B is copied from
+  bool LocalReduction_ = false,   // Whether stages/iterations > 0 accumulate into the device's own D (reduction over K on device)
+  class Iterations_ = TP_>        // CuTe constant defining the number of stages/iterations
 struct BaseSchedule {
 
   using TP = TP_;
@@ -88,8 +91,16 @@ struct BaseSchedule {
   static_assert(cute::rank(ProcessorTiler_{}) == 4, "Expected rank-4 processor tiler.");
   static_assert(cute::rank(IterationTiler_{}) == 4, "Expected rank-4 iteration tiler.");
 
+  using Iterations = Iterations_;
+
+  static_assert(
+      cute::is_static<Iterations>::value && cute::is_integral<Iterations>::value && Iterations{} <= TP{},
+      "The number of iterations must be a static integer no larger than TP.");
+
   static_assert(cute::rank(PeerDeviceMapping_{}) == 2, 
       "PeerDeviceMapping must be rank-2 (device_idx, iter)");
+  static_assert(cute::rank(PeerDeviceMappingB_{}) == 2, 
+      "PeerDeviceMappingB must be rank-2 (device_idx, iter)");
 
   static_assert(cute::rank(IterationMappingM_{}) == 2, 
       "IterationMappingM must be rank-2 (device_idx, iter).");
@@ -104,6 +115,7 @@ struct BaseSchedule {
   using IterationTiler = IterationTiler_;
 
   using PeerDeviceMapping = PeerDeviceMapping_;
+  using PeerDeviceMappingB = PeerDeviceMappingB_;
   using IterationMappingM = IterationMappingM_;
   using IterationMappingN = IterationMappingN_;
   using IterationMappingK = IterationMappingK_;
@@ -115,30 +127,32 @@ struct BaseSchedule {
   static constexpr bool MemcpyA = MemcpyA_;
   static constexpr bool MemcpyB = MemcpyB_;
   static constexpr bool HasMemcpy = MemcpyA || MemcpyB;
+  static constexpr bool LocalReduction = LocalReduction_;
 
   static constexpr int NumBuffersA = NumBuffersA_;
   static constexpr int NumBuffersB = NumBuffersB_;
   static constexpr int NumBuffersC = NumBuffersC_;
   static constexpr int NumBuffersD = NumBuffersD_;
 
-  static_assert(
-      NumBuffersA > 0 ^ 
-      NumBuffersB > 0 ^ 
-      NumBuffersC > 0 ^ 
-      NumBuffersD > 0,
-      "Only one of the ABCD tensors can be buffered!");
-
   static constexpr bool BufferedOutput = NumBuffersC > 0 || NumBuffersD > 0;
   static constexpr bool RemoteC = NumBuffersC == 0 && NumBuffersD > 0;
   static constexpr bool RemoteD = NumBuffersD == 0 && NumBuffersC > 0;
 
+  static_assert(
+      NumBuffersA > 0 || NumBuffersB > 0 || BufferedOutput,
+      "At least one of the ABCD tensors must be buffered!");
+  static_assert(not (NumBuffersC > 0 && NumBuffersD > 0), "Only one of C and D can be buffered!");
   static_assert(not RemoteD, "Remote D is not supported yet.");
+  static_assert(not (LocalReduction && BufferedOutput),
+      "Local reduction accumulates into the local D, and can't be combined with buffered outputs.");
+  static_assert(not MemcpyA || NumBuffersA > 0, "Memcpied tensor A must be buffered.");
+  static_assert(not MemcpyB || NumBuffersB > 0, "Memcpied tensor B must be buffered.");
 
   // Host-side API: can_implement based on the GLOBAL problem shape
   template <typename ProblemShape>
   static bool
   can_implement_global(ProblemShape const& global_problem_shape) {
-    auto [M, N, K, L] = append<4>(global_problem_shape, 1);
+    auto [M, N, K, L] = cute::append<4>(global_problem_shape, 1);
 
     auto [ptileM, ptileN, ptileK, ptileL] = ProcessorTiler{};
     auto [itileM, itileN, itileK, itileL] = IterationTiler{};
@@ -155,7 +169,7 @@ struct BaseSchedule {
   CUTLASS_HOST_DEVICE
   static auto
   get_local_gemm_shape(ProblemShape const& global_problem_shape) {
-    auto problem_shape_MNKL = append<4>(global_problem_shape, 1);
+    auto problem_shape_MNKL = cute::append<4>(global_problem_shape, 1);
 
     return shape_div(
         shape_div(
@@ -173,7 +187,8 @@ struct BaseSchedule {
     return cute::make_tuple(left_peer_id, right_peer_id);
   }
 
-  // Determines peer given device index and iteration
+  // Determines peer given device index and iteration.
+  // This is the peer whose partial output is accumulated when C is remote.
   static int
   get_remote_peer_id(int device_idx, int iteration) {
     auto device_iter_to_peer_idx = PeerDeviceMapping{};
@@ -183,15 +198,64 @@ struct BaseSchedule {
     return peer_idx;
   }
 
+  // Determines the peer A is copied from given device index and iteration
+  static int
+  get_remote_peer_id_a(int device_idx, int iteration) {
+    auto device_iter_to_peer_idx = PeerDeviceMapping{};
+    auto peer_idx = (
+      device_iter_to_peer_idx(device_idx + ProcessorOffset{}, iteration) + TP{}
+    ) % TP{};
+    return peer_idx;
+  }
+
+  // Determines the peer B is copied from given device index and iteration
+  static int
+  get_remote_peer_id_b(int device_idx, int iteration) {
+    auto device_iter_to_peer_idx = PeerDeviceMappingB{};
+    auto peer_idx = (
+      device_iter_to_peer_idx(device_idx + ProcessorOffset{}, iteration) + TP{}
+    ) % TP{};
+    return peer_idx;
+  }
+
+  // Per-iteration communication. Schedules may redefine these in order to communicate only in some
+  // iterations, but every iteration > 0 must be gated by either a copy or an arrival flag, because
+  // the kernel waits on one before running the GEMM of every iteration > 0.
+
+  // Whether memcpied operands are copied from their peers ahead of the GEMM of this iteration.
+  static bool
+  copies_operands(int iteration) {
+    return HasMemcpy && iteration > 0;
+  }
+
+  // The iteration whose operand is copied from the peer: 0 copies the peer's own slice, and later
+  // iterations forward a slice the peer has itself received in that iteration.
+  static int
+  get_copy_source_iteration([[maybe_unused]] int device_idx, [[maybe_unused]] int iteration) {
+    return 0;
+  }
+
+  // Whether the epilogue accumulates the partial output of the peer's previous iteration.
+  static bool
+  accumulates_peer_output(int iteration) {
+    return RemoteC && iteration > 0;
+  }
+
+  // Whether the epilogue accumulates the device's own output of its previous iteration.
+  static bool
+  accumulates_local_output(int iteration) {
+    return LocalReduction && iteration > 0;
+  }
+
   // Construct tilers and index mappers for sharding across processors
   template <typename Tensor>
   CUTLASS_HOST_DEVICE
   static auto
   get_processor_tiler_a(Tensor tensor) {
     if constexpr (NumBuffersA > 0) {
-      return shape_div(tensor.shape(), select<0,2,3>(IterationTiler{}));
+      return shape_div(tensor.shape(), cute::select<0,2,3>(IterationTiler{}));
     } else {
-      return shape_div(tensor.shape(), select<0,2,3>(ProcessorTiler{}));
+      return shape_div(tensor.shape(), cute::select<0,2,3>(ProcessorTiler{}));
     }
   }
 
@@ -200,9 +264,9 @@ struct BaseSchedule {
   static auto
   get_processor_tiler_b(Tensor tensor) {
     if constexpr (NumBuffersB > 0) {
-      return shape_div(tensor.shape(), select<1,2,3>(IterationTiler{}));
+      return shape_div(tensor.shape(), cute::select<1,2,3>(IterationTiler{}));
     } else {
-      return shape_div(tensor.shape(), select<1,2,3>(ProcessorTiler{}));
+      return shape_div(tensor.shape(), cute::select<1,2,3>(ProcessorTiler{}));
     }
   }
 
@@ -211,9 +275,9 @@ struct BaseSchedule {
   static auto
   get_processor_tiler_c(Tensor tensor) {
     if constexpr (BufferedOutput) {
-      return shape_div(tensor.shape(), select<0,1,3>(IterationTiler{}));
+      return shape_div(tensor.shape(), cute::select<0,1,3>(IterationTiler{}));
     } else {
-      return shape_div(tensor.shape(), select<0,1,3>(ProcessorTiler{}));
+      return shape_div(tensor.shape(), cute::select<0,1,3>(ProcessorTiler{}));
     }
   }
 
@@ -230,7 +294,7 @@ struct BaseSchedule {
   static auto
   get_device_tiler_a(Tensor tensor) {
     static_assert(NumBuffersA == 0, "Buffered tensors don't have device tilers!");
-    return shape_div(tensor.shape(), select<0,2,3>(IterationTiler{}));
+    return shape_div(tensor.shape(), cute::select<0,2,3>(IterationTiler{}));
   }
 
   template <typename Tensor>
@@ -238,7 +302,7 @@ struct BaseSchedule {
   static auto
   get_device_tiler_b(Tensor tensor) {
     static_assert(NumBuffersB == 0, "Buffered tensors don't have device tilers!");
-    return shape_div(tensor.shape(), select<1,2,3>(IterationTiler{}));
+    return shape_div(tensor.shape(), cute::select<1,2,3>(IterationTiler{}));
   }
 
   template <typename Tensor>
@@ -246,7 +310,7 @@ struct BaseSchedule {
   static auto
   get_device_tiler_c(Tensor tensor) {
     static_assert(NumBuffersC == 0 && NumBuffersD == 0, "Buffered tensors don't have device tilers!");
-    return shape_div(tensor.shape(), select<0,1,3>(IterationTiler{}));
+    return shape_div(tensor.shape(), cute::select<0,1,3>(IterationTiler{}));
   }
 
   template <typename Tensor>
@@ -254,7 +318,7 @@ struct BaseSchedule {
   static auto
   get_device_tiler_d(Tensor tensor) {
     static_assert(NumBuffersC == 0 && NumBuffersD == 0, "Buffered tensors don't have device tilers!");
-    return shape_div(tensor.shape(), select<0,1,3>(IterationTiler{}));
+    return shape_div(tensor.shape(), cute::select<0,1,3>(IterationTiler{}));
   }
 
   // Map device index and iteration to tile coordinate
@@ -416,7 +480,7 @@ struct BaseSchedule {
 
       Element * ptr_buffer = reinterpret_cast<Element *>(tensor_buffer_ptr);
       // last iteration is the local tensor, the rest are buffers
-      if (iteration == TP{} - 1) {
+      if (iteration == Iterations{} - 1) {
         return tensor;
       }
       ptr_buffer += size(shape) * iteration; // note: iteration, not iteration - 1
@@ -429,17 +493,17 @@ struct BaseSchedule {
   CUTLASS_HOST_DEVICE
   static auto
   get_local_a_shape(ProblemShape problem_shape) {
-    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto problem_shape_MNKL = cute::append<4>(problem_shape, 1);
     if constexpr (NumBuffersA == 0) {
       return shape_div(
-            select<0,2,3>(problem_shape_MNKL),
-            select<0,2,3>(ProcessorTiler{}));
+            cute::select<0,2,3>(problem_shape_MNKL),
+            cute::select<0,2,3>(ProcessorTiler{}));
     } else {
       return shape_div(
           shape_div(
-            select<0,2,3>(problem_shape_MNKL),
-            select<0,2,3>(ProcessorTiler{})),
-          select<0,2,3>(IterationTiler{}));
+            cute::select<0,2,3>(problem_shape_MNKL),
+            cute::select<0,2,3>(ProcessorTiler{})),
+          cute::select<0,2,3>(IterationTiler{}));
     }
   }
 
@@ -447,17 +511,17 @@ struct BaseSchedule {
   CUTLASS_HOST_DEVICE
   static auto
   get_local_b_shape(ProblemShape problem_shape) {
-    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto problem_shape_MNKL = cute::append<4>(problem_shape, 1);
     if constexpr (NumBuffersB == 0) {
       return shape_div(
-            select<1,2,3>(problem_shape_MNKL),
-            select<1,2,3>(ProcessorTiler{}));
+            cute::select<1,2,3>(problem_shape_MNKL),
+            cute::select<1,2,3>(ProcessorTiler{}));
     } else {
       return shape_div(
           shape_div(
-            select<1,2,3>(problem_shape_MNKL),
-            select<1,2,3>(ProcessorTiler{})),
-          select<1,2,3>(IterationTiler{}));
+            cute::select<1,2,3>(problem_shape_MNKL),
+            cute::select<1,2,3>(ProcessorTiler{})),
+          cute::select<1,2,3>(IterationTiler{}));
     }
   }
 
@@ -465,17 +529,17 @@ struct BaseSchedule {
   CUTLASS_HOST_DEVICE
   static auto
   get_local_c_shape(ProblemShape problem_shape) {
-    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto problem_shape_MNKL = cute::append<4>(problem_shape, 1);
     if constexpr (not BufferedOutput) {
       return shape_div(
-            select<0,1,3>(problem_shape_MNKL),
-            select<0,1,3>(ProcessorTiler{}));
+            cute::select<0,1,3>(problem_shape_MNKL),
+            cute::select<0,1,3>(ProcessorTiler{}));
     } else {
       return shape_div(
           shape_div(
-            select<0,1,3>(problem_shape_MNKL),
-            select<0,1,3>(ProcessorTiler{})),
-          select<0,1,3>(IterationTiler{}));
+            cute::select<0,1,3>(problem_shape_MNKL),
+            cute::select<0,1,3>(ProcessorTiler{})),
+          cute::select<0,1,3>(IterationTiler{}));
     }
   }
 
@@ -483,17 +547,17 @@ struct BaseSchedule {
   CUTLASS_HOST_DEVICE
   static auto
   get_local_d_shape(ProblemShape problem_shape) {
-    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto problem_shape_MNKL = cute::append<4>(problem_shape, 1);
     if constexpr (not BufferedOutput) {
       return shape_div(
-            select<0,1,3>(problem_shape_MNKL),
-            select<0,1,3>(ProcessorTiler{}));
+            cute::select<0,1,3>(problem_shape_MNKL),
+            cute::select<0,1,3>(ProcessorTiler{}));
     } else {
       return shape_div(
           shape_div(
-            select<0,1,3>(problem_shape_MNKL),
-            select<0,1,3>(ProcessorTiler{})),
-          select<0,1,3>(IterationTiler{}));
+            cute::select<0,1,3>(problem_shape_MNKL),
+            cute::select<0,1,3>(ProcessorTiler{})),
+          cute::select<0,1,3>(IterationTiler{}));
     }
   }
 
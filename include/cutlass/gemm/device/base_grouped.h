@@ -115,6 +115,103 @@ protected:
 
 private:
 
+  /// Page-locked host staging buffer for the precomputed schedule, reused across calls to
+  /// initialize() and update(). An event recorded after each upload guards against the buffer
+  /// being rewritten while the previous copy may still be reading from it. Copies of the owning
+  /// operator start with an empty buffer.
+  class HostPrecomputeBuffer {
+  public:
+
+    HostPrecomputeBuffer() { }
+
+    HostPrecomputeBuffer(HostPrecomputeBuffer const &) { }
+
+    HostPrecomputeBuffer &operator=(HostPrecomputeBuffer const &) { return *this; }
+
+    ~HostPrecomputeBuffer() {
+      wait();
+      if (data_) {
+        cudaFreeHost(data_);
+      }
+      if (event_) {
+        cudaEventDestroy(event_);
+      }
+    }
+
+    void *data() const { return data_; }
+
+    /// Blocks until the most recent upload from the buffer has completed
+    Status wait() {
+      if (pending_) {
+        pending_ = false;
+        cudaError_t cuda_error = cudaEventSynchronize(event_);
+        if (cuda_error != cudaSuccess) {
+          cuda_error = cudaGetLastError();
+          CUTLASS_TRACE_HOST("  cudaEventSynchronize() returned error " << cudaGetErrorString(cuda_error));
+          return Status::kErrorInternal;
+        }
+      }
+      return Status::kSuccess;
+    }
+
+    /// Ensures the buffer holds at least `bytes`. Waits for any pending upload first.
+    Status reserve(size_t bytes) {
+      Status status = wait();
+      if (status != Status::kSuccess || bytes <= capacity_) {
+        return status;
+      }
+
+      if (data_) {
+        cudaFreeHost(data_);
+        data_ = nullptr;
+        capacity_ = 0;
+      }
+
+      cudaError_t cuda_error = cudaMallocHost(&data_, bytes);
+      if (cuda_error != cudaSuccess) {
+        cuda_error = cudaGetLastError();
+        data_ = nullptr;
+        CUTLASS_TRACE_HOST("  cudaMallocHost() returned error " << cudaGetErrorString(cuda_error));
+        return Status::kErrorMemoryAllocation;
+      }
+      capacity_ = bytes;
+      return Status::kSuccess;
+    }
+
+    /// Records completion of the uploads enqueued so far on `stream`
+    Status record(cudaStream_t stream) {
+      cudaError_t cuda_error = cudaSuccess;
+      if (!event_) {
+        cuda_error = cudaEventCreateWithFlags(&event_, cudaEventDisableTiming);
+      }
+      if (cuda_error == cudaSuccess) {
+        cuda_error = cudaEventRecord(event_, stream);
+      }
+      if (cuda_error != cudaSuccess) {
+        cuda_error = cudaGetLastError();
+        CUTLASS_TRACE_HOST("  cudaEventRecord() returned error " << cudaGetErrorString(cuda_error));
+        return Status::kErrorInternal;
+      }
+      pending_ = true;
+      return Status::kSuccess;
+    }
+
+  private:
+
+    void *data_ = nullptr;
+    size_t capacity_ = 0;
+    cudaEvent_t event_ = nullptr;
+    bool pending_ = false;
+  };
+
+  /// Staging buffer and record of the schedule most recently uploaded to `precomputed_workspace_`
+  HostPrecomputeBuffer host_precompute_buffer_;
+  typename BaseKernel::ProblemVisitor::HostPrecomputeState host_precompute_state_;
+  void const *precomputed_workspace_ = nullptr;
+
+  /// Host threads used to compute the schedule (0 selects std::thread::hardware_concurrency())
+  int host_precompute_thread_count_ = 0;
+
   /// Get the number of tiles across all problems in a group
   static int32_t group_tile_count(const cutlass::gemm::GemmCoord* problem_sizes_ptr, int problem_count) {
     int32_t tiles = 0;
@@ -126,14 +223,26 @@ private:
     return tiles;
   }
 
-  /// Copy from `data` to `workspace`
-  Status copy_to_workspace(void* workspace, void* data, size_t bytes, cudaStream_t stream = nullptr) {
-    cudaError_t cuda_error = cudaMemcpyAsync(workspace, data, bytes, cudaMemcpyHostToDevice, stream);
+  /// Copy entries [first_entry, entries_per_block) of each block's schedule from `data` to `workspace`
+  Status copy_to_workspace(
+    void* workspace,
+    void const* data,
+    int32_t first_entry,
+    int32_t entries_per_block,
+    int32_t block_count,
+    cudaStream_t stream = nullptr) {
+
+    size_t pitch = sizeof(ProblemInfo) * entries_per_block;
+    size_t offset = sizeof(ProblemInfo) * first_entry;
+    cudaError_t cuda_error = cudaMemcpy2DAsync(
+      static_cast<uint8_t*>(workspace) + offset, pitch,
+      static_cast<uint8_t const*>(data) + offset, pitch,
+      pitch - offset, block_count, cudaMemcpyHostToDevice, stream);
     if (cuda_error != cudaSuccess) {
       // Call cudaGetLastError() to clear the error bit
       cuda_error = cudaGetLastError();
       CUTLASS_TRACE_HOST(
-          "  cudaMemcpy() returned error "
+          "  cudaMemcpy2DAsync() returned error "
           << cudaGetErrorString(cuda_error));
       return Status::kErrorInternal;
     }
@@ -142,14 +251,52 @@ private:
   }
 
   /// Precomputes scheduling information for the grouped GEMM
+  ///
+  /// The schedule is staged in a reusable page-locked buffer. When the same device workspace is
+  /// updated again, only the entries that follow the first problem whose tile count changed are
+  /// recomputed and uploaded; the device workspace is assumed not to have been modified elsewhere
+  /// in the meantime.
   Status precompute(Arguments const &args, int32_t tile_count, void* workspace, cudaStream_t stream = nullptr) {
     size_t workspace_bytes = get_workspace_size(args);
-    std::vector<uint8_t> host_workspace(workspace_bytes);
-    BaseKernel::ProblemVisitor::host_precompute(args.host_problem_sizes,
-                                                args.problem_count,
-                                                args.threadblock_count,
-                                                (void*)host_workspace.data());
-    return copy_to_workspace(workspace, host_workspace.data(), workspace_bytes, stream);
+    if (!workspace_bytes) {
+      return Status::kSuccess;
+    }
+
+    Status status = host_precompute_buffer_.reserve(workspace_bytes);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    int32_t first_entry = BaseKernel::ProblemVisitor::host_precompute(args.host_problem_sizes,
+                                                                      args.problem_count,
+                                                                      args.threadblock_count,
+                                                                      host_precompute_buffer_.data(),
+                                                                      &host_precompute_state_,
+                                                                      host_precompute_thread_count_);
+    int32_t entries_per_block = host_precompute_state_.entries_per_block;
+
+    if (workspace != precomputed_workspace_) {
+      first_entry = 0;
+    }
+
+    precomputed_workspace_ = nullptr;
+
+    if (first_entry < entries_per_block) {
+      status = copy_to_workspace(workspace, host_precompute_buffer_.data(), first_entry,
+                                 entries_per_block, args.threadblock_count, stream);
+      if (status != Status::kSuccess) {
+        host_precompute_state_.reset();
+        return status;
+      }
+
+      status = host_precompute_buffer_.record(stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    precomputed_workspace_ = workspace;
+    return Status::kSuccess;
   }
 
   /// Reorder `data` according to `indices`
@@ -169,6 +316,12 @@ public:
   /// Constructs the GEMM.
   BaseGrouped() { }
 
+  /// Sets the number of host threads used to precompute the schedule for GroupScheduleMode::kHostPrecompute
+  /// (0 selects std::thread::hardware_concurrency()). Small groups are always computed on the calling thread.
+  void set_host_precompute_thread_count(int thread_count) {
+    host_precompute_thread_count_ = thread_count;
+  }
+
   /// Determines whether the GEMM can execute the given problem.
   static Status can_implement(Arguments const &args) {
 
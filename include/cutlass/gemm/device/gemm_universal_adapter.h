@@ -48,6 +48,7 @@
 #if !defined(__CUDACC_RTC__)
 #include "cutlass/cluster_launch.hpp"
 #include "cutlass/trace.h"
+#include "cute/atom/copy_traits_sm90_tma_cache.hpp"
 #endif // !defined(__CUDACC_RTC__)
 
 // 2.x
@@ -213,6 +214,23 @@ private:
   /// Kernel API parameters object
   Params params_;
 
+#if !defined(__CUDACC_RTC__)
+  /// TMA descriptors encoded by previous calls, reused when only their addresses change
+  cute::TmaDescriptorCache tma_descriptor_cache_;
+#endif
+
+  /// Workspace supplied to the last initialize() or update()
+  void* workspace_ = nullptr;
+
+  /// Lowers args to params_ with the TMA descriptor cache active
+  void set_params(Arguments const& args, void* workspace) {
+#if !defined(__CUDACC_RTC__)
+    cute::TmaDescriptorCache::Scope tma_cache_scope(tma_descriptor_cache_);
+#endif
+    params_ = GemmKernel::to_underlying_arguments(args, workspace);
+    workspace_ = workspace;
+  }
+
 public:
 
   /// Access the Params structure
@@ -220,6 +238,13 @@ public:
     return params_;
   }
 
+#if !defined(__CUDACC_RTC__)
+  /// Access the cache of TMA descriptors used by initialize(), update() and update_pointers()
+  cute::TmaDescriptorCache& tma_descriptor_cache() {
+    return tma_descriptor_cache_;
+  }
+#endif
+
   /// Determines whether the GEMM can execute the given problem.
   static Status
   can_implement(Arguments const& args) {
@@ -318,7 +343,7 @@ public:
       return status;
     }
     // Initialize the Params structure
-    params_ = GemmKernel::to_underlying_arguments(args, workspace);
+    set_params(args, workspace);
     // Don't set the function attributes - require the CudaHostAdapter to set it.
     if constexpr (kEnableCudaHostAdapter) {
       CUTLASS_ASSERT(cuda_adapter);
@@ -358,7 +383,18 @@ public:
       return Status::kErrorWorkspaceNull;
     }
 
-    params_ = GemmKernel::to_underlying_arguments(args, workspace);
+    set_params(args, workspace);
+    return Status::kSuccess;
+  }
+
+  /// Lightweight update for arguments that differ from those of the last initialize() or update()
+  /// only in their operand pointers. The workspace is neither queried nor cleared again, and TMA
+  /// descriptors of unchanged geometry have their address replaced instead of being re-encoded.
+  Status
+  update_pointers(Arguments const& args) {
+    CUTLASS_TRACE_HOST("GemmUniversal()::update_pointers()");
+
+    set_params(args, workspace_);
     return Status::kSuccess;
   }
 
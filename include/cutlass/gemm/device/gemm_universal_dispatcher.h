@@ -0,0 +1,530 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file
+  \brief Selects among several CUTLASS 3.x GEMM instantiations from the runtime problem.
+
+  Applications that embed a handful of GemmUniversalAdapter instantiations typically choose between
+  them with a hand-written ladder over the operand layouts, alignments and the problem size, calling
+  can_implement() on each rung. GemmUniversalDispatcher replaces the ladder: each candidate declares
+  the predicates under which it applies, the dispatcher encodes them as bitmasks when it is
+  instantiated, and a lookup resolves to the first applicable candidate with a table index and one
+  mask test per candidate of the problem's layout. An optional GemmDispatchCostTable, filled from
+  profiling runs, ranks applicable candidates by measured cost instead of by declaration order.
+
+  Example:
+
+    using Dispatcher = cutlass::gemm::device::GemmUniversalDispatcher<
+      GemmDispatchCandidate<GemmTile256x128, 8, 8, 8, 8, GemmDispatchDivisible::MN>,
+      GemmDispatchCandidate<GemmTile128x128, 8, 8, 8, 8>,
+      GemmDispatchCandidate<GemmTile128x128Align1, 1, 1, 1, 1>
+    >;
+
+    GemmDispatchProblem problem;
+    problem.m = m; problem.n = n; problem.k = k; problem.l = l;
+    problem.alignment_a = gemm_dispatch_alignment<ElementA>(ptr_A, lda);
+    ...
+    Status status = Dispatcher::dispatch(problem, [&](auto candidate) {
+      using Gemm = typename decltype(candidate)::Gemm;
+      typename Gemm::Arguments arguments{...};
+      Gemm gemm;
+      Status status = gemm.can_implement(arguments);
+      return status == Status::kSuccess ? gemm.run(arguments, workspace, stream) : status;
+    });
+*/
+
+#pragma once
+
+#include <algorithm>                  // std::fill
+#include <array>                      // std::array
+#include <cstdint>                    // uint64_t, uintptr_t
+#include <limits>                     // std::numeric_limits
+#include <tuple>                      // std::tuple_element_t
+#include <type_traits>                // std::is_same_v
+#include <utility>                    // std::index_sequence
+#include <vector>                     // std::vector
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"    // cutlass::sizeof_bits
+#include "cutlass/gemm/gemm.h"        // cutlass::gemm::detail::is_mn_major
+#include "cute/layout.hpp"            // cute::size
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Runtime properties of a GEMM that decide which dispatch candidates apply to it
+struct GemmDispatchProblem {
+  int m = 0;
+  int n = 0;
+  int k = 0;
+  int l = 1;
+
+  /// Alignment of each operand in elements, as returned by gemm_dispatch_alignment()
+  int alignment_a = 1;
+  int alignment_b = 1;
+  int alignment_c = 1;
+  int alignment_d = 1;
+
+  /// Whether K is the contiguous mode of A (row-major A) and of B (column-major B)
+  bool k_major_a = true;
+  bool k_major_b = true;
+};
+
+/// Largest alignment in bits that gemm_dispatch_alignment() reports
+constexpr int kGemmDispatchMaxAlignmentBits = 1024;
+
+/// Returns the alignment in elements of an operand: the largest power of two that divides its base
+/// address, its leading dimension and its batch stride, all counted in elements. Returns 0 if the
+/// address is not aligned to an element.
+template <class Element>
+int gemm_dispatch_alignment(void const* ptr, int64_t leading_dim, int64_t batch_stride = 0) {
+  constexpr uint64_t ElementBits = cutlass::sizeof_bits<Element>::value;
+  uint64_t bits = uint64_t(reinterpret_cast<uintptr_t>(ptr)) * 8 |
+                  uint64_t(leading_dim) * ElementBits |
+                  uint64_t(batch_stride) * ElementBits |
+                  uint64_t(kGemmDispatchMaxAlignmentBits);
+  uint64_t lowest = bits & (~bits + 1);
+  return int(lowest / ElementBits);
+}
+
+/// Modes of the problem that a candidate requires to be multiples of its CTA tile, combined with `|`
+struct GemmDispatchDivisible {
+  static constexpr int None = 0;
+  static constexpr int M = 1;
+  static constexpr int N = 2;
+  static constexpr int K = 4;
+  static constexpr int MN = M | N;
+  static constexpr int MNK = M | N | K;
+};
+
+/// A GEMM instantiation together with the predicates under which it applies to a problem.
+///
+/// `Gemm` is typically a GemmUniversalAdapter. The layouts of A and B and the CTA tile are read from
+/// Gemm::GemmKernel::StrideA, StrideB and TileShape. Alignments are in elements and must be powers
+/// of two; kernels that load an operand through TMA need it aligned to 128 bits.
+template <
+  class Gemm_,
+  int AlignmentA_ = 1,
+  int AlignmentB_ = 1,
+  int AlignmentC_ = 1,
+  int AlignmentD_ = AlignmentC_,
+  int Divisibility_ = GemmDispatchDivisible::None
+>
+struct GemmDispatchCandidate {
+  using Gemm = Gemm_;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using TileShape = typename GemmKernel::TileShape;
+
+  static constexpr int AlignmentA = AlignmentA_;
+  static constexpr int AlignmentB = AlignmentB_;
+  static constexpr int AlignmentC = AlignmentC_;
+  static constexpr int AlignmentD = AlignmentD_;
+  static constexpr int Divisibility = Divisibility_;
+
+  static constexpr bool kKMajorA = not cutlass::gemm::detail::is_mn_major<typename GemmKernel::StrideA>();
+  static constexpr bool kKMajorB = not cutlass::gemm::detail::is_mn_major<typename GemmKernel::StrideB>();
+
+  static constexpr int kTileM = int(cute::size<0>(TileShape{}));
+  static constexpr int kTileN = int(cute::size<1>(TileShape{}));
+  static constexpr int kTileK = int(cute::size<2>(TileShape{}));
+
+private:
+  static constexpr bool is_pow2(int x) { return x > 0 && (x & (x - 1)) == 0; }
+
+  static_assert(is_pow2(AlignmentA) && is_pow2(AlignmentB) && is_pow2(AlignmentC) && is_pow2(AlignmentD),
+    "Dispatch alignments must be powers of two.");
+  static_assert((Divisibility & ~GemmDispatchDivisible::MNK) == 0,
+    "Divisibility must combine GemmDispatchDivisible flags.");
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Costs of dispatch candidates (e.g., measured runtimes) binned by floor(log2) of M, N and K.
+///
+/// Filled offline from profiling runs through set(), or online through record(), which keeps the
+/// mean of the samples of a bin. Candidates without a cost in a bin are ranked behind those with
+/// one. Not safe to record() from several threads at once.
+class GemmDispatchCostTable {
+public:
+
+  /// Bins per mode; extents of 2^(kBins - 1) and above share the last bin
+  static constexpr int kBins = 16;
+
+  GemmDispatchCostTable() = default;
+
+  explicit GemmDispatchCostTable(int candidate_count):
+    candidate_count_(candidate_count),
+    cost_(size_t(candidate_count) * kBins * kBins * kBins, std::numeric_limits<float>::infinity()),
+    samples_(cost_.size(), 0) { }
+
+  int candidate_count() const {
+    return candidate_count_;
+  }
+
+  static int bin(int extent) {
+    int b = 0;
+    while (b + 1 < kBins && (extent >> (b + 1)) != 0) {
+      ++b;
+    }
+    return b;
+  }
+
+  /// Sets the cost of a candidate for the bin containing (m, n, k)
+  void set(int candidate, int m, int n, int k, float cost) {
+    size_t idx = index(candidate, m, n, k);
+    cost_[idx] = cost;
+    samples_[idx] = 1;
+  }
+
+  /// Adds a sample to the mean cost of a candidate for the bin containing (m, n, k)
+  void record(int candidate, int m, int n, int k, float cost) {
+    size_t idx = index(candidate, m, n, k);
+    uint32_t samples = ++samples_[idx];
+    cost_[idx] = samples == 1 ? cost : cost_[idx] + (cost - cost_[idx]) / float(samples);
+  }
+
+  /// Returns the cost of a candidate for the bin containing (m, n, k), or infinity if it has none
+  float cost(int candidate, int m, int n, int k) const {
+    return cost_[index(candidate, m, n, k)];
+  }
+
+  /// Returns the number of samples behind the cost of a candidate in the bin containing (m, n, k)
+  uint32_t samples(int candidate, int m, int n, int k) const {
+    return samples_[index(candidate, m, n, k)];
+  }
+
+  void clear() {
+    std::fill(cost_.begin(), cost_.end(), std::numeric_limits<float>::infinity());
+    std::fill(samples_.begin(), samples_.end(), 0);
+  }
+
+private:
+
+  size_t index(int candidate, int m, int n, int k) const {
+    return ((size_t(candidate) * kBins + bin(m)) * kBins + bin(n)) * kBins + bin(k);
+  }
+
+  int candidate_count_ = 0;
+  std::vector<float> cost_;
+  std::vector<uint32_t> samples_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Distinct tile extents of one mode
+template <int N>
+struct GemmDispatchExtents {
+  int count = 0;
+  std::array<int, N> extents{};
+};
+
+/// Dispatch candidates sharing the layouts of A and B, in declaration order
+template <int N>
+struct GemmDispatchGroup {
+  int count = 0;
+  std::array<int, N> candidates{};
+  std::array<uint64_t, N> requirements{};
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Dispatches a runtime GEMM problem to the first of `Candidates` (GemmDispatchCandidate types)
+/// whose predicates it satisfies, or to the cheapest according to a GemmDispatchCostTable.
+///
+/// Candidates are grouped by the layouts of A and B. Within a group, each candidate's predicates
+/// are encoded as a 64-bit requirement mask: per operand, the bit of its required alignment in a
+/// thermometer code of the problem's alignment, and per mode, one bit per distinct tile extent
+/// that some candidate requires the mode to be divisible by. A problem's features are computed
+/// once, after which testing a candidate is a single AND and compare.
+template <class... Candidates>
+class GemmUniversalDispatcher {
+public:
+
+  static constexpr int kCandidateCount = int(sizeof...(Candidates));
+  static constexpr int kNotFound = -1;
+
+  static_assert(kCandidateCount > 0, "GemmUniversalDispatcher requires at least one candidate.");
+
+private:
+
+  using ExtentArray = std::array<int, kCandidateCount>;
+  using DistinctExtents = detail::GemmDispatchExtents<kCandidateCount>;
+  using Group = detail::GemmDispatchGroup<kCandidateCount>;
+
+  static constexpr std::array<bool, kCandidateCount> kKMajorA{Candidates::kKMajorA...};
+  static constexpr std::array<bool, kCandidateCount> kKMajorB{Candidates::kKMajorB...};
+  static constexpr ExtentArray kAlignmentA{Candidates::AlignmentA...};
+  static constexpr ExtentArray kAlignmentB{Candidates::AlignmentB...};
+  static constexpr ExtentArray kAlignmentC{Candidates::AlignmentC...};
+  static constexpr ExtentArray kAlignmentD{Candidates::AlignmentD...};
+  static constexpr ExtentArray kDivisibility{Candidates::Divisibility...};
+  static constexpr ExtentArray kTileM{Candidates::kTileM...};
+  static constexpr ExtentArray kTileN{Candidates::kTileN...};
+  static constexpr ExtentArray kTileK{Candidates::kTileK...};
+
+  // Feature bits: 8 alignment levels (2 to 256 elements) for each of A, B, C and D, then the
+  // divisibility of M, N and K by each distinct required tile extent
+  static constexpr int kAlignmentLevels = 8;
+  static constexpr int kAlignmentCap = 1 << kAlignmentLevels;
+  static constexpr int kDivisibilityBase = 4 * kAlignmentLevels;
+
+  /// Distinct tile extents of a mode among candidates that require the mode to be divisible
+  static constexpr DistinctExtents distinct_extents(ExtentArray const& tiles, int flag) {
+    DistinctExtents result;
+    for (int i = 0; i < kCandidateCount; ++i) {
+      if ((kDivisibility[i] & flag) == 0) {
+        continue;
+      }
+      bool seen = false;
+      for (int j = 0; j < result.count; ++j) {
+        seen = seen || result.extents[j] == tiles[i];
+      }
+      if (not seen) {
+        result.extents[result.count++] = tiles[i];
+      }
+    }
+    return result;
+  }
+
+  static constexpr DistinctExtents kDivisorsM = distinct_extents(kTileM, GemmDispatchDivisible::M);
+  static constexpr DistinctExtents kDivisorsN = distinct_extents(kTileN, GemmDispatchDivisible::N);
+  static constexpr DistinctExtents kDivisorsK = distinct_extents(kTileK, GemmDispatchDivisible::K);
+
+  static constexpr int kDivisibilityBaseN = kDivisibilityBase + kDivisorsM.count;
+  static constexpr int kDivisibilityBaseK = kDivisibilityBaseN + kDivisorsN.count;
+
+  static_assert(kDivisibilityBaseK + kDivisorsK.count <= 64,
+    "Too many distinct tile extents with divisibility requirements for a 64-bit feature mask.");
+
+  static_assert(((Candidates::AlignmentA <= kAlignmentCap) && ...) &&
+                ((Candidates::AlignmentB <= kAlignmentCap) && ...) &&
+                ((Candidates::AlignmentC <= kAlignmentCap) && ...) &&
+                ((Candidates::AlignmentD <= kAlignmentCap) && ...),
+    "Dispatch alignments are limited to 256 elements.");
+
+  static constexpr int index_of(DistinctExtents const& divisors, int extent) {
+    for (int j = 0; j < divisors.count; ++j) {
+      if (divisors.extents[j] == extent) {
+        return j;
+      }
+    }
+    return -1;
+  }
+
+  /// Bit of an alignment requirement in the thermometer code alignment - 1
+  static constexpr uint64_t alignment_requirement(int alignment, int operand) {
+    return uint64_t(alignment >> 1) << (operand * kAlignmentLevels);
+  }
+
+  static constexpr uint64_t requirement(int i) {
+    uint64_t mask =
+      alignment_requirement(kAlignmentA[i], 0) |
+      alignment_requirement(kAlignmentB[i], 1) |
+      alignment_requirement(kAlignmentC[i], 2) |
+      alignment_requirement(kAlignmentD[i], 3);
+    if (kDivisibility[i] & GemmDispatchDivisible::M) {
+      mask |= uint64_t(1) << (kDivisibilityBase + index_of(kDivisorsM, kTileM[i]));
+    }
+    if (kDivisibility[i] & GemmDispatchDivisible::N) {
+      mask |= uint64_t(1) << (kDivisibilityBaseN + index_of(kDivisorsN, kTileN[i]));
+    }
+    if (kDivisibility[i] & GemmDispatchDivisible::K) {
+      mask |= uint64_t(1) << (kDivisibilityBaseK + index_of(kDivisorsK, kTileK[i]));
+    }
+    return mask;
+  }
+
+  static constexpr int group_index(bool k_major_a, bool k_major_b) {
+    return int(k_major_a) * 2 + int(k_major_b);
+  }
+
+  static constexpr std::array<Group, 4> make_groups() {
+    std::array<Group, 4> groups{};
+    for (int i = 0; i < kCandidateCount; ++i) {
+      Group& group = groups[group_index(kKMajorA[i], kKMajorB[i])];
+      group.candidates[group.count] = i;
+      group.requirements[group.count] = requirement(i);
+      ++group.count;
+    }
+    return groups;
+  }
+
+  static constexpr std::array<Group, 4> kGroups = make_groups();
+
+  static uint64_t alignment_feature(int alignment, int operand) {
+    int capped = alignment < 1 ? 1 : (alignment > kAlignmentCap ? kAlignmentCap : alignment);
+    // Round down to a power of two so that the feature is a thermometer code
+    while (capped & (capped - 1)) {
+      capped &= capped - 1;
+    }
+    return uint64_t(capped - 1) << (operand * kAlignmentLevels);
+  }
+
+  static uint64_t divisibility_feature(DistinctExtents const& divisors, int extent, int base) {
+    uint64_t mask = 0;
+    for (int j = 0; j < divisors.count; ++j) {
+      mask |= uint64_t(extent % divisors.extents[j] == 0) << (base + j);
+    }
+    return mask;
+  }
+
+  template <class Fn, size_t I>
+  static decltype(auto) invoke(Fn& fn) {
+    using Candidate = std::tuple_element_t<I, std::tuple<Candidates...>>;
+    return fn(Candidate{});
+  }
+
+  template <class Fn, size_t... Is>
+  static decltype(auto) visit_impl(int index, Fn& fn, std::index_sequence<Is...>) {
+    using Result = decltype(invoke<Fn, 0>(fn));
+    static_assert((std::is_same_v<Result, decltype(invoke<Fn, Is>(fn))> && ...),
+      "The dispatch function must return the same type for every candidate.");
+    using Thunk = Result (*)(Fn&);
+    static constexpr Thunk thunks[] = {&invoke<Fn, Is>...};
+    return thunks[index](fn);
+  }
+
+  /// Whether the function's status means that its candidate cannot implement the problem
+  static bool is_unsupported(Status status) {
+    return status == Status::kErrorNotSupported ||
+           status == Status::kErrorMisalignedOperand ||
+           status == Status::kErrorInvalidProblem;
+  }
+
+public:
+
+  /// Returns the mask of features a problem provides. A candidate of the problem's layouts applies
+  /// if its requirements are a subset of these features.
+  static uint64_t features(GemmDispatchProblem const& problem) {
+    return alignment_feature(problem.alignment_a, 0) |
+           alignment_feature(problem.alignment_b, 1) |
+           alignment_feature(problem.alignment_c, 2) |
+           alignment_feature(problem.alignment_d, 3) |
+           divisibility_feature(kDivisorsM, problem.m, kDivisibilityBase) |
+           divisibility_feature(kDivisorsN, problem.n, kDivisibilityBaseN) |
+           divisibility_feature(kDivisorsK, problem.k, kDivisibilityBaseK);
+  }
+
+  /// Returns whether candidate `index` applies to the problem
+  static bool is_applicable(int index, GemmDispatchProblem const& problem) {
+    if (index < 0 || index >= kCandidateCount ||
+        kKMajorA[index] != problem.k_major_a || kKMajorB[index] != problem.k_major_b) {
+      return false;
+    }
+    return (requirement(index) & ~features(problem)) == 0;
+  }
+
+  /// Returns the index of the first applicable candidate in declaration order, or kNotFound
+  static int select(GemmDispatchProblem const& problem) {
+    Group const& group = kGroups[group_index(problem.k_major_a, problem.k_major_b)];
+    uint64_t provided = features(problem);
+    for (int i = 0; i < group.count; ++i) {
+      if ((group.requirements[i] & ~provided) == 0) {
+        return group.candidates[i];
+      }
+    }
+    return kNotFound;
+  }
+
+  /// Returns the index of the applicable candidate with the lowest cost in the problem's bin.
+  /// Falls back to declaration order if no applicable candidate has a cost there.
+  static int select(GemmDispatchProblem const& problem, GemmDispatchCostTable const& costs) {
+    Group const& group = kGroups[group_index(problem.k_major_a, problem.k_major_b)];
+    uint64_t provided = features(problem);
+    int selected = kNotFound;
+    float selected_cost = std::numeric_limits<float>::infinity();
+    for (int i = 0; i < group.count; ++i) {
+      if ((group.requirements[i] & ~provided) != 0) {
+        continue;
+      }
+      int candidate = group.candidates[i];
+      float cost = costs.cost(candidate, problem.m, problem.n, problem.k);
+      if (selected == kNotFound || cost < selected_cost) {
+        selected = candidate;
+        selected_cost = cost;
+      }
+    }
+    return selected;
+  }
+
+  /// Calls `fn(Candidate{})` with the type of candidate `index`, through a table of function
+  /// pointers. `fn` must return the same type for every candidate.
+  template <class Fn>
+  static decltype(auto) visit(int index, Fn&& fn) {
+    return visit_impl(index, fn, std::make_index_sequence<kCandidateCount>{});
+  }
+
+  /// Selects a candidate for the problem and calls `fn(Candidate{})`, which returns a Status.
+  ///
+  /// If `fn` reports that its candidate cannot implement the problem (kErrorNotSupported,
+  /// kErrorMisalignedOperand or kErrorInvalidProblem, as returned by can_implement()), the
+  /// remaining applicable candidates are tried in declaration order. Returns kErrorNotSupported
+  /// if no candidate applies.
+  template <class Fn>
+  static Status dispatch(GemmDispatchProblem const& problem, Fn&& fn,
+                         GemmDispatchCostTable const* costs = nullptr) {
+    int selected = costs ? select(problem, *costs) : select(problem);
+    if (selected == kNotFound) {
+      return Status::kErrorNotSupported;
+    }
+
+    Status status = visit(selected, fn);
+    if (not is_unsupported(status)) {
+      return status;
+    }
+
+    Group const& group = kGroups[group_index(problem.k_major_a, problem.k_major_b)];
+    uint64_t provided = features(problem);
+    for (int i = 0; i < group.count; ++i) {
+      if (group.candidates[i] == selected || (group.requirements[i] & ~provided) != 0) {
+        continue;
+      }
+      status = visit(group.candidates[i], fn);
+      if (not is_unsupported(status)) {
+        return status;
+      }
+    }
+    return status;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::device
+
+////////////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,12 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/matrix_coord.h"
 
+#if !defined(__CUDACC_RTC__)
+#include <algorithm>
+#include <thread>
+#include <vector>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
@@ -180,6 +186,26 @@ struct BaseGroupedProblemVisitor {
 
     return total_tiles;
   }
+
+#if !defined(__CUDACC_RTC__)
+  /// Host-side record of the most recent schedule written by `host_precompute()`. Passing the
+  /// same state to successive calls allows the schedule to be updated in place: only entries
+  /// for tiles at or beyond the first problem whose tile count changed are rewritten.
+  struct HostPrecomputeState {
+    std::vector<int32_t> problem_ending_tiles;   ///< inclusive prefix sum of tiles per problem
+    int32_t block_count = 0;
+    int32_t entries_per_block = 0;
+    void const *host_workspace = nullptr;
+
+    /// Forces the next call to `host_precompute()` to rewrite the full schedule
+    void reset() {
+      problem_ending_tiles.clear();
+      block_count = 0;
+      entries_per_block = 0;
+      host_workspace = nullptr;
+    }
+  };
+#endif
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -327,6 +353,17 @@ struct GroupedProblemVisitor<ProblemSizeHelper,
                               int32_t problem_count,
                               int32_t block_count,
                               void* host_workspace_ptr) {}
+
+#if !defined(__CUDACC_RTC__)
+  static int32_t host_precompute(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
+                                 int32_t problem_count,
+                                 int32_t block_count,
+                                 void* host_workspace_ptr,
+                                 typename Base::HostPrecomputeState* state,
+                                 int thread_count = 0) {
+    return 0;
+  }
+#endif
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -418,30 +455,187 @@ struct GroupedProblemVisitor<ProblemSizeHelper,
     return sizeof(ProblemInfo) * entries_per_block * block_count;
   }
 #if !defined(__CUDACC_RTC__)
+  using HostPrecomputeState = typename Base::HostPrecomputeState;
+
+  /// Number of consecutive entries of each block's schedule written together (4 KiB of ProblemInfo),
+  /// keeping stores within one page per block while the per-row problem cursors stay in L1
+  static int32_t const kHostPrecomputeRowsPerPanel = 512;
+
+  /// Minimum problems (resp. tiles) handled per host thread before additional threads are used
+  static int32_t const kHostPrecomputeMinProblemsPerThread = 16384;
+  static int32_t const kHostPrecomputeMinTilesPerThread = 65536;
+
   static void host_precompute(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
                               int32_t problem_count,
                               int32_t block_count,
                               void* host_workspace_ptr) {
+    host_precompute(host_problem_sizes_ptr, problem_count, block_count, host_workspace_ptr, nullptr, 1);
+  }
+
+  /// Writes the schedule consumed by `prefetch_tiles()`: entry `j` of block `b` holds the
+  /// problem owning global tile `j * block_count + b`.
+  ///
+  /// The schedule is produced block-major so that stores are contiguous, and both the
+  /// per-problem prefix sum and the fill are split across up to `thread_count` host threads
+  /// (0 selects std::thread::hardware_concurrency()) once the group is large enough to
+  /// amortize them. If `state` describes the schedule currently held in `host_workspace_ptr`
+  /// for the same block count and entries per block, only entries `j >= return value` of each
+  /// block are rewritten; the remaining prefix is unchanged and need not be copied again.
+  ///
+  /// Returns the first entry index per block that was rewritten.
+  static int32_t host_precompute(const cutlass::gemm::GemmCoord* host_problem_sizes_ptr,
+                                 int32_t problem_count,
+                                 int32_t block_count,
+                                 void* host_workspace_ptr,
+                                 HostPrecomputeState* state,
+                                 int thread_count = 0) {
     ProblemInfo* host_problem_info_ptr = reinterpret_cast<ProblemInfo*>(host_workspace_ptr);
-    int32_t total_tiles = Base::group_tile_count(host_problem_sizes_ptr, problem_count);
+
+    if (thread_count <= 0) {
+      thread_count = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+
+    //
+    // Inclusive prefix sum of tiles per problem
+    //
+
+    std::vector<int32_t> problem_ending_tiles(problem_count);
+    int scan_threads = std::max(1, std::min(thread_count, problem_count / kHostPrecomputeMinProblemsPerThread));
+    std::vector<int32_t> chunk_totals(scan_threads, 0);
+
+    host_parallel_for(scan_threads, problem_count, [&](int chunk, int32_t begin, int32_t end) {
+      int32_t running = 0;
+      for (int32_t p_idx = begin; p_idx < end; ++p_idx) {
+        auto problem = host_problem_sizes_ptr[p_idx];
+        Base::possibly_transpose_problem(problem);
+        running += Base::tile_count(Base::grid_shape(problem));
+        problem_ending_tiles[p_idx] = running;
+      }
+      chunk_totals[chunk] = running;
+    });
+
+    if (scan_threads > 1) {
+      std::vector<int32_t> chunk_offsets(scan_threads, 0);
+      for (int chunk = 1; chunk < scan_threads; ++chunk) {
+        chunk_offsets[chunk] = chunk_offsets[chunk - 1] + chunk_totals[chunk - 1];
+      }
+      host_parallel_for(scan_threads, problem_count, [&](int chunk, int32_t begin, int32_t end) {
+        for (int32_t p_idx = begin; p_idx < end; ++p_idx) {
+          problem_ending_tiles[p_idx] += chunk_offsets[chunk];
+        }
+      });
+    }
+
+    int32_t total_tiles = problem_count ? problem_ending_tiles.back() : 0;
     int32_t entries_per_block = (total_tiles - 1 + block_count) / block_count;
 
-    int tile = 0;
-    int start_tile = 0;
-    for (int p_idx = 0; p_idx < problem_count; ++p_idx) {
-      auto problem = host_problem_sizes_ptr[p_idx];
-      Base::possibly_transpose_problem(problem);
-      auto grid = Base::grid_shape(problem);
-      int tiles = Base::tile_count(grid);
-      ProblemInfo problem_info(p_idx, start_tile);
-      for (int i = 0; i < tiles; ++i, ++tile) {
-        host_problem_info_ptr[(entries_per_block * (tile % block_count)) + (tile / block_count)] = problem_info;
+    //
+    // Determine the first entry per block affected by a change since the last call
+    //
+
+    int32_t first_entry = 0;
+    if (state &&
+        state->host_workspace == host_workspace_ptr &&
+        state->block_count == block_count &&
+        state->entries_per_block == entries_per_block) {
+
+      auto const &previous = state->problem_ending_tiles;
+      size_t common = std::min(previous.size(), problem_ending_tiles.size());
+      size_t first_changed = static_cast<size_t>(
+        std::mismatch(previous.begin(), previous.begin() + common, problem_ending_tiles.begin()).first - previous.begin());
+
+      if (first_changed == previous.size() && first_changed == problem_ending_tiles.size()) {
+        first_entry = entries_per_block;
+      }
+      else {
+        // Entries for tiles preceding the first changed problem are unaffected
+        int32_t first_changed_tile = first_changed ? problem_ending_tiles[first_changed - 1] : 0;
+        first_entry = first_changed_tile / block_count;
       }
-      start_tile += tiles;
     }
+
+    //
+    // Fill the schedule in panels of consecutive entries per block
+    //
+
+    int32_t panel_count =
+      (entries_per_block - first_entry + kHostPrecomputeRowsPerPanel - 1) / kHostPrecomputeRowsPerPanel;
+    int64_t rewritten_tiles = int64_t(entries_per_block - first_entry) * block_count;
+    int fill_threads = static_cast<int>(std::max<int64_t>(1,
+      std::min<int64_t>({thread_count, rewritten_tiles / kHostPrecomputeMinTilesPerThread, panel_count})));
+
+    host_parallel_for(fill_threads, panel_count, [&](int, int32_t panel_begin, int32_t panel_end) {
+      int32_t const *ends = problem_ending_tiles.data();
+      int32_t row_problem[kHostPrecomputeRowsPerPanel];
+
+      for (int32_t panel = panel_begin; panel < panel_end; ++panel) {
+        int32_t entry_begin = first_entry + panel * kHostPrecomputeRowsPerPanel;
+        int32_t rows = entries_per_block - entry_begin;
+        if (rows > kHostPrecomputeRowsPerPanel) {
+          rows = kHostPrecomputeRowsPerPanel;
+        }
+
+        // Problem owning the first tile of each row; advanced monotonically across blocks
+        for (int32_t row = 0; row < rows; ++row) {
+          int32_t tile = (entry_begin + row) * block_count;
+          row_problem[row] = static_cast<int32_t>(std::upper_bound(ends, ends + problem_count, tile) - ends);
+        }
+
+        for (int32_t block = 0; block < block_count; ++block) {
+          ProblemInfo *block_entries = host_problem_info_ptr + int64_t(entries_per_block) * block + entry_begin;
+          for (int32_t row = 0; row < rows; ++row) {
+            int32_t tile = (entry_begin + row) * block_count + block;
+            if (tile >= total_tiles) {
+              block_entries[row] = ProblemInfo();
+              continue;
+            }
+            int32_t &p_idx = row_problem[row];
+            while (ends[p_idx] <= tile) {
+              ++p_idx;
+            }
+            block_entries[row] = ProblemInfo(p_idx, p_idx ? ends[p_idx - 1] : 0);
+          }
+        }
+      }
+    });
+
+    if (state) {
+      state->problem_ending_tiles.swap(problem_ending_tiles);
+      state->block_count = block_count;
+      state->entries_per_block = entries_per_block;
+      state->host_workspace = host_workspace_ptr;
+    }
+
+    return first_entry;
   }
 #endif
 private:
+#if !defined(__CUDACC_RTC__)
+  /// Splits [0, item_count) into `workers` contiguous chunks and invokes `fn(chunk, begin, end)`
+  /// on each, running all but the first on separate host threads.
+  template <typename Fn>
+  static void host_parallel_for(int workers, int32_t item_count, Fn fn) {
+    if (workers <= 1 || item_count <= 1) {
+      fn(0, 0, item_count);
+      return;
+    }
+
+    auto chunk_begin = [&](int chunk) {
+      return static_cast<int32_t>((int64_t(item_count) * chunk) / workers);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (int chunk = 1; chunk < workers; ++chunk) {
+      threads.emplace_back(fn, chunk, chunk_begin(chunk), chunk_begin(chunk + 1));
+    }
+    fn(0, 0, chunk_begin(1));
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+#endif
+
   CUTLASS_DEVICE
   void prefetch_tiles() {
     CUTLASS_PRAGMA_UNROLL
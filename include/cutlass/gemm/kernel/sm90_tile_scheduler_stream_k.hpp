@@ -272,7 +272,7 @@ public:
     return get_current_work_for_linear_idx(unit_iter_start_, current_work_linear_idx_, block_id_in_cluster_, scheduler_params);
   }
 
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static WorkTileInfo
   get_current_work_for_linear_idx(uint32_t &unit_iter_start, uint64_t linear_idx, dim3 block_id_in_cluster, Params const& params) {
     // The maximum number of work units is units_per_problem_ * splits_.
@@ -302,7 +302,7 @@ public:
       current_work_linear_idx_, unit_iter_start_, block_id_in_cluster_, work_tile_info, scheduler_params);
   }
 
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static bool
   continue_current_work_for_linear_idx(
     uint64_t linear_idx,
@@ -590,7 +590,7 @@ public:
   }
 
   // Returns the linearized index of the output tile corresponding to the tile with offset [L, M, K]
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static uint64_t
   output_tile_index(Params const& params, WorkTileInfo const& work_tile_info) {
     uint64_t linear_idx_in_batch = UnderlyingScheduler::get_linear_idx_from_m_and_n(
@@ -729,7 +729,7 @@ public:
   }
 
   // Given raster order and current work tile linear index, reset cta m and n index in the cluster.
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static dim3
   get_current_work_cta_m_n_in_cluster(
     Params const& params,
@@ -756,7 +756,7 @@ public:
 
 private:
 
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static uint32_t
   get_current_work_iter_start_possible_update_work_tile_k_remaining(
     Params const& params,
@@ -900,7 +900,7 @@ private:
   }
 
   // Update output tile index given existing remaining k tiles of current work tile.
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static uint64_t update_output_tile_id_and_work_tile_k(
     Params const& params,
     WorkTileInfo& work_tile_info,
@@ -948,12 +948,12 @@ private:
     // The unit's starting k iteration in the current tile is either the starting
     // iteration for the tile as a whole, or the starting k iteration for the unit
     // as a whole (if the latter is greater than the former).
-    uint32_t tile_iter_start = max(output_tile_iter_start, unit_iter_start);
+    uint32_t tile_iter_start = platform::max(output_tile_iter_start, unit_iter_start);
 
     // Similarly, the unit's ending k iteration (exclusive) is either the end of
     // the current tile it is assigned, or the ending iteration of the unit as a whole
     // (if the latter is less than the former).
-    uint32_t tile_iter_end = min(output_tile_iter_end, unit_iter_end + 1);
+    uint32_t tile_iter_end = platform::min(output_tile_iter_end, unit_iter_end + 1);
 
     // Set the k offset to be the starting k tile for this output tile
     work_tile_info.K_idx = static_cast<int32_t>(tile_iter_start - output_tile_iter_start);
@@ -962,7 +962,7 @@ private:
     return output_tile_id;
   }
   // Given output tile index, update M, N, L index of current work tile info.
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static void
   update_work_tile_m_n_l(
     Params const& params,
@@ -996,7 +996,7 @@ private:
   // Sets the current stream-K work to compute within work_tile_info. If new_unit is true, work_tile_info
   // is populated as a new unit of work. Otherwise, state existing in work_tile_info (e.g., remaining
   // iterations) is used to find the next tile in the current work unit.
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static void
   assign_work(
     Params const& params,
@@ -1039,7 +1039,7 @@ private:
   // The fast path to get current output tile index then update fields of work tile info
   // when continuing current work tile is needed, since k tile starting index has precomputed
   // in the first time fetching current work tile.
-  CUTLASS_DEVICE
+  CUTLASS_HOST_DEVICE
   static void
   fast_assign_work(
     uint32_t unit_iter_start,
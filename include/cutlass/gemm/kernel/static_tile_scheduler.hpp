@@ -205,7 +205,7 @@ public:
 
   // Computes the linear index within a batch given M and N tile offsets within the batch.
   // This essentially inverts the mapping performed in get_work_idx_m_and_n
-  static CUTLASS_DEVICE
+  static CUTLASS_HOST_DEVICE
   uint64_t
   get_linear_idx_from_m_and_n(
     int32_t tile_m,
@@ -0,0 +1,226 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Content-addressed on-disk cache of compiled artifacts, shared safely between processes
+"""
+
+import concurrent.futures
+import hashlib
+import json
+import multiprocessing
+import os
+import struct
+import tempfile
+import time
+
+
+def content_key(*parts) -> str:
+    """
+    Returns the key of an artifact built from the given parts (e.g., sources, flags, architecture
+    and compiler version). Parts are length-prefixed so that different splits of the same
+    characters yield different keys.
+
+    :return: hexadecimal SHA-256 digest
+    :rtype: str
+    """
+    digest = hashlib.sha256()
+    for part in parts:
+        data = part if isinstance(part, bytes) else str(part).encode()
+        digest.update(struct.pack("<Q", len(data)))
+        digest.update(data)
+    return digest.hexdigest()
+
+
+class CacheStatistics:
+    """
+    Hits, misses and time spent compiling misses, accumulated over the lifetime of a cache.
+    ``compile_time`` sums the duration of all compilations, which exceeds the elapsed time
+    when misses are compiled concurrently.
+    """
+
+    def __init__(self):
+        self.hits = 0
+        self.misses = 0
+        self.compile_time = 0.0
+
+    def __repr__(self):
+        return f"hits: {self.hits}, misses: {self.misses}, compile time: {self.compile_time:.2f} s"
+
+
+def _timed_compile(compile_fn, payload):
+    start = time.perf_counter()
+    artifact = compile_fn(payload)
+    return artifact, time.perf_counter() - start
+
+
+class CompilationCache:
+    """
+    Cache of compiled artifacts keyed by ``content_key``. An artifact is a dictionary mapping names
+    to ``bytes`` (e.g., a cubin and a host library).
+
+    Each artifact is a single file ``<directory>/<key[:2]>/<key>``. Files are written to a temporary
+    file in the same directory and renamed into place, so concurrent readers and writers (including
+    other processes) only ever observe complete entries. Two processes compiling the same miss
+    write identical contents, and the last rename wins.
+
+    :param directory: root directory of the cache
+    :type directory: str
+    :param max_workers: number of misses compiled concurrently (defaults to the number of CPUs)
+    :type max_workers: int
+    :param use_processes: compile misses in worker processes rather than threads. Threads suffice
+        when the compile function spends its time in a subprocess, as when invoking nvcc.
+    :type use_processes: bool
+    """
+
+    _MAGIC = b"CUTLASS\x01"
+
+    def __init__(self, directory: str, max_workers: int = None, use_processes: bool = False):
+        self.directory = directory
+        self.max_workers = max_workers if max_workers is not None else (os.cpu_count() or 1)
+        self.use_processes = use_processes
+        self.stats = CacheStatistics()
+
+    def path(self, key: str) -> str:
+        return os.path.join(self.directory, key[:2], key)
+
+    def load(self, key: str):
+        """
+        Returns the artifact stored under ``key``, or None if there is no complete entry for it
+        """
+        try:
+            with open(self.path(key), "rb") as file:
+                data = file.read()
+        except FileNotFoundError:
+            return None
+
+        # Entries with a foreign format or truncated by a crash are treated as misses
+        header_offset = len(self._MAGIC) + 8
+        if len(data) < header_offset or not data.startswith(self._MAGIC):
+            return None
+        header_size, = struct.unpack_from("<Q", data, len(self._MAGIC))
+        try:
+            sizes = json.loads(data[header_offset:header_offset + header_size])
+        except ValueError:
+            return None
+
+        offset = header_offset + header_size
+        if offset + sum(sizes.values()) != len(data):
+            return None
+        artifact = {}
+        for name, size in sizes.items():
+            artifact[name] = data[offset:offset + size]
+            offset += size
+        return artifact
+
+    def store(self, key: str, artifact: dict):
+        """
+        Atomically writes ``artifact`` under ``key``
+        """
+        header = json.dumps({name: len(blob) for name, blob in artifact.items()}).encode()
+        shard = os.path.dirname(self.path(key))
+        os.makedirs(shard, exist_ok=True)
+
+        fd, temp_path = tempfile.mkstemp(prefix=f".{key}.", suffix=".tmp", dir=shard)
+        try:
+            with os.fdopen(fd, "wb") as file:
+                file.write(self._MAGIC)
+                file.write(struct.pack("<Q", len(header)))
+                file.write(header)
+                for blob in artifact.values():
+                    file.write(blob)
+                file.flush()
+                os.fsync(file.fileno())
+            os.replace(temp_path, self.path(key))
+        except BaseException:
+            if os.path.exists(temp_path):
+                os.remove(temp_path)
+            raise
+
+    def get_or_compile(self, jobs: dict, compile_fn, bypass: bool = False) -> dict:
+        """
+        Returns the artifacts of ``jobs``, compiling and storing those that are not in the cache
+
+        :param jobs: map from key to the payload passed to ``compile_fn`` on a miss
+        :type jobs: dict
+        :param compile_fn: function mapping a payload to an artifact. With ``use_processes``, it and
+            the payloads must be picklable.
+        :param bypass: compile every job regardless of the contents of the cache
+        :type bypass: bool
+
+        :return: map from key to artifact
+        :rtype: dict
+        """
+        artifacts = {}
+        misses = []
+        for key in jobs:
+            artifact = None if bypass else self.load(key)
+            if artifact is None:
+                misses.append(key)
+            else:
+                artifacts[key] = artifact
+        self.stats.hits += len(artifacts)
+        self.stats.misses += len(misses)
+
+        def finish(key, result):
+            artifact, seconds = result
+            self.store(key, artifact)
+            self.stats.compile_time += seconds
+            artifacts[key] = artifact
+
+        # Successful compilations are stored even if others fail; the first error is raised at the end
+        error = None
+        if len(misses) == 1 or self.max_workers <= 1:
+            for key in misses:
+                try:
+                    finish(key, _timed_compile(compile_fn, jobs[key]))
+                except Exception as e:
+                    error = error or e
+        else:
+            if self.use_processes:
+                # Workers must not inherit the CUDA context of the parent
+                executor = concurrent.futures.ProcessPoolExecutor(
+                    max_workers=self.max_workers, mp_context=multiprocessing.get_context("spawn"))
+            else:
+                executor = concurrent.futures.ThreadPoolExecutor(max_workers=self.max_workers)
+
+            with executor:
+                futures = {executor.submit(_timed_compile, compile_fn, jobs[key]): key for key in misses}
+                for future in concurrent.futures.as_completed(futures):
+                    try:
+                        finish(futures[future], future.result())
+                    except Exception as e:
+                        error = error or e
+
+        if error is not None:
+            raise error
+        return artifacts
@@ -31,9 +31,7 @@
 #################################################################################################
 
 import ctypes
-import json
 import os
-import sqlite3
 import subprocess
 import tempfile
 
@@ -44,7 +42,8 @@ nvrtc = lazy_import("cuda.nvrtc")
 from cutlass_library import SubstituteTemplate
 
 import cutlass_cppgen
-from cutlass_cppgen import CACHE_FILE, CUTLASS_PATH, cuda_install_path, logger
+from cutlass_cppgen import CACHE_DIR, CUTLASS_PATH, cuda_install_path, logger
+from cutlass_cppgen.backend.compilation_cache import CompilationCache, content_key
 from cutlass_cppgen.backend.gemm_operation import GemmOperationUniversal
 from cutlass_cppgen.backend.library import ApiVersion
 from cutlass_cppgen.backend.utils.device import device_cc
@@ -73,6 +72,103 @@ def compile_with_nvcc(cmd, source, error_file):
         raise Exception(f"Invalid Kernel. See '{error_file}' for details.")
 
 
+def compile_with_nvrtc(source, options):
+    """
+    Compiles ``source`` with NVRTC and returns the cubin image
+    """
+    err, program = nvrtc.nvrtcCreateProgram(
+        str.encode(source),
+        bytes(str.encode("module.cu")),
+        0, [], [])
+
+    if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+        raise RuntimeError("NVRTC Error: {}".format(err))
+
+    # Compile program
+    err, = nvrtc.nvrtcCompileProgram(program, len(options), options)
+    if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+        error_string = "NVRTC Error: {}\n".format(err)
+
+        # Get log from compilation
+        err, logSize = nvrtc.nvrtcGetProgramLogSize(program)
+        if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+            raise RuntimeError("NVRTC Error: {}".format(err))
+
+        log = b" " * logSize
+        err, = nvrtc.nvrtcGetProgramLog(program, log)
+        if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+            raise RuntimeError("NVRTC Error: {}".format(err))
+
+        raise RuntimeError(error_string + log.decode() + source)
+
+    # Get data from compilation
+    err, dataSize = nvrtc.nvrtcGetCUBINSize(program)
+    if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+        raise RuntimeError("NVRTC Error: {}".format(err))
+
+    cubin_image = b" " * dataSize
+    (err,) = nvrtc.nvrtcGetCUBIN(program, cubin_image)
+    if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+        raise RuntimeError("NVRTC Error: {}".format(err))
+
+    return cubin_image
+
+
+def compile_module(job):
+    """
+    Compiles the device and host sources of a module. Runs in a worker of the compilation cache,
+    so it depends only on the (picklable) job created by ``ArtifactManager.add_module``.
+
+    :return: artifact holding the cubin image and the host shared library
+    :rtype: dict
+    """
+    if job["backend"] == "nvrtc":
+        cubin_image = compile_with_nvrtc(job["device_source"], job["device_options"])
+
+    with tempfile.TemporaryDirectory(prefix="cutlass_compile", dir="./") as workdir:
+        if job["backend"] == "nvcc":
+            # emit code
+            src_file = os.path.join(workdir, "kernel.cu")
+            cubin_file = os.path.join(workdir, "kernel.cubin")
+            with open(src_file, "w") as file:
+                file.write(job["device_source"])
+
+            # compile with nvcc
+            cmd_template = "${cuda_install_path}/bin/nvcc ${options} -cubin ${srcfile} -o ${tarfile}"
+            values = {
+                "cuda_install_path": job["cuda_install_path"],
+                "options": job["device_options"],
+                "srcfile": src_file,
+                "tarfile": cubin_file,
+            }
+            cmd = SubstituteTemplate(cmd_template, values)
+            compile_with_nvcc(cmd.split(" "), job["device_source"], "./cutlass_python_compilation_device_error.txt")
+
+            # load the cubin image
+            with open(cubin_file, "rb") as file:
+                cubin_image = file.read()
+
+        # Write the host source
+        host_src_file = os.path.join(workdir, "host_src.cu")
+        host_lib_file = os.path.join(workdir, "host_func.so")
+        with open(host_src_file, "w") as outfile:
+            outfile.write(job["host_source"])
+
+        # Set up host compilation arguments
+        cmd = []
+        cmd.append(f"{job['cuda_install_path']}/bin/nvcc")
+        cmd.extend(["-x", "cu", "-Xcompiler=-fpermissive", "-Xcompiler=-w", "-Xcompiler=-fPIC"])
+        cmd.extend(job["host_options"].split(" "))
+        cmd.extend(["-shared", "-o", host_lib_file, host_src_file, "-lcudart", "-lcuda"])
+
+        # Compile the library
+        compile_with_nvcc(cmd, job["host_source"], error_file="./cutlass_python_compilation_host_error.txt")
+        with open(host_lib_file, "rb") as file:
+            host_binary = file.read()
+
+    return {"cubin": cubin_image, "hostbin": host_binary}
+
+
 class CompilationOptions:
     """
     Compilation options.
@@ -117,12 +213,6 @@ class CompilationOptions:
         return options
 
 
-def convertToBinaryData(filename):
-    with open(filename, "rb") as file:
-        blobData = file.read()
-    return blobData
-
-
 def CDLLBin(host_binary):
     tempfile.tempdir = "./"
     temp_so = tempfile.NamedTemporaryFile(prefix="host_func", suffix=".so", delete=True)
@@ -135,22 +225,16 @@ def CDLLBin(host_binary):
 class ArtifactManager:
     """
     Artifact manager
+
+    Compiled modules are kept in a content-addressed ``CompilationCache`` under ``CACHE_DIR``, keyed by
+    their sources, compilation options, architecture and compiler version. Operations missing from the
+    cache are compiled as separate modules, concurrently. Compilations run on threads by default;
+    set ``cache.use_processes`` to compile in worker processes instead, which requires the main
+    script to be import-safe (guarded by ``if __name__ == "__main__"``).
     """
 
     def __init__(self) -> None:
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        # Create the table if it does not already exist
-        sqlite_create_table_query = """
-        CREATE TABLE IF NOT EXISTS compiled_operations(op_key TEXT NOT NULL UNIQUE,
-                                                        cubin BLOB NOT NULL,
-                                                        hostbin BLOB NOT NULL,
-                                                        op_name TEXT NOT NULL,
-                                                        op_attrs TEXT NOT NULL)
-        """
-        cursor.execute(sqlite_create_table_query)
-        connection.commit()
-        cursor.close()
+        self.cache = CompilationCache(CACHE_DIR)
 
         self._nvrtc_compile_options = ["-std=c++17", "-default-device"]
         self._nvcc_compile_options = [
@@ -170,66 +254,17 @@ class ArtifactManager:
         self.backend = "nvcc"
         self.default_compile_options = self._nvcc_compile_options
 
-    def insert_operation(self, op_key, cubin, hostfile, op_name, op_attrs):
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        sqlite_insert_blob_query = """ INSERT OR IGNORE INTO compiled_operations (op_key, cubin, hostbin, op_name, op_attrs) VALUES (?, ?, ?, ?, ?)"""
-
-        hostbin = convertToBinaryData(hostfile)
-
-        data_tuple = (op_key, cubin, hostbin, op_name, json.dumps(op_attrs))
-
-        cursor.execute(sqlite_insert_blob_query, data_tuple)
-        connection.commit()
-        cursor.close()
-
-    def load_operation(self, op_key, extra_funcs):
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        sqlite_fetch_blob_query = """SELECT * from compiled_operations where op_key = ?"""
-        cursor.execute(sqlite_fetch_blob_query, (op_key,))
-        record = cursor.fetchall()
-        if len(record) == 0:
-            return False
-        for row in record:
-            key, cubin_image, host_binary, operation_name, op_attr = row
-            op_attr = json.loads(op_attr)
-            err, module = cuda.cuModuleLoadData(cubin_image)
-            if err != cuda.CUresult.CUDA_SUCCESS:
-                raise RuntimeError("Cuda Error: {}".format(err))
-
-            err, kernel = cuda.cuModuleGetFunction(module, bytes(str.encode(operation_name)))
-            self.compiled_cache_device[key] = kernel
-
-            compiled_host_fns = {}
-            host_lib = CDLLBin(host_binary)
-
-            func_name = operation_name + "_get_params"
-            func = getattr(host_lib, func_name)
-            func.restype = ctypes.POINTER(ctypes.c_char * op_attr[0])
-            compiled_host_fns["get_args"] = func
-
-            func_name = operation_name + "_shared_memory_size"
-            func = getattr(host_lib, func_name)
-            compiled_host_fns["shared_memory_capacity"] = func()
-
-            for attr in op_attr:
-                if isinstance(attr, str):
-                    func_name = operation_name + "_" + attr
-                    func = getattr(host_lib, func_name)
-
-                    # Set the return type of the function
-                    if attr in extra_funcs and extra_funcs[attr] != None:
-                        func.restype = extra_funcs[attr]
-
-                    compiled_host_fns[attr] = func
-
-            self.compiled_cache_host[key] = compiled_host_fns
-        return True
+    def compiler_version(self):
+        if self.backend == "nvrtc":
+            err, major, minor = nvrtc.nvrtcVersion()
+            if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
+                raise RuntimeError("NVRTC Error: {}".format(err))
+            return f"nvrtc {major}.{minor}"
+        return f"nvcc {cutlass_cppgen.nvcc_version()}"
 
-    def emit_compile_(self, operation_list, compilation_options, host_compilation_options):
+    def emit_sources_(self, operation_list):
         """
-        Compile a list of kernels and store them into database
+        Emit the device and host sources of a module containing a list of kernels
         """
         source_buffer_device = ""
         source_buffer_host = ""
@@ -267,93 +302,58 @@ class ArtifactManager:
             )
             source_buffer_host += SubstituteTemplate(operation.HostTemplate, values)
 
-        if self.backend == "nvrtc":
-            # 3. compile
-            err, program = nvrtc.nvrtcCreateProgram(
-                str.encode(source_buffer_device),
-                bytes(str.encode("module.cu")),
-                0, [], [])
-
-            if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
-                raise RuntimeError("NVRTC Error: {}".format(err))
-
-            # Compile program
-            options = compilation_options.get()
-
-            err, = nvrtc.nvrtcCompileProgram(program, len(options), options)
-            if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
-                error_string = "NVRTC Error: {}\n".format(err)
-
-                # Get log from compilation
-                err, logSize = nvrtc.nvrtcGetProgramLogSize(program)
-                if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
-                    raise RuntimeError("NVRTC Error: {}".format(err))
-
-                log = b" " * logSize
-                err, = nvrtc.nvrtcGetProgramLog(program, log)
-                if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
-                    raise RuntimeError("NVRTC Error: {}".format(err))
+        return source_buffer_device, source_buffer_host
 
-                raise RuntimeError(error_string + log.decode() + source_buffer_device)
-
-            # Get data from compilation
-            err, dataSize = nvrtc.nvrtcGetCUBINSize(program)
-            if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
-                raise RuntimeError("NVRTC Error: {}".format(err))
-
-            cubin_image = b" " * dataSize
-            (err,) = nvrtc.nvrtcGetCUBIN(program, cubin_image)
-            if err != nvrtc.nvrtcResult.NVRTC_SUCCESS:
-                raise RuntimeError("NVRTC Error: {}".format(err))
-
-        else:  # with nvcc backend
-            # emit code
-            tempfile.tempdir = "./"
-            temp_cu = tempfile.NamedTemporaryFile(
-                prefix="kernel", suffix=".cu", delete=True)
-            temp_cubin = tempfile.NamedTemporaryFile(
-                prefix="kernel", suffix=".cubin", delete=True)
-            with open(temp_cu.name, "w") as file:
-                file.write(source_buffer_device)
-
-            # compile with nvcc
-            cmd_template = "${cuda_install_path}/bin/nvcc ${options} -cubin ${srcfile} -o ${tarfile}"
-            values = {
-                "cuda_install_path": cuda_install_path(),
-                "options": compilation_options.get_str(),
-                "srcfile": temp_cu.name,
-                "tarfile": temp_cubin.name,
-            }
-            cmd = SubstituteTemplate(cmd_template, values)
-            compile_with_nvcc(cmd.split(" "), source_buffer_device, "./cutlass_python_compilation_device_error.txt")
-
-            # load the cubin image
-            with open(temp_cubin.name, "rb") as file:
-                cubin_image = file.read()
-
-        tempfile.tempdir = "./"
-        temp_src = tempfile.NamedTemporaryFile(
-            prefix="host_src", suffix=".cu", delete=True)
-
-        # Write the host source
-        with open(temp_src.name, "w") as outfile:
-            outfile.write(source_buffer_host)
-
-        temp_dst = tempfile.NamedTemporaryFile(
-            prefix="host_func", suffix=".so", delete=True)
-
-        # Set up host compilation arguments
-        cmd = []
-        cmd.append(f"{cuda_install_path()}/bin/nvcc")
-        cmd.extend(["-x", "cu", "-Xcompiler=-fpermissive", "-Xcompiler=-w", "-Xcompiler=-fPIC"])
-        cmd.extend(host_compilation_options.get_str().split(" "))
-        cmd.extend(["-shared", "-o", temp_dst.name, temp_src.name, "-lcudart", "-lcuda"])
-
-        # Comile and load the library
-        compile_with_nvcc( cmd, source_buffer_host, error_file="./cutlass_python_compilation_host_error.txt")
-        host_lib = ctypes.CDLL(temp_dst.name)
+    def load_module_(self, operation, key, artifact):
+        """
+        Load a compiled module and bind its kernel and host functions to ``operation``
+        """
+        err, module = cuda.cuModuleLoadData(artifact["cubin"])
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("Cuda Error: {}".format(err))
+
+        # get device kernels
+        err, operation.kernel = cuda.cuModuleGetFunction(
+            module,
+            bytes(str.encode(operation.name()))
+        )
+        self.compiled_cache_device[key] = operation.kernel
+
+        # get host functions
+        host_lib = CDLLBin(artifact["hostbin"])
+        compiled_host_fns = {}
+
+        # get param size
+        func_name = operation.name() + "_get_param_size"
+        func = getattr(host_lib, func_name)
+        param_size = func()
+
+        func_name = operation.name() + "_get_params"
+        func = getattr(host_lib, func_name)
+        func.argtype = operation.argtype
+        func.restype = ctypes.POINTER(ctypes.c_char * param_size)
+        setattr(operation, "get_args", func)
+        compiled_host_fns["get_args"] = func
+
+        # set shared memory size
+        func_name = operation.name() + "_shared_memory_size"
+        func = getattr(host_lib, func_name)
+        setattr(operation, "shared_memory_capacity", func())
+        compiled_host_fns["shared_memory_capacity"] = func()
+        # set the maximum dynamic shared size
+        operation.initialize()
+
+        # get extra functions
+        if hasattr(operation, "extra_funcs"):
+            for suffix, ret_type in operation.extra_funcs.items():
+                func_name = operation.name() + "_" + suffix
+                func = getattr(host_lib, func_name)
+                if ret_type is not None:
+                    func.restype = ret_type
+                setattr(operation, suffix, func)
+                compiled_host_fns[suffix] = func
 
-        return cubin_image, host_lib, temp_dst
+        self.compiled_cache_host[key] = compiled_host_fns
 
     def add_module(self, operations, compile_options=None, bypass_cache=False):
         """
@@ -374,89 +374,45 @@ class ArtifactManager:
         if compile_options is None:
             compile_options = CompilationOptions(
                 self.default_compile_options, arch, include_paths)
-        # save the cubin
-        operation_key = []
-        operation_list = []
+
+        if self.backend == "nvrtc":
+            device_options = compile_options.get()
+        else:
+            device_options = compile_options.get_str()
+        host_options = host_compile_options.get_str()
+        compiler_version = self.compiler_version()
+
+        jobs = {}
+        pending = []
         for operation in operations:
-            # step 1: get kernel string as key
-            key = operation.rt_module.emit() + operation.procedural_name() + self.backend
-            # step 1: check if the operation is in cache
-            compiled_kernel = self.compiled_cache_device.get(key)
+            # step 1: the key is the content hash of everything that determines the compiled module
+            device_source, host_source = self.emit_sources_([operation.rt_module])
+            key = content_key(self.backend, compiler_version, cutlass_cppgen.__version__, arch,
+                              device_options, host_options, device_source, host_source)
 
-            if compiled_kernel is None and not bypass_cache:
-                hit = self.load_operation(key, getattr( operation.rt_module, "extra_funcs", {}))
-                if hit:
-                    compiled_kernel = self.compiled_cache_device.get(key)
-                    assert compiled_kernel is not None
+            # step 2: check if the operation is already loaded
+            compiled_kernel = self.compiled_cache_device.get(key)
             if compiled_kernel is not None:
                 operation.rt_module.kernel = compiled_kernel
                 compiled_host_fns = self.compiled_cache_host.get(key)
                 assert compiled_host_fns is not None
-                for key in compiled_host_fns.keys():
-                    setattr(operation.rt_module, key, compiled_host_fns[key])
+                for name in compiled_host_fns.keys():
+                    setattr(operation.rt_module, name, compiled_host_fns[name])
                 operation.rt_module.initialize()
             else:
-                operation_list.append(operation.rt_module)
-                operation_key.append(key)
-
-        if len(operation_list) > 0:
-            cubin_image, host_lib, host_file = self.emit_compile_(
-                operation_list, compile_options, host_compile_options)
-
-            err, module = cuda.cuModuleLoadData(cubin_image)
-            if err != cuda.CUresult.CUDA_SUCCESS:
-                raise RuntimeError("Cuda Error: {}".format(err))
-
-            operation_name = []
-            operation_attr = []
-            for operation, key in zip(operation_list, operation_key):
-                # get device kernels
-                err, operation.kernel = cuda.cuModuleGetFunction(
-                    module,
-                    bytes(str.encode(operation.name()))
-                )
-                operation_name.append(operation.name())
-                self.compiled_cache_device[key] = operation.kernel
-                # get host functions
-                compiled_host_fns = {}
-                op_attr = []
-
-                # get param size
-                func_name = operation.name() + "_get_param_size"
-                func = getattr(host_lib, func_name)
-                param_size = func()
-
-                func_name = operation.name() + "_get_params"
-                func = getattr(host_lib, func_name)
-                func.argtype = operation.argtype
-                func.restype = ctypes.POINTER(ctypes.c_char * param_size)
-                setattr(operation, "get_args", func)
-                compiled_host_fns["get_args"] = func
-
-                # set shared memory size
-                func_name = operation.name() + "_shared_memory_size"
-                func = getattr(host_lib, func_name)
-                setattr(operation, "shared_memory_capacity", func())
-                compiled_host_fns["shared_memory_capacity"] = func()
-                # set the maximum dynamic shared size
-                operation.initialize()
-
-                # get extra functions
-                op_attr.append(param_size)
-
-                if hasattr(operation, "extra_funcs"):
-                    for suffix, ret_type  in operation.extra_funcs.items():
-                        func_name = operation.name() + "_" + suffix
-                        func = getattr(host_lib, func_name)
-                        if ret_type is not None:
-                            func.restype = ret_type
-                        setattr(operation, suffix, func)
-                        compiled_host_fns[suffix] = func
-                        op_attr.append(suffix)
-
-                operation_attr.append(op_attr)
-                self.compiled_cache_host[key] = compiled_host_fns
-
-            for (key, operation_name, operation_attr,) in zip(operation_key, operation_name, operation_attr):
-                self.insert_operation(
-                    key, cubin_image, host_file.name, operation_name, operation_attr)
+                jobs[key] = {
+                    "backend": self.backend,
+                    "cuda_install_path": cuda_install_path(),
+                    "device_source": device_source,
+                    "device_options": device_options,
+                    "host_source": host_source,
+                    "host_options": host_options,
+                }
+                pending.append((operation.rt_module, key))
+
+        # step 3: load the remaining operations from the cache, compiling the misses concurrently
+        if len(jobs) > 0:
+            artifacts = self.cache.get_or_compile(jobs, compile_module, bypass=bypass_cache)
+            for operation, key in pending:
+                self.load_module_(operation, key, artifacts[key])
+            logger.info(f"Compilation cache: {self.cache.stats}")
@@ -57,6 +57,11 @@ class FusionCallbacks:
             self.namespace = "threadblock"
         else:
             self.namespace = "fusion"
+        # Structurally identical visitors are declared once and aliased
+        # canonical_decls: declaration body -> first visitor declared with it
+        # aliases: visitor name -> canonical visitor name
+        self.canonical_decls = {}
+        self.aliases = {}
 
     #
     # Helper functions
@@ -72,9 +77,34 @@ class FusionCallbacks:
         else:
             return meta.name_camel
 
+    def get_canonical_name(self, visitor_name: str):
+        """
+        Get the name of the first declared visitor identical to ``visitor_name``
+        """
+        return self.aliases.get(visitor_name, visitor_name)
+
+    def dedup_decl(self, visitor_name: str, decl: str):
+        """
+        Replace the declaration of a visitor by an alias if an identical visitor has been
+        declared before. Declarations made of several statements (e.g., with a descriptor)
+        are kept as they are.
+        """
+        prefix = f"using {visitor_name} = "
+        stripped = decl.strip()
+        if not stripped.startswith(prefix) or stripped.count("using ") != 1:
+            return decl
+        body = stripped[len(prefix):]
+        canonical_name = self.canonical_decls.setdefault(body, visitor_name)
+        if canonical_name == visitor_name:
+            return decl
+        self.aliases[visitor_name] = canonical_name
+        return f"\nusing {visitor_name} = {canonical_name};\n"
+
     def emit(self):
         node_metas = self.dag_ir.node_metas_topological_order()
         epilogue_str = ""
+        self.canonical_decls = {}
+        self.aliases = {}
         # Step 1: emit individual node type decl
         #         emit the EVT & DAG connector
         for meta in node_metas:
@@ -105,13 +135,14 @@ class FusionCallbacks:
 
         evt_tmp = f"""
 using EVT{node.name_camel} = cutlass::epilogue::{self.namespace}::Sm{self.evt_cc}EVT<
-    {node.name_camel},
+    {self.get_canonical_name(node.name_camel)},
 """
         sorted_children = self.dag_ir.get_all_inputs(node.name)
-        evt_node_strs = [f"    {self.get_visitor_name(child_name)}" for child_name in sorted_children]
+        evt_node_strs = [
+            f"    {self.get_canonical_name(self.get_visitor_name(child_name))}" for child_name in sorted_children]
         evt_tmp += ",\n".join(evt_node_strs) + ">;\n"
 
-        return evt_tmp
+        return self.dedup_decl(f"EVT{node.name_camel}", evt_tmp)
 
     def emit_dag(self, node):
         subgraph = node.subgraph
@@ -135,18 +166,18 @@ using EVT{node.name_camel} = cutlass::epilogue::{self.namespace}::Sm{self.evt_cc
         for n in subgraph_nodes[:-1]:
             n_meta = subgraph.get_node_meta(n)
             if n_meta.disabled:
-                dag_node_strs.append(f"    {self.get_visitor_name(n)}")
+                dag_node_strs.append(f"    {self.get_canonical_name(self.get_visitor_name(n))}")
             else:
-                dag_node_strs.append(f"    {n_meta.name_camel}")
+                dag_node_strs.append(f"    {self.get_canonical_name(n_meta.name_camel)}")
         dag_nodes = ",\n".join(dag_node_strs)
 
-        return f"""
+        return self.dedup_decl(node.name_camel, f"""
 using {node.name_camel} = cutlass::epilogue::{self.namespace}::Sm{self.evt_cc}TopologicalVisitor<
     {DataTypeTag[node.subgraph.element_compute]},
     {edge_tuples},
 {dag_nodes}
 >;
-"""
+""")
 
     def emit_node(self, node):
         if isinstance(node, TopoVisitorNode):
@@ -156,4 +187,4 @@ using {node.name_camel} = cutlass::epilogue::{self.namespace}::Sm{self.evt_cc}To
                     emission += self.emit_node(node)
             return emission
         else:
-            return node.underlying_impl.type_decl
+            return self.dedup_decl(node.name_camel, node.underlying_impl.type_decl)
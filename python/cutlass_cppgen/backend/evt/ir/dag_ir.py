@@ -34,12 +34,14 @@
 DAG IR used by Python EVT
 """
 
+import hashlib
+
 import networkx as nx
 
 from cutlass_library import DataType
 
 from cutlass_cppgen.backend.evt.ir.compute_nodes import ComputeNode
-from cutlass_cppgen.backend.evt.ir.node import NodeBase
+from cutlass_cppgen.backend.evt.ir.node import NodeBase, freeze
 from cutlass_cppgen.backend.library import ActivationOp
 from cutlass_cppgen.backend.utils import device_cc
 
@@ -252,3 +254,37 @@ class DAGIR:
         Return True is a path exists from src to target
         """
         return nx.has_path(self._graph, src, target)
+
+    #
+    # Structural hashing
+    #
+    def node_hashes(self, with_names: bool=True):
+        """
+        Get the Merkle hash of every node: the digest of its structural key and of the hashes
+        of its inputs in edge-weight order. Two nodes have the same hash iff they apply the same
+        computation to the same input cone, so structurally identical subgraphs can be detected
+        (``with_names=False``) or a whole DAG can be used as a cache key (``with_names=True``).
+
+        :return: dict[str, str]
+        """
+        hashes = {}
+        for node in nx.topological_sort(self._graph):
+            digest = hashlib.sha256(repr(self.get_node_meta(node).structural_key(with_names)).encode())
+            for src, _, weight in sorted(self._graph.in_edges(node, data="weight"), key=lambda e: e[2]):
+                digest.update(f"{weight}:{hashes[src]};".encode())
+            hashes[node] = digest.hexdigest()
+        return hashes
+
+    def structural_hash(self, with_names: bool=True) -> str:
+        """
+        Get the hash of the DAG, combining the hashes of its output (zero out-degree) nodes, the
+        compute type and the compute capability
+        """
+        hashes = self.node_hashes(with_names)
+        digest = hashlib.sha256(repr((self.cc, freeze(self.element_compute))).encode())
+        if with_names:
+            # The counter determines the names of identity nodes inserted by later passes
+            digest.update(f"{self.identity_counter};".encode())
+        for node_hash in sorted(hashes[node] for node in self._graph if self.out_degree(node) == 0):
+            digest.update(node_hash.encode())
+        return digest.hexdigest()
@@ -35,14 +35,84 @@ Base & visitor classes of DAGIR Nodes
 """
 
 import ctypes
+import enum
+import hashlib
 from re import sub
 
 from cutlass_library import LayoutType
 
-from cutlass_cppgen.backend.evt.ir.layout_algorithm import _list_to_tuple, _reverse_tuple
+from cutlass_cppgen.backend.evt.ir.layout_algorithm import Layout, _list_to_tuple, _reverse_tuple
 from cutlass_cppgen.backend.evt.ir.tensor import Tensor
 
 
+def _freeze_closure(value, with_names: bool, active: set):
+    """
+    Freeze the default arguments and the captured variables of a Python function
+    """
+    cells = []
+    for cell in value.__closure__ or ():
+        try:
+            contents = cell.cell_contents
+        except ValueError:
+            cells.append("<empty>")
+            continue
+        cells.append(freeze(contents, with_names, active))
+    return (freeze(value.__defaults__, with_names, active),
+            freeze(value.__kwdefaults__, with_names, active),
+            tuple(cells))
+
+
+def freeze(value, with_names: bool=True, _active: set=None):
+    """
+    Convert an attribute of a node into a hashable value that only depends on its contents
+    (e.g., tensors are compared by element and layout, functions by qualified name, default
+    arguments and captured variables)
+    """
+    if value is None or isinstance(value, (bool, int, str)):
+        return value
+    elif isinstance(value, float):
+        return repr(value)
+    elif isinstance(value, enum.Enum):
+        return f"{type(value).__qualname__}.{value.name}"
+    elif isinstance(value, (tuple, list)):
+        return tuple(freeze(item, with_names, _active) for item in value)
+    elif isinstance(value, dict):
+        return tuple(sorted((str(k), freeze(v, with_names, _active)) for k, v in value.items()))
+    elif isinstance(value, Layout):
+        return ("Layout", freeze(value.shape), freeze(value.stride))
+    elif isinstance(value, Tensor):
+        return ("Tensor", freeze(value.element), freeze(value.layout), value.is_constant,
+                freeze(getattr(value, "value", None)))
+    elif isinstance(value, NodeBase):
+        return value.structural_key(with_names)
+    elif hasattr(value, "structural_hash"):
+        return value.structural_hash(with_names)
+    elif isinstance(value, type) or callable(value):
+        qualname = getattr(value, "__qualname__", type(value).__qualname__)
+        name = f"{getattr(value, '__module__', '')}.{qualname}"
+        code = getattr(value, "__code__", None)
+        if code is None:
+            return name
+        _active = set() if _active is None else _active
+        if id(value) in _active:
+            # Recursive reference to a function being frozen
+            return ("<recursive>", name)
+        _active.add(id(value))
+        try:
+            captured = _freeze_closure(value, with_names, _active)
+        finally:
+            _active.discard(id(value))
+        if "<" in qualname:
+            # Lambdas and closures are only identified by their body
+            return (qualname, hashlib.sha256(code.co_code).hexdigest(), repr(code.co_consts), captured)
+        return (name, captured)
+    elif hasattr(value, "shape") and hasattr(value, "dtype"):
+        # Array-like constants
+        return ("Array", tuple(value.shape), str(value.dtype), repr(value.tolist()))
+    else:
+        return repr(value)
+
+
 class TupleEmitter:
     """
     Emit the cute tuple to C++ code
@@ -173,6 +243,22 @@ class NodeBase:
         # Whether the node is disabled for emit
         self.disabled = False
 
+    # Attributes that do not describe the computation of the node
+    unstructured_attributes = ["underlying_impl"]
+
+    def structural_key(self, with_names: bool=True) -> tuple:
+        """
+        Return a hashable key of the node's own attributes (op, function, element types, tensor
+        layout, ...), excluding its inputs. With ``with_names=False``, two nodes computing the same
+        function under different names have the same key.
+        """
+        key = [type(self).__name__]
+        for attr, value in sorted(vars(self).items()):
+            if attr in self.unstructured_attributes or (attr == "name" and not with_names):
+                continue
+            key.append((attr, freeze(value, with_names)))
+        return tuple(key)
+
     @property
     def name_camel(self) -> str:
         """
@@ -36,7 +36,7 @@ from cutlass_cppgen.backend.evt.passes.pass_dag_2_tree import PassDAG2Tree
 from cutlass_cppgen.backend.evt.passes.pass_get_impl import PassGetImpl
 from cutlass_cppgen.backend.evt.passes.pass_fix_element_d import PassFixElementD
 from cutlass_cppgen.backend.evt.passes.pass_layout_elimination import PassLayoutManipulateElimination
-from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassManager
+from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassManager, PassCache, pass_cache
 from cutlass_cppgen.backend.evt.passes.pass_preprocess_red import PassPreprocessRed
 from cutlass_cppgen.backend.evt.passes.pass_shape_type_propagation import PassShapeTypePropagation
 from cutlass_cppgen.backend.evt.passes.smem_size_calculator import GetSmemSize
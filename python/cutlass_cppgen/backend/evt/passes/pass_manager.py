@@ -34,6 +34,10 @@
 Pass manager for DAG IR.
 """
 
+from collections import OrderedDict
+from copy import deepcopy
+import hashlib
+import threading
 from typing import Any
 
 import networkx as nx
@@ -110,15 +114,83 @@ class EVTPassBase:
             raise NotImplementedError(f"func {func.__name__} is not overwritten for Sm{self.cc}")
 
 
+class PassCache:
+    """
+    Least-recently-used cache of DAG IR states after running a pass pipeline.
+
+    Entries are keyed by the structural hash of the DAG IR before the passes (see
+    ``DAGIR.structural_hash``) and by the scheduled passes, so tracing an epilogue that is
+    structurally identical to one traced before restores the optimized DAG IR instead of
+    re-running the passes. States are deep-copied on store and on lookup, so the returned DAG IR
+    (including its node metas) may be modified freely. The cache is safe to use from multiple
+    threads.
+
+    :param max_size: maximum number of entries (0 disables the cache)
+    :type max_size: int
+    """
+    def __init__(self, max_size: int=256) -> None:
+        self.max_size = max_size
+        self.hits = 0
+        self.misses = 0
+        self._entries = OrderedDict()
+        self._lock = threading.Lock()
+
+    def __len__(self):
+        return len(self._entries)
+
+    def __repr__(self):
+        return f"hits: {self.hits}, misses: {self.misses}, entries: {len(self)}/{self.max_size}"
+
+    def lookup(self, key: str):
+        """
+        Returns a deep copy of the state stored under ``key``, or None
+        """
+        with self._lock:
+            state = self._entries.get(key)
+            if state is None:
+                self.misses += 1
+                return None
+            self._entries.move_to_end(key)
+            self.hits += 1
+        return deepcopy(state)
+
+    def store(self, key: str, state: dict):
+        """
+        Stores a copy of ``state`` under ``key``, evicting the least recently used entries
+        """
+        if self.max_size <= 0:
+            return
+        state = deepcopy(state)
+        with self._lock:
+            self._entries[key] = state
+            self._entries.move_to_end(key)
+            while len(self._entries) > self.max_size:
+                self._entries.popitem(last=False)
+
+    def clear(self):
+        with self._lock:
+            self._entries.clear()
+            self.hits = 0
+            self.misses = 0
+
+
+# Pass cache shared by all the EVT frontends
+pass_cache = PassCache()
+
+
 class EVTPassManager(nx.DiGraph):
     """
     Topological-based Pass Manager.
     Each registered pass has a list of dependencies. The pass manager organizes
     the passes as a DAG and launch the compiler passes under topological order.
+
+    The results are memoized in ``cache`` by the structural hash of the input DAG IR.
+    Set ``cache=None`` to always run the passes.
     """
-    def __init__(self, dag_ir: DAGIR, pass_list):
+    def __init__(self, dag_ir: DAGIR, pass_list, cache: PassCache=pass_cache):
         super().__init__()
         self.dag_ir = dag_ir
+        self.cache = cache
         for pass_cls in pass_list:
             self.add_pass(pass_cls)
 
@@ -155,10 +227,33 @@ class EVTPassManager(nx.DiGraph):
         # Topological sort
         return list(nx.topological_sort(self))
 
+    def cache_key(self) -> str:
+        """
+        Key of the current DAG IR and the scheduled passes in the pass cache
+        """
+        digest = hashlib.sha256(self.dag_ir.structural_hash().encode())
+        for pass_name in self.sorted_passes:
+            pass_cls = type(self.get_callable(pass_name))
+            digest.update(f"{pass_cls.__module__}.{pass_cls.__qualname__};".encode())
+        return digest.hexdigest()
+
     def __call__(self) -> Any:
         """
         Launch the registered passes
         """
+        key = None
+        if self.cache is not None and self.cache.max_size > 0:
+            key = self.cache_key()
+            state = self.cache.lookup(key)
+            if state is not None:
+                # Restore in place: the passes and the frontend hold references to the DAG IR
+                self.dag_ir.__dict__.clear()
+                self.dag_ir.__dict__.update(state)
+                return
+
         for pass_name in self.sorted_passes:
             callable = self.get_callable(pass_name)
             callable()
+
+        if key is not None:
+            self.cache.store(key, vars(self.dag_ir))
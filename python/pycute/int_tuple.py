@@ -182,6 +182,36 @@ def crd2idx(crd, shape, stride=None):
       return crd * stride
 
 
+# Batched idx2crd over an integer NumPy array of indices
+# Returns an array of shape idx.shape + (len(flatten(shape)),) holding the flattened coordinates.
+# crd2idx and idx2crd above also accept integer arrays in place of int indices and coordinates.
+def idx2crd_batch(idx, shape, stride=None):
+  import numpy as np
+
+  if stride is None:
+    stride = prefix_product(shape)
+
+  idx = np.asarray(idx)
+  flat_shape  = flatten(shape)
+  flat_stride = flatten(stride)
+  assert len(flat_shape) == len(flat_stride)
+  return np.stack([(idx // d) % s for s, d in zip(flat_shape, flat_stride)], axis=-1)
+
+
+# Batched crd2idx over an integer NumPy array of flattened coordinates, of shape (..., len(flatten(shape)))
+# Returns an array of shape crd.shape[:-1] holding the indices.
+def crd2idx_batch(crd, shape, stride=None):
+  import numpy as np
+
+  if stride is None:
+    stride = prefix_product(shape)
+
+  crd = np.asarray(crd)
+  flat_stride = flatten(stride)
+  assert crd.shape[-1] == len(flat_stride), f"crd.shape={crd.shape}, shape={shape}"
+  return crd @ np.asarray(flat_stride, dtype=crd.dtype)
+
+
 # Transform crd into the dst_shape's iteration space
 def crd2crd(crd, dst_shape, src_shape=None):
   if is_tuple(crd):
@@ -34,6 +34,7 @@
 Definition of CuTe Layouts and functions to manipulate them
 """
 
+from functools import lru_cache, update_wrapper
 from itertools import chain
 from typing import Union
 
@@ -48,18 +49,36 @@ def is_layout(x):
   return isinstance(x, LayoutBase)
 
 
+# Layouts are immutable: shape and stride cannot be reassigned, and both should be ints or tuples
 class Layout(LayoutBase):
   def __init__(self, _shape, _stride=None):
-    self.shape  = _shape
+    self._shape = _shape
     if _stride is None:
-      self.stride = prefix_product(self.shape)
+      self._stride = prefix_product(_shape)
     else:
-      self.stride = _stride
+      self._stride = _stride
+    self._hash = None
+
+  @property
+  def shape(self):
+    return self._shape
+
+  @property
+  def stride(self):
+    return self._stride
 
   # operator ==
   def __eq__(self, other):
+    if not isinstance(other, Layout):
+      return NotImplemented
     return self.shape == other.shape and self.stride == other.stride
 
+  # hash(L)   Layouts with equal shape and stride hash equally
+  def __hash__(self):
+    if self._hash is None:
+      self._hash = hash((self._shape, self._stride))
+    return self._hash
+
   # operator len(L)  (len [rank] like tuples)
   def __len__(self):
     if is_tuple(self.shape):
@@ -112,6 +131,56 @@ class Layout(LayoutBase):
     return f"Layout({self.shape},{self.stride})"
 
 
+# Memoization of the layout algebra
+#
+# The algebra below is a pure function of its (immutable) arguments, so results are kept in an LRU
+# cache per function. Calls with unhashable arguments (e.g. lists) are evaluated without caching.
+_CACHE_SIZE = 1 << 16
+_MEMOIZED = []
+
+
+class _Memoized:
+  def __init__(self, func):
+    update_wrapper(self, func)
+    self.func   = func
+    self.cached = lru_cache(maxsize=_CACHE_SIZE, typed=True)(func)
+
+  def __call__(self, *args, **kwargs):
+    try:
+      hash((args, tuple(kwargs.items())))
+    except TypeError:
+      return self.func(*args, **kwargs)
+    return self.cached(*args, **kwargs)
+
+  def resize(self, maxsize):
+    self.cached = lru_cache(maxsize=maxsize, typed=True)(self.func)
+
+
+def memoize(func):
+  wrapper = _Memoized(func)
+  _MEMOIZED.append(wrapper)
+  return wrapper
+
+
+# Statistics of the caches, by function name
+def cache_info():
+  return {f.__name__: f.cached.cache_info() for f in _MEMOIZED}
+
+
+# Drop all cached results
+def clear_cache():
+  for f in _MEMOIZED:
+    f.cached.cache_clear()
+
+
+# Set the number of results kept per function: None is unbounded and 0 disables memoization
+def set_cache_size(maxsize):
+  global _CACHE_SIZE
+  _CACHE_SIZE = maxsize
+  for f in _MEMOIZED:
+    f.resize(maxsize)
+
+
 # Make Layout from a list of layouts (each layout it's own mode in the result)
 def make_layout(*layouts):
   if len(layouts) == 1 and not is_layout(layouts[0]):
@@ -134,6 +203,7 @@ def cosize(layout):
 
 
 # Layout coalesce -- flatten and combine as many modes as possible while preserving the int-to-int function
+@memoize
 def coalesce(layout, profile=None):
   if is_tuple(profile):
     assert len(layout) >= len(profile)
@@ -165,6 +235,7 @@ def coalesce(layout, profile=None):
 
 
 # Layout filter -- replace all stride-0 modes with size-1 and then coalesce to remove them
+@memoize
 def filter(layout, profile=None):
   if is_tuple(profile):
     assert len(layout) >= len(profile)
@@ -187,6 +258,7 @@ def filter(layout, profile=None):
 
 # Layout composition
 # Use tuples-of-layouts to perform this operation by-mode and None as no-op
+@memoize
 def composition(layoutA, layoutB):
   if layoutB is None:
     return layoutA
@@ -229,6 +301,7 @@ def composition(layoutA, layoutB):
 
 
 # Layout complement
+@memoize
 def complement(layout, max_idx=1):
   if is_int(layout):
     return complement(Layout(layout))
@@ -257,6 +330,7 @@ def complement(layout, max_idx=1):
 
 
 # Layout right inverse
+@memoize
 def right_inverse(layout):
   if layout is None:
     return None
@@ -284,6 +358,7 @@ def right_inverse(layout):
 
 
 # Layout left inverse
+@memoize
 def left_inverse(layout):
   if layout is None:
     return None
@@ -294,6 +369,7 @@ def left_inverse(layout):
 
 # Split a layout by the composition of B and the "rest"
 # Use tuples-of-layouts to perform this operation by-mode and None as no-op
+@memoize
 def logical_divide(layoutA, layoutB):
   if layoutB is None:
     return layoutA
@@ -309,6 +385,7 @@ def logical_divide(layoutA, layoutB):
 
 # Reproduce a layoutA over a layoutB
 # Use tuples-of-layouts to perform this operation by-mode and None as no-op
+@memoize
 def logical_product(layoutA, layoutB):
   if layoutB is None:
     return layoutA
@@ -340,22 +417,26 @@ def hier_unzip(splitter, layoutA, layoutB):
 
 
 # Apply logical divide hierarchically and gather the split modes into two modes
+@memoize
 def zipped_divide(layoutA, layoutB):
   return hier_unzip(logical_divide, layoutA, layoutB)
 
 
 # Perform logical divide hierarchically and gather tiles (B-layouts) into a new mode
+@memoize
 def tiled_divide(layoutA, layoutB):
   result = zipped_divide(layoutA, layoutB)
   return make_layout([result[0]] + [result[1][i] for i in range(len(result[1]))])
 
 
 # Apply logical product hierarchically and gather the split modes into two modes
+@memoize
 def zipped_product(layoutA, layoutB):
   return hier_unzip(logical_product, layoutA, layoutB)
 
 
 # Perform logical product hierarchically and gather tiles (B-layouts) into a new mode
+@memoize
 def tiled_product(layoutA, layoutB):
   result = zipped_product(layoutA, layoutB)
   return make_layout([result[0]] + [result[1][i] for i in range(len(result[1]))])
@@ -81,6 +81,16 @@ class Swizzle:
   def cosize(self):
     return self.size()
 
+  # operator ==
+  def __eq__(self, other):
+    if not isinstance(other, Swizzle):
+      return NotImplemented
+    return (self.bits, self.base, self.shift) == (other.bits, other.base, other.shift)
+
+  # hash(S)
+  def __hash__(self):
+    return hash((self.bits, self.base, self.shift))
+
   # print and str
   def __str__(self):
     return f"SW_{self.bits}_{self.base}_{self.shift}"
@@ -100,6 +110,10 @@ class ComposedLayout(LayoutBase):
   def __eq__(self, other):
     return self.layoutB == other.layoutB and self.offset == other.offset and self.layoutA == other.layoutA
 
+  # hash(L)
+  def __hash__(self):
+    return hash((self.layoutB, self.offset, self.layoutA))
+
   # operator len(L)  (len [rank] like tuples)
   def __len__(self):
     return len(self.layoutA)
@@ -0,0 +1,103 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Compile-time benchmark: CuTe layout algebra on static layouts of varying rank and depth.
+
+    CUTLASS_BENCHMARK_RANK sets the number of top-level modes and CUTLASS_BENCHMARK_DEPTH the
+    nesting depth of each mode. The suite in suite.json compiles this file once per combination.
+*/
+
+#include <cute/tensor.hpp>
+#include <cute/atom/copy_atom.hpp>
+
+#if !defined(CUTLASS_BENCHMARK_RANK)
+#define CUTLASS_BENCHMARK_RANK 2
+#endif
+
+#if !defined(CUTLASS_BENCHMARK_DEPTH)
+#define CUTLASS_BENCHMARK_DEPTH 2
+#endif
+
+namespace cutlass_benchmark {
+
+using namespace cute;
+
+constexpr int Rank  = CUTLASS_BENCHMARK_RANK;
+constexpr int Depth = CUTLASS_BENCHMARK_DEPTH;
+
+static_assert(Rank  >= 1, "CUTLASS_BENCHMARK_RANK must be positive");
+static_assert(Depth >= 1, "CUTLASS_BENCHMARK_DEPTH must be positive");
+
+/// A static mode of size 2^D nested D levels deep: (2,(2,(2,...)))
+template <int D>
+CUTE_HOST_DEVICE constexpr
+auto
+nested_mode()
+{
+  if constexpr (D == 1) {
+    return Int<2>{};
+  } else {
+    return make_shape(Int<2>{}, nested_mode<D-1>());
+  }
+}
+
+template <int D, size_t... I>
+CUTE_HOST_DEVICE constexpr
+auto
+nested_shape(index_sequence<I...>)
+{
+  return make_shape(((void)I, nested_mode<D>())...);
+}
+
+int
+instantiate_all()
+{
+  auto shape = nested_shape<Depth>(make_index_sequence<Rank>{});
+
+  auto col = make_layout(shape);                      // Compact column-major
+  auto row = make_layout(shape, LayoutRight{});       // Compact row-major: non-trivial strides
+
+  auto comp = composition(row, col);
+  auto div  = logical_divide(row, repeat<Rank>(Layout<_2>{}));
+  auto cmp  = complement(get<0>(row), size(row));
+  auto inv  = right_inverse(row);
+  auto linv = left_inverse(col);
+  auto coal = coalesce(comp);
+
+  auto copy = make_tiled_copy(Copy_Atom<UniversalCopy<uint32_t>, float>{},
+                              Layout<Shape<_32, Int<Rank>>>{},
+                              Layout<Shape<Int<Depth>, _4>>{});
+
+  return int(size(comp) + cosize(div) + size(cmp) + size(inv) + size(linv) + rank(coal) + size(copy));
+}
+
+} // namespace cutlass_benchmark
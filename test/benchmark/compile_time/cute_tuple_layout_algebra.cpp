@@ -0,0 +1,112 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Compile-time benchmark: cute::tuple access and representative CuTe layout algebra.
+
+    This translation unit is not executed. It is compiled by measure_compile_time.py, which
+    records the host compiler's wall time and peak memory, as a proxy for the metaprogramming
+    cost paid by every CuTe-based kernel.
+*/
+
+#include <cute/tensor.hpp>
+
+namespace cutlass_benchmark {
+
+using namespace cute;
+
+/// Element I of a tuple mixing static and dynamic elements
+template <size_t I>
+CUTE_HOST_DEVICE constexpr
+auto
+element()
+{
+  if constexpr (I % 3 == 0) {
+    return C<int(I + 1)>{};
+  } else {
+    return int(I + 1);
+  }
+}
+
+template <size_t... I>
+CUTE_HOST_DEVICE constexpr
+auto
+wide_tuple(index_sequence<I...>)
+{
+  return cute::make_tuple(element<I>()...);
+}
+
+template <class Tuple, size_t... I>
+CUTE_HOST_DEVICE constexpr
+int
+sum_elements(Tuple const& t, index_sequence<I...>)
+{
+  return (0 + ... + int(get<I>(t)));
+}
+
+/// Reads every element of a tuple of rank N
+template <size_t N>
+int
+tuple_access()
+{
+  auto t = wide_tuple(make_index_sequence<N>{});
+  return sum_elements(t, make_index_sequence<N>{});
+}
+
+/// Layout algebra on hierarchical layouts typical of SM90 mainloop and epilogue tiling
+template <int TileM, int TileN>
+auto
+layout_algebra(int m, int n)
+{
+  auto gmem   = make_layout(make_shape(m, make_shape(n, Int<4>{})), make_stride(Int<1>{}, make_stride(m, m * n)));
+  auto tile   = Shape<Int<TileM>, Int<TileN>>{};
+  auto smem   = composition(Swizzle<3,4,3>{}, Layout<Shape<_8,Shape<_8,_8>>, Stride<_8,Stride<_1,_64>>>{});
+  auto tiled  = logical_divide(gmem, tile);
+  auto zipped = zipped_divide(make_layout(make_shape(Int<TileM * 2>{}, Int<TileN * 2>{})), tile);
+  auto cmp    = complement(Layout<Shape<_4,_8>, Stride<_1,_16>>{}, Int<TileM * TileN>{});
+  auto inv    = right_inverse(Layout<Shape<Int<TileM>,Int<TileN>>, Stride<Int<TileN>,_1>>{});
+  auto prod   = blocked_product(Layout<Shape<_2,_2>>{}, Layout<Shape<Int<TileM/8>,Int<TileN/8>>>{});
+  auto comp   = composition(make_layout(make_shape(Int<TileM>{}, Int<TileN>{})), prod);
+  return cute::make_tuple(size(tiled), cosize(smem), size(zipped), cosize(cmp), size(inv), size(comp));
+}
+
+int
+instantiate_all(int m, int n)
+{
+  int result = tuple_access<4>() + tuple_access<8>() + tuple_access<16>() + tuple_access<32>();
+  result += int(get<0>(layout_algebra< 64,  64>(m, n)));
+  result += int(get<0>(layout_algebra<128,  64>(m, n)));
+  result += int(get<0>(layout_algebra<128, 128>(m, n)));
+  result += int(get<0>(layout_algebra<256, 128>(m, n)));
+  return result;
+}
+
+} // namespace cutlass_benchmark
@@ -0,0 +1,273 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+
+"""
+Measures the compiler's cost of compiling CUTLASS/CuTe translation units.
+
+Cases are given either as source files on the command line or by a suite file (see suite.json).
+A suite case names a source, optionally a CUDA architecture it requires, and optionally a matrix
+of preprocessor definitions; one case is compiled for every combination of the matrix values.
+Sources ending in .cu are compiled by --cuda-compiler and are skipped when it is not given or the
+case's architecture is not listed in --cuda-archs.
+
+Each case is compiled `--repeat` times as a separate process. The minimum wall time and the peak
+resident set size of the compiler and its subprocesses are reported. Unless --no-profile is given,
+the case is then compiled once more with the compiler's own profiling enabled to obtain template
+instantiation statistics:
+
+  - clang: -ftime-trace. Reports the number of class and function template instantiations and
+    the time spent in them. The trace JSON is kept in --trace-dir when given.
+  - gcc:   -ftime-report. Reports the wall time of the "template instantiation" phase only.
+  - nvcc:  not profiled; the instantiation columns are left empty.
+
+One CSV row is written per case. With --append, rows are appended to an existing report, and
+--label (e.g. a release tag) distinguishes the runs so that a report can be tracked over time.
+
+Example:
+    python measure_compile_time.py --compiler clang++ --flags="-std=c++17 -O0" \\
+        --include include --suite suite.json --label v4.0 --append --output report.csv
+"""
+
+import argparse
+import csv
+import itertools
+import json
+import os
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+
+FIELDS = ['label', 'case', 'compiler', 'wall_s', 'peak_rss_mib', 'instantiations', 'instantiation_s', 'repeat']
+
+
+def compile_once(command):
+    """
+    Runs `command` and returns (wall seconds, peak RSS in MiB, return code, stderr).
+    Peak RSS is reported as 0 on platforms without os.wait4.
+    """
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=subprocess.DEVNULL, stderr=subprocess.PIPE)
+    if not hasattr(os, 'wait4'):
+        _, stderr = process.communicate()
+        return time.perf_counter() - start, 0.0, process.returncode, stderr.decode(errors='replace')
+
+    # Drain stderr before waiting so that a verbose compiler cannot block on a full pipe
+    stderr = process.stderr.read().decode(errors='replace')
+    process.stderr.close()
+    # wait4 reports the resource usage of this child and the descendants it waited for (e.g. cc1plus),
+    # unlike getrusage(RUSAGE_CHILDREN), which accumulates over all children of this script
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    process.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+    # ru_maxrss is reported in KiB on Linux and in bytes on macOS
+    scale = 1.0 / (1024 * 1024) if sys.platform == 'darwin' else 1.0 / 1024
+    return elapsed, usage.ru_maxrss * scale, process.returncode, stderr
+
+
+def compiler_kind(compiler):
+    """Returns 'clang', 'gcc', 'nvcc' or 'unknown' based on the compiler's version banner."""
+    try:
+        banner = subprocess.run([compiler, '--version'], capture_output=True, text=True).stdout
+    except OSError:
+        return 'unknown'
+    if 'clang' in banner:
+        return 'clang'
+    if 'Cuda compiler driver' in banner or 'NVIDIA' in banner:
+        return 'nvcc'
+    if 'GCC' in banner or 'Free Software Foundation' in banner:
+        return 'gcc'
+    return 'unknown'
+
+
+def parse_clang_time_trace(path):
+    """Returns (instantiation count, instantiation seconds) from a clang -ftime-trace JSON file."""
+    with open(path) as f:
+        events = json.load(f).get('traceEvents', [])
+
+    # The "Total <event>" summaries are not subject to -ftime-trace-granularity
+    count, micros = 0, 0
+    for event in events:
+        if event.get('name') in ('Total InstantiateClass', 'Total InstantiateFunction'):
+            count += int(event.get('args', {}).get('count', 0))
+            micros += int(event.get('dur', 0))
+    return count, micros * 1e-6
+
+
+# " template instantiation : 1.98 ( 35%)   0.53 ( 28%)   2.49 ( 32%)   180M ( 43%)" (usr, sys, wall, GGC)
+_GCC_TEMPLATE_PHASE = re.compile(
+    r'^\s*template instantiation\s*:\s*[\d.]+\s*\(\s*\d+%\)\s*[\d.]+\s*\(\s*\d+%\)\s*([\d.]+)', re.MULTILINE)
+
+
+def parse_gcc_time_report(stderr):
+    """Returns the wall seconds of the template instantiation phase from gcc -ftime-report output."""
+    match = _GCC_TEMPLATE_PHASE.search(stderr)
+    return float(match.group(1)) if match else None
+
+
+def expand_suite(path, sources):
+    """Returns a list of cases (name, source, arch, defines) from a suite file and plain sources."""
+    cases = [(os.path.basename(s), s, None, {}) for s in sources]
+    if not path:
+        return cases
+
+    with open(path) as f:
+        suite = json.load(f)
+    root = os.path.dirname(os.path.abspath(path))
+    for entry in suite['cases']:
+        source = os.path.join(root, entry['source'])
+        matrix = entry.get('matrix', {})
+        names = list(matrix.keys())
+        for values in itertools.product(*(matrix[n] for n in names)):
+            defines = dict(zip(names, values))
+            name = os.path.basename(source)
+            if defines:
+                name += '[' + ','.join('{}={}'.format(n.replace('CUTLASS_BENCHMARK_', ''), v)
+                                       for n, v in defines.items()) + ']'
+            cases.append((name, source, entry.get('arch'), defines))
+    return cases
+
+
+def case_command(args, source, arch, defines, obj):
+    """Returns (compiler, command) for a case, or (None, reason) if the case cannot be compiled."""
+    command = ['-I' + d for d in args.include]
+    command += ['-D{}={}'.format(n, v) for n, v in defines.items()]
+    command += ['-c', source, '-o', obj]
+
+    if source.endswith('.cu'):
+        if not args.cuda_compiler:
+            return None, 'no CUDA compiler'
+        if arch and arch not in args.cuda_archs:
+            return None, 'sm_{} not enabled'.format(arch)
+        target = ['-gencode=arch=compute_{0},code=sm_{0}'.format(arch)] if arch else []
+        return args.cuda_compiler, [args.cuda_compiler] + shlex.split(args.cuda_flags) + target + command
+
+    return args.compiler, [args.compiler] + shlex.split(args.flags) + command
+
+
+def profile(kind, command, obj, trace_dir, name):
+    """Compiles once with profiling enabled. Returns (instantiations, instantiation seconds)."""
+    if kind == 'clang':
+        _, _, code, stderr = compile_once(command + ['-ftime-trace', '-ftime-trace-granularity=0'])
+        trace = os.path.splitext(obj)[0] + '.json'
+        if code != 0 or not os.path.exists(trace):
+            return None, None
+        if trace_dir:
+            os.makedirs(trace_dir, exist_ok=True)
+            shutil.copy(trace, os.path.join(trace_dir, re.sub(r'[^\w.=,-]', '_', name) + '.json'))
+        return parse_clang_time_trace(trace)
+
+    if kind == 'gcc':
+        _, _, code, stderr = compile_once(command + ['-ftime-report'])
+        return None, (parse_gcc_time_report(stderr) if code == 0 else None)
+
+    return None, None
+
+
+def measure(args):
+    cases = expand_suite(args.suite, args.sources)
+    if not cases:
+        raise RuntimeError('No sources or suite given')
+
+    kinds = {}
+    rows = []
+    with tempfile.TemporaryDirectory() as scratch:
+        for index, (name, source, arch, defines) in enumerate(cases):
+            obj = os.path.join(scratch, 'case{}.o'.format(index))
+            compiler, command = case_command(args, source, arch, defines, obj)
+            if compiler is None:
+                print('{:64} skipped ({})'.format(name, command))
+                continue
+
+            times, peaks = [], []
+            for _ in range(args.repeat):
+                elapsed, peak_mib, code, stderr = compile_once(command)
+                if code != 0:
+                    sys.stderr.write(stderr)
+                    raise RuntimeError('Compilation of {} failed with exit code {}'.format(name, code))
+                times.append(elapsed)
+                peaks.append(peak_mib)
+
+            instantiations, instantiation_s = None, None
+            if not args.no_profile:
+                kind = kinds.setdefault(compiler, compiler_kind(compiler))
+                instantiations, instantiation_s = profile(kind, command, obj, args.trace_dir, name)
+
+            row = {
+                'label': args.label,
+                'case': name,
+                'compiler': os.path.basename(compiler),
+                'wall_s': '{:.3f}'.format(min(times)),
+                'peak_rss_mib': '{:.1f}'.format(max(peaks)),
+                'instantiations': '' if instantiations is None else instantiations,
+                'instantiation_s': '' if instantiation_s is None else '{:.3f}'.format(instantiation_s),
+                'repeat': args.repeat,
+            }
+            rows.append(row)
+            print('{case:64} {wall_s:>9} s {peak_rss_mib:>9} MiB {instantiations:>9} inst {instantiation_s:>9} s'.format(**row))
+
+    if args.output:
+        append = args.append and os.path.exists(args.output) and os.path.getsize(args.output) > 0
+        with open(args.output, 'a' if append else 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=FIELDS)
+            if not append:
+                writer.writeheader()
+            writer.writerows(rows)
+    return rows
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('sources', nargs='*', help='Translation units to compile, in addition to the suite')
+    parser.add_argument('--suite', help='JSON suite file listing cases and their definition matrices')
+    parser.add_argument('--compiler', required=True, help='Host compiler executable')
+    parser.add_argument('--flags', default='-std=c++17 -O0', help='Host compiler flags, as a single string')
+    parser.add_argument('--cuda-compiler', help='CUDA compiler executable for .cu sources')
+    parser.add_argument('--cuda-flags', default='-std=c++17 --expt-relaxed-constexpr',
+                        help='CUDA compiler flags, as a single string')
+    parser.add_argument('--cuda-archs', nargs='*', default=[], help='Enabled CUDA architectures, e.g. 90a 100a')
+    parser.add_argument('--include', action='append', default=[], help='Include directory (repeatable)')
+    parser.add_argument('--repeat', type=int, default=3, help='Compilations per case; the minimum time is reported')
+    parser.add_argument('--no-profile', action='store_true', help='Do not collect template instantiation statistics')
+    parser.add_argument('--trace-dir', help='Directory in which to keep clang -ftime-trace files')
+    parser.add_argument('--label', default='', help='Label written to every row, e.g. a release tag')
+    parser.add_argument('--append', action='store_true', help='Append to --output instead of overwriting it')
+    parser.add_argument('--output', help='CSV file to write')
+    args = parser.parse_args()
+    if args.repeat < 1:
+        parser.error('--repeat must be at least 1')
+    measure(args)
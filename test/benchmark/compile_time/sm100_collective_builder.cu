@@ -0,0 +1,123 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Compile-time benchmark: SM100 collective builders and the GemmUniversal kernel they feed.
+
+    The configuration is selected by CUTLASS_BENCHMARK_TILE_N and CUTLASS_BENCHMARK_2SM. With
+    CUTLASS_BENCHMARK_2SM=1 the MMA tile is 256xN on a 2x1 cluster, otherwise 128xN on 1x1.
+    Taking the address of the device kernel forces it to be instantiated and compiled, as in a
+    generated library TU.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/arch/mma_sm100.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#if !defined(CUTLASS_BENCHMARK_TILE_N)
+#define CUTLASS_BENCHMARK_TILE_N 128
+#endif
+
+#if !defined(CUTLASS_BENCHMARK_2SM)
+#define CUTLASS_BENCHMARK_2SM 0
+#endif
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+namespace cutlass_benchmark {
+
+using namespace cute;
+
+using ElementA           = cutlass::float_e4m3_t;
+using LayoutA            = cutlass::layout::RowMajor;
+using ElementB           = cutlass::float_e4m3_t;
+using LayoutB            = cutlass::layout::ColumnMajor;
+using ElementC           = cutlass::bfloat16_t;
+using LayoutC            = cutlass::layout::RowMajor;
+using ElementAccumulator = float;
+
+using MmaTileShape = Shape<Int<CUTLASS_BENCHMARK_2SM != 0 ? 256 : 128>, Int<CUTLASS_BENCHMARK_TILE_N>, _128>;
+using ClusterShape = Shape<Int<CUTLASS_BENCHMARK_2SM != 0 ? 2 : 1>, _1, _1>;
+
+using KernelSchedule = cute::conditional_t<CUTLASS_BENCHMARK_2SM != 0,
+    cutlass::gemm::KernelTmaWarpSpecialized2SmSm100,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmSm100>;
+
+using EpilogueSchedule = cute::conditional_t<CUTLASS_BENCHMARK_2SM != 0,
+    cutlass::epilogue::TmaWarpSpecialized2Sm,
+    cutlass::epilogue::TmaWarpSpecialized1Sm>;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+    MmaTileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC, 8,
+    ElementC, LayoutC, 8,
+    EpilogueSchedule
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+    ElementA, LayoutA, 16,
+    ElementB, LayoutB, 16,
+    ElementAccumulator,
+    MmaTileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    KernelSchedule
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>,
+    CollectiveMainloop,
+    CollectiveEpilogue,
+    void>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+void const*
+instantiate_all()
+{
+  return reinterpret_cast<void const*>(&cutlass::device_kernel<GemmKernel>);
+}
+
+} // namespace cutlass_benchmark
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
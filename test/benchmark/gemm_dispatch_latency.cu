@@ -0,0 +1,348 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host microbenchmark for the latency of choosing among GemmUniversalAdapter instantiations.
+
+    Compares two ways of selecting one of several SM90 GEMMs for a stream of problems that vary in
+    size, operand layouts and pointer alignment: a hand-written ladder that builds the Arguments of
+    each candidate in turn and calls can_implement() until one accepts the problem, and a
+    GemmUniversalDispatcher that resolves the candidate from its declared predicates and then calls
+    can_implement() once. Reports the mean host time in ns per selection and checks that both pick
+    the same kernel. No kernel is launched, so no GPU is needed.
+
+    Example:
+
+      $ cutlass_benchmark_gemm_dispatch_latency --problems=4096 --iterations=200
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/device/gemm_universal_dispatcher.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/packed_stride.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+
+  bool help = false;
+  int problems = 4096;
+  int iterations = 200;
+  int seed = 2025;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("problems", problems, problems);
+    cmd.get_cmd_line_argument("iterations", iterations, iterations);
+    cmd.get_cmd_line_argument("seed", seed, seed);
+  }
+
+  std::ostream &print_usage(std::ostream &out) const {
+    out << "cutlass_benchmark_gemm_dispatch_latency\n\n"
+      << "  Times the host selection of a GEMM kernel with an if-ladder and with GemmUniversalDispatcher.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement.\n\n"
+      << "  --problems=<int>            Number of distinct problems selected for.\n\n"
+      << "  --iterations=<int>          Timed passes over the problems.\n\n"
+      << "  --seed=<int>                Seed of the random problems.\n\n";
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/// F16 GEMM with F32 accumulation and F16 output built by the collective builders
+template <
+  class LayoutA,
+  class LayoutB,
+  class TileShape,
+  class KernelSchedule,
+  class EpilogueSchedule
+>
+struct GemmConfig {
+  using ElementA = cutlass::half_t;
+  using ElementB = cutlass::half_t;
+  using ElementC = cutlass::half_t;
+  using LayoutC = cutlass::layout::ColumnMajor;
+  static constexpr int Alignment = 8;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, Shape<_1,_1,_1>,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementC, LayoutC, Alignment,
+      ElementC, LayoutC, Alignment,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      ElementA, LayoutA, Alignment,
+      ElementB, LayoutB, Alignment,
+      float,
+      TileShape, Shape<_1,_1,_1>,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+using RowMajor = cutlass::layout::RowMajor;
+using ColumnMajor = cutlass::layout::ColumnMajor;
+
+using GemmTN256x128 = GemmConfig<RowMajor, ColumnMajor, Shape<_256,_128,_64>,
+  cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+using GemmTN128x128 = GemmConfig<RowMajor, ColumnMajor, Shape<_128,_128,_64>,
+  cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+using GemmTN64x128 = GemmConfig<RowMajor, ColumnMajor, Shape<_64,_128,_64>,
+  cutlass::gemm::KernelTmaWarpSpecializedPingpong, cutlass::epilogue::TmaWarpSpecialized>::Gemm;
+using GemmNT128x128 = GemmConfig<ColumnMajor, RowMajor, Shape<_128,_128,_64>,
+  cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+using GemmNN128x128 = GemmConfig<ColumnMajor, ColumnMajor, Shape<_128,_128,_64>,
+  cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::epilogue::TmaWarpSpecializedCooperative>::Gemm;
+
+using cutlass::gemm::device::GemmDispatchCandidate;
+using cutlass::gemm::device::GemmDispatchDivisible;
+
+using Dispatcher = cutlass::gemm::device::GemmUniversalDispatcher<
+  GemmDispatchCandidate<GemmTN256x128, 8, 8, 8, 8, GemmDispatchDivisible::MN>,
+  GemmDispatchCandidate<GemmTN128x128, 8, 8, 8, 8, GemmDispatchDivisible::MN>,
+  GemmDispatchCandidate<GemmTN64x128, 8, 8, 8, 8>,
+  GemmDispatchCandidate<GemmNT128x128, 8, 8, 8, 8>,
+  GemmDispatchCandidate<GemmNN128x128, 8, 8, 8, 8>
+>;
+
+/// A problem as an application sees it: extents, layouts and operand pointers
+struct Workload {
+  int m, n, k, l;
+  bool k_major_a, k_major_b;
+  cutlass::half_t const *ptr_A;
+  cutlass::half_t const *ptr_B;
+  cutlass::half_t const *ptr_C;
+  cutlass::half_t *ptr_D;
+};
+
+template <class Gemm>
+typename Gemm::Arguments make_arguments(Workload const &w) {
+  using GemmKernel = typename Gemm::GemmKernel;
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(w.m, w.k, w.l));
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(w.n, w.k, w.l));
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, cute::make_shape(w.m, w.n, w.l));
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(w.m, w.n, w.l));
+  return typename Gemm::Arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {w.m, w.n, w.k, w.l},
+    {w.ptr_A, stride_A, w.ptr_B, stride_B},
+    {{1.0f, 0.0f}, w.ptr_C, stride_C, w.ptr_D, stride_D}
+  };
+}
+
+template <class Gemm>
+bool accepts(Workload const &w) {
+  return Gemm::can_implement(make_arguments<Gemm>(w)) == cutlass::Status::kSuccess;
+}
+
+/// The ladder GemmUniversalDispatcher replaces: returns the index of the selected candidate or -1
+int select_ladder(Workload const &w) {
+  // TMA needs 16B aligned base addresses, which can_implement() does not check
+  auto aligned = [](void const *ptr) { return reinterpret_cast<uintptr_t>(ptr) % 16 == 0; };
+  if (not (aligned(w.ptr_A) && aligned(w.ptr_B) && aligned(w.ptr_C) && aligned(w.ptr_D))) {
+    return -1;
+  }
+  if (w.k_major_a && w.k_major_b) {
+    if (w.m % 256 == 0 && w.n % 128 == 0 && accepts<GemmTN256x128>(w)) {
+      return 0;
+    }
+    if (w.m % 128 == 0 && w.n % 128 == 0 && accepts<GemmTN128x128>(w)) {
+      return 1;
+    }
+    if (accepts<GemmTN64x128>(w)) {
+      return 2;
+    }
+  }
+  else if (not w.k_major_a && not w.k_major_b) {
+    if (accepts<GemmNT128x128>(w)) {
+      return 3;
+    }
+  }
+  else if (not w.k_major_a && w.k_major_b) {
+    if (accepts<GemmNN128x128>(w)) {
+      return 4;
+    }
+  }
+  return -1;
+}
+
+/// Resolves the candidate from its predicates and confirms it with a single can_implement()
+int select_dispatcher(Workload const &w) {
+  using cutlass::gemm::device::gemm_dispatch_alignment;
+  cutlass::gemm::device::GemmDispatchProblem problem;
+  problem.m = w.m;
+  problem.n = w.n;
+  problem.k = w.k;
+  problem.l = w.l;
+  problem.k_major_a = w.k_major_a;
+  problem.k_major_b = w.k_major_b;
+  problem.alignment_a = gemm_dispatch_alignment<cutlass::half_t>(w.ptr_A, w.k_major_a ? w.k : w.m, int64_t(w.m) * w.k);
+  problem.alignment_b = gemm_dispatch_alignment<cutlass::half_t>(w.ptr_B, w.k_major_b ? w.k : w.n, int64_t(w.n) * w.k);
+  problem.alignment_c = gemm_dispatch_alignment<cutlass::half_t>(w.ptr_C, w.m, int64_t(w.m) * w.n);
+  problem.alignment_d = gemm_dispatch_alignment<cutlass::half_t>(w.ptr_D, w.m, int64_t(w.m) * w.n);
+
+  int selected = Dispatcher::select(problem);
+  if (selected == Dispatcher::kNotFound) {
+    return -1;
+  }
+  bool accepted = Dispatcher::visit(selected, [&](auto candidate) {
+    return accepts<typename decltype(candidate)::Gemm>(w);
+  });
+  return accepted ? selected : -1;
+}
+
+/// Returns the mean time in ns of selecting a kernel for one of the workloads
+template <class Select>
+double time_ns(std::vector<Workload> const &workloads, int iterations, std::vector<int> &selected, Select select) {
+  auto start = std::chrono::steady_clock::now();
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    for (size_t i = 0; i < workloads.size(); ++i) {
+      selected[i] = select(workloads[i]);
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() / (double(iterations) * workloads.size());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+  // Operand pointers refer to a host buffer; kernels are selected but never launched
+  alignas(256) static cutlass::half_t operands[4096];
+
+  std::mt19937 rng(options.seed);
+  std::uniform_int_distribution<int> tiles(1, 64);
+  std::uniform_int_distribution<int> extent(1, 8192);
+  std::uniform_int_distribution<int> choice(0, 7);
+
+  std::vector<Workload> workloads(options.problems);
+  for (Workload &w : workloads) {
+    // Mostly multiples of 64, some multiples of 8 and some unaligned extents
+    auto make_extent = [&]() {
+      int c = choice(rng);
+      return c < 5 ? 64 * tiles(rng) : (c < 7 ? 8 * (extent(rng) / 8 + 1) : extent(rng));
+    };
+    w.m = make_extent();
+    w.n = make_extent();
+    w.k = make_extent();
+    w.l = choice(rng) < 6 ? 1 : 2;
+    int layouts = choice(rng) & 3;
+    w.k_major_a = (layouts & 2) == 0;
+    w.k_major_b = layouts != 1;
+    int offset = choice(rng) == 0 ? 4 : 0;
+    w.ptr_A = operands + offset;
+    w.ptr_B = operands + 1024;
+    w.ptr_C = operands + 2048;
+    w.ptr_D = operands + 3072;
+  }
+
+  std::vector<int> ladder(workloads.size());
+  std::vector<int> dispatched(workloads.size());
+
+  double ladder_ns = time_ns(workloads, options.iterations, ladder, select_ladder);
+  double dispatcher_ns = time_ns(workloads, options.iterations, dispatched, select_dispatcher);
+
+  int unsupported = 0;
+  for (int selected : ladder) {
+    unsupported += selected < 0;
+  }
+  bool verified = ladder == dispatched;
+
+  std::cout << std::fixed << std::setprecision(1)
+    << std::setw(16) << "selection" << std::setw(14) << "ns/problem" << "\n"
+    << std::setw(16) << "if-ladder" << std::setw(14) << ladder_ns << "\n"
+    << std::setw(16) << "dispatcher" << std::setw(14) << dispatcher_ns << "\n\n"
+    << workloads.size() << " problems, " << unsupported << " without an applicable kernel, "
+    << "selections " << (verified ? "agree" : "DIFFER") << "\n";
+
+  return verified ? 0 : -1;
+
+#else
+
+  std::cout << "This benchmark requires a build with SM90 enabled.\n";
+  return 0;
+
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,327 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host microbenchmark for the per-call host overhead of GemmUniversalAdapter.
+
+    Kernels are compiled with CUTLASS_ENABLE_CUDA_HOST_ADAPTER so that workspace fills and launches
+    go through a RecordingCudaHostAdapter, and no GPU is needed. For representative SM90 and SM100
+    kernels, reports the mean host time in ns of GemmKernel::to_underlying_arguments(), and of
+    GemmUniversalAdapter::initialize(), update(), update_pointers() and the static run(params).
+    to_underlying_arguments() encodes every TMA descriptor, while the adapter methods reuse the
+    descriptors in its cache and only replace their addresses; update_pointers() alternates between
+    two sets of operand pointers. TMA descriptors are encoded through the CUDA driver entry point, so
+    the driver library must be installed. The recorded launch is checked against get_grid_shape().
+
+    Example:
+
+      $ cutlass_benchmark_gemm_host_overhead --m=256 --n=256 --k=1024 --l=1 --iterations=20000
+*/
+
+#define CUTLASS_ENABLE_CUDA_HOST_ADAPTER true
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/recording_cuda_host_adapter.hpp"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+
+  bool help = false;
+  int m = 256;
+  int n = 256;
+  int k = 1024;
+  int l = 1;
+  int sm_count = 132;
+  int iterations = 20000;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m, m);
+    cmd.get_cmd_line_argument("n", n, n);
+    cmd.get_cmd_line_argument("k", k, k);
+    cmd.get_cmd_line_argument("l", l, l);
+    cmd.get_cmd_line_argument("sm_count", sm_count, sm_count);
+    cmd.get_cmd_line_argument("iterations", iterations, iterations);
+  }
+
+  std::ostream &print_usage(std::ostream &out) const {
+    out << "cutlass_benchmark_gemm_host_overhead\n\n"
+      << "  Times the host side of GEMM initialization and launch through a recording host adapter.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement.\n\n"
+      << "  --m=<int>                   GEMM M extent.\n\n"
+      << "  --n=<int>                   GEMM N extent.\n\n"
+      << "  --k=<int>                   GEMM K extent.\n\n"
+      << "  --l=<int>                   Batch count.\n\n"
+      << "  --sm_count=<int>            SM count passed in KernelHardwareInfo (no device is queried).\n\n"
+      << "  --iterations=<int>          Timed repetitions per measurement.\n\n";
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the mean time in seconds of `iterations` calls to `fn`
+template <typename Fn>
+double time_s(int iterations, Fn fn) {
+  fn();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count() / iterations;
+}
+
+/// F16 TN GEMM with F32 accumulation and F16 output built by the collective builders
+template <
+  class ArchTag,
+  class TileShape,
+  class ClusterShape,
+  class KernelSchedule,
+  class EpilogueSchedule,
+  class TileScheduler = void
+>
+struct GemmConfig {
+  using ElementA = cutlass::half_t;
+  using LayoutA = cutlass::layout::RowMajor;
+  using ElementB = cutlass::half_t;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using ElementC = cutlass::half_t;
+  using LayoutC = cutlass::layout::ColumnMajor;
+  static constexpr int Alignment = 8;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      ArchTag, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementC, LayoutC, Alignment,
+      ElementC, LayoutC, Alignment,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      ArchTag, cutlass::arch::OpClassTensorOp,
+      ElementA, LayoutA, Alignment,
+      ElementB, LayoutB, Alignment,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      TileScheduler
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Times the host entry points of Config::Gemm. Operand pointers refer to a small host buffer:
+/// descriptors are encoded from them but no kernel ever dereferences them.
+template <class Config>
+bool run(std::string const &name, Options const &options,
+         dim3 cluster_shape = dim3(0, 0, 0), dim3 cluster_shape_fallback = dim3(0, 0, 0)) {
+
+  using Gemm = typename Config::Gemm;
+  using GemmKernel = typename Config::GemmKernel;
+
+  alignas(256) static uint8_t operands[8192];
+  auto *ptr_A = reinterpret_cast<typename Config::ElementA *>(operands);
+  auto *ptr_B = reinterpret_cast<typename Config::ElementB *>(operands + 1024);
+  auto *ptr_C = reinterpret_cast<typename Config::ElementC *>(operands + 2048);
+  auto *ptr_D = reinterpret_cast<typename Config::ElementC *>(operands + 3072);
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, cute::make_shape(options.m, options.k, options.l));
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, cute::make_shape(options.n, options.k, options.l));
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, cute::make_shape(options.m, options.n, options.l));
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, cute::make_shape(options.m, options.n, options.l));
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, options.k, options.l},
+    {ptr_A, stride_A, ptr_B, stride_B},
+    {{1.0f, 0.0f}, ptr_C, stride_C, ptr_D, stride_D}
+  };
+  arguments.hw_info.sm_count = options.sm_count;
+  arguments.hw_info.cluster_shape = cluster_shape;
+  arguments.hw_info.cluster_shape_fallback = cluster_shape_fallback;
+
+  typename Gemm::Arguments moved_arguments = arguments;
+  moved_arguments.mainloop.ptr_A = ptr_A + 2048;
+  moved_arguments.mainloop.ptr_B = ptr_B + 2048;
+  moved_arguments.epilogue.ptr_C = ptr_C + 2048;
+  moved_arguments.epilogue.ptr_D = ptr_D + 2048;
+
+  if (Gemm::can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cout << std::setw(16) << name << "  cannot implement the problem\n";
+    return false;
+  }
+
+  std::vector<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  void *workspace_ptr = workspace.empty() ? nullptr : workspace.data();
+
+  cutlass::RecordingCudaHostAdapter::Options adapter_options;
+  adapter_options.device_sms = options.sm_count;
+  adapter_options.record = false;
+  cutlass::RecordingCudaHostAdapter adapter(adapter_options);
+
+  Gemm gemm;
+
+  double to_underlying_s = time_s(options.iterations, [&]() {
+    auto params = GemmKernel::to_underlying_arguments(arguments, workspace_ptr);
+    (void)params;
+  });
+  double initialize_s = time_s(options.iterations, [&]() {
+    gemm.initialize(arguments, workspace_ptr, nullptr, &adapter);
+  });
+  double update_s = time_s(options.iterations, [&]() {
+    gemm.update(arguments, workspace_ptr);
+  });
+  int flip = 0;
+  double update_pointers_s = time_s(options.iterations, [&]() {
+    gemm.update_pointers((flip ^= 1) ? moved_arguments : arguments);
+  });
+  size_t const descriptor_misses = gemm.tma_descriptor_cache().misses();
+
+  auto params = gemm.params();
+  double run_s = time_s(options.iterations, [&]() {
+    Gemm::run(params, nullptr, &adapter);
+  });
+
+  // Check the launch a single initialize() and run() records, and that after the first call the
+  // descriptors came from the cache
+  cutlass::RecordingCudaHostAdapter::Options check_options;
+  check_options.device_sms = options.sm_count;
+  cutlass::RecordingCudaHostAdapter check(check_options);
+
+  bool verified =
+    gemm.initialize(arguments, workspace_ptr, nullptr, &check) == cutlass::Status::kSuccess &&
+    gemm.run(nullptr, &check) == cutlass::Status::kSuccess;
+
+  auto launches = check.launches();
+  dim3 grid = Gemm::get_grid_shape(gemm.params());
+  verified = verified && descriptor_misses == gemm.tma_descriptor_cache().size() &&
+    launches.size() == 1 &&
+    launches[0].grid_dims.x == grid.x &&
+    launches[0].grid_dims.y == grid.y &&
+    launches[0].grid_dims.z == grid.z &&
+    launches[0].block_dims.x == GemmKernel::get_block_shape().x &&
+    launches[0].smem_size == size_t(GemmKernel::SharedStorageSize);
+
+  std::cout << std::fixed << std::setprecision(1)
+    << std::setw(16) << name
+    << std::setw(14) << to_underlying_s * 1.0e9
+    << std::setw(14) << initialize_s * 1.0e9
+    << std::setw(14) << update_s * 1.0e9
+    << std::setw(14) << update_pointers_s * 1.0e9
+    << std::setw(14) << run_s * 1.0e9
+    << std::setw(12) << check.memset_count()
+    << std::setw(10) << (verified ? "yes" : "NO") << "\n";
+
+  return verified;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  std::cout
+    << std::setw(16) << "kernel" << std::setw(14) << "to_args_ns"
+    << std::setw(14) << "initialize_ns" << std::setw(14) << "update_ns" << std::setw(14) << "update_ptr_ns"
+    << std::setw(14) << "run_ns"
+    << std::setw(12) << "memsets" << std::setw(10) << "verified" << "\n";
+
+  bool passed = true;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  passed &= run<GemmConfig<cutlass::arch::Sm90, Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>>("sm90_coop_1x1", options);
+  passed &= run<GemmConfig<cutlass::arch::Sm90, Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>>("sm90_pingpong_2x1", options);
+  passed &= run<GemmConfig<cutlass::arch::Sm90, Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative,
+    cutlass::gemm::StreamKScheduler>>("sm90_streamk", options);
+#endif
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+  passed &= run<GemmConfig<cutlass::arch::Sm100, Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmSm100,
+    cutlass::epilogue::TmaWarpSpecialized1Sm>>("sm100_1sm_1x1", options);
+  passed &= run<GemmConfig<cutlass::arch::Sm100, Shape<_256,_128,_64>, Shape<int,int,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized2SmSm100,
+    cutlass::epilogue::TmaWarpSpecialized2Sm>>("sm100_2sm_dyn", options, dim3(4, 1, 1), dim3(2, 1, 1));
+#endif
+
+  return passed ? 0 : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
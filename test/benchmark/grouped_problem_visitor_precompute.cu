@@ -0,0 +1,231 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host microbenchmark for GroupScheduleMode::kHostPrecompute schedule generation.
+
+    Compares the tile-ordered serial construction of the grouped GEMM schedule against
+    GroupedProblemVisitor::host_precompute() run serially, across host threads, and as an
+    incremental update after a small change to the group.
+
+    Example:
+
+      $ cutlass_benchmark_grouped_problem_visitor_precompute --problems=1024,16384,131072 --blocks=264,1056
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/kernel/gemm_grouped_problem_visitor.h"
+
+#include "cutlass/util/command_line.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ProblemVisitor = cutlass::gemm::kernel::GemmGroupedProblemVisitor<
+                          cutlass::gemm::GemmShape<128, 128, 32>,
+                          cutlass::gemm::kernel::GroupScheduleMode::kHostPrecompute,
+                          128, 128, false>;
+
+using ProblemInfo = ProblemVisitor::ProblemInfo;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+
+  bool help = false;
+  std::vector<int> problems = {1024, 16384, 131072};
+  std::vector<int> blocks = {264, 1056};
+  int max_extent = 2048;
+  int iterations = 20;
+  int threads = 0;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    if (cmd.check_cmd_line_flag("problems")) {
+      cmd.get_cmd_line_arguments("problems", problems, ',');
+    }
+    if (cmd.check_cmd_line_flag("blocks")) {
+      cmd.get_cmd_line_arguments("blocks", blocks, ',');
+    }
+    cmd.get_cmd_line_argument("max-extent", max_extent, max_extent);
+    cmd.get_cmd_line_argument("iterations", iterations, iterations);
+    cmd.get_cmd_line_argument("threads", threads, threads);
+  }
+
+  std::ostream &print_usage(std::ostream &out) const {
+    out << "cutlass_benchmark_grouped_problem_visitor_precompute\n\n"
+      << "  Times host-side schedule generation for grouped GEMMs using GroupScheduleMode::kHostPrecompute.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement.\n\n"
+      << "  --problems=<int>[,<int>]    Numbers of problems in the group.\n\n"
+      << "  --blocks=<int>[,<int>]      Numbers of threadblocks launched.\n\n"
+      << "  --max-extent=<int>          Upper bound of the randomly chosen GEMM M and N extents.\n\n"
+      << "  --iterations=<int>          Timed repetitions per measurement.\n\n"
+      << "  --threads=<int>             Host threads for the parallel variants (0 = hardware concurrency).\n\n";
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tile-ordered serial construction of the schedule, writing entry `tile / B` of block `tile % B`
+void baseline_host_precompute(
+  cutlass::gemm::GemmCoord const *problem_sizes,
+  int32_t problem_count,
+  int32_t block_count,
+  ProblemInfo *schedule) {
+
+  int32_t total_tiles = ProblemVisitor::group_tile_count(problem_sizes, problem_count);
+  int32_t entries_per_block = (total_tiles - 1 + block_count) / block_count;
+
+  int32_t tile = 0;
+  for (int32_t p_idx = 0; p_idx < problem_count; ++p_idx) {
+    auto problem = problem_sizes[p_idx];
+    ProblemVisitor::possibly_transpose_problem(problem);
+    int32_t tiles = ProblemVisitor::tile_count(ProblemVisitor::grid_shape(problem));
+    ProblemInfo problem_info(p_idx, tile);
+    for (int32_t i = 0; i < tiles; ++i, ++tile) {
+      schedule[int64_t(entries_per_block) * (tile % block_count) + (tile / block_count)] = problem_info;
+    }
+  }
+}
+
+/// Returns the mean time in microseconds of `iterations` calls to `fn`
+template <typename Fn>
+double time_us(int iterations, Fn fn) {
+  fn();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(stop - start).count() / iterations;
+}
+
+bool same_schedule(std::vector<ProblemInfo> const &a, std::vector<ProblemInfo> const &b, int32_t total_tiles, int32_t block_count) {
+  int32_t entries_per_block = (total_tiles - 1 + block_count) / block_count;
+  for (int32_t tile = 0; tile < total_tiles; ++tile) {
+    size_t idx = size_t(entries_per_block) * (tile % block_count) + (tile / block_count);
+    if (a[idx].problem_idx != b[idx].problem_idx || a[idx].problem_start != b[idx].problem_start) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  std::cout
+    << std::setw(10) << "problems" << std::setw(8) << "blocks" << std::setw(12) << "tiles"
+    << std::setw(14) << "baseline_us" << std::setw(14) << "serial_us" << std::setw(14) << "parallel_us"
+    << std::setw(16) << "incremental_us" << std::setw(10) << "speedup" << std::setw(10) << "verified" << "\n";
+
+  bool passed = true;
+
+  for (int problem_count : options.problems) {
+    std::mt19937 generator(problem_count);
+    std::uniform_int_distribution<int> extent(1, options.max_extent);
+    std::vector<cutlass::gemm::GemmCoord> problem_sizes;
+    for (int i = 0; i < problem_count; ++i) {
+      problem_sizes.emplace_back(extent(generator), extent(generator), 256);
+    }
+
+    int32_t total_tiles = ProblemVisitor::group_tile_count(problem_sizes.data(), problem_count);
+
+    for (int block_count : options.blocks) {
+      size_t entries = ProblemVisitor::get_workspace_size(problem_sizes.data(), problem_count, block_count) / sizeof(ProblemInfo);
+      std::vector<ProblemInfo> baseline(entries);
+      std::vector<ProblemInfo> schedule(entries);
+
+      double baseline_us = time_us(options.iterations, [&]() {
+        baseline_host_precompute(problem_sizes.data(), problem_count, block_count, baseline.data());
+      });
+
+      double serial_us = time_us(options.iterations, [&]() {
+        ProblemVisitor::host_precompute(problem_sizes.data(), problem_count, block_count, schedule.data(), nullptr, 1);
+      });
+
+      double parallel_us = time_us(options.iterations, [&]() {
+        ProblemVisitor::host_precompute(problem_sizes.data(), problem_count, block_count, schedule.data(), nullptr, options.threads);
+      });
+
+      bool verified = same_schedule(baseline, schedule, total_tiles, block_count);
+
+      // Alternately reorder a handful of problems near the end of the group, as when a
+      // serving loop replaces its most recent requests between launches
+      ProblemVisitor::HostPrecomputeState state;
+      ProblemVisitor::host_precompute(problem_sizes.data(), problem_count, block_count, schedule.data(), &state, options.threads);
+      auto window = problem_sizes.end() - std::min(problem_count, 8);
+      double incremental_us = time_us(options.iterations, [&]() {
+        std::rotate(window, window + 1, problem_sizes.end());
+        ProblemVisitor::host_precompute(problem_sizes.data(), problem_count, block_count, schedule.data(), &state, options.threads);
+      });
+
+      baseline_host_precompute(problem_sizes.data(), problem_count, block_count, baseline.data());
+      verified = verified && same_schedule(baseline, schedule, total_tiles, block_count);
+      passed = passed && verified;
+
+      std::cout << std::fixed << std::setprecision(1)
+        << std::setw(10) << problem_count << std::setw(8) << block_count << std::setw(12) << total_tiles
+        << std::setw(14) << baseline_us << std::setw(14) << serial_us << std::setw(14) << parallel_us
+        << std::setw(16) << incremental_us
+        << std::setw(9) << std::setprecision(2) << baseline_us / std::min(serial_us, parallel_us) << "x"
+        << std::setw(10) << (verified ? "yes" : "NO") << "\n";
+    }
+  }
+
+  return passed ? 0 : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,206 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host microbenchmark for cutlass::HostStructuredSparseCompressor.
+
+    Compresses a 2:4 (1:2 for f32) structured sparse operand A with the legacy scalar host
+    compressor used as reference by the unit tests, and with HostStructuredSparseCompressor run
+    serially and across host threads, and reports the throughput in GB/s of A read.
+
+    Example:
+
+      $ cutlass_benchmark_sparse_gemm_compressor_throughput --m=8192 --k=8192 --l=1 --threads=0
+*/
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/atom/mma_traits_sm90_gmma.hpp"
+#include "cutlass/gemm/collective/builders/sm90_common.inl"
+#include "cutlass/gemm/collective/builders/sm90_sparse_config.inl"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/host_sparse_compressor.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../unit/transform/device/sm90_sparse_gemm_compressor_legacy.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+
+  bool help = false;
+  int m = 8192;
+  int k = 8192;
+  int l = 1;
+  int iterations = 3;
+  int threads = 0;
+  bool reference = true;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m, m);
+    cmd.get_cmd_line_argument("k", k, k);
+    cmd.get_cmd_line_argument("l", l, l);
+    cmd.get_cmd_line_argument("iterations", iterations, iterations);
+    cmd.get_cmd_line_argument("threads", threads, threads);
+    cmd.get_cmd_line_argument("reference", reference, reference);
+  }
+
+  std::ostream &print_usage(std::ostream &out) const {
+    out << "cutlass_benchmark_sparse_gemm_compressor_throughput\n\n"
+      << "  Times host-side compression of structured sparse GEMM operands.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement.\n\n"
+      << "  --m=<int>                   GEMM M extent of A.\n\n"
+      << "  --k=<int>                   GEMM K extent of A.\n\n"
+      << "  --l=<int>                   Batch count of A.\n\n"
+      << "  --iterations=<int>          Timed repetitions per measurement.\n\n"
+      << "  --threads=<int>             Host threads for the parallel variant (0 = hardware concurrency).\n\n"
+      << "  --reference=<bool>          Also time the legacy scalar compressor (slow on large operands).\n\n";
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the mean time in seconds of `iterations` calls to `fn`
+template <typename Fn>
+double time_s(int iterations, Fn fn) {
+  fn();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    fn();
+  }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count() / iterations;
+}
+
+template <class ElementA, class LayoutATag, class ElementEMma>
+bool run(std::string const &name, Options const &options) {
+
+  static constexpr cute::GMMA::Major GmmaMajorA = cutlass::gemm::collective::detail::gmma_rs_tag_to_major_A<LayoutATag>();
+  using SparseConfig = cutlass::Sm90GemmSparseConfig<cute::sparse_elem<2, ElementA>, GmmaMajorA, ElementEMma, cute::Int<128>>;
+  using ProblemShape = cute::Shape<int, int, int, int>;
+  using Compressor = cutlass::HostStructuredSparseCompressor<ProblemShape, ElementA, LayoutATag, SparseConfig>;
+  using Reference = cutlass::transform::kernel::SM90StructuredSparseCompressorLegacy<ProblemShape, ElementA, LayoutATag, SparseConfig>;
+  using ElementAUint = cute::uint_bit_t<cute::sizeof_bits_v<ElementA>>;
+
+  ProblemShape problem{options.m, 1, options.k, options.l};
+  auto dA = cutlass::make_cute_packed_stride(typename Compressor::StrideA{}, cute::make_shape(options.m, options.k, options.l));
+  typename Compressor::Utility utility(problem, dA);
+
+  std::vector<ElementAUint> A(size_t(options.m) * options.k * options.l);
+  std::mt19937 rng(options.m);
+  std::uniform_int_distribution<uint64_t> bits;
+  for (auto &a : A) {
+    a = ElementAUint(bits(rng) | 1);
+  }
+  utility.structure_sparse_zero_mask_fill(A.data(), 2025);
+
+  std::vector<uint8_t> AC(utility.get_compressed_tensor_A_bytes());
+  std::vector<uint8_t> E(utility.get_tensor_E_bytes());
+  std::vector<uint8_t> AC_ref(AC.size());
+  std::vector<uint8_t> E_ref(E.size());
+
+  double gigabytes = double(A.size() * sizeof(ElementAUint)) / 1.0e9;
+
+  double reference_s = 0;
+  if (options.reference) {
+    typename Reference::Arguments args{problem,
+      {reinterpret_cast<ElementA const*>(A.data()), dA, reinterpret_cast<ElementA*>(AC_ref.data()), E_ref.data()}, {}};
+    std::vector<uint8_t> workspace(Reference::get_workspace_size(args));
+    auto params = Reference::to_underlying_arguments(args, workspace.data());
+    reference_s = time_s(options.iterations, [&]() { Reference::run(params); });
+  }
+
+  Compressor serial(problem, 1);
+  double serial_s = time_s(options.iterations, [&]() {
+    serial.compress(A.data(), dA, AC.data(), E.data());
+  });
+  bool verified = !options.reference || (AC == AC_ref && E == E_ref);
+
+  Compressor parallel(problem, options.threads);
+  std::fill(AC.begin(), AC.end(), uint8_t(0xA5));
+  double parallel_s = time_s(options.iterations, [&]() {
+    parallel.compress(A.data(), dA, AC.data(), E.data());
+  });
+  verified = verified && (!options.reference || (AC == AC_ref && E == E_ref));
+
+  std::cout << std::fixed << std::setprecision(2)
+    << std::setw(10) << name << std::setw(12) << gigabytes
+    << std::setw(14) << (options.reference ? gigabytes / reference_s : 0.0)
+    << std::setw(14) << gigabytes / serial_s
+    << std::setw(14) << gigabytes / parallel_s
+    << std::setw(10) << (options.reference ? (verified ? "yes" : "NO") : "-") << "\n";
+
+  return verified;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  std::cout
+    << std::setw(10) << "operand" << std::setw(12) << "A_GB"
+    << std::setw(14) << "legacy_GB/s" << std::setw(14) << "serial_GB/s" << std::setw(14) << "parallel_GB/s"
+    << std::setw(10) << "verified" << "\n";
+
+  bool passed = true;
+  passed &= run<cutlass::half_t, cutlass::layout::RowMajor, cute::sparse_elem<8, uint8_t>>("f16_t", options);
+  passed &= run<cutlass::half_t, cutlass::layout::ColumnMajor, cute::sparse_elem<8, uint8_t>>("f16_n", options);
+  passed &= run<cutlass::float_e4m3_t, cutlass::layout::RowMajor, cute::sparse_elem<8, uint8_t>>("e4m3_t", options);
+  passed &= run<float, cutlass::layout::RowMajor, cute::sparse_elem<4, uint8_t>>("f32_t", options);
+
+  return passed ? 0 : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
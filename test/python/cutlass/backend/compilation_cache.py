@@ -0,0 +1,177 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests of the on-disk compilation cache, using a stub compiler
+"""
+
+import multiprocessing
+import os
+import tempfile
+import threading
+import time
+import unittest
+
+from cutlass_cppgen.backend.compilation_cache import CompilationCache, content_key
+
+
+_calls = []
+_calls_lock = threading.Lock()
+
+
+def stub_compile(source):
+    """
+    Stub compiler: the artifact is derived from the source, and sources containing "error" fail
+    """
+    with _calls_lock:
+        _calls.append(source)
+    time.sleep(0.05)
+    if "error" in source:
+        raise RuntimeError(f"Failed to compile {source}")
+    return {"cubin": source.encode(), "hostbin": source[::-1].encode()}
+
+
+def store_repeatedly(directory, key, count):
+    cache = CompilationCache(directory)
+    for _ in range(count):
+        cache.store(key, stub_compile("shared kernel"))
+
+
+class CompilationCacheTest(unittest.TestCase):
+    def setUp(self):
+        self.directory = tempfile.TemporaryDirectory()
+        _calls.clear()
+
+    def tearDown(self):
+        self.directory.cleanup()
+
+    def jobs(self, sources, flags="-O3"):
+        return {content_key(source, flags, 90, "nvcc 12.8"): source for source in sources}
+
+    def test_content_key(self):
+        self.assertEqual(content_key("a", "-O3", 90), content_key("a", "-O3", 90))
+        self.assertNotEqual(content_key("a", "-O3", 90), content_key("a", "-O3", 100))
+        self.assertNotEqual(content_key("ab", "c"), content_key("a", "bc"))
+
+    def test_hits_and_misses(self):
+        cache = CompilationCache(self.directory.name)
+        jobs = self.jobs([f"kernel {i}" for i in range(4)])
+
+        artifacts = cache.get_or_compile(jobs, stub_compile)
+        self.assertEqual(len(_calls), 4)
+        self.assertEqual((cache.stats.hits, cache.stats.misses), (0, 4))
+        self.assertGreater(cache.stats.compile_time, 0)
+        for key, source in jobs.items():
+            self.assertEqual(artifacts[key], {"cubin": source.encode(), "hostbin": source[::-1].encode()})
+            self.assertTrue(os.path.isfile(os.path.join(self.directory.name, key[:2], key)))
+
+        # A new cache on the same directory, e.g. in another process, hits every entry
+        cache = CompilationCache(self.directory.name)
+        self.assertEqual(cache.get_or_compile(jobs, stub_compile), artifacts)
+        self.assertEqual(len(_calls), 4)
+        self.assertEqual((cache.stats.hits, cache.stats.misses), (4, 0))
+
+        # Different flags change the key
+        cache.get_or_compile(self.jobs(["kernel 0"], flags="-O2"), stub_compile)
+        self.assertEqual((cache.stats.hits, cache.stats.misses), (4, 1))
+
+        # Bypassing the cache recompiles
+        cache.get_or_compile(jobs, stub_compile, bypass=True)
+        self.assertEqual(len(_calls), 9)
+
+    def test_concurrent_compilation(self):
+        cache = CompilationCache(self.directory.name, max_workers=8)
+        jobs = self.jobs([f"kernel {i}" for i in range(16)])
+
+        start = time.perf_counter()
+        artifacts = cache.get_or_compile(jobs, stub_compile)
+        elapsed = time.perf_counter() - start
+
+        self.assertEqual(len(artifacts), 16)
+        self.assertEqual(sorted(_calls), sorted(jobs.values()))
+        # 16 compilations of 50 ms on 8 workers
+        self.assertLess(elapsed, 16 * 0.05)
+
+    def test_process_workers(self):
+        cache = CompilationCache(self.directory.name, max_workers=2, use_processes=True)
+        jobs = self.jobs(["kernel 0", "kernel 1"])
+        artifacts = cache.get_or_compile(jobs, stub_compile)
+        for key, source in jobs.items():
+            self.assertEqual(artifacts[key]["cubin"], source.encode())
+
+    def test_failed_compilation(self):
+        cache = CompilationCache(self.directory.name, max_workers=4)
+        jobs = self.jobs(["kernel 0", "kernel error", "kernel 1"])
+        with self.assertRaises(RuntimeError):
+            cache.get_or_compile(jobs, stub_compile)
+
+        # Successful compilations are kept
+        _calls.clear()
+        with self.assertRaises(RuntimeError):
+            cache.get_or_compile(jobs, stub_compile)
+        self.assertEqual(_calls, ["kernel error"])
+
+    def test_incomplete_entry(self):
+        cache = CompilationCache(self.directory.name)
+        key, = self.jobs(["kernel 0"]).keys()
+        cache.store(key, stub_compile("kernel 0"))
+
+        with open(cache.path(key), "rb") as file:
+            data = file.read()
+        with open(cache.path(key), "wb") as file:
+            file.write(data[:-1])
+        self.assertIsNone(cache.load(key))
+
+        cache.get_or_compile({key: "kernel 0"}, stub_compile)
+        self.assertEqual(cache.load(key)["cubin"], b"kernel 0")
+
+    def test_concurrent_writers(self):
+        key = content_key("shared kernel")
+        context = multiprocessing.get_context("spawn")
+        writers = [context.Process(target=store_repeatedly, args=(self.directory.name, key, 20)) for _ in range(4)]
+        for writer in writers:
+            writer.start()
+        cache = CompilationCache(self.directory.name)
+        while any(writer.is_alive() for writer in writers):
+            artifact = cache.load(key)
+            self.assertIn(artifact, [None, {"cubin": b"shared kernel", "hostbin": b"lenrek derahs"}])
+        for writer in writers:
+            writer.join()
+            self.assertEqual(writer.exitcode, 0)
+
+        self.assertEqual(cache.load(key)["hostbin"], b"lenrek derahs")
+        # Only the entry remains: no temporary files are left behind
+        self.assertEqual(os.listdir(os.path.dirname(cache.path(key))), [key])
+
+
+if __name__ == '__main__':
+    unittest.main()
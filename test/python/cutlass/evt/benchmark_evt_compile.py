@@ -0,0 +1,135 @@
+################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+"""
+Benchmark of the EVT compile latency on the host: tracing (parsing and DAG IR passes) and
+emission of the fusion callbacks, with and without the pass cache.
+
+The workload mimics a kernel generator: each epilogue variant (function, data types and problem
+shape) is traced once per candidate kernel configuration, so structurally identical DAGs are traced
+repeatedly. No GPU is required.
+
+  $ PYTHONPATH=python python test/python/cutlass/evt/benchmark_evt_compile.py --repeat 8
+"""
+
+import argparse
+import itertools
+import time
+
+import numpy as np
+
+from cutlass_cppgen.backend.evt.backend.emitter_base import FusionCallbacks
+from cutlass_cppgen.backend.evt.passes import pass_cache
+from cutlass_cppgen.epilogue import relu, sigmoid, tanh, trace
+
+
+def linear_combination(accum, C, alpha, beta):
+    D = alpha * accum + beta * C
+    return D
+
+
+def bias_relu(accum, C, alpha, beta, bias):
+    D = relu(alpha * accum + beta * C + bias)
+    return D
+
+
+def bias_sigmoid_aux(accum, C, alpha, beta, bias):
+    F = alpha * accum + beta * C + bias
+    D = sigmoid(F)
+    return D, F
+
+
+def gated(accum, C, alpha, beta, aux):
+    F = alpha * accum + beta * C
+    D = relu(F) * tanh(F) + aux * F
+    return D, F
+
+
+def variants(cc):
+    dtypes = [np.float16, np.float32]
+    shapes = [(1, 256, 256), (2, 512, 128)]
+    for fn, element, shape in itertools.product(
+            [linear_combination, bias_relu, bias_sigmoid_aux, gated], dtypes, shapes):
+        l, m, n = shape
+        example_inputs = {
+            "accum": np.zeros(shape, np.float32),
+            "C": np.zeros(shape, element),
+            "alpha": 1.0,
+            "beta": 0.5,
+            "bias": np.zeros((m, 1), element),
+            "aux": np.zeros(shape, element),
+            "D": np.zeros(shape, element),
+            "F": np.zeros(shape, element),
+        }
+        args = fn.__code__.co_varnames[:fn.__code__.co_argcount]
+        outputs = ["D", "F"] if fn in [bias_sigmoid_aux, gated] else ["D"]
+        yield fn, {key: value for key, value in example_inputs.items() if key in args or key in outputs}
+
+
+def time_trace(cc, repeat, cache_size):
+    pass_cache.max_size = cache_size
+    pass_cache.clear()
+    workload = list(variants(cc))
+    start = time.perf_counter()
+    traced = []
+    for _ in range(repeat):
+        traced = [trace(fn, example_inputs, cc=cc) for fn, example_inputs in workload]
+    return time.perf_counter() - start, traced
+
+
+def time_emit(cc, traced, repeat):
+    start = time.perf_counter()
+    aliases = 0
+    for _ in range(repeat):
+        for epilogue in traced:
+            callbacks = FusionCallbacks(epilogue.dag_ir, cc, emit_CD=(cc < 90))
+            callbacks.emit()
+            aliases += len(callbacks.aliases)
+    return time.perf_counter() - start, aliases // repeat
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--repeat", default=8, type=int, help="Traces of each epilogue variant")
+    parser.add_argument("--cc", default=90, type=int, help="Compute capability to trace for")
+    args = parser.parse_args()
+
+    cold, _ = time_trace(args.cc, args.repeat, 0)
+    memoized, traced = time_trace(args.cc, args.repeat, 256)
+    count = len(traced) * args.repeat
+    print(f"EVT trace, SM{args.cc}, {len(traced)} variants x {args.repeat} traces")
+    print(f"  uncached: {cold:8.3f} s  ({1e3 * cold / count:.2f} ms/trace)")
+    print(f"  memoized: {memoized:8.3f} s  ({1e3 * memoized / count:.2f} ms/trace, {cold / memoized:.1f}x)")
+    print(f"    pass cache {pass_cache}")
+
+    emit, aliases = time_emit(args.cc, traced, args.repeat)
+    print(f"Fusion callbacks emission: {1e3 * emit / count:.2f} ms/epilogue, "
+          f"{aliases} visitor declarations aliased over {len(traced)} epilogues")
@@ -0,0 +1,265 @@
+################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#
+################################################################################
+
+"""
+Unittest of the structural hash of the DAG IR, the pass cache and the alias deduplication of the
+fusion callbacks emitter. These tests only run on the host: no GPU is required.
+"""
+
+import copy
+import unittest
+
+import numpy as np
+
+from cutlass_cppgen.backend.evt.backend.emitter_base import FusionCallbacks
+from cutlass_cppgen.backend.evt.frontend.python_ast import PythonASTFrontend
+from cutlass_cppgen.backend.evt.ir.node import freeze
+from cutlass_cppgen.backend.evt.passes import pass_cache
+from cutlass_cppgen.epilogue import relu, trace
+
+import benchmark_evt_compile
+
+
+SHAPE = (1, 256, 256)
+
+
+def example_inputs(element_C=np.float16, **scalars):
+    inputs = {
+        "accum": np.zeros(SHAPE, np.float32),
+        "C": np.zeros(SHAPE, element_C),
+        "D": np.zeros(SHAPE, np.float16),
+    }
+    inputs.update(scalars)
+    return inputs
+
+
+def parse(fn, inputs, cc):
+    """
+    Build the DAG IR of ``fn`` without running the passes
+    """
+    class EpilogueFunctor(PythonASTFrontend):
+        pass
+    setattr(EpilogueFunctor, "__call__", staticmethod(fn))
+    frontend = EpilogueFunctor(cc)
+    frontend.parse(inputs)
+    return frontend.dag_ir
+
+
+def linear_combination(accum, C, alpha, beta):
+    D = alpha * accum + beta * C
+    return D
+
+
+def linear_combination_gamma(accum, C, gamma, beta):
+    D = gamma * accum + beta * C
+    return D
+
+
+def scale_2(accum, C):
+    D = relu(accum * 2.0 + C)
+    return D
+
+
+def scale_3(accum, C):
+    D = relu(accum * 3.0 + C)
+    return D
+
+
+def accum_minus_C(accum, C):
+    D = accum - C
+    return D
+
+
+def C_minus_accum(accum, C):
+    D = C - accum
+    return D
+
+
+class TestEVTStructuralHash(unittest.TestCase):
+
+    def assertSameHash(self, lhs, rhs, with_names=True):
+        self.assertEqual(lhs.structural_hash(with_names), rhs.structural_hash(with_names))
+
+    def assertDifferentHash(self, lhs, rhs, with_names=True):
+        self.assertNotEqual(lhs.structural_hash(with_names), rhs.structural_hash(with_names))
+
+    def test_identical(self):
+        for cc in [80, 90]:
+            inputs = example_inputs(alpha=1.0, beta=0.5)
+            self.assertSameHash(parse(linear_combination, inputs, cc), parse(linear_combination, inputs, cc))
+
+    def test_scalar_values(self):
+        """
+        Scalar arguments are runtime values: their example values are not part of the structure
+        """
+        lhs = parse(linear_combination, example_inputs(alpha=1.0, beta=0.5), 90)
+        rhs = parse(linear_combination, example_inputs(alpha=2.0, beta=0.0), 90)
+        self.assertSameHash(lhs, rhs)
+
+    def test_constant(self):
+        lhs = parse(scale_2, example_inputs(), 90)
+        rhs = parse(scale_3, example_inputs(), 90)
+        self.assertDifferentHash(lhs, rhs)
+        self.assertDifferentHash(lhs, rhs, with_names=False)
+
+    def test_names(self):
+        lhs = parse(linear_combination, example_inputs(alpha=1.0, beta=0.5), 90)
+        rhs = parse(linear_combination_gamma, example_inputs(gamma=1.0, beta=0.5), 90)
+        self.assertDifferentHash(lhs, rhs)
+        self.assertSameHash(lhs, rhs, with_names=False)
+
+    def test_edge_weights(self):
+        """
+        Operands of non-commutative ops are ordered by the edge weights
+        """
+        lhs = parse(accum_minus_C, example_inputs(), 90)
+        rhs = parse(C_minus_accum, example_inputs(), 90)
+        self.assertDifferentHash(lhs, rhs)
+        self.assertDifferentHash(lhs, rhs, with_names=False)
+
+    def test_element_types(self):
+        lhs = parse(linear_combination, example_inputs(np.float16, alpha=1.0, beta=0.5), 90)
+        rhs = parse(linear_combination, example_inputs(np.float32, alpha=1.0, beta=0.5), 90)
+        self.assertDifferentHash(lhs, rhs)
+        self.assertDifferentHash(lhs, rhs, with_names=False)
+
+    def test_compute_capability(self):
+        inputs = example_inputs(alpha=1.0, beta=0.5)
+        self.assertDifferentHash(parse(linear_combination, inputs, 80), parse(linear_combination, inputs, 90))
+
+
+class TestEVTFreeze(unittest.TestCase):
+
+    def test_closure(self):
+        def make(scale):
+            return lambda x: x * scale
+        self.assertEqual(freeze(make(2.0)), freeze(make(2.0)))
+        self.assertNotEqual(freeze(make(2.0)), freeze(make(3.0)))
+
+    def test_defaults(self):
+        def make(scale):
+            def fn(x, scale=scale):
+                return x * scale
+            return fn
+        self.assertEqual(freeze(make(2.0)), freeze(make(2.0)))
+        self.assertNotEqual(freeze(make(2.0)), freeze(make(3.0)))
+
+    def test_recursive_closure(self):
+        def make(depth):
+            def fn(x):
+                return fn(x - 1) if x > depth else x
+            return fn
+        self.assertEqual(freeze(make(1)), freeze(make(1)))
+        self.assertNotEqual(freeze(make(1)), freeze(make(2)))
+
+
+class TestEVTPassCache(unittest.TestCase):
+
+    def setUp(self):
+        self.max_size = pass_cache.max_size
+        pass_cache.clear()
+
+    def tearDown(self):
+        pass_cache.max_size = self.max_size
+        pass_cache.clear()
+
+    def emit(self, fn, inputs, cc):
+        epilogue = trace(fn, inputs, cc=cc)
+        return FusionCallbacks(epilogue.dag_ir, cc, emit_CD=(cc < 90)).emit()
+
+    def test_cache_hit_emission(self):
+        """
+        The fusion callbacks emitted from a cache hit are identical to those of a cold trace
+        """
+        for cc in [80, 90]:
+            for fn, inputs in benchmark_evt_compile.variants(cc):
+                pass_cache.max_size = 0
+                cold = self.emit(fn, inputs, cc)
+
+                pass_cache.max_size = 256
+                pass_cache.clear()
+                self.assertEqual(self.emit(fn, inputs, cc), cold)
+                self.assertEqual(pass_cache.misses, 1)
+                self.assertEqual(self.emit(fn, inputs, cc), cold)
+                self.assertEqual(pass_cache.hits, 1)
+
+    def test_cache_hit_is_isolated(self):
+        """
+        Modifying the node metas of a restored DAG IR does not affect the cached entry
+        """
+        pass_cache.max_size = 256
+        inputs = example_inputs(alpha=1.0, beta=0.5)
+        cold = self.emit(linear_combination, inputs, 90)
+
+        epilogue = trace(linear_combination, inputs, cc=90)
+        self.assertEqual(pass_cache.hits, 1)
+        for meta in epilogue.dag_ir.nodes_meta:
+            meta.name = meta.name + "_renamed"
+
+        self.assertEqual(self.emit(linear_combination, inputs, 90), cold)
+        self.assertEqual(pass_cache.hits, 2)
+
+    def test_benchmark(self):
+        """
+        Smoke test of the compile latency benchmark
+        """
+        for cc in [80, 90]:
+            _, traced = benchmark_evt_compile.time_trace(cc, 2, 256)
+            self.assertGreater(pass_cache.hits, 0)
+            _, aliases = benchmark_evt_compile.time_emit(cc, traced, 1)
+            self.assertGreater(aliases, 0)
+
+
+class TestEVTAliases(unittest.TestCase):
+
+    def test_linear_combination(self):
+        """
+        Structurally identical visitors are declared once and aliased: beta broadcasts a scalar
+        like alpha, and both products use the same compute node
+        """
+        for cc in [80, 90]:
+            epilogue = trace(linear_combination, example_inputs(alpha=1.0, beta=0.5), cc=cc)
+            callbacks = FusionCallbacks(epilogue.dag_ir, cc, emit_CD=(cc < 90))
+            code, _ = callbacks.emit()
+            self.assertEqual(callbacks.aliases, {"Beta": "Alpha", "Compute1": "Compute0"})
+            self.assertIn("using Beta = Alpha;", code)
+            self.assertIn("using Compute1 = Compute0;", code)
+            self.assertEqual(code.count("using Alpha = "), 1)
+            self.assertEqual(code.count("using Compute0 = "), 1)
+            # Aliased visitors are referenced by their canonical name
+            self.assertNotIn("    Beta", code)
+            self.assertNotIn("    Compute1,", code)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,126 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Benchmark of the pycute layout algebra: memoized vs. uncached evaluation, and batched vs.
+per-element crd2idx/idx2crd.
+
+The algebra workload mimics a tile search: every tile in a set of candidates is divided into every
+problem layout, and the resulting layouts are inverted and coalesced. Each pass evaluates the same
+set of operations, as a generator calling the algebra repeatedly does.
+
+  $ PYTHONPATH=python python test/python/pycute/benchmark_layout_algebra.py --repeat 10
+"""
+
+import argparse
+import itertools
+import time
+
+from pycute import *
+
+
+def problem_layouts():
+  layouts = []
+  for m, n in itertools.product([64, 128, 256], [64, 128, 256]):
+    layouts.append(Layout((m,n), (1,m)))        # column-major
+    layouts.append(Layout((m,n), (n,1)))        # row-major
+    layouts.append(Layout(((8,m//8),n), ((1,8*n),8)))
+  return layouts
+
+
+def tiles():
+  return [(Layout(tm), Layout(tn)) for tm, tn in itertools.product([8, 16, 32, 64], [8, 16, 32, 64])]
+
+
+def algebra_pass(layouts, tilers):
+  count = 0
+  for layout in layouts:
+    for tiler in tilers:
+      divided = zipped_divide(layout, tiler)
+      count += size(right_inverse(coalesce(divided[0])))
+      count += size(composition(layout, tiler))
+      count += size(complement(coalesce(layout[0]), size(layout)))
+  return count
+
+
+def time_algebra(repeat, cache_size):
+  set_cache_size(cache_size)
+  clear_cache()
+  layouts, tilers = problem_layouts(), tiles()
+  start = time.perf_counter()
+  for _ in range(repeat):
+    algebra_pass(layouts, tilers)
+  return time.perf_counter() - start
+
+
+def time_evaluation(layout):
+  import numpy as np
+
+  n = size(layout)
+  start = time.perf_counter()
+  expected = [layout(i) for i in range(n)]
+  crds = [idx2crd(i, layout.shape) for i in range(n)]
+  scalar = time.perf_counter() - start
+
+  start = time.perf_counter()
+  idx = np.arange(n)
+  result = crd2idx_batch(idx2crd_batch(idx, layout.shape), layout.shape, layout.stride)
+  batched = time.perf_counter() - start
+
+  assert result.tolist() == expected and len(crds) == n
+  return scalar, batched
+
+
+if __name__ == "__main__":
+  parser = argparse.ArgumentParser()
+  parser.add_argument("--repeat", default=10, type=int, help="Passes over the algebra workload")
+  args = parser.parse_args()
+
+  uncached = time_algebra(args.repeat, 0)
+  cached = time_algebra(args.repeat, 1 << 16)
+  print(f"Layout algebra, {args.repeat} passes")
+  print(f"  uncached: {uncached:8.3f} s")
+  print(f"  memoized: {cached:8.3f} s  ({uncached / cached:.1f}x)")
+  for name, info in sorted(cache_info().items()):
+    if info.hits + info.misses:
+      print(f"    {name:16} hits {info.hits:8}  misses {info.misses:6}")
+
+  try:
+    import numpy
+  except ImportError:
+    print("NumPy is not installed: skipping crd2idx_batch/idx2crd_batch")
+  else:
+    layout = Layout(((8,16),(16,32)), ((1,8*16*32),(8,32)))
+    scalar, batched = time_evaluation(layout)
+    print(f"crd2idx/idx2crd over {size(layout)} coordinates of {layout}")
+    print(f"  per element: {scalar:8.3f} s")
+    print(f"  batched:     {batched:8.3f} s  ({scalar / batched:.1f}x)")
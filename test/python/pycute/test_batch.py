@@ -0,0 +1,87 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Unit tests for the batched pycute.crd2idx_batch and pycute.idx2crd_batch
+"""
+
+import logging
+import unittest
+
+from pycute import *
+
+try:
+  import numpy as np
+except ImportError:
+  np = None
+
+_LOGGER = logging.getLogger(__name__)
+
+
+@unittest.skipIf(np is None, "NumPy is not installed")
+class TestBatch(unittest.TestCase):
+  def helper_test_batch(self, layout):
+    _LOGGER.debug(f"{layout}")
+
+    idx = np.arange(size(layout)).reshape(-1, 2) if size(layout) % 2 == 0 else np.arange(size(layout))
+
+    crd = idx2crd_batch(idx, layout.shape)
+    self.assertEqual(crd.shape, idx.shape + (len(flatten(layout.shape)),))
+    for i in idx.flat:
+      self.assertEqual(tuple(crd.reshape(-1, crd.shape[-1])[i]), flatten(idx2crd(int(i), layout.shape)))
+
+    result = crd2idx_batch(crd, layout.shape, layout.stride)
+    self.assertEqual(result.shape, idx.shape)
+    for i in idx.flat:
+      self.assertEqual(result.flat[i], layout(int(i)))
+
+    # The scalar functions accept integer arrays too
+    self.assertTrue(np.array_equal(layout(idx), result))
+
+  def test_batch(self):
+    self.helper_test_batch(Layout(1,0))
+    self.helper_test_batch(Layout(8,2))
+    self.helper_test_batch(Layout((2,4),(4,1)))
+    self.helper_test_batch(Layout((3,(2,4)),(1,(3,6))))
+    self.helper_test_batch(Layout(((2,2),(2,3)),((1,4),(0,8))))
+
+  def test_batch_strided_idx2crd(self):
+    shape  = (4,(2,3))
+    stride = (1,(4,8))
+    idx = np.arange(24)
+    crd = idx2crd_batch(idx, shape, stride)
+    for i in range(24):
+      self.assertEqual(tuple(crd[i]), flatten(idx2crd(i, shape, stride)))
+
+
+if __name__ == "__main__":
+  unittest.main()
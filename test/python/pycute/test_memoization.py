@@ -0,0 +1,96 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Unit tests for pycute memoization and hashing
+"""
+
+import logging
+import unittest
+
+from pycute import *
+
+_LOGGER = logging.getLogger(__name__)
+
+
+class TestMemoization(unittest.TestCase):
+  def setUp(self):
+    clear_cache()
+
+  def test_hash(self):
+    self.assertEqual(hash(Layout((2,4))), hash(Layout((2,4),(1,2))))
+    self.assertEqual(len({Layout((2,4)), Layout((2,4),(1,2)), Layout((2,4),(4,1))}), 2)
+    self.assertNotEqual(Layout(4,1), 4)
+    self.assertEqual(hash(Swizzle(3,4,3)), hash(Swizzle(3,4,3)))
+    self.assertEqual(ComposedLayout(Swizzle(3,4,3), 0, Layout((8,64),(64,1))),
+                     ComposedLayout(Swizzle(3,4,3), 0, Layout((8,64),(64,1))))
+
+  def test_immutable(self):
+    layout = Layout((2,4))
+    with self.assertRaises(AttributeError):
+      layout.shape = (4,2)
+    with self.assertRaises(AttributeError):
+      layout.stride = (4,1)
+
+  def test_cached_results(self):
+    layoutA = Layout((8,8),(8,1))
+    layoutB = Layout((2,2),(4,1))
+
+    result = logical_divide(layoutA, layoutB)
+    hits = cache_info()["logical_divide"].hits
+    self.assertEqual(logical_divide(Layout((8,8),(8,1)), Layout((2,2),(4,1))), result)
+    self.assertEqual(cache_info()["logical_divide"].hits, hits + 1)
+
+    # Unhashable arguments are evaluated without caching
+    misses = cache_info()["coalesce"].misses
+    self.assertEqual(coalesce(Layout((2,4)), [1]), coalesce(Layout((2,4))))
+    self.assertEqual(cache_info()["coalesce"].misses, misses + 1)
+    self.assertEqual(complement(Layout((2,2),(1,6)), 24), complement(Layout((2,2),(1,6)), max_idx=24))
+
+    clear_cache()
+    self.assertEqual(cache_info()["logical_divide"].currsize, 0)
+
+  def test_cache_size(self):
+    layout = Layout((2,(4,6)))
+    expected = coalesce(layout)
+    try:
+      set_cache_size(0)
+      self.assertEqual(coalesce(layout), expected)
+      self.assertEqual(cache_info()["coalesce"].currsize, 0)
+    finally:
+      set_cache_size(1 << 16)
+    coalesce(layout)
+    self.assertEqual(cache_info()["coalesce"].currsize, 1)
+
+
+if __name__ == "__main__":
+  unittest.main()
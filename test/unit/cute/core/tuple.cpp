@@ -897,3 +897,38 @@ TEST(CuTe_core, TupleFind)
 {
   test::test_tuple_find_all<cute::tuple>();
 }
+
+TEST(CuTe_core, TupleLongGet)
+{
+  using namespace cute;
+
+  // Elements beyond the first eight are reached through more than one getr step
+  using Long = tuple<int, _1, float, _2, int, int, _4, int, double, _8, int, int, int, _16, int, int, int64_t, int, _32>;
+  Long t{ 0, {}, 2.5f, {}, 4, 5, {}, 7, 8.5, {}, 10, 11, 12, {}, 14, 15, int64_t(16), 17, {}};
+
+  ASSERT_TRUE(std::is_standard_layout<Long>::value);
+  ASSERT_EQ(get< 0>(t),  0);
+  ASSERT_EQ(get< 2>(t),  2.5f);
+  ASSERT_EQ(get< 7>(t),  7);
+  ASSERT_EQ(get< 8>(t),  8.5);
+  ASSERT_EQ(get<15>(t), 15);
+  ASSERT_EQ(get<16>(t), int64_t(16));
+  ASSERT_EQ(get<17>(t), 17);
+  CUTE_STATIC_ASSERT_V(get< 9>(t) == _8{});
+  CUTE_STATIC_ASSERT_V(get<13>(t) == _16{});
+  CUTE_STATIC_ASSERT_V(get<18>(t) == _32{});
+
+  // References returned by get alias the stored elements
+  get<12>(t) = 120;
+  get<16>(t) += 1;
+  ASSERT_EQ(get<12>(t), 120);
+  ASSERT_EQ(get<16>(t), int64_t(17));
+  ASSERT_TRUE((std::is_same_v<decltype(get<12>(t)), int&>));
+  ASSERT_TRUE((std::is_same_v<decltype(get<12>(static_cast<Long const&>(t))), int const&>));
+  ASSERT_TRUE((std::is_same_v<decltype(get<12>(static_cast<Long&&>(t))), int&&>));
+  ASSERT_TRUE((std::is_same_v<decltype(get<13>(t)), _16>));
+
+  ASSERT_TRUE(reinterpret_cast<char const*>(&get<17>(t)) >= reinterpret_cast<char const*>(&t));
+  ASSERT_TRUE(reinterpret_cast<char const*>(&get<17>(t)) <  reinterpret_cast<char const*>(&t) + sizeof(t));
+  ASSERT_EQ(product(take<10,13>(t)), 10 * 11 * 120);
+}
@@ -423,4 +423,29 @@ TEST(SM90_CuTe_Hopper, Tma_Load_InternalType)
   }
 }
 
+TEST(SM90_CuTe_Hopper, Tma_Load_Descriptor_Cache)
+{
+  Layout smem_layout = Layout<Shape<_32,_32>, Stride<_1,_32>>{};
+  Layout gmem_layout = make_layout(make_shape(64, 64));
+
+  TmaDescriptorCache cache;
+  TmaDescriptorCache::Scope scope(cache);
+
+  // Encoded on the first call, address replaced on the second
+  test_tma_load<half_t>(gmem_layout, smem_layout);
+  {
+  // Occupy the freed buffers so that the second call loads from new addresses
+  thrust::device_vector<uint8_t> spacer(cosize(gmem_layout) * sizeof(half_t));
+  test_tma_load<half_t>(gmem_layout, smem_layout);
+  }
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.misses(), 1u);
+  EXPECT_EQ(cache.hits(), 1u);
+
+  // A different element type is a different geometry
+  test_tma_load<float>(gmem_layout, smem_layout);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.misses(), 2u);
+}
+
 #endif
@@ -32,7 +32,10 @@
     \brief Tests for grouped GEMM problem visitors
 */
 
+#include <algorithm>
 #include <iostream>
+#include <random>
+#include <vector>
 
 #include "../../common/cutlass_unit_test.h"
 #include "cutlass/cutlass.h"
@@ -220,3 +223,123 @@ TEST(SM80_Device_GemmGroupedScheduler_p256_t256_transpose, 32x64x32) {
 #endif // #if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Host-only checks of GroupScheduleMode::kHostPrecompute schedule generation
+
+namespace {
+
+using HostPrecomputeVisitor = cutlass::gemm::kernel::GemmGroupedProblemVisitor<
+                                cutlass::gemm::GemmShape<64, 64, 32>,
+                                cutlass::gemm::kernel::GroupScheduleMode::kHostPrecompute,
+                                128, 128, true>;
+
+using HostPrecomputeProblemInfo = HostPrecomputeVisitor::ProblemInfo;
+
+// Tile-ordered construction of the schedule: entry j of block b holds the problem owning tile j * B + b
+std::vector<HostPrecomputeProblemInfo> reference_host_precompute(
+  std::vector<cutlass::gemm::GemmCoord> const &problem_sizes,
+  int32_t block_count) {
+
+  int32_t problem_count = int32_t(problem_sizes.size());
+  int32_t total_tiles = HostPrecomputeVisitor::group_tile_count(problem_sizes.data(), problem_count);
+  int32_t entries_per_block = (total_tiles - 1 + block_count) / block_count;
+  std::vector<HostPrecomputeProblemInfo> schedule(size_t(entries_per_block) * block_count);
+
+  int32_t tile = 0;
+  for (int32_t p_idx = 0; p_idx < problem_count; ++p_idx) {
+    auto problem = problem_sizes[p_idx];
+    HostPrecomputeVisitor::possibly_transpose_problem(problem);
+    int32_t tiles = HostPrecomputeVisitor::tile_count(HostPrecomputeVisitor::grid_shape(problem));
+    HostPrecomputeProblemInfo problem_info(p_idx, tile);
+    for (int32_t i = 0; i < tiles; ++i, ++tile) {
+      schedule[size_t(entries_per_block) * (tile % block_count) + (tile / block_count)] = problem_info;
+    }
+  }
+  return schedule;
+}
+
+std::vector<cutlass::gemm::GemmCoord> random_problem_sizes(int32_t problem_count, int max_extent, unsigned seed) {
+  std::mt19937 generator(seed);
+  std::uniform_int_distribution<int> extent(0, max_extent);
+  std::vector<cutlass::gemm::GemmCoord> problem_sizes;
+  for (int32_t i = 0; i < problem_count; ++i) {
+    problem_sizes.emplace_back(extent(generator), extent(generator), 64);
+  }
+  return problem_sizes;
+}
+
+void expect_schedule_eq(
+  std::vector<HostPrecomputeProblemInfo> const &expected,
+  std::vector<HostPrecomputeProblemInfo> const &actual) {
+
+  ASSERT_LE(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].problem_idx, actual[i].problem_idx) << "entry " << i;
+    ASSERT_EQ(expected[i].problem_start, actual[i].problem_start) << "entry " << i;
+  }
+}
+
+} // namespace
+
+TEST(GemmGroupedScheduler_HostPrecompute, matches_reference) {
+  for (int32_t problem_count : {1, 27, 300, 40000}) {
+    for (int32_t block_count : {1, 54, 432}) {
+      for (int thread_count : {1, 4}) {
+        auto problem_sizes = random_problem_sizes(problem_count, 384, unsigned(problem_count + block_count));
+        auto expected = reference_host_precompute(problem_sizes, block_count);
+        std::vector<HostPrecomputeProblemInfo> schedule(expected.size());
+        HostPrecomputeVisitor::HostPrecomputeState state;
+
+        int32_t first_entry = HostPrecomputeVisitor::host_precompute(
+          problem_sizes.data(), problem_count, block_count, schedule.data(), &state, thread_count);
+
+        EXPECT_EQ(first_entry, 0);
+        expect_schedule_eq(expected, schedule);
+      }
+    }
+  }
+}
+
+TEST(GemmGroupedScheduler_HostPrecompute, incremental_update) {
+  int32_t const problem_count = 40000;
+  int32_t const block_count = 216;
+
+  for (int thread_count : {1, 4}) {
+    auto problem_sizes = random_problem_sizes(problem_count, 256, 2024);
+    auto expected = reference_host_precompute(problem_sizes, block_count);
+    std::vector<HostPrecomputeProblemInfo> schedule(expected.size() * 2);
+    HostPrecomputeVisitor::HostPrecomputeState state;
+
+    HostPrecomputeVisitor::host_precompute(
+      problem_sizes.data(), problem_count, block_count, schedule.data(), &state, thread_count);
+    expect_schedule_eq(expected, schedule);
+
+    // Unchanged problems rewrite nothing
+    int32_t entries_per_block = state.entries_per_block;
+    EXPECT_EQ(entries_per_block, HostPrecomputeVisitor::host_precompute(
+      problem_sizes.data(), problem_count, block_count, schedule.data(), &state, thread_count));
+
+    // Reordering late problems preserves the total tile count and only rewrites the tail of each block
+    auto changed = problem_sizes.end() - 100;
+    std::rotate(changed, changed + 1, changed + 8);
+    expected = reference_host_precompute(problem_sizes, block_count);
+    ASSERT_EQ(int32_t(expected.size()), entries_per_block * block_count);
+
+    int32_t first_entry = HostPrecomputeVisitor::host_precompute(
+      problem_sizes.data(), problem_count, block_count, schedule.data(), &state, thread_count);
+    EXPECT_GT(first_entry, 0);
+    EXPECT_LT(first_entry, entries_per_block);
+    expect_schedule_eq(expected, schedule);
+
+    // A change in the number of entries per block rewrites the full schedule
+    problem_sizes[0] = cutlass::gemm::GemmCoord(4096, 4096, 64);
+    expected = reference_host_precompute(problem_sizes, block_count);
+    ASSERT_LE(expected.size(), schedule.size());
+    first_entry = HostPrecomputeVisitor::host_precompute(
+      problem_sizes.data(), problem_count, block_count, schedule.data(), &state, thread_count);
+    EXPECT_EQ(first_entry, 0);
+    expect_schedule_eq(expected, schedule);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,275 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for GemmUniversalDispatcher: candidate selection, cost tables and fallback
+*/
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/gemm/device/gemm_universal_dispatcher.h"
+
+#include "cute/layout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cutlass::gemm::device;
+using cute::_1;
+using cute::_64;
+using cute::_128;
+using cute::_256;
+
+// Strides of (M,K,L) or (N,K,L) operands with K or with M/N contiguous
+using StrideK = cute::Stride<int64_t, _1, int64_t>;
+using StrideMN = cute::Stride<_1, int64_t, int64_t>;
+
+/// Stands in for a GemmUniversalAdapter: the dispatcher only reads the kernel's tile and strides
+template <class TileShape_, class StrideA_ = StrideK, class StrideB_ = StrideK>
+struct MockGemm {
+  struct GemmKernel {
+    using TileShape = TileShape_;
+    using StrideA = StrideA_;
+    using StrideB = StrideB_;
+  };
+};
+
+using Gemm256x128 = MockGemm<cute::Shape<_256, _128, _64>>;
+using Gemm128x128 = MockGemm<cute::Shape<_128, _128, _64>>;
+using Gemm64x64 = MockGemm<cute::Shape<_64, _64, _64>>;
+using Gemm128x128NT = MockGemm<cute::Shape<_128, _128, _64>, StrideMN, StrideMN>;
+
+using Dispatcher = GemmUniversalDispatcher<
+  GemmDispatchCandidate<Gemm256x128, 8, 8, 8, 8, GemmDispatchDivisible::MN>,   // 0
+  GemmDispatchCandidate<Gemm128x128, 8, 8, 8, 8, GemmDispatchDivisible::MNK>,  // 1
+  GemmDispatchCandidate<Gemm128x128, 8, 8, 4, 4>,                              // 2
+  GemmDispatchCandidate<Gemm128x128NT, 8, 8, 8, 8>,                            // 3
+  GemmDispatchCandidate<Gemm64x64, 1, 1, 1, 1>                                 // 4
+>;
+
+GemmDispatchProblem make_problem(int m, int n, int k, int alignment = 8, bool k_major = true) {
+  GemmDispatchProblem problem;
+  problem.m = m;
+  problem.n = n;
+  problem.k = k;
+  problem.alignment_a = problem.alignment_b = problem.alignment_c = problem.alignment_d = alignment;
+  problem.k_major_a = problem.k_major_b = k_major;
+  return problem;
+}
+
+/// The if-ladder the dispatcher replaces, written against the candidates' declared predicates
+template <class Candidate>
+bool applies(GemmDispatchProblem const& p) {
+  return Candidate::kKMajorA == p.k_major_a && Candidate::kKMajorB == p.k_major_b &&
+    p.alignment_a >= Candidate::AlignmentA && p.alignment_b >= Candidate::AlignmentB &&
+    p.alignment_c >= Candidate::AlignmentC && p.alignment_d >= Candidate::AlignmentD &&
+    (!(Candidate::Divisibility & GemmDispatchDivisible::M) || p.m % Candidate::kTileM == 0) &&
+    (!(Candidate::Divisibility & GemmDispatchDivisible::N) || p.n % Candidate::kTileN == 0) &&
+    (!(Candidate::Divisibility & GemmDispatchDivisible::K) || p.k % Candidate::kTileK == 0);
+}
+
+template <class... Candidates>
+int reference_select(GemmUniversalDispatcher<Candidates...>, GemmDispatchProblem const& p) {
+  bool const applicable[] = {applies<Candidates>(p)...};
+  for (int i = 0; i < int(sizeof...(Candidates)); ++i) {
+    if (applicable[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GemmUniversalDispatcher, candidate_traits) {
+  using Candidate = GemmDispatchCandidate<Gemm256x128, 8, 4>;
+  static_assert(Candidate::kTileM == 256 && Candidate::kTileN == 128 && Candidate::kTileK == 64);
+  static_assert(Candidate::kKMajorA && Candidate::kKMajorB);
+  static_assert(Candidate::AlignmentC == 1 && Candidate::AlignmentD == 1);
+  static_assert(!GemmDispatchCandidate<Gemm128x128NT>::kKMajorA);
+  static_assert(!GemmDispatchCandidate<Gemm128x128NT>::kKMajorB);
+  EXPECT_EQ(Dispatcher::kCandidateCount, 5);
+}
+
+TEST(GemmUniversalDispatcher, first_applicable_in_declaration_order) {
+  EXPECT_EQ(Dispatcher::select(make_problem(512, 256, 128)), 0);
+  EXPECT_EQ(Dispatcher::select(make_problem(384, 256, 128)), 1);
+  EXPECT_EQ(Dispatcher::select(make_problem(384, 256, 100)), 2);
+  EXPECT_EQ(Dispatcher::select(make_problem(100, 100, 100)), 2);
+  EXPECT_EQ(Dispatcher::select(make_problem(512, 256, 128, 4)), 4);
+  EXPECT_EQ(Dispatcher::select(make_problem(512, 256, 128, 1)), 4);
+  EXPECT_EQ(Dispatcher::select(make_problem(512, 256, 128, 8, false)), 3);
+
+  // Only the output is 4-aligned
+  GemmDispatchProblem problem = make_problem(512, 256, 128);
+  problem.alignment_c = problem.alignment_d = 4;
+  EXPECT_EQ(Dispatcher::select(problem), 2);
+
+  // No candidate for MN-major A with K-major B
+  problem = make_problem(512, 256, 128);
+  problem.k_major_a = false;
+  EXPECT_EQ(Dispatcher::select(problem), Dispatcher::kNotFound);
+  EXPECT_FALSE(Dispatcher::is_applicable(3, problem));
+}
+
+TEST(GemmUniversalDispatcher, matches_reference_ladder) {
+  std::mt19937 rng(2025);
+  std::uniform_int_distribution<int> extent(1, 2048);
+  std::uniform_int_distribution<int> log2_alignment(0, 9);
+  std::uniform_int_distribution<int> coin(0, 3);
+
+  for (int trial = 0; trial < 20000; ++trial) {
+    GemmDispatchProblem p;
+    // Bias towards tile multiples so that every divisibility branch is exercised
+    p.m = coin(rng) ? 64 * (extent(rng) / 64 + 1) : extent(rng);
+    p.n = coin(rng) ? 64 * (extent(rng) / 64 + 1) : extent(rng);
+    p.k = coin(rng) ? 64 * (extent(rng) / 64 + 1) : extent(rng);
+    p.alignment_a = 1 << log2_alignment(rng);
+    p.alignment_b = 1 << log2_alignment(rng);
+    p.alignment_c = 1 << log2_alignment(rng);
+    p.alignment_d = 1 << log2_alignment(rng);
+    p.k_major_a = coin(rng) != 0;
+    p.k_major_b = coin(rng) != 0;
+
+    int expected = reference_select(Dispatcher{}, p);
+    ASSERT_EQ(Dispatcher::select(p), expected) << "m=" << p.m << " n=" << p.n << " k=" << p.k;
+    if (expected != Dispatcher::kNotFound) {
+      EXPECT_TRUE(Dispatcher::is_applicable(expected, p));
+    }
+  }
+}
+
+TEST(GemmUniversalDispatcher, operand_alignment) {
+  alignas(256) static cutlass::half_t buffer[1024];
+
+  // Capped at kGemmDispatchMaxAlignmentBits
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::half_t>(buffer, 4096), 64);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::half_t>(buffer, 4096, 4096 * 4096), 64);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::half_t>(buffer, 72), 8);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::half_t>(buffer + 4, 4096), 4);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::half_t>(buffer, 4097), 1);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::half_t>(buffer, 4096, 12), 4);
+  EXPECT_EQ(gemm_dispatch_alignment<float>(buffer + 1, 4096), 0);
+
+  // Sub-byte elements count in elements, not bytes
+  auto* bytes = reinterpret_cast<uint8_t*>(buffer);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::int4b_t>(bytes, 4096), 256);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::int4b_t>(bytes + 16, 4096), 32);
+  EXPECT_EQ(gemm_dispatch_alignment<cutlass::int4b_t>(bytes, 33), 1);
+}
+
+TEST(GemmUniversalDispatcher, cost_table) {
+  GemmDispatchCostTable costs(Dispatcher::kCandidateCount);
+  EXPECT_EQ(GemmDispatchCostTable::bin(1), 0);
+  EXPECT_EQ(GemmDispatchCostTable::bin(255), 7);
+  EXPECT_EQ(GemmDispatchCostTable::bin(256), 8);
+  EXPECT_EQ(GemmDispatchCostTable::bin(1 << 30), GemmDispatchCostTable::kBins - 1);
+
+  GemmDispatchProblem problem = make_problem(512, 256, 128);
+
+  // Without costs, declaration order
+  EXPECT_EQ(Dispatcher::select(problem, costs), 0);
+
+  // A candidate with a cost outranks those without one
+  costs.set(2, 512, 256, 128, 10.0f);
+  EXPECT_EQ(Dispatcher::select(problem, costs), 2);
+  costs.set(1, 512, 256, 128, 5.0f);
+  EXPECT_EQ(Dispatcher::select(problem, costs), 1);
+
+  // Costs apply to the whole bin but never make an inapplicable candidate eligible
+  EXPECT_EQ(Dispatcher::select(make_problem(511, 256, 128), costs), 2);
+  costs.set(4, 512, 256, 128, 1.0f);
+  EXPECT_EQ(Dispatcher::select(make_problem(512, 256, 128), costs), 4);
+  EXPECT_EQ(Dispatcher::select(make_problem(512, 256, 128, 8, false), costs), 3);
+
+  // Online recording keeps the mean
+  costs.clear();
+  costs.record(0, 512, 256, 128, 4.0f);
+  costs.record(0, 512, 256, 128, 8.0f);
+  EXPECT_EQ(costs.samples(0, 512, 256, 128), 2u);
+  EXPECT_FLOAT_EQ(costs.cost(0, 512, 256, 128), 6.0f);
+  costs.record(2, 512, 256, 128, 7.0f);
+  EXPECT_EQ(Dispatcher::select(problem, costs), 0);
+}
+
+TEST(GemmUniversalDispatcher, dispatch_visits_selected_type) {
+  int visited_tile_m = 0;
+  cutlass::Status status = Dispatcher::dispatch(make_problem(512, 256, 128), [&](auto candidate) {
+    using Gemm = typename decltype(candidate)::Gemm;
+    visited_tile_m = decltype(candidate)::kTileM;
+    return std::is_same_v<Gemm, Gemm256x128> ? cutlass::Status::kSuccess : cutlass::Status::kErrorInternal;
+  });
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  EXPECT_EQ(visited_tile_m, 256);
+
+  EXPECT_EQ(Dispatcher::visit(3, [](auto candidate) { return decltype(candidate)::kKMajorA; }), false);
+}
+
+TEST(GemmUniversalDispatcher, dispatch_falls_back_when_unsupported) {
+  // Candidates 0 and 1 reject the problem as can_implement() would; 2 accepts it
+  std::vector<int> visited;
+  auto fn = [&](auto candidate) {
+    visited.push_back(decltype(candidate)::kTileM * 10 + decltype(candidate)::AlignmentC);
+    return visited.size() < 3 ? cutlass::Status::kErrorMisalignedOperand : cutlass::Status::kSuccess;
+  };
+  EXPECT_EQ(Dispatcher::dispatch(make_problem(512, 256, 128), fn), cutlass::Status::kSuccess);
+  EXPECT_EQ(visited, (std::vector<int>{2568, 1288, 1284}));
+
+  // Other errors are returned as is
+  visited.clear();
+  EXPECT_EQ(Dispatcher::dispatch(make_problem(512, 256, 128), [&](auto) {
+    visited.push_back(0);
+    return cutlass::Status::kErrorInternal;
+  }), cutlass::Status::kErrorInternal);
+  EXPECT_EQ(visited.size(), 1u);
+
+  // With a cost table, fallback continues in declaration order
+  GemmDispatchCostTable costs(Dispatcher::kCandidateCount);
+  costs.set(2, 512, 256, 128, 1.0f);
+  visited.clear();
+  EXPECT_EQ(Dispatcher::dispatch(make_problem(512, 256, 128), fn, &costs), cutlass::Status::kSuccess);
+  EXPECT_EQ(visited, (std::vector<int>{1284, 2568, 1288}));
+
+  // Nothing applies
+  GemmDispatchProblem problem = make_problem(512, 256, 128);
+  problem.k_major_b = false;
+  EXPECT_EQ(Dispatcher::dispatch(problem, fn), cutlass::Status::kErrorNotSupported);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
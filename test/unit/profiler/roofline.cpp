@@ -0,0 +1,279 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/** \file
+    \brief Tests for the profiler's roofline metrics and device spec table
+*/
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "cutlass/profiler/roofline.h"
+
+using cutlass::library::MathOperationID;
+using cutlass::library::NumericTypeID;
+using cutlass::library::OpcodeClassID;
+using cutlass::profiler::DeviceSpec;
+using cutlass::profiler::RooflineMathClass;
+using cutlass::profiler::RooflineMetrics;
+using cutlass::profiler::RooflineSummary;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Device with 1000 GB/s of bandwidth and 100 TFLOP/s of F16 tensor core throughput
+DeviceSpec make_spec() {
+  DeviceSpec spec;
+  spec.name = "test";
+  spec.compute_capability = 80;
+  spec.memory_bandwidth = 1000;
+  spec.peak_math[RooflineMathClass::kF16] = 100000;
+  return spec;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Profiler_Roofline, memory_bound) {
+
+  DeviceSpec spec = make_spec();
+
+  // Intensity of 10 FLOP/byte is below the ridge point of 100 FLOP/byte
+  int64_t bytes = int64_t(1) << 30;
+  int64_t flops = bytes * 10;
+
+  // Moving the bytes at full bandwidth takes bytes / 1e12 seconds
+  double ideal_ms = double(bytes) / 1.0e9;
+
+  RooflineMetrics metrics = cutlass::profiler::compute_roofline(
+    spec, RooflineMathClass::kF16, flops, bytes, ideal_ms * 2);
+
+  ASSERT_TRUE(metrics.good());
+  EXPECT_TRUE(metrics.memory_bound);
+  EXPECT_DOUBLE_EQ(metrics.arithmetic_intensity, 10.0);
+  EXPECT_NEAR(metrics.bound_gflops, 10000.0, 1e-6);
+  EXPECT_NEAR(metrics.percent_of_bound, 50.0, 1e-9);
+}
+
+TEST(Profiler_Roofline, compute_bound) {
+
+  DeviceSpec spec = make_spec();
+
+  int64_t bytes = int64_t(1) << 20;
+  int64_t flops = bytes * 1000;
+
+  double ideal_ms = double(flops) / 1.0e14 * 1.0e3;
+
+  RooflineMetrics metrics = cutlass::profiler::compute_roofline(
+    spec, RooflineMathClass::kF16, flops, bytes, ideal_ms * 4);
+
+  ASSERT_TRUE(metrics.good());
+  EXPECT_FALSE(metrics.memory_bound);
+  EXPECT_NEAR(metrics.bound_gflops, 100000.0, 1e-6);
+  EXPECT_NEAR(metrics.percent_of_bound, 25.0, 1e-9);
+}
+
+TEST(Profiler_Roofline, unknown_peak_or_runtime) {
+
+  DeviceSpec spec = make_spec();
+
+  // No TF32 peak in the spec
+  RooflineMetrics metrics = cutlass::profiler::compute_roofline(
+    spec, RooflineMathClass::kTF32, 1000, 100, 1.0);
+
+  EXPECT_FALSE(metrics.good());
+  EXPECT_DOUBLE_EQ(metrics.arithmetic_intensity, 10.0);
+
+  // Results which did not run
+  metrics = cutlass::profiler::compute_roofline(spec, RooflineMathClass::kF16, 1000, 100, 0);
+  EXPECT_FALSE(metrics.good());
+
+  // Unknown device
+  metrics = cutlass::profiler::compute_roofline(DeviceSpec(), RooflineMathClass::kF16, 1000, 100, 1.0);
+  EXPECT_FALSE(metrics.good());
+
+  // Kernels performing no math are bound by bandwidth alone
+  metrics = cutlass::profiler::compute_roofline(spec, RooflineMathClass::kInvalid, 0, 1000000, 0.002);
+  ASSERT_TRUE(metrics.good());
+  EXPECT_TRUE(metrics.memory_bound);
+  EXPECT_NEAR(metrics.percent_of_bound, 50.0, 1e-9);
+}
+
+TEST(Profiler_Roofline, math_class) {
+
+  using cutlass::profiler::roofline_math_class;
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kSimt, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kF32, NumericTypeID::kF32), RooflineMathClass::kF32);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kSimt, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kF64, NumericTypeID::kF64), RooflineMathClass::kF64);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kF32, NumericTypeID::kF32), RooflineMathClass::kTF32);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAddFastBF16,
+    NumericTypeID::kF32, NumericTypeID::kF32), RooflineMathClass::kF16);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kBF16, NumericTypeID::kBF16), RooflineMathClass::kF16);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kFE4M3, NumericTypeID::kFE5M2), RooflineMathClass::kF8);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kBlockScaledOp, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kFE2M1, NumericTypeID::kFE2M1), RooflineMathClass::kF4);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kS8, NumericTypeID::kS8), RooflineMathClass::kS8);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAddSaturate,
+    NumericTypeID::kS4, NumericTypeID::kS4), RooflineMathClass::kS4);
+
+  // Mixed-input kernels are bounded by the slower of the two operand types
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAddMixedInputUpcast,
+    NumericTypeID::kS8, NumericTypeID::kF16), RooflineMathClass::kF16);
+
+  EXPECT_EQ(roofline_math_class(OpcodeClassID::kTensorOp, MathOperationID::kMultiplyAdd,
+    NumericTypeID::kB1, NumericTypeID::kB1), RooflineMathClass::kInvalid);
+}
+
+TEST(Profiler_Roofline, math_class_from_description) {
+
+  cutlass::library::GemmDescription desc;
+  desc.kind = cutlass::library::OperationKind::kGemm;
+  desc.tile_description.math_instruction.opcode_class = OpcodeClassID::kTensorOp;
+  desc.A.element = NumericTypeID::kF16;
+  desc.B.element = NumericTypeID::kF16;
+
+  EXPECT_EQ(cutlass::profiler::roofline_math_class(desc), RooflineMathClass::kF16);
+
+  cutlass::library::OperationDescription reduction;
+  reduction.kind = cutlass::library::OperationKind::kReduction;
+
+  EXPECT_EQ(cutlass::profiler::roofline_math_class(reduction), RooflineMathClass::kInvalid);
+}
+
+TEST(Profiler_Roofline, device_spec_table) {
+
+  DeviceSpec spec;
+
+  ASSERT_TRUE(cutlass::profiler::find_device_spec(spec, "NVIDIA A100-SXM4-80GB", 80));
+  EXPECT_EQ(spec.name, "A100 SXM");
+
+  ASSERT_TRUE(cutlass::profiler::find_device_spec(spec, "NVIDIA A100-PCIE-40GB", 80));
+  EXPECT_EQ(spec.name, "A100 PCIe");
+
+  // Unrecognized names fall back to the first entry for the compute capability
+  ASSERT_TRUE(cutlass::profiler::find_device_spec(spec, "NVIDIA H100 80GB HBM3", 90));
+  EXPECT_EQ(spec.name, "H100 SXM");
+  EXPECT_GT(spec.peak(RooflineMathClass::kF8), spec.peak(RooflineMathClass::kF16));
+
+  // Without 4-bit integer tensor core instructions, int4 is bounded by the int8 rate
+  EXPECT_EQ(spec.peak(RooflineMathClass::kS4), spec.peak(RooflineMathClass::kS8));
+
+  ASSERT_TRUE(cutlass::profiler::find_device_spec(spec, "NVIDIA A100-SXM4-80GB", 80));
+  EXPECT_EQ(spec.peak(RooflineMathClass::kS4), 2 * spec.peak(RooflineMathClass::kS8));
+
+  EXPECT_FALSE(cutlass::profiler::find_device_spec(spec, "Unknown", 12));
+
+  // Every entry knows its bandwidth and at least the F32 throughput
+  for (auto const &entry : cutlass::profiler::device_spec_table()) {
+    EXPECT_TRUE(entry.good()) << entry.name;
+    EXPECT_GT(entry.peak(RooflineMathClass::kF32), 0) << entry.name;
+  }
+}
+
+TEST(Profiler_Roofline, parse_device_spec) {
+
+  std::istringstream json(R"({
+    "name": "Custom \"GPU\"",
+    "compute_capability": 90,
+    "memory_bandwidth": 3000.5,
+    "comment": ["ignored", {"nested": true}, null],
+    "peak_math": { "f16": 900000, "f8": 1.8e6 }
+  })");
+
+  DeviceSpec spec = cutlass::profiler::parse_device_spec(json);
+
+  EXPECT_EQ(spec.name, "Custom \"GPU\"");
+  EXPECT_EQ(spec.compute_capability, 90);
+  EXPECT_DOUBLE_EQ(spec.memory_bandwidth, 3000.5);
+  EXPECT_DOUBLE_EQ(spec.peak(RooflineMathClass::kF16), 900000);
+  EXPECT_DOUBLE_EQ(spec.peak(RooflineMathClass::kF8), 1.8e6);
+  EXPECT_DOUBLE_EQ(spec.peak(RooflineMathClass::kTF32), 0);
+
+  std::istringstream unknown_class(R"({ "memory_bandwidth": 1, "peak_math": { "f12": 1 } })");
+  EXPECT_THROW(cutlass::profiler::parse_device_spec(unknown_class), std::runtime_error);
+
+  std::istringstream no_bandwidth(R"({ "peak_math": { "f16": 1 } })");
+  EXPECT_THROW(cutlass::profiler::parse_device_spec(no_bandwidth), std::runtime_error);
+
+  std::istringstream malformed(R"({ "memory_bandwidth": 1 )");
+  EXPECT_THROW(cutlass::profiler::parse_device_spec(malformed), std::runtime_error);
+}
+
+TEST(Profiler_Roofline, summary) {
+
+  RooflineSummary summary(50);
+
+  RooflineMetrics memory;
+  memory.math_class = RooflineMathClass::kF16;
+  memory.memory_bound = true;
+  memory.percent_of_bound = 80;
+
+  RooflineMetrics compute;
+  compute.math_class = RooflineMathClass::kF16;
+  compute.memory_bound = false;
+  compute.percent_of_bound = 30;
+
+  summary.add(1, "kernel_a", memory);
+  summary.add(1, "kernel_b", compute);
+  summary.add(2, "kernel_c", RooflineMetrics());
+
+  EXPECT_EQ(summary.count(), 2u);
+  EXPECT_EQ(summary.memory_bound_count(), 1u);
+  EXPECT_EQ(summary.compute_bound_count(), 1u);
+
+  ASSERT_EQ(summary.flagged().size(), 1u);
+  EXPECT_EQ(summary.flagged().front().operation_name, "kernel_b");
+  EXPECT_EQ(summary.flagged().front().problem_index, 1u);
+
+  std::ostringstream out;
+  summary.print(out);
+  EXPECT_NE(out.str().find("kernel_b"), std::string::npos);
+  EXPECT_EQ(out.str().find("kernel_a"), std::string::npos);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
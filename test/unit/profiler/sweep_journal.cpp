@@ -0,0 +1,249 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/** \file
+    \brief Tests for the profiler's sweep journal used by --resume
+*/
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cutlass/profiler/sweep_journal.h"
+
+using cutlass::profiler::SweepJournal;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Thrown by the fake sweep to emulate the profiler being killed
+struct Interrupted : std::runtime_error {
+  Interrupted(): std::runtime_error("interrupted") { }
+};
+
+/// Fake operation set mirroring the structure of OperationProfiler::profile_all(): for each
+/// problem, every operation is visited and its result appended to a report.
+struct FakeSweep {
+
+  std::vector<std::string> kinds;
+  std::vector<std::string> operations;
+  size_t problem_count;
+
+  /// Number of times each (kind, problem, operation) was profiled
+  std::map<std::string, int> profiled;
+
+  /// Rows written to the fake report
+  std::vector<std::string> report;
+
+  FakeSweep(
+    std::vector<std::string> kinds_,
+    std::vector<std::string> operations_,
+    size_t problem_count_
+  ):
+    kinds(std::move(kinds_)), operations(std::move(operations_)), problem_count(problem_count_) { }
+
+  /// Runs the sweep, throwing Interrupted before profiling the 'interrupt_at'-th operation
+  void run(SweepJournal &journal, int interrupt_at = -1) {
+    int visited = 0;
+    for (auto const &kind : kinds) {
+      for (size_t problem = 1; problem <= problem_count; ++problem) {
+        if (journal.problem_completed(kind, problem)) {
+          continue;
+        }
+
+        for (auto const &operation : operations) {
+          if (journal.operation_completed(kind, problem, operation)) {
+            continue;
+          }
+          if (visited++ == interrupt_at) {
+            throw Interrupted();
+          }
+          std::string key = kind + "/" + std::to_string(problem) + "/" + operation;
+          ++profiled[key];
+          report.push_back(key);
+          journal.operation_done(kind, problem, operation);
+        }
+        journal.problem_done(kind, problem);
+      }
+    }
+  }
+
+  size_t total() const {
+    return kinds.size() * operations.size() * problem_count;
+  }
+};
+
+std::string journal_path(char const *name) {
+  return ::testing::TempDir() + "cutlass_profiler_" + name + ".journal";
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Profiler_SweepJournal, resume_skips_completed_work) {
+
+  std::string path = journal_path("resume");
+  std::string fingerprint = SweepJournal::compute_fingerprint("v", {{"operation", "gemm"}});
+
+  FakeSweep sweep({"gemm", "conv2d"}, {"op_a", "op_b", "op_c"}, 4);
+
+  // Interrupt repeatedly at different points until the sweep finishes
+  std::vector<int> interrupt_points = {5, 0, 7, 1};
+  bool resume = false;
+  for (int interrupt_at : interrupt_points) {
+    SweepJournal journal(path, fingerprint, resume);
+    ASSERT_TRUE(journal.good());
+    EXPECT_THROW(sweep.run(journal, interrupt_at), Interrupted);
+    resume = true;
+  }
+
+  {
+    SweepJournal journal(path, fingerprint, true);
+    ASSERT_TRUE(journal.good());
+    EXPECT_GT(journal.recovered_records(), 0u);
+    EXPECT_TRUE(journal.problem_completed("gemm", 4));
+    sweep.run(journal);
+  }
+
+  EXPECT_EQ(sweep.profiled.size(), sweep.total());
+  EXPECT_EQ(sweep.report.size(), sweep.total());
+  for (auto const &entry : sweep.profiled) {
+    EXPECT_EQ(entry.second, 1) << entry.first;
+  }
+
+  // A finished journal skips everything
+  {
+    SweepJournal journal(path, fingerprint, true);
+    ASSERT_TRUE(journal.good());
+    sweep.run(journal);
+    EXPECT_EQ(sweep.report.size(), sweep.total());
+  }
+
+  // Without resume, the journal is truncated and the sweep starts over
+  {
+    SweepJournal journal(path, fingerprint, false);
+    ASSERT_TRUE(journal.good());
+    EXPECT_EQ(journal.recovered_records(), 0u);
+    EXPECT_FALSE(journal.problem_completed("gemm", 1));
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(Profiler_SweepJournal, torn_record_is_ignored) {
+
+  std::string path = journal_path("torn");
+  std::string fingerprint = SweepJournal::compute_fingerprint("v", {});
+
+  {
+    SweepJournal journal(path, fingerprint, false);
+    journal.operation_done("gemm", 1, "op_a");
+  }
+
+  // Emulate a crash in the middle of writing a record
+  {
+    std::ofstream out(path, std::ios::app);
+    out << "done\tgemm\t1\top_";
+  }
+
+  {
+    SweepJournal journal(path, fingerprint, true);
+    ASSERT_TRUE(journal.good());
+    EXPECT_EQ(journal.recovered_records(), 1u);
+    EXPECT_TRUE(journal.operation_completed("gemm", 1, "op_a"));
+    EXPECT_FALSE(journal.operation_completed("gemm", 1, "op_"));
+    journal.operation_done("gemm", 1, "op_b");
+  }
+
+  // The record appended after recovery must be intact
+  {
+    SweepJournal journal(path, fingerprint, true);
+    ASSERT_TRUE(journal.good());
+    EXPECT_EQ(journal.recovered_records(), 2u);
+    EXPECT_TRUE(journal.operation_completed("gemm", 1, "op_b"));
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(Profiler_SweepJournal, fingerprint) {
+
+  std::string path = journal_path("fingerprint");
+
+  std::string a = SweepJournal::compute_fingerprint("v", {{"m", "128"}, {"n", "256"}});
+  std::string b = SweepJournal::compute_fingerprint("v", {{"n", "256"}, {"m", "128"}});
+  std::string c = SweepJournal::compute_fingerprint("v", {{"m", "1282"}, {"n", "56"}});
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+
+  {
+    SweepJournal journal(path, a, false);
+    journal.operation_done("gemm", 1, "op_a");
+  }
+
+  // Resuming with different arguments would assign different problems to the same indices
+  {
+    SweepJournal journal(path, c, true);
+    EXPECT_FALSE(journal.good());
+  }
+
+  {
+    SweepJournal journal(path, b, true);
+    EXPECT_TRUE(journal.good());
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(Profiler_SweepJournal, malformed_journal) {
+
+  std::string path = journal_path("malformed");
+
+  {
+    std::ofstream out(path);
+    out << "not a journal\n";
+  }
+
+  SweepJournal journal(path, SweepJournal::compute_fingerprint("v", {}), true);
+  EXPECT_FALSE(journal.good());
+
+  std::remove(path.c_str());
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
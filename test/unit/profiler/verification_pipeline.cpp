@@ -0,0 +1,269 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/** \file
+    \brief Tests for the profiler's host verification pipeline
+*/
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "cutlass/profiler/verification_pipeline.h"
+
+using cutlass::library::Provider;
+using cutlass::profiler::Disposition;
+using cutlass::profiler::PerformanceResult;
+using cutlass::profiler::PerformanceResultVector;
+using cutlass::profiler::VerificationPipeline;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Result produced by the CUTLASS provider, tagged with an index via its bytes count
+PerformanceResultVector make_results(int index) {
+  PerformanceResult result;
+  result.provider = Provider::kCUTLASS;
+  result.disposition = Disposition::kNotVerified;
+  result.bytes = index;
+  return PerformanceResultVector{result};
+}
+
+/// Snapshot returning a task that sleeps before yielding 'disposition'
+VerificationPipeline::Snapshot make_snapshot(Disposition disposition, int delay_ms = 0) {
+  return [=]() {
+    return VerificationPipeline::Task([=]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+      return disposition;
+    });
+  };
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Profiler_VerificationPipeline, results_delivered_in_order) {
+
+  VerificationPipeline pipeline(4, 1 << 20);
+
+  std::vector<int64_t> delivered;
+  auto sink = [&](PerformanceResultVector const &results) {
+    for (auto const &result : results) {
+      delivered.push_back(result.bytes);
+    }
+  };
+
+  // Earlier checks take longer, so workers complete them out of order
+  for (int i = 0; i < 8; ++i) {
+    pipeline.enqueue(Provider::kReferenceHost, 16, make_snapshot(Disposition::kPassed, (8 - i) * 5));
+    pipeline.append_results(make_results(i), sink);
+  }
+
+  pipeline.flush(true);
+
+  ASSERT_EQ(delivered.size(), 8u);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(delivered[i], i);
+  }
+  EXPECT_EQ(pipeline.pending(), 0u);
+  EXPECT_EQ(pipeline.bytes_in_flight(), 0u);
+}
+
+TEST(Profiler_VerificationPipeline, results_without_checks_wait_for_predecessors) {
+
+  VerificationPipeline pipeline(1, 1 << 20);
+
+  std::vector<int64_t> delivered;
+  auto sink = [&](PerformanceResultVector const &results) {
+    delivered.push_back(results.front().bytes);
+  };
+
+  pipeline.enqueue(Provider::kReferenceHost, 16, make_snapshot(Disposition::kPassed, 50));
+  pipeline.append_results(make_results(0), sink);
+  pipeline.append_results(make_results(1), sink);
+
+  // The second batch has no checks but must not overtake the first
+  EXPECT_TRUE(delivered.empty() || delivered.front() == 0);
+
+  pipeline.flush(true);
+
+  ASSERT_EQ(delivered.size(), 2u);
+  EXPECT_EQ(delivered[0], 0);
+  EXPECT_EQ(delivered[1], 1);
+}
+
+TEST(Profiler_VerificationPipeline, host_memory_is_bounded) {
+
+  size_t const kBudget = 100;
+  size_t const kSnapshotBytes = 40;
+
+  VerificationPipeline pipeline(4, kBudget);
+
+  std::atomic<size_t> peak{0};
+  std::atomic<size_t> live{0};
+
+  auto sink = [](PerformanceResultVector const &) { };
+
+  for (int i = 0; i < 16; ++i) {
+    pipeline.enqueue(Provider::kReferenceHost, kSnapshotBytes, [&]() {
+      size_t now = (live += kSnapshotBytes);
+      size_t prev = peak.load();
+      while (now > prev && !peak.compare_exchange_weak(prev, now)) { }
+
+      // The task owns the snapshot; releasing it mirrors destroying the host buffers
+      std::shared_ptr<void> buffer(nullptr, [&live, kSnapshotBytes](void *) { live -= kSnapshotBytes; });
+
+      return VerificationPipeline::Task([buffer]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        return Disposition::kPassed;
+      });
+    });
+    pipeline.append_results(make_results(i), sink);
+
+    EXPECT_LE(pipeline.bytes_in_flight(), kBudget);
+  }
+
+  pipeline.flush(true);
+
+  EXPECT_LE(peak.load(), kBudget);
+  EXPECT_EQ(pipeline.bytes_in_flight(), 0u);
+}
+
+TEST(Profiler_VerificationPipeline, oversized_snapshot_is_admitted_alone) {
+
+  VerificationPipeline pipeline(2, 10);
+
+  Disposition disposition = Disposition::kInvalid;
+  pipeline.enqueue(Provider::kReferenceHost, 1000, make_snapshot(Disposition::kPassed));
+  pipeline.append_results(make_results(0), [&](PerformanceResultVector const &results) {
+    disposition = results.front().disposition;
+  });
+
+  pipeline.flush(true);
+  EXPECT_EQ(disposition, Disposition::kPassed);
+}
+
+TEST(Profiler_VerificationPipeline, merge_disposition) {
+
+  PerformanceResult result;
+  result.disposition = Disposition::kNotVerified;
+
+  VerificationPipeline::merge_disposition(result, Provider::kReferenceHost, Disposition::kPassed);
+  EXPECT_EQ(result.disposition, Disposition::kPassed);
+
+  VerificationPipeline::merge_disposition(result, Provider::kReferenceDevice, Disposition::kIncorrect);
+  EXPECT_EQ(result.disposition, Disposition::kIncorrect);
+
+  // An incorrect outcome from any provider is not overridden by a later pass
+  VerificationPipeline::merge_disposition(result, Provider::kCUBLAS, Disposition::kPassed);
+  EXPECT_EQ(result.disposition, Disposition::kIncorrect);
+
+  PerformanceResult not_run;
+  not_run.disposition = Disposition::kNotVerified;
+  VerificationPipeline::merge_disposition(not_run, Provider::kReferenceHost, Disposition::kNotRun);
+  EXPECT_EQ(not_run.disposition, Disposition::kNotVerified);
+  EXPECT_EQ(not_run.verification_map[Provider::kReferenceHost], Disposition::kNotRun);
+}
+
+TEST(Profiler_VerificationPipeline, only_cutlass_results_are_merged) {
+
+  VerificationPipeline pipeline(1, 1 << 20);
+
+  PerformanceResultVector results = make_results(0);
+  PerformanceResult cublas;
+  cublas.provider = Provider::kCUBLAS;
+  cublas.disposition = Disposition::kNotVerified;
+  results.push_back(cublas);
+
+  PerformanceResultVector delivered;
+  pipeline.enqueue(Provider::kReferenceHost, 16, make_snapshot(Disposition::kIncorrect));
+  pipeline.append_results(results, [&](PerformanceResultVector const &ready) {
+    delivered = ready;
+  });
+  pipeline.flush(true);
+
+  ASSERT_EQ(delivered.size(), 2u);
+  EXPECT_EQ(delivered[0].disposition, Disposition::kIncorrect);
+  EXPECT_EQ(delivered[1].disposition, Disposition::kNotVerified);
+}
+
+TEST(Profiler_VerificationPipeline, task_exception_fails_verification) {
+
+  VerificationPipeline pipeline(2, 1 << 20);
+
+  Disposition disposition = Disposition::kInvalid;
+  pipeline.enqueue(Provider::kReferenceHost, 16, []() {
+    return VerificationPipeline::Task([]() -> Disposition {
+      throw std::runtime_error("reference failed");
+    });
+  });
+  pipeline.append_results(make_results(0), [&](PerformanceResultVector const &results) {
+    disposition = results.front().disposition;
+  });
+
+  pipeline.flush(true);
+  EXPECT_EQ(disposition, Disposition::kFailed);
+  EXPECT_EQ(pipeline.bytes_in_flight(), 0u);
+}
+
+TEST(Profiler_VerificationPipeline, zero_threads_runs_inline) {
+
+  VerificationPipeline pipeline(0, 1 << 20);
+  EXPECT_EQ(pipeline.thread_count(), 0);
+
+  std::thread::id caller = std::this_thread::get_id();
+  std::thread::id executor;
+
+  pipeline.enqueue(Provider::kReferenceHost, 16, [&]() {
+    return VerificationPipeline::Task([&]() {
+      executor = std::this_thread::get_id();
+      return Disposition::kPassed;
+    });
+  });
+
+  // Delivered immediately since the check already completed
+  Disposition disposition = Disposition::kInvalid;
+  pipeline.append_results(make_results(0), [&](PerformanceResultVector const &results) {
+    disposition = results.front().disposition;
+  });
+
+  EXPECT_EQ(executor, caller);
+  EXPECT_EQ(disposition, Disposition::kPassed);
+  EXPECT_EQ(pipeline.pending(), 0u);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
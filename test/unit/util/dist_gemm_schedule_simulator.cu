@@ -0,0 +1,344 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host-side Distributed GEMM schedule simulator
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
+#include "cutlass/util/dist_gemm_schedule_simulator.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cutlass::distributed::schedules;
+
+template <class TP, class ProcessorTiler, class IterationTiler, class PeerStride, class MStride,
+          class NStride, class ProcessorOffset, bool MemcpyA, int NumBuffersA, int NumBuffersD>
+using Schedule1D = BaseSchedule<
+    TP,
+    ProcessorTiler,
+    IterationTiler,
+    cute::Layout<cute::Shape<TP, TP>, PeerStride>,
+    cute::Layout<cute::Shape<TP, TP>, MStride>,
+    cute::Layout<cute::Shape<TP, TP>, NStride>,
+    cute::Layout<cute::Shape<TP, TP>, cute::Stride<cute::_0, cute::_0>>,
+    cute::Layout<cute::Shape<TP, TP>, cute::Stride<cute::_0, cute::_0>>,
+    ProcessorOffset,
+    MemcpyA,
+    false,
+    !MemcpyA,
+    NumBuffersA,
+    0,
+    0,
+    NumBuffersD>;
+
+/// ReduceScatter1D_TilingA_RotatingC whose M tile does not rotate across iterations
+using ReduceScatterFixedM = Schedule1D<
+    cute::_4, cute::Shape<cute::_1, cute::_1, cute::_4, cute::_1>, cute::Shape<cute::_4, cute::_1, cute::_1, cute::_1>,
+    cute::Stride<cute::_1, cute::_0>, cute::Stride<cute::_1, cute::_0>, cute::Stride<cute::_0, cute::_0>,
+    cute::_m1, false, 0, 3>;
+
+/// ReduceScatter1D_TilingA_RotatingC accumulating into the right rather than the left neighbor
+using ReduceScatterWrongPeer = Schedule1D<
+    cute::_4, cute::Shape<cute::_1, cute::_1, cute::_4, cute::_1>, cute::Shape<cute::_4, cute::_1, cute::_1, cute::_1>,
+    cute::Stride<cute::_1, cute::_0>, cute::Stride<cute::_1, cute::_m1>, cute::Stride<cute::_0, cute::_0>,
+    cute::_1, false, 0, 3>;
+
+/// AllGather1D_TilingCD_RotatingA copying A from the same peer in every iteration
+using AllGatherFixedPeer = Schedule1D<
+    cute::_4, cute::Shape<cute::_1, cute::_4, cute::_1, cute::_1>, cute::Shape<cute::_4, cute::_1, cute::_1, cute::_1>,
+    cute::Stride<cute::_1, cute::_0>, cute::Stride<cute::_1, cute::_1>, cute::Stride<cute::_0, cute::_0>,
+    cute::_0, true, 3, 0>;
+
+/// AllGatherHierarchical_TilingCD_RotatingA forwarding slices received in the wrong iteration
+struct AllGatherWrongForwarding: AllGatherHierarchical_TilingCD_RotatingA<cute::_4, cute::_2> {
+  static int
+  get_copy_source_iteration(int device_idx, int iteration) {
+    int source_iteration = AllGatherHierarchical_TilingCD_RotatingA::get_copy_source_iteration(device_idx, iteration);
+    return source_iteration > 0 ? iteration - 1 : 0;
+  }
+};
+
+template <class Schedule>
+typename cutlass::DistGemmScheduleSimulator<Schedule>::Result
+simulate(int m, int n, int k, int l = 1, int domain_size = 0) {
+  typename cutlass::DistGemmScheduleSimulator<Schedule>::Arguments args;
+  args.problem_size = cutlass::gemm::BatchedGemmCoord(m, n, k, l);
+  args.domain_size = domain_size;
+  return cutlass::DistGemmScheduleSimulator<Schedule>::run(args);
+}
+
+/// Traffic of a schedule for a 16384 x 16384 x 16384 GEMM
+struct Traffic {
+  bool valid = false;
+  uint64_t total_bytes = 0;
+  uint64_t inter_domain_bytes = 0;
+  double end_us = 0;
+};
+
+template <class Schedule>
+Traffic traffic(int domain_size) {
+  auto result = simulate<Schedule>(16384, 16384, 16384, 1, domain_size);
+  return Traffic{result.valid(), result.total_bytes(), result.inter_domain_bytes(), result.end_us()};
+}
+
+template <template <class> class Schedule>
+void expect_valid() {
+  for (int l : {1, 2}) {
+    auto result_2 = simulate<Schedule<cute::_2>>(4096, 2048, 1024, l);
+    auto result_4 = simulate<Schedule<cute::_4>>(4096, 2048, 1024, l);
+    auto result_8 = simulate<Schedule<cute::_8>>(4096, 2048, 1024, l);
+    EXPECT_TRUE(result_2.valid()) << (result_2.errors.empty() ? "" : result_2.errors.front());
+    EXPECT_TRUE(result_4.valid()) << (result_4.errors.empty() ? "" : result_4.errors.front());
+    EXPECT_TRUE(result_8.valid()) << (result_8.errors.empty() ? "" : result_8.errors.front());
+  }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DistGemmScheduleSimulator, all_gather_schedules_are_valid) {
+  expect_valid<AllGather1D_TilingCD_RotatingA>();
+  expect_valid<AllGather1D_TilingCD_RotatingB>();
+}
+
+TEST(DistGemmScheduleSimulator, reduce_scatter_schedules_are_valid) {
+  expect_valid<ReduceScatter1D_TilingA_RotatingC>();
+  expect_valid<ReduceScatter1D_TilingB_RotatingC>();
+}
+
+TEST(DistGemmScheduleSimulator, summa_schedules_are_valid) {
+  EXPECT_TRUE((simulate<SUMMA2D_TilingCD_RotatingAB<cute::_2>>(4096, 2048, 1024).valid()));
+  EXPECT_TRUE((simulate<SUMMA2D_TilingCD_RotatingAB<cute::_2>>(4096, 2048, 1024, 2).valid()));
+  EXPECT_TRUE((simulate<SUMMA2D_TilingCD_RotatingAB<cute::_4>>(4096, 2048, 1024, 2).valid()));
+
+  auto result = simulate<SUMMA2D_TilingCD_RotatingAB<cute::_4>>(4096, 2048, 1024);
+  ASSERT_TRUE(result.valid());
+
+  // Every device accumulates its own tile of D over P iterations, rotating A along the columns
+  // and B along the rows of the grid
+  for (int device = 0; device < 16; ++device) {
+    int x = device % 4;
+    int y = device / 4;
+    EXPECT_FALSE(result.step(device, 0).accumulates_local);
+    EXPECT_EQ(result.step(device, 0).bytes_copied, 0u);
+    for (int iteration = 0; iteration < 4; ++iteration) {
+      auto const &step = result.step(device, iteration);
+      EXPECT_EQ(step.m, x);
+      EXPECT_EQ(step.n, y);
+      EXPECT_EQ(step.k, (x + y + iteration) % 4);
+      if (iteration > 0) {
+        EXPECT_TRUE(step.accumulates_local);
+        EXPECT_EQ(step.peer_a, x + ((y + iteration) % 4) * 4);
+        EXPECT_EQ(step.peer_b, (x + iteration) % 4 + y * 4);
+        EXPECT_EQ(step.bytes_copied, uint64_t(4096 / 4 + 2048 / 4) * (1024 / 4) * 2);
+      }
+    }
+  }
+}
+
+TEST(DistGemmScheduleSimulator, all_gather_reduce_scatter_2d_schedules_are_valid) {
+  EXPECT_TRUE((simulate<AllGatherReduceScatter2D_TilingB_RotatingAC<cute::_2, cute::_2>>(4096, 2048, 1024).valid()));
+  EXPECT_TRUE((simulate<AllGatherReduceScatter2D_TilingB_RotatingAC<cute::_4, cute::_2>>(4096, 2048, 1024).valid()));
+  EXPECT_TRUE((simulate<AllGatherReduceScatter2D_TilingB_RotatingAC<cute::_2, cute::_4>>(4096, 2048, 1024, 2).valid()));
+
+  auto result = simulate<AllGatherReduceScatter2D_TilingB_RotatingAC<cute::_4, cute::_2>>(4096, 2048, 1024);
+  ASSERT_TRUE(result.valid());
+
+  // A is gathered along the rows at the start of every group of R = 2 iterations, and partial
+  // outputs are reduced along the columns within each group
+  for (int device = 0; device < 8; ++device) {
+    int x = device % 4;
+    int y = device / 4;
+    for (int iteration = 0; iteration < 8; ++iteration) {
+      auto const &step = result.step(device, iteration);
+      int group = iteration / 2;
+      EXPECT_EQ(step.m, (x + group) % 4);
+      EXPECT_EQ(step.k, y);
+      EXPECT_EQ(step.accumulates_peer, iteration % 2 == 1);
+      EXPECT_EQ(step.peer, x + (1 - y) * 4);
+      EXPECT_EQ(step.peer_a, iteration % 2 == 0 && iteration > 0 ? (x + group) % 4 + y * 4 : -1);
+    }
+    // The last step of every group reduces a tile of the device's own column of D
+    EXPECT_EQ(result.step(device, 7).n, x * 2 + y);
+  }
+}
+
+TEST(DistGemmScheduleSimulator, hierarchical_all_gather_schedules_are_valid) {
+  using Schedule = AllGatherHierarchical_TilingCD_RotatingA<cute::_4, cute::_2>;
+
+  EXPECT_TRUE((simulate<AllGatherHierarchical_TilingCD_RotatingA<cute::_2, cute::_2>>(4096, 2048, 1024).valid()));
+  EXPECT_TRUE((simulate<AllGatherHierarchical_TilingCD_RotatingA<cute::_8, cute::_2>>(4096, 2048, 1024).valid()));
+  EXPECT_TRUE((simulate<AllGatherHierarchical_TilingCD_RotatingB<cute::_4, cute::_4>>(4096, 2048, 1024).valid()));
+  EXPECT_TRUE((simulate<AllGatherHierarchical_TilingCD_RotatingB<cute::_2, cute::_4>>(4096, 2048, 1024, 2).valid()));
+
+  auto result = simulate<Schedule>(4096, 2048, 1024, 1, 4);
+  ASSERT_TRUE(result.valid());
+
+  // Slices within the domain are gathered first. Each device then copies one slice of the other
+  // domain, and receives the rest of them from the devices of its own domain.
+  for (int device = 0; device < 8; ++device) {
+    for (int iteration = 1; iteration < 8; ++iteration) {
+      auto const &step = result.step(device, iteration);
+      EXPECT_EQ(step.inter_domain, iteration == 4);
+      EXPECT_EQ(step.copy_source_iteration, iteration > 4 ? 4 : 0);
+      EXPECT_EQ(step.peer_a / 4, iteration == 4 ? 1 - device / 4 : device / 4);
+    }
+  }
+
+  // The total traffic is the same as for the 1-D ring, but only 1 / DomainSize of it crosses domains
+  auto ring = simulate<AllGather1D_TilingCD_RotatingA<cute::_8>>(4096, 2048, 1024, 1, 4);
+  ASSERT_TRUE(ring.valid());
+  EXPECT_EQ(result.total_bytes(), ring.total_bytes());
+  EXPECT_EQ(result.inter_domain_bytes() * 4, ring.inter_domain_bytes());
+}
+
+TEST(DistGemmScheduleSimulator, two_dimensional_schedules_reduce_inter_domain_traffic) {
+  // TP = 16 on two domains of 8 devices
+  auto all_gather_a = traffic<AllGather1D_TilingCD_RotatingA<cute::_16>>(8);
+  auto all_gather_b = traffic<AllGather1D_TilingCD_RotatingB<cute::_16>>(8);
+  auto reduce_scatter_a = traffic<ReduceScatter1D_TilingA_RotatingC<cute::_16>>(8);
+  auto reduce_scatter_b = traffic<ReduceScatter1D_TilingB_RotatingC<cute::_16>>(8);
+  auto summa = traffic<SUMMA2D_TilingCD_RotatingAB<cute::_4>>(8);
+  auto all_gather_reduce_scatter = traffic<AllGatherReduceScatter2D_TilingB_RotatingAC<cute::_4, cute::_4>>(8);
+  auto hierarchical = traffic<AllGatherHierarchical_TilingCD_RotatingA<cute::_8, cute::_2>>(8);
+
+  ASSERT_TRUE(summa.valid);
+  ASSERT_TRUE(all_gather_reduce_scatter.valid);
+  ASSERT_TRUE(hierarchical.valid);
+
+  // The 2-D schedules move less data in total, and less data across domains, than the 1-D
+  // schedules they generalize, and finish earlier than any of the 1-D schedules
+  for (Traffic const &result : {all_gather_a, all_gather_b, reduce_scatter_a, reduce_scatter_b}) {
+    ASSERT_TRUE(result.valid);
+    for (Traffic const &result_2d : {summa, all_gather_reduce_scatter}) {
+      EXPECT_LT(result_2d.total_bytes, result.total_bytes);
+      EXPECT_LT(result_2d.end_us, result.end_us);
+    }
+    EXPECT_LT(all_gather_reduce_scatter.inter_domain_bytes, result.inter_domain_bytes);
+  }
+
+  for (Traffic const &result : {all_gather_a, all_gather_b}) {
+    EXPECT_LT(summa.inter_domain_bytes, result.inter_domain_bytes);
+    EXPECT_LT(hierarchical.inter_domain_bytes, result.inter_domain_bytes);
+    EXPECT_EQ(hierarchical.total_bytes, result.total_bytes);
+    EXPECT_LT(hierarchical.end_us, result.end_us);
+  }
+}
+
+TEST(DistGemmScheduleSimulator, all_gather_traffic) {
+  // Every device receives the (TP - 1) A slices of its peers, one per iteration after the first
+  auto result = simulate<AllGather1D_TilingCD_RotatingA<cute::_4>>(4096, 2048, 1024);
+  uint64_t slice_bytes = 4096 / 4 * 1024 * 2;
+
+  ASSERT_TRUE(result.valid());
+  EXPECT_EQ(result.iteration_bytes(0), 0u);
+  for (int iteration = 1; iteration < 4; ++iteration) {
+    EXPECT_EQ(result.iteration_bytes(iteration), 4 * slice_bytes);
+    for (int device = 0; device < 4; ++device) {
+      EXPECT_EQ(result.step(device, iteration).bytes_copied, slice_bytes);
+      EXPECT_EQ(result.step(device, iteration).peer, (device + iteration) % 4);
+    }
+  }
+  EXPECT_EQ(result.total_bytes(), 12 * slice_bytes);
+}
+
+TEST(DistGemmScheduleSimulator, reduce_scatter_traffic) {
+  // Every iteration after the first accumulates into the partial output of the left neighbor
+  auto result = simulate<ReduceScatter1D_TilingB_RotatingC<cute::_8>>(4096, 2048, 1024);
+  uint64_t partial_bytes = 4096 * 2048 / 8 * 2;
+
+  ASSERT_TRUE(result.valid());
+  for (int device = 0; device < 8; ++device) {
+    EXPECT_FALSE(result.step(device, 0).accumulates_peer);
+    EXPECT_EQ(result.step(device, 0).bytes_peer_read, 0u);
+    for (int iteration = 1; iteration < 8; ++iteration) {
+      EXPECT_TRUE(result.step(device, iteration).accumulates_peer);
+      EXPECT_EQ(result.step(device, iteration).peer, (device + 7) % 8);
+      EXPECT_EQ(result.step(device, iteration).bytes_peer_read, partial_bytes);
+    }
+  }
+  EXPECT_EQ(result.total_bytes(), 8 * 7 * partial_bytes);
+}
+
+TEST(DistGemmScheduleSimulator, timeline) {
+  using Simulator = cutlass::DistGemmScheduleSimulator<AllGather1D_TilingCD_RotatingA<cute::_4>>;
+  Simulator::Arguments args;
+  args.problem_size = cutlass::gemm::BatchedGemmCoord(16384, 16384, 16384, 1);
+  args.device_tflops = 800.0;
+  args.peer_bandwidth_gbps = 400.0;
+
+  // Copies are hidden behind the GEMMs when the link is fast enough ...
+  Simulator::Result hidden = Simulator::run(args);
+  ASSERT_TRUE(hidden.valid());
+  for (auto const &device : hidden.devices) {
+    EXPECT_DOUBLE_EQ(device.exposed_communication_us(), 0.0);
+    EXPECT_DOUBLE_EQ(device.overlap(), 1.0);
+    EXPECT_DOUBLE_EQ(device.end_us, device.compute_us);
+  }
+
+  // ... and exposed otherwise
+  args.peer_bandwidth_gbps = 50.0;
+  Simulator::Result exposed = Simulator::run(args);
+  ASSERT_TRUE(exposed.valid());
+  for (auto const &device : exposed.devices) {
+    EXPECT_GT(device.exposed_communication_us(), 0.0);
+    EXPECT_LT(device.overlap(), 1.0);
+    EXPECT_GT(device.end_us, device.communication_us);
+  }
+}
+
+TEST(DistGemmScheduleSimulator, rejects_indivisible_problem) {
+  auto result = simulate<ReduceScatter1D_TilingA_RotatingC<cute::_8>>(4100, 2048, 1024);
+  EXPECT_FALSE(result.can_implement);
+  EXPECT_FALSE(result.valid());
+}
+
+TEST(DistGemmScheduleSimulator, detects_invalid_schedules) {
+  auto fixed_m = simulate<ReduceScatterFixedM>(4096, 2048, 1024);
+  auto wrong_peer = simulate<ReduceScatterWrongPeer>(4096, 2048, 1024);
+  auto fixed_peer = simulate<AllGatherFixedPeer>(4096, 2048, 1024);
+  auto wrong_forwarding = simulate<AllGatherWrongForwarding>(4096, 2048, 1024);
+
+  EXPECT_TRUE(fixed_m.can_implement);
+  EXPECT_FALSE(fixed_m.valid());
+  EXPECT_FALSE(wrong_peer.valid());
+  EXPECT_FALSE(fixed_peer.valid());
+  EXPECT_FALSE(fixed_peer.errors.empty());
+  EXPECT_FALSE(wrong_forwarding.valid());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,332 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host-side runtime layout algebra, cross-checked against static CuTe
+*/
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/layout.hpp"
+#include "cute/swizzle_layout.hpp"
+#include "cutlass/util/dynamic_layout.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+namespace dl = cutlass::dynamic_layout;
+
+/// Expects the runtime result to be the same layout as the static CuTe result
+template <class StaticLayout>
+void expect_same(dl::Context &ctx, dl::Layout const &dynamic, StaticLayout const &reference) {
+  EXPECT_EQ(dl::to_string(dynamic), dl::to_string(dl::make_layout(ctx, reference)));
+}
+
+/// Random hierarchical shape of rank 1-3 with modes nested up to depth 2
+dl::IntTuple random_shape(dl::Context &ctx, std::mt19937 &rng, int depth = 0) {
+  static int64_t const extents[] = {1, 2, 3, 4, 6, 8};
+  std::uniform_int_distribution<int> rank_dist(1, 3);
+  std::uniform_int_distribution<int> extent_dist(0, 5);
+  std::uniform_int_distribution<int> nest_dist(0, 3);
+
+  std::vector<dl::IntTuple> modes;
+  int rank = rank_dist(rng);
+  for (int i = 0; i < rank; ++i) {
+    if (depth < 1 && nest_dist(rng) == 0) {
+      modes.push_back(random_shape(ctx, rng, depth + 1));
+    } else {
+      modes.push_back(ctx.make_int(extents[extent_dist(rng)]));
+    }
+  }
+  return ctx.make_tuple(modes);
+}
+
+/// Injective layout of the given shape: compact strides assigned to the flat modes in random order
+dl::Layout random_injective_layout(dl::Context &ctx, std::mt19937 &rng, dl::IntTuple const &shape) {
+  std::vector<int64_t> flat = dl::flatten_values(shape);
+  std::vector<size_t> order(flat.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::shuffle(order.begin(), order.end(), rng);
+
+  std::vector<int64_t> flat_stride(flat.size());
+  int64_t current = 1;
+  for (size_t i : order) {
+    flat_stride[i] = current;
+    current *= flat[i];
+  }
+
+  // Rebuild the strides with the hierarchy of the shape
+  size_t next = 0;
+  std::function<dl::IntTuple(dl::IntTuple const &)> rebuild = [&](dl::IntTuple const &s) {
+    if (s.is_integral()) {
+      return ctx.make_int(flat_stride[next++]);
+    }
+    std::vector<dl::IntTuple> modes;
+    for (int i = 0; i < s.rank(); ++i) {
+      modes.push_back(rebuild(s[i]));
+    }
+    return ctx.make_tuple(modes);
+  };
+  return dl::make_layout(shape, rebuild(shape));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DynamicLayout, interning_and_parsing) {
+  dl::Context ctx;
+
+  dl::IntTuple a = ctx.parse("((2,_4),8)");
+  dl::IntTuple b = ctx.make_tuple({ctx.make_tuple(std::vector<int64_t>{2, 4}), ctx.make_int(8)});
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a.id(), b.id());
+  EXPECT_EQ(dl::to_string(a), "((2,4),8)");
+  EXPECT_EQ(a.rank(), 2);
+  EXPECT_EQ(dl::depth(a), 2);
+  EXPECT_EQ(a.product(), 64);
+  EXPECT_EQ(ctx.parse("()").rank(), 0);
+  EXPECT_NE(ctx.parse("(8)"), ctx.parse("8"));
+
+  size_t nodes = ctx.node_count();
+  ctx.parse("((2,4),8)");
+  EXPECT_EQ(ctx.node_count(), nodes);
+
+  dl::Layout layout = ctx.parse_layout("(_4,_8):(_8,_1)");
+  expect_same(ctx, layout, cute::Layout<cute::Shape<cute::_4,cute::_8>, cute::Stride<cute::_8,cute::_1>>{});
+  EXPECT_EQ(ctx.parse_layout("((2,4),8)"), dl::make_layout(a));
+
+  EXPECT_THROW(ctx.parse("(2,"), std::invalid_argument);
+  EXPECT_THROW(ctx.parse_layout("(2,4):8"), std::invalid_argument);
+
+  dl::Context other;
+  EXPECT_THROW(other.make_tuple({a}), std::invalid_argument);
+}
+
+TEST(DynamicLayout, coordinates) {
+  using namespace cute;
+  dl::Context ctx;
+
+  auto reference = Layout<Shape<Shape<_2,_3>,_4>, Stride<Stride<_12,_1>,_3>>{};
+  dl::Layout layout = dl::make_layout(ctx, reference);
+
+  EXPECT_EQ(dl::size(layout), size(reference));
+  EXPECT_EQ(dl::cosize(layout), cosize(reference));
+  for (int i = 0; i < size(reference); ++i) {
+    EXPECT_EQ(layout(i), reference(i));
+    dl::IntTuple coord = dl::idx2crd(i, layout.shape);
+    EXPECT_EQ(layout(coord), reference(i));
+    EXPECT_EQ(dl::to_string(coord), dl::to_string(dl::make_int_tuple(ctx, idx2crd(i, reference.shape()))));
+  }
+}
+
+TEST(DynamicLayout, unary_ops_match_cute) {
+  using namespace cute;
+  dl::Context ctx;
+
+  auto layouts = cute::make_tuple(
+    Layout<_1,_0>{},
+    Layout<_8,_1>{},
+    Layout<Shape<_4,_8>, Stride<_8,_1>>{},
+    Layout<Shape<_8,_4>, Stride<_1,_16>>{},
+    Layout<Shape<_4,_1,_3>, Stride<_3,_7,_1>>{},
+    Layout<Shape<Shape<_2,_4>,Shape<_3,_2>>, Stride<Stride<_1,_6>,Stride<_2,_24>>>{},
+    Layout<Shape<_2,Shape<_4,_2>>, Stride<_4,Stride<_1,_8>>>{});
+
+  cute::for_each(layouts, [&](auto const &reference) {
+    dl::Layout layout = dl::make_layout(ctx, reference);
+    SCOPED_TRACE(dl::to_string(layout));
+    expect_same(ctx, dl::coalesce(layout),      coalesce(reference));
+    expect_same(ctx, dl::filter(layout),        filter(reference));
+    expect_same(ctx, dl::right_inverse(layout), right_inverse(reference));
+    expect_same(ctx, dl::left_inverse(layout),  left_inverse(reference));
+    expect_same(ctx, dl::complement(layout),    complement(reference));
+    expect_same(ctx, dl::complement(layout, 128), complement(reference, Int<128>{}));
+    expect_same(ctx, dl::complement(layout, ctx.parse("(16,12)")), complement(reference, Shape<_16,_12>{}));
+  });
+
+  // Layouts with stride-0 modes
+  auto broadcast = Layout<Shape<_4,_3,_2>, Stride<_0,_1,_3>>{};
+  dl::Layout layout = dl::make_layout(ctx, broadcast);
+  expect_same(ctx, dl::coalesce(layout),      coalesce(broadcast));
+  expect_same(ctx, dl::filter(layout),        filter(broadcast));
+  expect_same(ctx, dl::right_inverse(layout), right_inverse(broadcast));
+  expect_same(ctx, dl::left_inverse(layout),  left_inverse(broadcast));
+  expect_same(ctx, dl::complement(layout, 24), complement(broadcast, Int<24>{}));
+}
+
+TEST(DynamicLayout, binary_ops_match_cute) {
+  using namespace cute;
+  dl::Context ctx;
+
+  auto layouts = cute::make_tuple(
+    Layout<Shape<_8,_8>, Stride<_8,_1>>{},
+    Layout<Shape<Shape<_2,_4>,_8>, Stride<Stride<_1,_16>,_2>>{},
+    Layout<Shape<_16,_4>, Stride<_1,_32>>{});
+
+  auto tilers = cute::make_tuple(
+    Layout<_4,_1>{},
+    Layout<_4,_2>{},
+    Layout<Shape<_2,_4>, Stride<_1,_8>>{},
+    Layout<Shape<_2,_2>, Stride<_4,_1>>{});
+
+  cute::for_each(layouts, [&](auto const &reference) {
+    dl::Layout layout = dl::make_layout(ctx, reference);
+    cute::for_each(tilers, [&](auto const &tiler_reference) {
+      dl::Layout tiler = dl::make_layout(ctx, tiler_reference);
+      SCOPED_TRACE(dl::to_string(layout) + " / " + dl::to_string(tiler));
+      expect_same(ctx, dl::composition(layout, tiler),     composition(reference, tiler_reference));
+      expect_same(ctx, dl::logical_divide(layout, tiler),  logical_divide(reference, tiler_reference));
+      expect_same(ctx, dl::logical_product(tiler, layout), logical_product(tiler_reference, reference));
+    });
+
+    // Mode-by-mode tilers
+    auto by_mode = make_tile(Layout<_4,_1>{}, Layout<_2,_2>{});
+    dl::Tiler tiler{dl::make_layout(ctx, get<0>(by_mode)), dl::make_layout(ctx, get<1>(by_mode))};
+    SCOPED_TRACE(dl::to_string(layout) + " / by-mode");
+    expect_same(ctx, dl::composition(layout, tiler),     composition(reference, by_mode));
+    expect_same(ctx, dl::logical_divide(layout, tiler),  logical_divide(reference, by_mode));
+    expect_same(ctx, dl::zipped_divide(layout, tiler),   zipped_divide(reference, by_mode));
+    expect_same(ctx, dl::tiled_divide(layout, tiler),    tiled_divide(reference, by_mode));
+    expect_same(ctx, dl::zipped_product(layout, tiler),  zipped_product(reference, by_mode));
+    expect_same(ctx, dl::composition(layout, 16),        composition(reference, Int<16>{}));
+  });
+}
+
+TEST(DynamicLayout, swizzle_matches_cute) {
+  using namespace cute;
+  dl::Context ctx;
+
+  auto reference = composition(Swizzle<3,4,3>{}, Layout<Shape<_8,_64>, Stride<_64,_1>>{});
+  dl::SwizzledLayout layout = dl::make_layout(ctx, reference);
+  EXPECT_EQ(layout.swizzle, dl::Swizzle(3, 4, 3));
+  for (int i = 0; i < size(reference); ++i) {
+    EXPECT_EQ(layout(i), reference(i));
+  }
+
+  auto tiled = composition(reference, Layout<Shape<_8,_8>, Stride<_64,_1>>{});
+  dl::SwizzledLayout dynamic_tiled = dl::composition(layout, ctx.parse_layout("(8,8):(64,1)"));
+  for (int i = 0; i < size(tiled); ++i) {
+    EXPECT_EQ(dynamic_tiled(i), tiled(i));
+  }
+
+  dl::Swizzle left(2, 1, -3);
+  for (int i = 0; i < 1024; ++i) {
+    EXPECT_EQ(left(i), (Swizzle<2,1,-3>{}(i)));
+  }
+
+  EXPECT_THROW(dl::Swizzle(3, 4, 2), std::invalid_argument);
+}
+
+TEST(DynamicLayout, algebra_properties) {
+  dl::Context ctx;
+  std::mt19937 rng(2025);
+  int compositions = 0;
+
+  for (int trial = 0; trial < 200; ++trial) {
+    dl::Layout a = random_injective_layout(ctx, rng, random_shape(ctx, rng));
+    int64_t n = dl::size(a);
+    SCOPED_TRACE(dl::to_string(a));
+
+    // coalesce preserves the function on the domain
+    dl::Layout c = dl::coalesce(a);
+    EXPECT_LE(dl::depth(c), 1);
+    for (int64_t i = 0; i < n; ++i) {
+      EXPECT_EQ(c(i), a(i));
+    }
+
+    // a is a bijection onto [0, n), so both inverses are complete
+    dl::Layout r = dl::right_inverse(a);
+    dl::Layout l = dl::left_inverse(a);
+    EXPECT_EQ(dl::size(r), n);
+    for (int64_t i = 0; i < n; ++i) {
+      EXPECT_EQ(a(r(i)), i);
+      EXPECT_EQ(l(a(i)), i);
+    }
+
+    // (a, complement(a, 4n)) is a bijection onto [0, 4n)
+    dl::Layout full = dl::make_layout(a, dl::complement(a, 4 * n));
+    EXPECT_EQ(dl::size(full), 4 * n);
+    std::set<int64_t> image;
+    for (int64_t i = 0; i < dl::size(full); ++i) {
+      image.insert(full(i));
+    }
+    EXPECT_EQ(int64_t(image.size()), 4 * n);
+    EXPECT_EQ(*image.rbegin(), 4 * n - 1);
+
+    // composition agrees with function composition under the strong divisibility condition,
+    // which holds when every extent of a is a power of two
+    dl::Layout b = random_injective_layout(ctx, rng, ctx.parse("(2,2)"));
+    std::vector<int64_t> extents = dl::flatten_values(a.shape);
+    bool power_of_two = std::all_of(extents.begin(), extents.end(), [](int64_t e) { return (e & (e - 1)) == 0; });
+    if (power_of_two && n % 4 == 0) {
+      try {
+        dl::Layout ab = dl::composition(a, b);
+        ++compositions;
+        for (int64_t i = 0; i < dl::size(b); ++i) {
+          EXPECT_EQ(ab(i), a(b(i)));
+        }
+      } catch (std::invalid_argument const &) {
+      }
+    }
+  }
+
+  EXPECT_GT(compositions, 20);
+}
+
+TEST(DynamicLayout, operation_cache) {
+  dl::Context ctx;
+  dl::Layout a = ctx.parse_layout("((2,4),8):((1,16),2)");
+  dl::Layout t = ctx.parse_layout("(2,4):(1,8)");
+
+  dl::Layout first = dl::logical_divide(a, t);
+  uint64_t misses = ctx.cache_misses();
+  uint64_t hits = ctx.cache_hits();
+
+  dl::Layout second = dl::logical_divide(ctx.parse_layout("((2,4),8):((1,16),2)"), ctx.parse_layout("(2,4):(1,8)"));
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(ctx.cache_misses(), misses);
+  EXPECT_EQ(ctx.cache_hits(), hits + 1);
+
+  ctx.clear_cache();
+  EXPECT_EQ(dl::logical_divide(a, t), first);
+  EXPECT_GT(ctx.cache_misses(), 0u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,246 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the grouped host reference driver and memory-mapped operand source
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/util/reference/host/gett.hpp"
+#include "cutlass/util/reference/host/grouped_gett.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+namespace ref = cutlass::reference::host;
+
+using ProblemShape = cute::Shape<int, int, int>;
+
+/// Operands A (M,K), B (N,K) and the output D (M,N) under test of each group, stored back to back
+struct GroupedOperandFile {
+  std::string path;
+  std::vector<ProblemShape> problems;
+  std::vector<size_t> offsets;
+  std::vector<size_t> bytes;
+
+  GroupedOperandFile(std::vector<ProblemShape> problems_, int corrupted_group)
+      : path(testing::TempDir() + "cutlass_grouped_gett_" + std::to_string(std::random_device{}()) + ".bin"),
+        problems(problems_) {
+    std::ofstream file(path, std::ios::binary);
+    std::mt19937 rng(2025);
+    std::uniform_int_distribution<int> dist(-4, 4);
+    size_t offset = 0;
+
+    for (int group_idx = 0; group_idx < int(problems.size()); ++group_idx) {
+      auto [M, N, K] = problems[group_idx];
+      std::vector<float> A(size_t(M) * K), B(size_t(N) * K), D(size_t(M) * N, 0.f);
+      for (auto &a : A) { a = float(dist(rng)); }
+      for (auto &b : B) { b = float(dist(rng)); }
+      for (int m = 0; m < M; ++m) {
+        for (int n = 0; n < N; ++n) {
+          for (int k = 0; k < K; ++k) {
+            D[m * N + n] += A[m * K + k] * B[n * K + k];
+          }
+        }
+      }
+      if (group_idx == corrupted_group) {
+        D.back() += 1.f;
+      }
+
+      offsets.push_back(offset);
+      for (auto const *v : {&A, &B, &D}) {
+        file.write(reinterpret_cast<char const *>(v->data()), v->size() * sizeof(float));
+        offset += v->size() * sizeof(float);
+      }
+      bytes.push_back(offset - offsets.back());
+    }
+  }
+
+  ~GroupedOperandFile() {
+    std::remove(path.c_str());
+  }
+
+  /// Runs Gett() on the mapped operands of `group_idx` and compares against the stored D
+  bool verify(ref::MappedFile const &mapped, int group_idx) const {
+    using namespace cute;
+    auto [M, N, K] = problems[group_idx];
+    size_t offset = offsets[group_idx];
+
+    float const *ptr_A = mapped.data_at<float>(offset);
+    float const *ptr_B = ptr_A + size_t(M) * K;
+    float const *ptr_D = ptr_B + size_t(N) * K;
+
+    auto A = make_tensor(ptr_A, make_layout(make_shape(M, K, 1), make_stride(K, 1, 0)));
+    auto B = make_tensor(ptr_B, make_layout(make_shape(N, K, 1), make_stride(K, 1, 0)));
+    std::vector<float> reference(size_t(M) * N);
+    auto D = make_tensor(reference.data(), make_layout(make_shape(M, N, 1), make_stride(N, 1, 0)));
+
+    ref::GettMainloopParams<float, decltype(A), decltype(B)> mainloop_params{};
+    mainloop_params.A = A;
+    mainloop_params.B = B;
+    ref::GettEpilogueParams<float, float, float, float, decltype(D), decltype(D)> epilogue_params(1.f, 0.f, D, D);
+    ref::Gett(mainloop_params, epilogue_params);
+
+    bool passed = std::equal(reference.begin(), reference.end(), ptr_D);
+    mapped.release(offset, bytes[group_idx]);
+    return passed;
+  }
+};
+
+/// Expert sizes of a mixture-of-experts layer: uneven token counts per expert
+std::vector<ProblemShape> moe_problems(int experts) {
+  std::vector<ProblemShape> problems;
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> tokens(0, 96);
+  for (int e = 0; e < experts; ++e) {
+    problems.push_back(ProblemShape{tokens(rng), 32, 48});
+  }
+  return problems;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GroupedGettReference, longest_first_order) {
+  std::vector<double> costs = {4, 9, 1, 9, 0, 4};
+  std::vector<int> expected = {1, 3, 0, 5, 2, 4};
+  EXPECT_EQ(ref::longest_first_order(costs), expected);
+
+  EXPECT_EQ(ref::gemm_cost(cute::make_shape(2, 3, 4)), 24.0);
+  EXPECT_EQ(ref::gemm_cost(cute::make_shape(2, 3, 4, 5)), 120.0);
+  EXPECT_EQ(ref::gemm_cost(cutlass::gemm::GemmCoord(2, 3, 4)), 24.0);
+}
+
+TEST(GroupedGettReference, moe_from_mapped_file) {
+  auto problems = moe_problems(40);
+  GroupedOperandFile operands(problems, 17);
+  ref::MappedFile mapped(operands.path);
+  ASSERT_EQ(mapped.size(), operands.offsets.back() + operands.bytes.back());
+
+  for (int thread_count : {1, 4}) {
+    ref::GroupedReferenceOptions options;
+    options.thread_count = thread_count;
+    auto result = ref::run_grouped_reference(problems, operands.bytes,
+      [&](int group_idx) { return operands.verify(mapped, group_idx); }, options);
+
+    EXPECT_FALSE(result.passed());
+    EXPECT_EQ(result.failed_groups, std::vector<int>{17});
+  }
+}
+
+TEST(GroupedGettReference, resident_bytes_bound) {
+  auto problems = moe_problems(64);
+  GroupedOperandFile operands(problems, -1);
+  ref::MappedFile mapped(operands.path);
+
+  size_t largest = *std::max_element(operands.bytes.begin(), operands.bytes.end());
+  ref::GroupedReferenceOptions options;
+  options.thread_count = 8;
+  options.max_resident_bytes = largest + largest / 2;
+
+  std::atomic<size_t> in_flight{0};
+  std::atomic<size_t> peak{0};
+  std::vector<int> started;
+  std::mutex mutex;
+
+  auto result = ref::run_grouped_reference(problems, operands.bytes, [&](int group_idx) {
+    size_t now = in_flight += operands.bytes[group_idx];
+    size_t seen = peak;
+    while (now > seen && !peak.compare_exchange_weak(seen, now)) {}
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      started.push_back(group_idx);
+    }
+    bool passed = operands.verify(mapped, group_idx);
+    in_flight -= operands.bytes[group_idx];
+    return passed;
+  }, options);
+
+  EXPECT_TRUE(result.passed());
+  EXPECT_LE(peak.load(), options.max_resident_bytes);
+  EXPECT_LE(result.peak_resident_bytes, options.max_resident_bytes);
+  EXPECT_GE(result.peak_resident_bytes, peak.load());
+
+  // Groups start from the most expensive
+  ASSERT_EQ(started.size(), problems.size());
+  EXPECT_EQ(ref::gemm_cost(problems[started.front()]),
+            ref::gemm_cost(*std::max_element(problems.begin(), problems.end(), [](auto a, auto b) {
+              return ref::gemm_cost(a) < ref::gemm_cost(b); })));
+
+  // A group larger than the bound still runs, alone
+  options.max_resident_bytes = 1;
+  peak = 0;
+  result = ref::run_grouped_reference(problems, operands.bytes, [&](int group_idx) {
+    size_t now = ++in_flight;
+    size_t seen = peak;
+    while (now > seen && !peak.compare_exchange_weak(seen, now)) {}
+    bool passed = operands.verify(mapped, group_idx);
+    --in_flight;
+    return passed;
+  }, options);
+  EXPECT_TRUE(result.passed());
+  EXPECT_EQ(peak.load(), 1u);
+}
+
+TEST(GroupedGettReference, exceptions_propagate) {
+  // The failing group is the most expensive, so it starts first
+  std::vector<double> costs(32, 1.0);
+  costs[3] = 2.0;
+  std::atomic<int> calls{0};
+  ref::GroupedReferenceOptions options;
+  options.thread_count = 4;
+  EXPECT_THROW(ref::run_grouped_reference(costs, {}, [&](int group_idx) {
+    ++calls;
+    if (group_idx == 3) {
+      throw std::runtime_error("failed to load group");
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    return true;
+  }, options), std::runtime_error);
+  EXPECT_LT(calls.load(), 32);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,268 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host block-scaled quantizer against the scaling of the host GETT reference
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/host_blockscaled_quantizer.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cute;
+
+std::vector<float> random_matrix(int64_t size, int seed) {
+  std::mt19937 generator(seed);
+  std::normal_distribution<float> normal(0.0f, 1.0f);
+  std::uniform_real_distribution<float> exponent(-6.0f, 6.0f);
+  std::vector<float> data(size);
+  for (auto &x : data) {
+    // Magnitudes spread over several binades exercise every scale factor exponent
+    x = normal(generator) * std::exp2(exponent(generator));
+  }
+  return data;
+}
+
+/// Quantizes (M,K,L) row-major `src` with the per-vector steps of
+/// compute_1d_scaling_factor_and_quantized_output() and checks the outputs of the quantizer
+template <class ElementData, class ElementSF, int SFVecSize>
+void check_quantize(int M, int K, int L, float global_scale, int thread_count) {
+  using Quantizer = cutlass::HostBlockScaledQuantizer<ElementData, ElementSF, SFVecSize>;
+  using SfConfig = typename Quantizer::SfConfig;
+  using Storage = cute::uint_bit_t<cute::sizeof_bits_v<ElementData>>;
+
+  auto problem_shape = make_shape(M, 1, K, L);
+  auto layout_src = make_layout(make_shape(M, K, L), make_stride(int64_t(K), _1{}, int64_t(M) * K));
+  auto layout_sf = SfConfig::tile_atom_to_shape_SFA(problem_shape);
+
+  std::vector<float> src = random_matrix(int64_t(M) * K * L, M + K);
+  // A zero vector and one with a NaN
+  for (int k = 0; k < std::min(K, SFVecSize); ++k) {
+    src[layout_src(1, k, 0)] = 0.0f;
+  }
+  src[layout_src(2, 0, 0)] = std::numeric_limits<float>::quiet_NaN();
+
+  cute::array_subbyte<ElementData, 1 << 20> data_storage;
+  std::vector<ElementSF> sf_storage(cosize(layout_sf), ElementSF::bitcast(0x5a));
+  auto data = make_tensor(data_storage.begin(), layout_src);
+  auto sf = make_tensor(sf_storage.data(), layout_sf);
+  ASSERT_LE(cosize(layout_src), int64_t(data_storage.size()));
+
+  Quantizer(thread_count).quantize(make_tensor(src.data(), layout_src), data, sf, global_scale);
+
+  float const fp_max = float(std::numeric_limits<ElementData>::max());
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int k0 = 0; k0 < K; k0 += SFVecSize) {
+        float amax = 0.0f;
+        for (int k = k0; k < std::min(K, k0 + SFVecSize); ++k) {
+          amax = cutlass::maximum_with_nan_propogation<float>{}(amax, std::fabs(src[layout_src(m, k, l)]));
+        }
+        ElementSF expected_sf = static_cast<ElementSF>(amax * (global_scale * (1.0f / fp_max)));
+        float acc_scale = global_scale * (1.0f / float(expected_sf));
+        acc_scale = cutlass::minimum_with_nan_propagation<float>{}(acc_scale, std::numeric_limits<float>::max());
+
+        ASSERT_EQ(sf(m, k0, l).raw(), expected_sf.raw()) << "m=" << m << " k=" << k0 << " l=" << l;
+        for (int k = k0; k < std::min(K, k0 + SFVecSize); ++k) {
+          ElementData expected = cutlass::NumericConverter<ElementData, float>{}(src[layout_src(m, k, l)] * acc_scale);
+          ASSERT_EQ(Storage(ElementData(data(m, k, l)).raw()), Storage(expected.raw()))
+            << "m=" << m << " k=" << k << " l=" << l;
+        }
+      }
+    }
+
+    // Padding of the scale factor tiles past M and K
+    for (int m = 0; m < int(size<0>(layout_sf)); ++m) {
+      for (int k = 0; k < int(size<1>(layout_sf)); k += SFVecSize) {
+        if (m >= M || k >= K) {
+          ASSERT_EQ(sf(m, k, l).raw(), 0);
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostBlockScaledQuantizer, e2m1_thresholds_match_converter) {
+  using Quantizer = cutlass::HostBlockScaledQuantizer<cutlass::float_e2m1_t, cutlass::float_ue4m3_t, 16>;
+  cutlass::NumericConverter<cutlass::float_e2m1_t, float> converter;
+
+  auto check = [&](float x) {
+    ASSERT_EQ(int(Quantizer::quantize_e2m1(x)), int(converter(x).raw())) << "x=" << x;
+  };
+
+  // Every rounding boundary, its neighbours, and the special values
+  for (float boundary : {0.0f, 0.25f, 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 1.75f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f, 5.0f, 6.0f}) {
+    for (float sign : {1.0f, -1.0f}) {
+      float x = sign * boundary;
+      check(x);
+      check(std::nextafter(x, 0.0f));
+      check(std::nextafter(x, sign * 8.0f));
+    }
+  }
+  for (float x : {std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(),
+                  std::numeric_limits<float>::denorm_min(), std::numeric_limits<float>::max()}) {
+    check(x);
+    check(-x);
+  }
+
+  // A sweep over all exponents and signs of float
+  for (uint64_t bits = 0; bits < (uint64_t(1) << 32); bits += 65521) {
+    uint32_t word = uint32_t(bits);
+    float x;
+    std::memcpy(&x, &word, sizeof(x));
+    check(x);
+  }
+}
+
+TEST(HostBlockScaledQuantizer, nvfp4_vector16) {
+  check_quantize<cutlass::float_e2m1_t, cutlass::float_ue4m3_t, 16>(200, 96, 2, 1.0f, 0);
+  check_quantize<cutlass::float_e2m1_t, cutlass::float_ue4m3_t, 16>(130, 40, 1, 2.5f, 3);
+  // Odd M*K: batches share a byte of packed data, so blocks must not be written concurrently
+  check_quantize<cutlass::float_e2m1_t, cutlass::float_ue4m3_t, 16>(257, 257, 3, 1.0f, 3);
+}
+
+TEST(HostBlockScaledQuantizer, mxfp4_vector32) {
+  check_quantize<cutlass::float_e2m1_t, cutlass::float_ue8m0_t, 32>(256, 128, 1, 1.0f, 0);
+  check_quantize<cutlass::float_e2m1_t, cutlass::float_ue8m0_t, 32>(97, 80, 3, 0.5f, 2);
+}
+
+TEST(HostBlockScaledQuantizer, mxfp6_mxfp8_vector32) {
+  check_quantize<cutlass::float_e2m3_t, cutlass::float_ue8m0_t, 32>(160, 64, 2, 1.0f, 0);
+  check_quantize<cutlass::float_e3m2_t, cutlass::float_ue8m0_t, 32>(64, 96, 1, 1.0f, 0);
+  check_quantize<cutlass::float_e4m3_t, cutlass::float_ue8m0_t, 32>(144, 96, 2, 1.0f, 0);
+}
+
+TEST(HostBlockScaledQuantizer, scale_factor_placement) {
+  // Offsets of the K-major scale factor atom ((32,4),(SFVecSize,4)):((16,4),(0,1)), tiled K first
+  constexpr int SFVecSize = 16;
+  using SfConfig = cutlass::detail::Sm1xxBlockScaledConfig<SFVecSize>;
+  int const M = 300, K = 200, L = 2;
+  auto layout_sf = SfConfig::tile_atom_to_shape_SFA(make_shape(M, 1, K, L));
+  int const tiles_m = (M + 127) / 128;
+  int const tiles_k = (K + 4 * SFVecSize - 1) / (4 * SFVecSize);
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < tiles_m * 128; ++m) {
+      for (int k = 0; k < tiles_k * 4 * SFVecSize; ++k) {
+        int64_t tile = (int64_t(l) * tiles_m + m / 128) * tiles_k + k / (4 * SFVecSize);
+        int64_t expected = tile * 512 + (m % 32) * 16 + ((m / 32) % 4) * 4 + (k / SFVecSize) % 4;
+        ASSERT_EQ(int64_t(layout_sf(m, k, l)), expected) << "m=" << m << " k=" << k << " l=" << l;
+      }
+    }
+  }
+}
+
+TEST(HostBlockScaledQuantizer, layouts_and_dequantize) {
+  using ElementData = cutlass::float_e2m1_t;
+  using ElementSF = cutlass::float_ue4m3_t;
+  using Quantizer = cutlass::HostBlockScaledQuantizer<ElementData, ElementSF, 16>;
+  int const N = 136, K = 64, L = 2;
+  auto problem_shape = make_shape(1, N, K, L);
+  auto layout_sf = Quantizer::SfConfig::tile_atom_to_shape_SFB(problem_shape);
+  auto layout_k_major = make_layout(make_shape(N, K, L), make_stride(int64_t(K), _1{}, int64_t(N) * K));
+  auto layout_n_major = make_layout(make_shape(N, K, L), make_stride(_1{}, int64_t(N), int64_t(N) * K));
+
+  std::vector<float> src_float = random_matrix(int64_t(N) * K * L, 7);
+  std::vector<cutlass::bfloat16_t> src(src_float.size());
+  for (size_t i = 0; i < src.size(); ++i) {
+    src[i] = cutlass::bfloat16_t(src_float[i]);
+  }
+
+  // bfloat16 source, N-major (column-major B) data and K-major data agree, for any thread count
+  cute::array_subbyte<ElementData, 1 << 15> data_k, data_n;
+  std::vector<ElementSF> sf_k(cosize(layout_sf)), sf_n(cosize(layout_sf));
+  Quantizer(1).quantize(make_tensor(src.data(), layout_k_major),
+                        make_tensor(data_k.begin(), layout_k_major), make_tensor(sf_k.data(), layout_sf));
+  Quantizer(5).quantize(make_tensor(src.data(), layout_k_major),
+                        make_tensor(data_n.begin(), layout_n_major), make_tensor(sf_n.data(), layout_sf));
+
+  auto tensor_k = make_tensor(data_k.begin(), layout_k_major);
+  auto tensor_n = make_tensor(data_n.begin(), layout_n_major);
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < N; ++n) {
+      for (int k = 0; k < K; ++k) {
+        ASSERT_EQ(ElementData(tensor_k(n, k, l)).raw(), ElementData(tensor_n(n, k, l)).raw());
+      }
+    }
+  }
+  for (size_t i = 0; i < sf_k.size(); ++i) {
+    ASSERT_EQ(sf_k[i].raw(), sf_n[i].raw());
+  }
+
+  // Dequantization inverts the scaling exactly, and the error is bounded by half an e2m1 step of amax
+  float const global_scale = 4.0f;
+  std::vector<ElementSF> sf(cosize(layout_sf));
+  Quantizer().quantize(make_tensor(src_float.data(), layout_k_major),
+                       make_tensor(data_k.begin(), layout_k_major), make_tensor(sf.data(), layout_sf), global_scale);
+  std::vector<float> dst(src_float.size());
+  Quantizer().dequantize(make_tensor(data_k.begin(), layout_k_major), make_tensor(sf.data(), layout_sf),
+                         make_tensor(dst.data(), layout_k_major), global_scale);
+
+  auto tensor_sf = make_tensor(sf.data(), layout_sf);
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < N; ++n) {
+      for (int k0 = 0; k0 < K; k0 += 16) {
+        float scale = float(tensor_sf(n, k0, l));
+        float amax = 0.0f;
+        for (int k = k0; k < k0 + 16; ++k) {
+          amax = std::max(amax, std::fabs(src_float[layout_k_major(n, k, l)]));
+        }
+        for (int k = k0; k < k0 + 16; ++k) {
+          float x = src_float[layout_k_major(n, k, l)];
+          float y = dst[layout_k_major(n, k, l)];
+          EXPECT_EQ(y, float(ElementData(tensor_k(n, k, l))) * scale / global_scale);
+          // Steps of e2m1 are at most 2 (between 4 and 6), a third of its range; the scale factor
+          // rounds amax by at most 1/16 in e4m3
+          EXPECT_LE(std::fabs(x - y), amax * (1.0f / 6.0f + 1.0f / 8.0f) + 1e-30f) << "n=" << n << " k=" << k;
+        }
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,437 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host fused multi-head attention references against a naive softmax(QK^T)V
+*/
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/reference/host/fmha.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cute;
+namespace ref = cutlass::reference::host;
+
+// Mirrors of the problem-shape extents and masks of cutlass::fmha::collective
+struct VariableLength {
+  int max_length;
+  int *cumulative_length = nullptr;
+  int total_length = -1;
+
+  operator int() const { return max_length; }
+};
+
+struct ResidualMask {};
+
+template <bool kIsQBegin>
+struct CausalMask {
+  static constexpr bool IsQBegin = kIsQBegin;
+};
+
+template <class Mask>
+bool is_masked(int q, int k, int seqlen_q, int seqlen_k) {
+  if constexpr (std::is_same_v<Mask, ResidualMask>) {
+    return false;
+  }
+  else {
+    int offset_q = Mask::IsQBegin ? 0 : seqlen_k - seqlen_q;
+    return q + offset_q < k;
+  }
+}
+
+void fill_random(std::vector<float> &data, int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-1.f, 1.f);
+  for (auto &x : data) {
+    x = dist(rng);
+  }
+}
+
+/// Attention problem with L = ((H_R, H_K), B), GQA strides and optionally variable sequence lengths
+struct AttentionProblem {
+  int max_q, max_k, D, D_VO, H_R, H_K, B;
+  std::vector<int> cumulative_q, cumulative_k;
+  int rows_q, rows_k;
+  std::vector<float> Q, K, V, O, LSE, dO;
+
+  AttentionProblem(int max_q_, int max_k_, int D_, int D_VO_, int H_R_, int H_K_, int B_,
+                   std::vector<int> seqlens_q = {}, std::vector<int> seqlens_k = {})
+      : max_q(max_q_), max_k(max_k_), D(D_), D_VO(D_VO_), H_R(H_R_), H_K(H_K_), B(B_) {
+    rows_q = max_q * B;
+    rows_k = max_k * B;
+    if (!seqlens_q.empty()) {
+      cumulative_q = {0};
+      cumulative_k = {0};
+      for (int b = 0; b < B; ++b) {
+        cumulative_q.push_back(cumulative_q.back() + seqlens_q[b]);
+        cumulative_k.push_back(cumulative_k.back() + seqlens_k[b]);
+      }
+      rows_q = cumulative_q.back();
+      rows_k = cumulative_k.back();
+    }
+    int H = H_R * H_K;
+    Q.resize(size_t(rows_q) * H * D);
+    K.resize(size_t(rows_k) * H_K * D);
+    V.resize(size_t(rows_k) * H_K * D_VO);
+    O.assign(size_t(rows_q) * H * D_VO, 0.f);
+    dO.resize(O.size());
+    LSE.assign(size_t(rows_q) * H, 0.f);
+    fill_random(Q, 1);
+    fill_random(K, 2);
+    fill_random(V, 3);
+    fill_random(dO, 4);
+  }
+
+  bool is_varlen() const { return !cumulative_q.empty(); }
+
+  auto shape_L() const { return make_shape(make_shape(H_R, H_K), B); }
+
+  // Rows of all the batches are stacked; with variable lengths, the batch stride is zero
+  template <class Element>
+  auto tensor_q(Element *ptr, int cols) const {
+    int H = H_R * H_K;
+    int batch_stride = is_varlen() ? 0 : max_q * H * cols;
+    return make_tensor(ptr, make_shape(rows_q, cols, shape_L()),
+                       make_stride(H * cols, _1{}, make_stride(make_stride(cols, H_R * cols), batch_stride)));
+  }
+
+  template <class Element>
+  auto tensor_k(Element *ptr, int cols) const {
+    int batch_stride = is_varlen() ? 0 : max_k * H_K * cols;
+    return make_tensor(ptr, make_shape(rows_k, cols, shape_L()),
+                       make_stride(H_K * cols, _1{}, make_stride(make_stride(_0{}, cols), batch_stride)));
+  }
+
+  auto tensor_lse(float *ptr) const {
+    int H = H_R * H_K;
+    int batch_stride = is_varlen() ? 0 : max_q * H;
+    return make_tensor(ptr, make_shape(rows_q, shape_L()),
+                       make_stride(H, make_stride(make_stride(1, H_R), batch_stride)));
+  }
+
+  int seqlen_q(int b) const { return is_varlen() ? cumulative_q[b + 1] - cumulative_q[b] : max_q; }
+  int seqlen_k(int b) const { return is_varlen() ? cumulative_k[b + 1] - cumulative_k[b] : max_k; }
+  int offset_q(int b) const { return is_varlen() ? cumulative_q[b] : 0; }
+  int offset_k(int b) const { return is_varlen() ? cumulative_k[b] : 0; }
+};
+
+/// Naive attention over every (query, head, batch) in double precision, materializing the
+/// scores of a full row. Writes O and LSE, and dQ, dK, dV if `dQ` is not empty.
+template <class Mask>
+void naive_attention(AttentionProblem const &p, int head_qk, int head_v,
+                     std::vector<double> &O, std::vector<double> &LSE,
+                     std::vector<double> &dQ, std::vector<double> &dK, std::vector<double> &dV) {
+  int H = p.H_R * p.H_K;
+  double scale = 1.0 / std::sqrt(double(head_qk));
+  auto q_index = [&](int row, int h, int d, int cols) { return (size_t(row) * H + h) * cols + d; };
+  auto k_index = [&](int row, int h_k, int d, int cols) { return (size_t(row) * p.H_K + h_k) * cols + d; };
+  auto q_row = [&](int b, int q) { return p.is_varlen() ? p.offset_q(b) + q : b * p.max_q + q; };
+  auto k_row = [&](int b, int k) { return p.is_varlen() ? p.offset_k(b) + k : b * p.max_k + k; };
+  bool backward = !dQ.empty();
+
+  for (int b = 0; b < p.B; ++b) {
+    int SQ = p.seqlen_q(b), SK = p.seqlen_k(b);
+    for (int h_k = 0; h_k < p.H_K; ++h_k) {
+      for (int h_r = 0; h_r < p.H_R; ++h_r) {
+        int h = h_r + p.H_R * h_k;
+        for (int q = 0; q < SQ; ++q) {
+          int qr = q_row(b, q);
+          std::vector<double> s(SK, -std::numeric_limits<double>::infinity());
+          double max_s = -std::numeric_limits<double>::infinity();
+          for (int k = 0; k < SK; ++k) {
+            if (is_masked<Mask>(q, k, SQ, SK)) {
+              continue;
+            }
+            double acc = 0;
+            for (int d = 0; d < head_qk; ++d) {
+              acc += double(p.Q[q_index(qr, h, d, head_qk)]) * double(p.K[k_index(k_row(b, k), h_k, d, head_qk)]);
+            }
+            s[k] = scale * acc;
+            max_s = std::max(max_s, s[k]);
+          }
+          double sum = 0;
+          for (int k = 0; k < SK; ++k) {
+            s[k] = std::isinf(s[k]) ? 0.0 : std::exp(s[k] - max_s);
+            sum += s[k];
+          }
+          LSE[size_t(qr) * H + h] = sum > 0 ? std::log(sum) + max_s : -std::numeric_limits<double>::infinity();
+          for (int d = 0; d < head_v; ++d) {
+            double acc = 0;
+            for (int k = 0; k < SK; ++k) {
+              acc += s[k] * double(p.V[k_index(k_row(b, k), h_k, d, head_v)]);
+            }
+            O[q_index(qr, h, d, head_v)] = sum > 0 ? acc / sum : 0.0;
+          }
+          if (!backward || sum == 0) {
+            continue;
+          }
+
+          // dS = P * (dO V^T - rowsum(dO * O)), with O as produced by the forward pass
+          double dot_o = 0;
+          for (int d = 0; d < head_v; ++d) {
+            dot_o += double(p.dO[q_index(qr, h, d, head_v)]) * double(p.O[q_index(qr, h, d, head_v)]);
+          }
+          for (int k = 0; k < SK; ++k) {
+            double prob = s[k] / sum;
+            if (prob == 0) {
+              continue;
+            }
+            int kr = k_row(b, k);
+            double dp = 0;
+            for (int d = 0; d < head_v; ++d) {
+              dp += double(p.dO[q_index(qr, h, d, head_v)]) * double(p.V[k_index(kr, h_k, d, head_v)]);
+              dV[k_index(kr, h_k, d, head_v)] += prob * double(p.dO[q_index(qr, h, d, head_v)]);
+            }
+            double ds = prob * (dp - dot_o) * scale;
+            for (int d = 0; d < head_qk; ++d) {
+              dQ[q_index(qr, h, d, head_qk)] += ds * double(p.K[k_index(kr, h_k, d, head_qk)]);
+              dK[k_index(kr, h_k, d, head_qk)] += ds * double(p.Q[q_index(qr, h, d, head_qk)]);
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+template <class Actual>
+void expect_near(std::vector<Actual> const &actual, std::vector<double> const &expected, double tolerance) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    double a = double(actual[i]);
+    if (std::isinf(expected[i])) {
+      EXPECT_TRUE(std::isinf(a) && a < 0) << "at " << i;
+    }
+    else {
+      EXPECT_NEAR(a, expected[i], tolerance) << "at " << i;
+    }
+  }
+}
+
+template <class Mask>
+void run_forward(AttentionProblem &p, int thread_count = 0) {
+  int H = p.H_R * p.H_K;
+  auto problem_shape = make_shape(p.max_q, p.max_k, p.D, p.D_VO, p.shape_L());
+  ref::FmhaForward(problem_shape,
+                   p.tensor_q(p.Q.data(), p.D), p.tensor_k(p.K.data(), p.D), p.tensor_k(p.V.data(), p.D_VO),
+                   p.tensor_q(p.O.data(), p.D_VO), p.tensor_lse(p.LSE.data()), Mask{}, 0.f, thread_count);
+
+  std::vector<double> O(p.O.size()), LSE(size_t(p.rows_q) * H), unused;
+  naive_attention<Mask>(p, p.D, p.D_VO, O, LSE, unused, unused, unused);
+  expect_near(p.O, O, 1e-5);
+  expect_near(p.LSE, LSE, 1e-4);
+}
+
+template <class Mask>
+void run_backward(AttentionProblem &p) {
+  int H = p.H_R * p.H_K;
+  run_forward<Mask>(p);
+
+  auto problem_shape = make_shape(p.max_q, p.max_k, p.D, p.D_VO, p.shape_L());
+  std::vector<float> dQ(p.Q.size()), dK(p.K.size()), dV(p.V.size());
+  ref::FmhaBackward(problem_shape,
+                    p.tensor_q(p.Q.data(), p.D), p.tensor_k(p.K.data(), p.D), p.tensor_k(p.V.data(), p.D_VO),
+                    p.tensor_q(p.O.data(), p.D_VO), p.tensor_lse(p.LSE.data()), p.tensor_q(p.dO.data(), p.D_VO),
+                    p.tensor_q(dQ.data(), p.D), p.tensor_k(dK.data(), p.D), p.tensor_k(dV.data(), p.D_VO),
+                    Mask{});
+
+  std::vector<double> O(p.O.size()), LSE(size_t(p.rows_q) * H);
+  std::vector<double> ref_dQ(dQ.size()), ref_dK(dK.size()), ref_dV(dV.size());
+  naive_attention<Mask>(p, p.D, p.D_VO, O, LSE, ref_dQ, ref_dK, ref_dV);
+  expect_near(dQ, ref_dQ, 1e-4);
+  expect_near(dK, ref_dK, 1e-4);
+  expect_near(dV, ref_dV, 1e-4);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(FmhaHostReference, forward_residual_gqa) {
+  AttentionProblem p(93, 150, 32, 32, 2, 3, 2);
+  run_forward<ResidualMask>(p);
+}
+
+TEST(FmhaHostReference, forward_causal) {
+  AttentionProblem q_begin(80, 130, 16, 24, 1, 2, 2);
+  run_forward<CausalMask<true>>(q_begin);
+
+  // Queries aligned to the last keys: the first 30 queries see no key at all
+  AttentionProblem q_end(130, 100, 16, 16, 2, 1, 1);
+  run_forward<CausalMask<false>>(q_end);
+  EXPECT_EQ(q_end.O[0], 0.f);
+  EXPECT_TRUE(std::isinf(q_end.LSE[0]));
+}
+
+TEST(FmhaHostReference, forward_variable_length) {
+  std::vector<int> seqlens_q = {17, 0, 64, 5};
+  std::vector<int> seqlens_k = {40, 9, 130, 0};
+  AttentionProblem p(64, 130, 32, 32, 2, 2, 4, seqlens_q, seqlens_k);
+  auto problem_shape = make_shape(
+    VariableLength{p.max_q, p.cumulative_q.data(), p.rows_q},
+    VariableLength{p.max_k, p.cumulative_k.data(), p.rows_k},
+    p.D, p.D_VO, p.shape_L());
+
+  ref::FmhaForward(problem_shape,
+                   p.tensor_q(p.Q.data(), p.D), p.tensor_k(p.K.data(), p.D), p.tensor_k(p.V.data(), p.D_VO),
+                   p.tensor_q(p.O.data(), p.D_VO), p.tensor_lse(p.LSE.data()), CausalMask<false>{});
+
+  std::vector<double> O(p.O.size()), LSE(p.LSE.size()), unused;
+  naive_attention<CausalMask<false>>(p, p.D, p.D_VO, O, LSE, unused, unused, unused);
+  expect_near(p.O, O, 1e-5);
+  expect_near(p.LSE, LSE, 1e-4);
+}
+
+TEST(FmhaHostReference, forward_half_deterministic) {
+  AttentionProblem p(70, 70, 64, 64, 4, 1, 1);
+  int H = p.H_R * p.H_K;
+  std::vector<cutlass::half_t> Q(p.Q.begin(), p.Q.end()), K(p.K.begin(), p.K.end()), V(p.V.begin(), p.V.end());
+  auto problem_shape = make_shape(p.max_q, p.max_k, p.D, p.D_VO, p.shape_L());
+
+  auto run = [&](int thread_count) {
+    std::vector<cutlass::half_t> O(p.O.size());
+    std::vector<float> LSE(p.LSE.size());
+    ref::FmhaForward(problem_shape,
+                     p.tensor_q(Q.data(), p.D), p.tensor_k(K.data(), p.D), p.tensor_k(V.data(), p.D_VO),
+                     p.tensor_q(O.data(), p.D_VO), p.tensor_lse(LSE.data()), CausalMask<true>{}, 0.f, thread_count);
+    return std::make_pair(O, LSE);
+  };
+  auto serial = run(1);
+  auto parallel = run(8);
+  EXPECT_TRUE(serial.first == parallel.first);
+  EXPECT_TRUE(serial.second == parallel.second);
+
+  // Inputs rounded to half_t; the output adds one rounding
+  for (size_t i = 0; i < Q.size(); ++i) { p.Q[i] = float(Q[i]); }
+  for (size_t i = 0; i < K.size(); ++i) { p.K[i] = float(K[i]); p.V[i] = float(V[i]); }
+  std::vector<double> O(p.O.size()), LSE(size_t(p.rows_q) * H), unused;
+  naive_attention<CausalMask<true>>(p, p.D, p.D_VO, O, LSE, unused, unused, unused);
+  expect_near(serial.first, O, 2e-3);
+}
+
+TEST(FmhaHostReference, forward_mla) {
+  // D = (D_latent, D_rope): Q and K have 48 columns, V and O have the 32 latent columns
+  AttentionProblem p(40, 90, 48, 32, 2, 1, 2);
+  auto problem_shape = make_shape(p.max_q, p.max_k, make_shape(32, 16), make_shape(32, 16), p.shape_L());
+  ref::FmhaForward(problem_shape,
+                   p.tensor_q(p.Q.data(), 48), p.tensor_k(p.K.data(), 48), p.tensor_k(p.V.data(), 32),
+                   p.tensor_q(p.O.data(), 32), p.tensor_lse(p.LSE.data()), CausalMask<true>{});
+
+  std::vector<double> O(p.O.size()), LSE(p.LSE.size()), unused;
+  naive_attention<CausalMask<true>>(p, 48, 32, O, LSE, unused, unused, unused);
+  expect_near(p.O, O, 1e-5);
+  expect_near(p.LSE, LSE, 1e-4);
+}
+
+TEST(FmhaHostReference, backward) {
+  AttentionProblem residual(45, 100, 16, 24, 2, 2, 2);
+  run_backward<ResidualMask>(residual);
+
+  AttentionProblem causal(100, 70, 32, 32, 3, 1, 1);
+  run_backward<CausalMask<false>>(causal);
+}
+
+TEST(FmhaHostReference, mla_decode_paged) {
+  int const H = 20, K = 150, D_latent = 32, D_rope = 16, B = 3, page_size = 32;
+  int const pages_per_seq = (K + page_size - 1) / page_size;
+  int const page_count = pages_per_seq * B;
+  std::vector<int> seqlens = {150, 33, 0};
+
+  // Latent and rope columns share the rows of Q and of the paged cache
+  std::vector<float> Q(size_t(B) * H * (D_latent + D_rope)), C(size_t(page_count) * page_size * (D_latent + D_rope));
+  fill_random(Q, 5);
+  fill_random(C, 6);
+  std::vector<int> page_table(size_t(pages_per_seq) * B);
+  for (int i = 0; i < int(page_table.size()); ++i) {
+    page_table[i] = (i * 7) % page_count;   // a permutation of the pages
+  }
+
+  int const ld = D_latent + D_rope;
+  auto mQL = make_tensor(Q.data(), make_shape(H, D_latent, B), make_stride(ld, _1{}, H * ld));
+  auto mQR = make_tensor(Q.data() + D_latent, make_shape(H, D_rope, B), make_stride(ld, _1{}, H * ld));
+  auto mCL = make_tensor(C.data(), make_shape(page_size, D_latent, page_count), make_stride(ld, _1{}, page_size * ld));
+  auto mKR = make_tensor(C.data() + D_latent, make_shape(page_size, D_rope, page_count), make_stride(ld, _1{}, page_size * ld));
+  auto mSeq = make_tensor(seqlens.data(), make_shape(B));
+  auto mPT = make_tensor(page_table.data(), make_shape(pages_per_seq, B));
+  std::vector<float> O(size_t(B) * H * D_latent), LSE(size_t(B) * H);
+  auto mO = make_tensor(O.data(), make_shape(H, D_latent, B), make_stride(D_latent, _1{}, H * D_latent));
+  auto mLSE = make_tensor(LSE.data(), make_shape(H, B), make_stride(_1{}, H));
+  float const scale = 1.f / std::sqrt(float(ld));
+
+  ref::FmhaMlaDecode(make_shape(H, K, make_shape(D_latent, D_rope), B),
+                     mSeq, mPT, mQL, mQR, mCL, mKR, mO, mLSE, scale);
+
+  for (int b = 0; b < B; ++b) {
+    for (int h = 0; h < H; ++h) {
+      std::vector<double> s(seqlens[b]);
+      double max_s = -std::numeric_limits<double>::infinity();
+      for (int k = 0; k < seqlens[b]; ++k) {
+        float const *c = &C[(size_t(page_table[k / page_size + pages_per_seq * b]) * page_size + k % page_size) * ld];
+        double acc = 0;
+        for (int d = 0; d < ld; ++d) {
+          acc += double(Q[(size_t(b) * H + h) * ld + d]) * double(c[d]);
+        }
+        s[k] = scale * acc;
+        max_s = std::max(max_s, s[k]);
+      }
+      double sum = 0;
+      for (auto &x : s) {
+        x = std::exp(x - max_s);
+        sum += x;
+      }
+      if (sum == 0) {
+        EXPECT_TRUE(std::isinf(mLSE(h, b)));
+        EXPECT_EQ(mO(h, 0, b), 0.f);
+        continue;
+      }
+      EXPECT_NEAR(mLSE(h, b), std::log(sum) + max_s, 1e-4);
+      for (int d = 0; d < D_latent; ++d) {
+        double acc = 0;
+        for (int k = 0; k < seqlens[b]; ++k) {
+          acc += s[k] * double(C[(size_t(page_table[k / page_size + pages_per_seq * b]) * page_size + k % page_size) * ld + d]);
+        }
+        EXPECT_NEAR(mO(h, d, b), acc / sum, 1e-5);
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
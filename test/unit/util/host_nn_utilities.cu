@@ -0,0 +1,326 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host reference implementations of the normalization, pooling and layout
+           conversion utilities
+*/
+
+#include <cfloat>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/reference/host/normalization.h"
+#include "cutlass/util/reference/host/pooling.h"
+#include "cutlass/util/reference/host/nchw_nhwc.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template <typename T>
+std::vector<T> make_random(int64_t count, unsigned seed, float lo = -5.0f, float hi = 5.0f) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<float> dist(lo, hi);
+  std::vector<T> values(count);
+  for (T &x : values) {
+    x = T(dist(engine));
+  }
+  return values;
+}
+
+template <typename T>
+cutlass::TensorRef<T, cutlass::layout::RowMajor> row_major(std::vector<T> &data, int ldm) {
+  return cutlass::TensorRef<T, cutlass::layout::RowMajor>(data.data(), cutlass::layout::RowMajor(ldm));
+}
+
+template <typename T>
+cutlass::TensorRef<T, cutlass::layout::TensorNHWC> nhwc(std::vector<T> &data, cutlass::Tensor4DCoord extent) {
+  return cutlass::TensorRef<T, cutlass::layout::TensorNHWC>(
+    data.data(), cutlass::layout::TensorNHWC::packed(extent));
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostReference, layernorm_f32) {
+
+  int const M = 100;
+  int const N = 1000;
+
+  std::vector<float> input = make_random<float>(int64_t(M) * N, 1);
+  std::vector<float> gamma = make_random<float>(N, 2);
+  std::vector<float> beta = make_random<float>(N, 3);
+
+  // Rows are padded to check that the leading dimension is honored
+  int const ldm = N + 24;
+  std::vector<float> padded(int64_t(M) * ldm, 0.0f);
+  for (int m = 0; m < M; ++m) {
+    std::copy(input.begin() + int64_t(m) * N, input.begin() + int64_t(m + 1) * N, padded.begin() + int64_t(m) * ldm);
+  }
+
+  for (int thread_count : {1, 4}) {
+    std::vector<float> output(int64_t(M) * ldm, 0.0f);
+
+    cutlass::reference::host::layernorm<float>(
+      {M, N}, row_major(output, ldm), row_major(padded, ldm), row_major(gamma, N), row_major(beta, N),
+      thread_count);
+
+    for (int m = 0; m < M; ++m) {
+      double mean = 0;
+      for (int n = 0; n < N; ++n) {
+        mean += input[int64_t(m) * N + n];
+      }
+      mean /= N;
+      double var = 0;
+      for (int n = 0; n < N; ++n) {
+        double d = input[int64_t(m) * N + n] - mean;
+        var += d * d;
+      }
+      var /= N;
+
+      for (int n = 0; n < N; ++n) {
+        double expected = (input[int64_t(m) * N + n] - mean) / std::sqrt(var + 1e-5) * gamma[n] + beta[n];
+        ASSERT_NEAR(output[int64_t(m) * ldm + n], expected, 1e-4) << "m: " << m << ", n: " << n;
+      }
+    }
+  }
+}
+
+TEST(HostReference, rmsnorm_f16) {
+
+  using ElementType = cutlass::half_t;
+
+  int const M = 16;
+  int const N = 1024;
+  float const epsilon = 1e-5f;
+
+  std::vector<ElementType> input = make_random<ElementType>(int64_t(M) * N, 2022);
+  std::vector<ElementType> weight = make_random<ElementType>(N, 2023);
+  std::vector<ElementType> output(int64_t(M) * N);
+
+  cutlass::reference::host::rmsnorm<ElementType>(
+    {M, N}, row_major(output, N), row_major(input, N), row_major(weight, N), epsilon);
+
+  for (int m = 0; m < M; ++m) {
+    float square_sum = 0;
+    for (int n = 0; n < N; ++n) {
+      float x = float(input[m * N + n]);
+      square_sum += x * x;
+    }
+    float rms = std::sqrt(square_sum / N + epsilon);
+
+    for (int n = 0; n < N; ++n) {
+      float expected = float(ElementType(float(input[m * N + n]) / rms * float(weight[n])));
+      // One half-precision ulp at the largest magnitudes
+      ASSERT_NEAR(float(output[m * N + n]), expected, 0.02f) << "m: " << m << ", n: " << n;
+    }
+  }
+}
+
+TEST(HostReference, groupnorm_f32) {
+
+  cutlass::Tensor4DCoord extent(8, 16, 15, 32);
+  int const num_groups = 4;
+  float const eps = 1e-5f;
+  int const group_channels = extent.c() / num_groups;
+
+  std::vector<float> input = make_random<float>(extent.product(), 7);
+  std::vector<float> gamma = make_random<float>(extent.c(), 8);
+  std::vector<float> beta = make_random<float>(extent.c(), 9);
+  std::vector<float> output(extent.product());
+
+  cutlass::Tensor4DCoord channel_extent(1, 1, 1, extent.c());
+
+  EXPECT_EQ(
+    cutlass::reference::host::groupnorm<float>(
+      extent, num_groups, eps, nhwc(output, extent), nhwc(input, extent),
+      nhwc(gamma, channel_extent), nhwc(beta, channel_extent), 3),
+    cutlass::Status::kSuccess);
+
+  auto at = [&](std::vector<float> const &t, int n, int h, int w, int c) {
+    return t[((int64_t(n) * extent.h() + h) * extent.w() + w) * extent.c() + c];
+  };
+
+  for (int n = 0; n < extent.n(); ++n) {
+    for (int g = 0; g < num_groups; ++g) {
+      double sum = 0, sum_sq = 0;
+      int64_t count = 0;
+      for (int h = 0; h < extent.h(); ++h) {
+        for (int w = 0; w < extent.w(); ++w) {
+          for (int c = g * group_channels; c < (g + 1) * group_channels; ++c, ++count) {
+            sum += at(input, n, h, w, c);
+            sum_sq += double(at(input, n, h, w, c)) * at(input, n, h, w, c);
+          }
+        }
+      }
+      double mean = sum / count;
+      double var = sum_sq / count - mean * mean;
+
+      for (int h = 0; h < extent.h(); ++h) {
+        for (int w = 0; w < extent.w(); ++w) {
+          for (int c = g * group_channels; c < (g + 1) * group_channels; ++c) {
+            double expected = (at(input, n, h, w, c) - mean) / std::sqrt(var + eps) * gamma[c] + beta[c];
+            ASSERT_NEAR(at(output, n, h, w, c), expected, 1e-4);
+          }
+        }
+      }
+    }
+  }
+
+  EXPECT_EQ(
+    cutlass::reference::host::groupnorm<float>(
+      extent, 5, eps, nhwc(output, extent), nhwc(input, extent),
+      nhwc(gamma, channel_extent), nhwc(beta, channel_extent)),
+    cutlass::Status::kErrorInvalidProblem);
+}
+
+TEST(HostReference, pooling_nhwc) {
+
+  cutlass::Tensor4DCoord input_extent(4, 41, 39, 16);
+  cutlass::Tensor4DCoord filter_extent(1, 3, 2, 1);
+  cutlass::Tensor4DCoord padding(0, 1, 1, 0);
+  cutlass::MatrixCoord stride(2, 2);
+
+  int const output_H = (input_extent.h() + 2 * padding.h() - filter_extent.h()) / stride.row() + 1;
+  int const output_W = (input_extent.w() + 2 * padding.w() - filter_extent.w()) / stride.column() + 1;
+  cutlass::Tensor4DCoord output_extent(input_extent.n(), output_H, output_W, input_extent.c());
+
+  std::vector<float> input = make_random<float>(input_extent.product(), 17);
+
+  for (int pooling_type : {0, 1}) {
+    for (int thread_count : {1, 2}) {
+      std::vector<float> output(output_extent.product());
+
+      EXPECT_EQ(
+        cutlass::reference::host::pooling_nhwc<float>(
+          input_extent, filter_extent, output_extent, padding, stride,
+          nhwc(input, input_extent), nhwc(output, output_extent), pooling_type, thread_count),
+        cutlass::Status::kSuccess);
+
+      for (int n = 0; n < output_extent.n(); ++n) {
+        for (int p = 0; p < output_H; ++p) {
+          for (int q = 0; q < output_W; ++q) {
+            for (int c = 0; c < output_extent.c(); ++c) {
+              float expected = pooling_type == 0 ? 0.0f : -FLT_MAX;
+              for (int r = 0; r < filter_extent.h(); ++r) {
+                for (int s = 0; s < filter_extent.w(); ++s) {
+                  int h = p * stride.row() - padding.h() + r;
+                  int w = q * stride.column() - padding.w() + s;
+                  if (h < 0 || h >= input_extent.h() || w < 0 || w >= input_extent.w()) {
+                    continue;
+                  }
+                  float x = input[((int64_t(n) * input_extent.h() + h) * input_extent.w() + w) * input_extent.c() + c];
+                  expected = pooling_type == 0 ? expected + x : std::max(expected, x);
+                }
+              }
+              if (pooling_type == 0) {
+                expected /= float(filter_extent.h() * filter_extent.w());
+              }
+
+              float computed = output[((int64_t(n) * output_H + p) * output_W + q) * output_extent.c() + c];
+              ASSERT_NEAR(computed, expected, 1e-5f) << "type: " << pooling_type;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Output extent inconsistent with the pooling parameters
+  std::vector<float> output(output_extent.product());
+  cutlass::Tensor4DCoord wrong_extent(output_extent.n(), output_H + 1, output_W, output_extent.c());
+  EXPECT_EQ(
+    cutlass::reference::host::pooling_nhwc<float>(
+      input_extent, filter_extent, wrong_extent, padding, stride,
+      nhwc(input, input_extent), nhwc(output, output_extent), 0),
+    cutlass::Status::kErrorInvalidProblem);
+}
+
+TEST(HostReference, nchw_nhwc_round_trip) {
+
+  int const N = 6;
+  int const C = 67;
+  int const H = 13;
+  int const W = 45;
+
+  std::vector<int> nchw_data(int64_t(N) * C * H * W);
+  for (size_t i = 0; i < nchw_data.size(); ++i) {
+    nchw_data[i] = int(i);
+  }
+  std::vector<int> nhwc_data(nchw_data.size(), -1);
+  std::vector<int> round_trip(nchw_data.size(), -1);
+
+  // The NCHW extent is passed as (N, C, H, W), following the device utilities
+  cutlass::Tensor4DCoord nchw_size(N, C, H, W);
+  cutlass::Tensor4DCoord nhwc_size(N, H, W, C);
+
+  cutlass::TensorRef<int, cutlass::layout::TensorNCHW> ref_nchw(
+    nchw_data.data(), cutlass::layout::TensorNCHW::packed({N, H, W, C}));
+  cutlass::TensorRef<int, cutlass::layout::TensorNCHW> ref_round_trip(
+    round_trip.data(), cutlass::layout::TensorNCHW::packed({N, H, W, C}));
+
+  for (int thread_count : {1, 4}) {
+    EXPECT_EQ(
+      cutlass::reference::host::nchw_to_nhwc<int>(
+        nchw_size, nhwc_size, ref_nchw, nhwc(nhwc_data, nhwc_size), thread_count),
+      cutlass::Status::kSuccess);
+
+    for (int n = 0; n < N; ++n) {
+      for (int h = 0; h < H; ++h) {
+        for (int w = 0; w < W; ++w) {
+          for (int c = 0; c < C; ++c) {
+            ASSERT_EQ(nhwc_data[((int64_t(n) * H + h) * W + w) * C + c],
+                      nchw_data[((int64_t(n) * C + c) * H + h) * W + w]);
+          }
+        }
+      }
+    }
+
+    EXPECT_EQ(
+      cutlass::reference::host::nhwc_to_nchw<int>(
+        nhwc_size, nchw_size, nhwc(nhwc_data, nhwc_size), ref_round_trip, thread_count),
+      cutlass::Status::kSuccess);
+
+    EXPECT_EQ(round_trip, nchw_data);
+  }
+
+  EXPECT_EQ(
+    cutlass::reference::host::nchw_to_nhwc<int>(
+      nhwc_size, nhwc_size, ref_nchw, nhwc(nhwc_data, nhwc_size)),
+    cutlass::Status::kErrorInvalidProblem);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,252 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the tiled, multithreaded host reorderings in host_reorder.h
+*/
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/util/host_reorder.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Element-by-element reorder_column, as implemented before the tiled traversal
+template <int Interleaved, typename Element, typename Layout>
+void serial_reorder_column(cutlass::TensorRef<Element, Layout> dest,
+                           cutlass::TensorRef<Element, Layout> src,
+                           cutlass::gemm::GemmCoord problem_size) {
+  const int InstructionShapeCol = 8;
+  const int ElementsPerThread = InstructionShapeCol / 4;
+  const int ReorderedElementsPerThread = Interleaved / 4;
+
+  for (int n = 0; n < problem_size.n(); n++) {
+    for (int k = 0; k < problem_size.k(); k++) {
+      dest.at({k, (n / Interleaved) * Interleaved +
+                      ((n % ReorderedElementsPerThread) / ElementsPerThread) *
+                          InstructionShapeCol +
+                      ((n % Interleaved) / ReorderedElementsPerThread) *
+                          ElementsPerThread +
+                      (n % ElementsPerThread)}) = src.at({k, n});
+    }
+  }
+}
+
+/// Element-by-element reorder_meta, as implemented before the tiled traversal
+template <typename Element, typename LayoutDest, typename LayoutSrc>
+void serial_reorder_meta(cutlass::TensorRef<Element, LayoutDest> dest,
+                         cutlass::TensorRef<Element, LayoutSrc> src,
+                         cutlass::gemm::GemmCoord problem_size) {
+  for (int m = 0; m < problem_size.m(); m++) {
+    for (int k = 0; k < problem_size.k(); k++) {
+      int group = (sizeof(Element) == 2) ? 32 : 16;
+      int interweave = (sizeof(Element) == 2) ? 4 : 2;
+
+      int dest_row = m / group * group + (m % 8) * interweave + (m % group) / 8;
+      int dest_col = k;
+
+      if (((dest_row % 2) == 0) && ((dest_col % 2) == 1)) {
+        ++dest_row;
+        --dest_col;
+      } else if (((dest_row % 2) == 1) && ((dest_col % 2) == 0)) {
+        --dest_row;
+        ++dest_col;
+      }
+
+      dest.at({dest_row, dest_col}) = src.at({m, k});
+    }
+  }
+}
+
+template <typename Element, typename Layout>
+void fill_random(cutlass::HostTensor<Element, Layout> &tensor, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_int_distribution<int> dist(-8, 7);
+  for (int r = 0; r < tensor.extent().row(); ++r) {
+    for (int c = 0; c < tensor.extent().column(); ++c) {
+      tensor.at({r, c}) = Element(dist(engine));
+    }
+  }
+}
+
+template <typename Element, typename Layout, int Interleaved>
+void run_reorder_column(cutlass::gemm::GemmCoord problem_size) {
+
+  cutlass::HostTensor<Element, Layout> src({problem_size.k(), problem_size.n()}, false);
+  cutlass::HostTensor<Element, Layout> expected({problem_size.k(), problem_size.n()}, false);
+
+  fill_random(src, 2024);
+  serial_reorder_column<Interleaved>(expected.host_ref(), src.host_ref(), problem_size);
+
+  for (int thread_count : {1, 3}) {
+    cutlass::HostTensor<Element, Layout> dest({problem_size.k(), problem_size.n()}, false);
+
+    EXPECT_EQ(cutlass::reorder_column<Interleaved>(dest.host_ref(), src.host_ref(), problem_size, thread_count),
+              cutlass::Status::kSuccess);
+
+    EXPECT_TRUE(cutlass::reference::host::TensorEquals(dest.host_view(), expected.host_view()))
+      << "threads: " << thread_count;
+  }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostReorder, reorder_column_s8_interleaved) {
+  run_reorder_column<int8_t, cutlass::layout::ColumnMajorInterleaved<32>, 32>({128, 512, 640});
+}
+
+TEST(HostReorder, reorder_column_s8_row_major) {
+  run_reorder_column<int8_t, cutlass::layout::RowMajor, 32>({128, 320, 700});
+}
+
+TEST(HostReorder, reorder_column_s4_interleaved) {
+  run_reorder_column<cutlass::int4b_t, cutlass::layout::ColumnMajorInterleaved<64>, 64>({128, 512, 640});
+}
+
+TEST(HostReorder, reorder_meta_u16) {
+
+  using ElementE = uint16_t;
+  cutlass::gemm::GemmCoord problem_size(2048, 128, 96);
+
+  cutlass::HostTensor<ElementE, cutlass::layout::RowMajor> src({problem_size.m(), problem_size.k()}, false);
+  cutlass::HostTensor<ElementE, cutlass::layout::ColumnMajorInterleaved<2>> expected(
+    {problem_size.m(), problem_size.k()}, false);
+
+  for (int m = 0; m < problem_size.m(); ++m) {
+    for (int k = 0; k < problem_size.k(); ++k) {
+      src.at({m, k}) = ElementE(m * 131 + k * 7);
+    }
+  }
+
+  serial_reorder_meta(expected.host_ref(), src.host_ref(), problem_size);
+
+  for (int thread_count : {1, 4}) {
+    cutlass::HostTensor<ElementE, cutlass::layout::ColumnMajorInterleaved<2>> dest(
+      {problem_size.m(), problem_size.k()}, false);
+
+    cutlass::reorder_meta(dest.host_ref(), src.host_ref(), problem_size, thread_count);
+
+    EXPECT_TRUE(cutlass::reference::host::TensorEquals(dest.host_view(), expected.host_view()))
+      << "threads: " << thread_count;
+  }
+}
+
+template <typename T>
+void run_reorder_tensor() {
+  using namespace cute;
+
+  // (N, K, L) column-major source; destination interleaves 8 consecutive K within each column
+  int const N = 200;
+  int const K = 256;
+  int const L = 3;
+
+  auto layout_src = make_layout(make_shape(N, K, L));
+  auto layout_dst = make_layout(
+    make_shape(N, make_shape(Int<8>{}, K / 8), L),
+    make_stride(Int<8>{}, make_stride(Int<1>{}, 8 * N), N * K));
+
+  size_t bytes = (size_t(N) * K * L * sizeof_bits_v<T> + 7) / 8;
+  std::vector<uint8_t> src(bytes), dst(bytes, 0);
+
+  std::mt19937 engine(5);
+  for (uint8_t &byte : src) {
+    byte = uint8_t(engine());
+  }
+
+  auto S = make_tensor(make_gmem_ptr<T>(src.data()), layout_src);
+  auto D = make_tensor(make_gmem_ptr<T>(dst.data()), layout_dst);
+
+  for (int thread_count : {1, 4}) {
+    std::fill(dst.begin(), dst.end(), uint8_t(0));
+    EXPECT_EQ(cutlass::reference::host::reorder_tensor(S, D, thread_count), cutlass::Status::kSuccess);
+
+    for (int i = 0; i < size(S); ++i) {
+      ASSERT_EQ(T(D(i)), T(S(i))) << "index: " << i << ", threads: " << thread_count;
+    }
+  }
+
+  // In-place version
+  std::vector<uint8_t> data = src;
+  cutlass::reference::host::reorder_tensor(reinterpret_cast<T *>(data.data()), layout_src, layout_dst);
+  EXPECT_EQ(data, dst);
+}
+
+TEST(HostReorder, reorder_tensor_s8) {
+  run_reorder_tensor<int8_t>();
+}
+
+TEST(HostReorder, reorder_tensor_s4) {
+  run_reorder_tensor<cutlass::int4b_t>();
+}
+
+TEST(HostReorder, reorder_tensor_u2) {
+  run_reorder_tensor<cutlass::uint2b_t>();
+}
+
+TEST(HostReorder, reorder_tensor_e2m3) {
+  // 6-bit elements straddle bytes
+  run_reorder_tensor<cutlass::float_e2m3_t>();
+}
+
+TEST(HostReorder, destination_out_of_bounds) {
+  using Element = cutlass::int4b_t;
+  using Layout = cutlass::layout::RowMajor;
+
+  // Columns of a partial group of 32 are interleaved past the last column of the destination
+  cutlass::gemm::GemmCoord problem_size(128, 100, 64);
+  cutlass::HostTensor<Element, Layout> src({problem_size.k(), problem_size.n()}, false);
+  cutlass::HostTensor<Element, Layout> dest({problem_size.k(), problem_size.n()}, false);
+  fill_random(src, 7);
+
+  for (int thread_count : {1, 3}) {
+    EXPECT_EQ(cutlass::reorder_column<32>(dest.host_ref(), src.host_ref(), problem_size, thread_count),
+              cutlass::Status::kErrorInvalidProblem);
+  }
+
+  auto layout = cute::make_layout(cute::make_shape(16, 16));
+  std::vector<uint8_t> data(128);
+  EXPECT_EQ(cutlass::reference::host::reorder_tensor(
+              reinterpret_cast<Element const *>(data.data()), layout,
+              reinterpret_cast<Element *>(data.data()), cute::make_layout(cute::make_shape(16, 8))),
+            cutlass::Status::kErrorInvalidProblem);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,222 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the multithreaded host structured sparse compressor, cross-checked against
+           the legacy host compressor used as reference by the device compressor tests
+*/
+
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/atom/mma_traits_sm90_gmma.hpp"                       // cute::GMMA::Major
+#include "cutlass/gemm/collective/builders/sm90_common.inl"         // gmma_rs_tag_to_major_A
+#include "cutlass/gemm/collective/builders/sm90_sparse_config.inl"  // Sm90GemmSparseConfig
+#include "cutlass/util/host_sparse_compressor.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../transform/device/sm90_sparse_gemm_compressor_legacy.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template <class ElementA_, class LayoutATag_, class ElementEMma, int MinTileShapeK>
+struct SparseCompressorConfig {
+  using ElementA = ElementA_;
+  using LayoutATag = LayoutATag_;
+  static constexpr cute::GMMA::Major GmmaMajorA = cutlass::gemm::collective::detail::gmma_rs_tag_to_major_A<LayoutATag>();
+  using SparseConfig = cutlass::Sm90GemmSparseConfig<cute::sparse_elem<2, ElementA>, GmmaMajorA, ElementEMma, cute::Int<MinTileShapeK>>;
+  using ProblemShape = cute::Shape<int, int, int, int>;
+
+  using Compressor = cutlass::HostStructuredSparseCompressor<ProblemShape, ElementA, LayoutATag, SparseConfig>;
+  using Utility = typename Compressor::Utility;
+  using Reference = cutlass::transform::kernel::SM90StructuredSparseCompressorLegacy<ProblemShape, ElementA, LayoutATag, SparseConfig>;
+  using StrideA = typename Compressor::StrideA;
+  using ElementAUint = cute::uint_bit_t<cute::sizeof_bits_v<ElementA>>;
+};
+
+/// Random structured sparse A in which some of the kept elements are also zero or negative zero,
+/// so that chunks with fewer nonzeros than the sparsity allows are exercised
+template <class Config>
+std::vector<uint8_t> make_sparse_A(typename Config::ProblemShape problem, typename Config::StrideA dA, int seed) {
+  using ElementAUint = typename Config::ElementAUint;
+  auto [M, N, K, L] = problem;
+  std::vector<ElementAUint> A(size_t(M) * K * L);
+
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<uint64_t> bits;
+  std::uniform_int_distribution<int> kind(0, 7);
+  ElementAUint const negative_zero = ElementAUint(ElementAUint(1) << (cute::sizeof_bits_v<ElementAUint> - 1));
+  for (auto &a : A) {
+    int k = kind(rng);
+    a = k == 0 ? ElementAUint(0) : k == 1 ? negative_zero : ElementAUint(bits(rng) | 1);
+  }
+
+  typename Config::Utility utility(problem, dA);
+  utility.structure_sparse_zero_mask_fill(A.data(), seed);
+
+  std::vector<uint8_t> bytes(A.size() * sizeof(ElementAUint));
+  std::memcpy(bytes.data(), A.data(), bytes.size());
+  return bytes;
+}
+
+template <class Config>
+void run_compressor_test(int M, int K, int L) {
+  using Compressor = typename Config::Compressor;
+  using Reference = typename Config::Reference;
+  using ElementA = typename Config::ElementA;
+
+  typename Config::ProblemShape problem{M, 1, K, L};
+  auto dA = cutlass::make_cute_packed_stride(typename Config::StrideA{}, cute::make_shape(M, K, L));
+  typename Config::Utility utility(problem, dA);
+
+  std::vector<uint8_t> A = make_sparse_A<Config>(problem, dA, M * 131 + K * 7 + L);
+
+  // Reference
+  std::vector<uint8_t> AC_ref(utility.get_compressed_tensor_A_bytes());
+  std::vector<uint8_t> E_ref(utility.get_tensor_E_bytes());
+  {
+    typename Reference::Arguments args{problem,
+      {reinterpret_cast<ElementA const*>(A.data()), dA,
+       reinterpret_cast<ElementA*>(AC_ref.data()), E_ref.data()}, {}};
+    std::vector<uint8_t> workspace(Reference::get_workspace_size(args));
+    Reference::run(Reference::to_underlying_arguments(args, workspace.data()));
+  }
+
+  for (int thread_count : {1, 3}) {
+    Compressor compressor(problem, thread_count);
+
+    // Garbage in the outputs checks that the padding is written
+    std::vector<uint8_t> AC(AC_ref.size(), 0xA5);
+    std::vector<uint8_t> E(E_ref.size(), 0xA5);
+    EXPECT_EQ(compressor.compress(A.data(), dA, AC.data(), E.data()), cutlass::Status::kSuccess);
+    EXPECT_TRUE(AC == AC_ref) << "M=" << M << " K=" << K << " L=" << L << " threads=" << thread_count;
+    EXPECT_TRUE(E == E_ref) << "M=" << M << " K=" << K << " L=" << L << " threads=" << thread_count;
+  }
+
+  // Blocks of rows, each copied out of A as if read from storage in turn
+  {
+    Compressor compressor(problem, 2);
+    std::vector<uint8_t> AC(AC_ref.size(), 0xA5);
+    std::vector<uint8_t> E(E_ref.size(), 0xA5);
+    int const rows_per_block = 37;
+    size_t const element_bytes = sizeof(typename Config::ElementAUint);
+
+    for (int l = 0; l < L; ++l) {
+      for (int m_begin = 0; m_begin < M; m_begin += rows_per_block) {
+        int m_end = std::min(M, m_begin + rows_per_block);
+        auto dA_rows = cutlass::make_cute_packed_stride(typename Config::StrideA{}, cute::make_shape(m_end - m_begin, K, 1));
+        std::vector<uint8_t> rows(size_t(m_end - m_begin) * K * element_bytes);
+        for (int m = m_begin; m < m_end; ++m) {
+          for (int k = 0; k < K; ++k) {
+            int64_t src = m * int64_t(cute::get<0>(dA)) + k * int64_t(cute::get<1>(dA)) + l * int64_t(cute::get<2>(dA));
+            int64_t dst = (m - m_begin) * int64_t(cute::get<0>(dA_rows)) + k * int64_t(cute::get<1>(dA_rows));
+            std::memcpy(&rows[dst * element_bytes], &A[src * element_bytes], element_bytes);
+          }
+        }
+        EXPECT_EQ(compressor.compress_rows(rows.data(), dA_rows, m_begin, m_end, l, AC.data(), E.data()),
+                  cutlass::Status::kSuccess);
+      }
+    }
+    EXPECT_TRUE(AC == AC_ref) << "M=" << M << " K=" << K << " L=" << L << " (blocks of rows)";
+    EXPECT_TRUE(E == E_ref) << "M=" << M << " K=" << K << " L=" << L << " (blocks of rows)";
+  }
+}
+
+template <class Config>
+void run_compressor_tests() {
+  int const chunk = Config::Compressor::LogicalElemsAPerChunk;
+  for (int M : {1, 63, 64, 200}) {
+    for (int K : {chunk, 24 * chunk, 96 * chunk + chunk}) {
+      for (int L : {1, 3}) {
+        run_compressor_test<Config>(M, K, L);
+      }
+    }
+  }
+  // Large enough to be split across host threads
+  run_compressor_test<Config>(1000, 256 * chunk, 2);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostStructuredSparseCompressor, f16_t) {
+  run_compressor_tests<SparseCompressorConfig<cutlass::half_t, cutlass::layout::RowMajor, cute::sparse_elem<8, uint8_t>, 32>>();
+}
+
+TEST(HostStructuredSparseCompressor, bf16_n) {
+  run_compressor_tests<SparseCompressorConfig<cutlass::bfloat16_t, cutlass::layout::ColumnMajor, cute::sparse_elem<8, uint8_t>, 64>>();
+}
+
+TEST(HostStructuredSparseCompressor, tf32_t) {
+  run_compressor_tests<SparseCompressorConfig<cutlass::tfloat32_t, cutlass::layout::RowMajor, cute::sparse_elem<4, uint8_t>, 32>>();
+}
+
+TEST(HostStructuredSparseCompressor, f32_n) {
+  run_compressor_tests<SparseCompressorConfig<float, cutlass::layout::ColumnMajor, cute::sparse_elem<4, uint8_t>, 32>>();
+}
+
+TEST(HostStructuredSparseCompressor, e4m3_t) {
+  run_compressor_tests<SparseCompressorConfig<cutlass::float_e4m3_t, cutlass::layout::RowMajor, cute::sparse_elem<8, uint8_t>, 64>>();
+}
+
+TEST(HostStructuredSparseCompressor, e5m2_n) {
+  run_compressor_tests<SparseCompressorConfig<cutlass::float_e5m2_t, cutlass::layout::ColumnMajor, cute::sparse_elem<8, uint8_t>, 128>>();
+}
+
+TEST(HostStructuredSparseCompressor, rejects_dense_chunks) {
+  using Config = SparseCompressorConfig<cutlass::half_t, cutlass::layout::RowMajor, cute::sparse_elem<8, uint8_t>, 32>;
+  int const M = 128, K = 64, L = 1;
+  typename Config::ProblemShape problem{M, 1, K, L};
+  auto dA = cutlass::make_cute_packed_stride(typename Config::StrideA{}, cute::make_shape(M, K, L));
+  typename Config::Utility utility(problem, dA);
+
+  std::vector<uint8_t> A = make_sparse_A<Config>(problem, dA, 1);
+  std::vector<uint8_t> AC(utility.get_compressed_tensor_A_bytes());
+  std::vector<uint8_t> E(utility.get_tensor_E_bytes());
+
+  typename Config::Compressor compressor(problem, 4);
+  EXPECT_EQ(compressor.compress(A.data(), dA, AC.data(), E.data()), cutlass::Status::kSuccess);
+
+  // Three nonzeros in the last chunk of A
+  cutlass::half_t *last = reinterpret_cast<cutlass::half_t *>(A.data()) + M * K - 4;
+  last[0] = last[1] = last[2] = cutlass::half_t(1);
+  EXPECT_EQ(compressor.compress(A.data(), dA, AC.data(), E.data()), cutlass::Status::kErrorInvalidProblem);
+
+  // K must be a multiple of the chunk
+  typename Config::Compressor odd_compressor(typename Config::ProblemShape{M, 1, K + 2, L});
+  EXPECT_EQ(odd_compressor.compress(A.data(), dA, AC.data(), E.data()), cutlass::Status::kErrorInvalidProblem);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,293 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the bulk sub-byte host operations against element-wise SubbyteReference access
+*/
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/container/array_subbyte.hpp"
+#include "cutlass/array.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/subbyte_reference.h"
+#include "cutlass/tensor_view.h"
+#include "cutlass/util/host_subbyte.hpp"
+#include "cutlass/util/reference/host/tensor_copy.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Bytes holding `count` elements of T, plus a guard byte
+template <class T>
+size_t bytes_for(size_t count) {
+  return (count * cutlass::sizeof_bits<T>::value + 7) / 8 + 1;
+}
+
+template <class T>
+T *as(std::vector<uint8_t> &bytes) {
+  return reinterpret_cast<T *>(bytes.data());
+}
+
+template <class T>
+T const *as(std::vector<uint8_t> const &bytes) {
+  return reinterpret_cast<T const *>(bytes.data());
+}
+
+template <class T>
+T element(std::vector<uint8_t> const &bytes, size_t idx) {
+  return T(cutlass::ReferenceFactory<T>::get(as<T>(bytes), int64_t(idx)));
+}
+
+std::vector<uint8_t> random_bytes(size_t size, int seed) {
+  std::mt19937 generator(seed);
+  std::vector<uint8_t> bytes(size);
+  for (auto &b : bytes) {
+    b = uint8_t(generator());
+  }
+  return bytes;
+}
+
+/// Fills, copies and generates over offsets and counts around byte boundaries, each checked
+/// against the same operation done one element at a time through SubbyteReference
+template <class T>
+void check_fill_copy_generate(T value) {
+  constexpr size_t kCapacity = 300;
+  for (size_t offset : {0, 1, 2, 3, 7, 8, 9}) {
+    for (size_t count : {0, 1, 2, 5, 16, 33, 200, 280}) {
+      size_t size = bytes_for<T>(kCapacity);
+
+      // Fill
+      std::vector<uint8_t> bulk = random_bytes(size, int(offset * 1000 + count));
+      std::vector<uint8_t> expected = bulk;
+      cutlass::subbyte_fill(as<T>(bulk), count, value, offset);
+      for (size_t i = 0; i < count; ++i) {
+        cutlass::ReferenceFactory<T>::get(as<T>(expected), int64_t(offset + i)) = value;
+      }
+      ASSERT_EQ(bulk, expected) << "fill offset=" << offset << " count=" << count;
+
+      // Copy, with the source at the same and at a different position within a byte
+      for (size_t src_offset : {offset, offset + 1, size_t(3)}) {
+        std::vector<uint8_t> src = random_bytes(size, int(count));
+        std::vector<uint8_t> dst = random_bytes(size, int(count + 1));
+        expected = dst;
+        cutlass::subbyte_copy(as<T>(dst), as<T>(src), count, offset, src_offset);
+        for (size_t i = 0; i < count; ++i) {
+          cutlass::ReferenceFactory<T>::get(as<T>(expected), int64_t(offset + i)) = element<T>(src, src_offset + i);
+        }
+        ASSERT_EQ(dst, expected) << "copy offset=" << offset << " src_offset=" << src_offset << " count=" << count;
+      }
+
+      // Generate, in element order
+      bulk = random_bytes(size, int(count + 2));
+      expected = bulk;
+      int calls = 0;
+      cutlass::subbyte_generate(as<T>(bulk), count, [&]() { return T(calls++ % 3 == 0 ? value : T(0)); }, offset);
+      EXPECT_EQ(size_t(calls), count);
+      for (size_t i = 0; i < count; ++i) {
+        cutlass::ReferenceFactory<T>::get(as<T>(expected), int64_t(offset + i)) = i % 3 == 0 ? value : T(0);
+      }
+      ASSERT_EQ(bulk, expected) << "generate offset=" << offset << " count=" << count;
+    }
+  }
+}
+
+/// Converts from float and back, checked against NumericConverter
+template <class T>
+void check_convert(std::vector<float> const &values) {
+  cutlass::NumericConverter<T, float> to_t;
+  cutlass::NumericConverter<float, T> to_float;
+
+  for (size_t offset : {0, 1, 3}) {
+    size_t count = values.size();
+    std::vector<uint8_t> bytes = random_bytes(bytes_for<T>(offset + count), 7);
+    std::vector<uint8_t> expected = bytes;
+    cutlass::subbyte_from_float(as<T>(bytes), values.data(), count, offset);
+    for (size_t i = 0; i < count; ++i) {
+      cutlass::ReferenceFactory<T>::get(as<T>(expected), int64_t(offset + i)) = to_t(values[i]);
+    }
+    ASSERT_EQ(bytes, expected) << "offset=" << offset;
+
+    std::vector<float> result(count);
+    cutlass::subbyte_to_float(result.data(), as<T>(bytes), count, offset);
+    for (size_t i = 0; i < count; ++i) {
+      ASSERT_EQ(result[i], to_float(to_t(values[i]))) << "offset=" << offset << " i=" << i;
+    }
+  }
+}
+
+std::vector<float> random_floats(size_t count, float lo, float hi) {
+  std::mt19937 generator(2025);
+  std::uniform_real_distribution<float> uniform(lo, hi);
+  std::vector<float> values(count);
+  for (auto &x : values) {
+    x = uniform(generator);
+  }
+  return values;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostSubbyte, fill_copy_generate) {
+  check_fill_copy_generate(cutlass::int4b_t(-3));
+  check_fill_copy_generate(cutlass::uint4b_t(11));
+  check_fill_copy_generate(cutlass::uint2b_t(2));
+  check_fill_copy_generate(cutlass::uint1b_t(1));
+  check_fill_copy_generate(cutlass::float_e2m1_t(1.5f));
+
+  // 6-bit elements straddle bytes and go through SubbyteReference
+  check_fill_copy_generate(cutlass::float_e3m2_t(-1.75f));
+}
+
+TEST(HostSubbyte, byte_elements) {
+  std::vector<int8_t> src = {1, -2, 3, -4, 5, -6, 7};
+  std::vector<int8_t> dst(src.size(), 0);
+  cutlass::subbyte_copy(dst.data() + 1, src.data(), 4, 1, 2);
+  EXPECT_EQ(dst, (std::vector<int8_t>{0, 0, 3, -4, 5, -6, 0}));
+  cutlass::subbyte_fill(dst.data(), 2, int8_t(9));
+  EXPECT_EQ(dst[0], 9);
+  EXPECT_EQ(dst[1], 9);
+
+  std::vector<float> values(src.size());
+  cutlass::subbyte_to_float(values.data(), src.data(), src.size());
+  EXPECT_EQ(values[1], -2.0f);
+}
+
+TEST(HostSubbyte, convert) {
+  check_convert<cutlass::int4b_t>(random_floats(1000, -8.4f, 7.4f));
+  check_convert<cutlass::uint4b_t>(random_floats(1000, 0.0f, 15.4f));
+  check_convert<cutlass::uint2b_t>(random_floats(1000, 0.0f, 3.4f));
+  check_convert<cutlass::float_e2m1_t>(random_floats(1000, -7.0f, 7.0f));
+  check_convert<cutlass::float_e3m2_t>(random_floats(1000, -20.0f, 20.0f));
+}
+
+TEST(HostSubbyte, containers) {
+  std::vector<float> values = random_floats(37, -6.0f, 6.0f);
+  cutlass::NumericConverter<cutlass::float_e2m1_t, float> to_e2m1;
+
+  cutlass::Array<cutlass::float_e2m1_t, 37> array;
+  cutlass::subbyte_from_float(array, values.data());
+  std::vector<float> result(37);
+  cutlass::subbyte_to_float(result.data(), array);
+  for (int i = 0; i < 37; ++i) {
+    EXPECT_EQ(float(array[i]), float(to_e2m1(values[i])));
+    EXPECT_EQ(result[i], float(to_e2m1(values[i])));
+  }
+
+  cute::array_subbyte<cutlass::float_e2m1_t, 37> cute_array{};
+  cutlass::subbyte_from_float(cute_array, values.data());
+  std::fill(result.begin(), result.end(), 0.0f);
+  cutlass::subbyte_to_float(result.data(), cute_array);
+  for (int i = 0; i < 37; ++i) {
+    EXPECT_EQ(float(cutlass::float_e2m1_t(cute_array[i])), float(to_e2m1(values[i])));
+    EXPECT_EQ(result[i], float(to_e2m1(values[i])));
+  }
+
+  cutlass::subbyte_fill(cute_array, cutlass::float_e2m1_t(-4.0f));
+  for (int i = 0; i < 37; ++i) {
+    EXPECT_EQ(float(cutlass::float_e2m1_t(cute_array[i])), -4.0f);
+  }
+
+  // array_subbyte::fill replicates the value across storage bytes, with a partial last byte
+  cute::array_subbyte<cutlass::uint2b_t, 13> narrow{};
+  narrow.fill(cutlass::uint2b_t(3));
+  for (int i = 0; i < 13; ++i) {
+    EXPECT_EQ(int(cutlass::uint2b_t(narrow[i])), 3);
+  }
+}
+
+TEST(HostSubbyte, reference_block_fills) {
+  // BlockFillRandomUniform and BlockFillRandomGaussian draw the same values in the same order
+  size_t const capacity = 1001;
+  std::vector<uint8_t> bulk(bytes_for<cutlass::int4b_t>(capacity), 0xa5);
+  std::vector<uint8_t> expected = bulk;
+
+  cutlass::reference::host::BlockFillRandomUniform(as<cutlass::int4b_t>(bulk), capacity, 2025, 7, -8, 0);
+  cutlass::reference::host::detail::RandomUniformFunc<cutlass::int4b_t> uniform(2025, 7, -8, 0, 0);
+  for (size_t i = 0; i < capacity; ++i) {
+    cutlass::ReferenceFactory<cutlass::int4b_t>::get(as<cutlass::int4b_t>(expected), int64_t(i)) = uniform();
+  }
+  EXPECT_EQ(bulk, expected);
+
+  cutlass::reference::host::BlockFillRandomGaussian(as<cutlass::float_e2m1_t>(bulk), capacity, 7, 0, 2);
+  cutlass::reference::host::detail::RandomGaussianFunc<cutlass::float_e2m1_t> gaussian(7, 0, 2, -1, 1.0);
+  for (size_t i = 0; i < capacity; ++i) {
+    cutlass::ReferenceFactory<cutlass::float_e2m1_t>::get(as<cutlass::float_e2m1_t>(expected), int64_t(i)) = gaussian();
+  }
+  EXPECT_EQ(bulk, expected);
+
+  cutlass::reference::host::BlockFill(as<cutlass::uint2b_t>(bulk), 5, cutlass::uint2b_t(1));
+  EXPECT_EQ(bulk[0], 0x55);
+  EXPECT_EQ(bulk[1] & 0x3, 0x1);
+  EXPECT_EQ(bulk[1] >> 2, expected[1] >> 2);
+}
+
+TEST(HostSubbyte, reference_tensor_fill_and_copy) {
+  using Element = cutlass::int4b_t;
+  using Layout = cutlass::layout::RowMajor;
+  int const rows = 9;
+  int const columns = 22;
+  cutlass::MatrixCoord extent(rows, columns);
+
+  // Dense tensors take the bulk path; a padded destination goes element by element
+  for (int ld : {columns, columns + 3}) {
+    std::vector<uint8_t> src(bytes_for<Element>(size_t(rows) * ld));
+    std::vector<uint8_t> dst(bytes_for<Element>(size_t(rows) * ld), 0);
+    cutlass::TensorView<Element, Layout> src_view(as<Element>(src), Layout(ld), extent);
+    cutlass::TensorView<Element, Layout> dst_view(as<Element>(dst), Layout(ld), extent);
+
+    cutlass::reference::host::TensorFill(src_view, Element(-2));
+    for (int r = 0; r < rows; ++r) {
+      for (int c = 0; c < columns; ++c) {
+        ASSERT_EQ(Element(src_view.at({r, c})), Element(-2));
+      }
+    }
+
+    cutlass::reference::host::BlockFillRandomUniform(as<Element>(src), size_t(rows) * ld, 3, 7, -8, 0);
+    cutlass::reference::host::TensorCopy(dst_view, src_view);
+    for (int r = 0; r < rows; ++r) {
+      for (int c = 0; c < columns; ++c) {
+        ASSERT_EQ(Element(dst_view.at({r, c})), Element(src_view.at({r, c}))) << "ld=" << ld;
+      }
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
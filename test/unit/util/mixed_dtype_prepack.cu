@@ -0,0 +1,242 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the fused host prepacking of mixed-input GEMM operands in mixed_dtype_utils.hpp
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/host_reorder.h"
+#include "cutlass/util/mixed_dtype_utils.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cute;
+
+using ValueShuffle4b = Layout<Shape<_2,_4>, Stride<_4,_1>>;
+using ValueShuffle8b = Layout<Shape<_2,_2>, Stride<_2,_1>>;
+using LayoutAtomFp8 = decltype(cutlass::compute_memory_reordering_atom<cutlass::float_e4m3_t>());
+using LayoutAtomBf16 = decltype(cutlass::compute_memory_reordering_atom<cutlass::bfloat16_t, Layout<Shape<_1,_1>>, ValueShuffle4b>());
+using LayoutAtomBf16x8b = decltype(cutlass::compute_memory_reordering_atom<cutlass::bfloat16_t, Layout<Shape<_1,_1>>, ValueShuffle8b>());
+
+/// Chains the separate steps on the host: unified_encode_int4b(), reorder_tensor() and pack_scale_fp8()
+template <class ElementQuant, class LayoutAtom, class ElementScale>
+void chain_prepack(std::vector<uint8_t> const& src, int N, int K, int L, bool unified_encode,
+                   std::vector<ElementScale> const& scale,
+                   std::vector<uint8_t>& dst, std::vector<cutlass::Array<ElementScale, 8>>& scale_packed) {
+  std::vector<uint8_t> encoded = src;
+  if (unified_encode) {
+    for (uint8_t& byte : encoded) {
+      byte = uint8_t(cutlass::unified_encode_int4b_storage(byte & 0x0f) |
+                     (cutlass::unified_encode_int4b_storage(byte >> 4) << 4));
+    }
+  }
+
+  auto shape = make_shape(N, K, L);
+  auto layout_src = make_layout(shape, make_stride(int64_t(K), _1{}, int64_t(N) * K));
+  auto layout_dst = tile_to_shape(LayoutAtom{}, shape);
+  dst.assign((size_t(cosize(layout_dst)) * sizeof_bits_v<ElementQuant> + 7) / 8, 0);
+  cutlass::reference::host::reorder_tensor(reinterpret_cast<ElementQuant const*>(encoded.data()), layout_src,
+                                           reinterpret_cast<ElementQuant*>(dst.data()), layout_dst);
+
+  scale_packed.resize(scale.size());
+  if constexpr (sizeof_bits_v<ElementScale> == 8) {
+    for (size_t i = 0; i < scale.size(); ++i) {
+      cutlass::packed_scale_t<ElementScale> packed(scale[i]);
+      scale_packed[i] = reinterpret_cast<cutlass::Array<ElementScale, 8> const&>(packed);
+    }
+  }
+}
+
+template <class ElementQuant, class LayoutAtom>
+void check_prepack(int N, int K, int L, int group_size, bool unified_encode) {
+  using ElementScale = cutlass::float_e4m3_t;
+  using Prepacker = cutlass::HostMixedDtypePrepacker<ElementQuant, LayoutAtom>;
+
+  int const groups = K / group_size;
+  auto shape = make_shape(N, K, L);
+  auto layout_src = make_layout(shape, make_stride(int64_t(K), _1{}, int64_t(N) * K));
+  auto layout_scale = make_layout(make_shape(N, groups, L), make_stride(int64_t(groups), _1{}, int64_t(N) * groups));
+
+  std::mt19937 engine(N + K);
+  std::vector<uint8_t> src(size_t(N) * K * L * sizeof_bits_v<ElementQuant> / 8);
+  for (uint8_t& byte : src) {
+    byte = uint8_t(engine());
+  }
+  std::vector<ElementScale> scale(size_t(N) * groups * L);
+  for (auto& s : scale) {
+    s = ElementScale::bitcast(uint8_t(engine() & 0x7f) | (engine() & 0x80));
+  }
+
+  std::vector<uint8_t> expected;
+  std::vector<cutlass::Array<ElementScale, 8>> expected_scale;
+  chain_prepack<ElementQuant, LayoutAtom>(src, N, K, L, unified_encode, scale, expected, expected_scale);
+
+  for (int thread_count : {1, 3}) {
+    std::vector<uint8_t> dst(expected.size(), 0xff);
+    std::vector<cutlass::Array<ElementScale, 8>> scale_packed(scale.size());
+    Prepacker(group_size, unified_encode, thread_count).prepack(
+      reinterpret_cast<ElementQuant const*>(src.data()), layout_src, reinterpret_cast<ElementQuant*>(dst.data()),
+      layout_scale, scale.data(), scale_packed.data());
+
+    EXPECT_EQ(dst, expected) << "threads: " << thread_count;
+    ASSERT_EQ(std::memcmp(scale_packed.data(), expected_scale.data(), scale.size() * sizeof(scale_packed[0])), 0)
+      << "threads: " << thread_count;
+  }
+}
+
+/// Quantizes a bfloat16 operand and checks it against the same quantization followed by the chain
+template <class ElementQuant, class LayoutAtom, class ElementScale, bool kHasZero>
+void check_quantize_and_prepack(int N, int K, int L, int group_size, bool unified_encode) {
+  using Prepacker = cutlass::HostMixedDtypePrepacker<ElementQuant, LayoutAtom>;
+  using Storage = uint8_t;
+
+  int const groups = K / group_size;
+  auto shape = make_shape(N, K, L);
+  auto layout_src = make_layout(shape, make_stride(int64_t(K), _1{}, int64_t(N) * K));
+  auto layout_scale = make_layout(make_shape(N, groups, L), make_stride(int64_t(groups), _1{}, int64_t(N) * groups));
+
+  std::mt19937 engine(N * K);
+  std::normal_distribution<float> normal(0.25f, 1.0f);
+  std::vector<cutlass::bfloat16_t> src(size_t(N) * K * L);
+  for (auto& x : src) {
+    x = cutlass::bfloat16_t(normal(engine));
+  }
+  // An all-zero group
+  for (int k = 0; k < group_size; ++k) {
+    src[layout_src(0, k, 0)] = cutlass::bfloat16_t(0.0f);
+  }
+
+  float const q_min = float(int(cutlass::platform::numeric_limits<ElementQuant>::lowest()));
+  float const q_max = float(int(cutlass::platform::numeric_limits<ElementQuant>::max()));
+
+  // Naive quantization to an unpacked (N,K,L) operand
+  std::vector<uint8_t> quantized(size_t(N) * K * L * sizeof_bits_v<ElementQuant> / 8, 0);
+  auto tensor_q = make_tensor(make_gmem_ptr<ElementQuant>(quantized.data()), layout_src);
+  std::vector<ElementScale> expected_scale(size_t(N) * groups * L);
+  std::vector<ElementScale> expected_zero(expected_scale.size());
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < N; ++n) {
+      for (int g = 0; g < groups; ++g) {
+        float lo = 0.0f, hi = 0.0f;
+        for (int k = g * group_size; k < (g + 1) * group_size; ++k) {
+          lo = std::min(lo, float(src[layout_src(n, k, l)]));
+          hi = std::max(hi, float(src[layout_src(n, k, l)]));
+        }
+        ElementScale s = kHasZero ? ElementScale((hi - lo) / (q_max - q_min)) : ElementScale(std::max(hi, -lo) / q_max);
+        ElementScale z = kHasZero ? ElementScale(lo - q_min * float(s)) : ElementScale(0.0f);
+        expected_scale[layout_scale(n, g, l)] = s;
+        expected_zero[layout_scale(n, g, l)] = z;
+
+        for (int k = g * group_size; k < (g + 1) * group_size; ++k) {
+          float x = float(src[layout_src(n, k, l)]);
+          float q = float(s) == 0.0f ? 0.0f : std::nearbyint((x - float(z)) * (1.0f / float(s)));
+          tensor_q(n, k, l) = ElementQuant(int(std::min(std::max(q, q_min), q_max)));
+          // Dequantization is within half a step of the source
+          EXPECT_LE(std::fabs(float(ElementQuant(tensor_q(n, k, l))) * float(s) + float(z) - x),
+                    0.5f * float(s) * 1.01f + 1e-6f) << "n=" << n << " k=" << k << " l=" << l;
+        }
+      }
+    }
+  }
+
+  std::vector<uint8_t> expected;
+  std::vector<cutlass::Array<ElementScale, 8>> expected_packed;
+  chain_prepack<ElementQuant, LayoutAtom>(quantized, N, K, L, unified_encode, expected_scale, expected, expected_packed);
+
+  std::vector<uint8_t> dst(expected.size(), 0xff);
+  std::vector<ElementScale> scale(expected_scale.size()), zero(expected_scale.size());
+  std::vector<cutlass::Array<ElementScale, 8>> scale_packed(expected_scale.size());
+  Prepacker(group_size, unified_encode).quantize_and_prepack(
+    src.data(), layout_src, reinterpret_cast<ElementQuant*>(dst.data()), layout_scale, scale.data(),
+    cutlass::sizeof_bits<ElementScale>::value == 8 ? scale_packed.data() : nullptr,
+    kHasZero ? zero.data() : nullptr);
+
+  EXPECT_EQ(dst, expected);
+  for (size_t i = 0; i < scale.size(); ++i) {
+    ASSERT_EQ(scale[i], expected_scale[i]) << "scale " << i;
+    if (kHasZero) {
+      ASSERT_EQ(zero[i], expected_zero[i]) << "zero " << i;
+    }
+  }
+  if (cutlass::sizeof_bits<ElementScale>::value == 8) {
+    EXPECT_EQ(std::memcmp(scale_packed.data(), expected_packed.data(), scale.size() * sizeof(scale_packed[0])), 0);
+  }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(MixedDtypePrepack, unified_encode_int4b_storage) {
+  // 1..7 take the encodings of -1..-7; zero and negative values are unchanged
+  uint8_t const expected[16] = {0, 7, 6, 5, 4, 3, 2, 1, 8, 9, 10, 11, 12, 13, 14, 15};
+  for (int storage = 0; storage < 16; ++storage) {
+    EXPECT_EQ(int(cutlass::unified_encode_int4b_storage(uint8_t(storage))), int(expected[storage]));
+  }
+}
+
+TEST(MixedDtypePrepack, int4_fp8_encoded) {
+  check_prepack<cutlass::int4b_t, LayoutAtomFp8>(256, 512, 2, 128, true);
+  check_prepack<cutlass::int4b_t, LayoutAtomFp8>(80, 256, 1, 64, true);
+}
+
+TEST(MixedDtypePrepack, int4_bf16_shuffled) {
+  check_prepack<cutlass::int4b_t, LayoutAtomBf16>(128, 256, 3, 128, false);
+}
+
+TEST(MixedDtypePrepack, int8_bf16_shuffled) {
+  check_prepack<int8_t, LayoutAtomBf16x8b>(96, 128, 2, 32, false);
+}
+
+TEST(MixedDtypePrepack, quantize_int4_fp8) {
+  check_quantize_and_prepack<cutlass::int4b_t, LayoutAtomFp8, cutlass::float_e4m3_t, false>(128, 512, 2, 128, true);
+}
+
+TEST(MixedDtypePrepack, quantize_int4_bf16_zero) {
+  check_quantize_and_prepack<cutlass::int4b_t, LayoutAtomBf16, cutlass::bfloat16_t, true>(64, 256, 1, 64, false);
+  check_quantize_and_prepack<cutlass::uint4b_t, LayoutAtomBf16, cutlass::bfloat16_t, true>(64, 256, 1, 64, false);
+}
+
+TEST(MixedDtypePrepack, quantize_int8_bf16) {
+  check_quantize_and_prepack<int8_t, LayoutAtomBf16x8b, cutlass::bfloat16_t, false>(80, 256, 2, 128, false);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,176 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for RecordingCudaHostAdapter
+*/
+
+// Route workspace fills through the host adapter
+#define CUTLASS_ENABLE_CUDA_HOST_ADAPTER true
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/workspace.h"
+#include "cutlass/util/recording_cuda_host_adapter.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(RecordingCudaHostAdapter, launch) {
+  cutlass::RecordingCudaHostAdapter::Options options;
+  options.kernel_param_bytes = sizeof(int);
+  cutlass::RecordingCudaHostAdapter adapter(options);
+
+  EXPECT_FALSE(adapter.empty());
+
+  int param = 42;
+  void *kernel_params[] = {&param};
+  cudaStream_t stream = reinterpret_cast<cudaStream_t>(0x10);
+
+  EXPECT_EQ(adapter.launch(dim3(4, 2, 1), dim3(128, 1, 1), 1024, stream, kernel_params, 0),
+            cutlass::Status::kSuccess);
+  EXPECT_EQ(adapter.launch(dim3(8, 2, 1), dim3(2, 1, 1), dim3(1, 1, 1), dim3(384, 1, 1), 2048,
+                           stream, kernel_params, 0),
+            cutlass::Status::kSuccess);
+
+  ASSERT_EQ(adapter.launch_count(), 2);
+  auto launches = adapter.launches();
+  ASSERT_EQ(launches.size(), 2u);
+
+  EXPECT_EQ(launches[0].grid_dims.x, 4u);
+  EXPECT_EQ(launches[0].grid_dims.y, 2u);
+  EXPECT_EQ(launches[0].cluster_dims.x, 0u);
+  EXPECT_EQ(launches[0].block_dims.x, 128u);
+  EXPECT_EQ(launches[0].smem_size, 1024u);
+  EXPECT_EQ(launches[0].stream, stream);
+  ASSERT_EQ(launches[0].kernel_param.size(), sizeof(int));
+  int recorded = 0;
+  std::memcpy(&recorded, launches[0].kernel_param.data(), sizeof(int));
+  EXPECT_EQ(recorded, 42);
+
+  EXPECT_EQ(launches[1].grid_dims.x, 8u);
+  EXPECT_EQ(launches[1].cluster_dims.x, 2u);
+  EXPECT_EQ(launches[1].fallback_cluster_dims.x, 1u);
+  EXPECT_EQ(launches[1].block_dims.x, 384u);
+  EXPECT_EQ(launches[1].smem_size, 2048u);
+
+  adapter.clear();
+  EXPECT_EQ(adapter.launch_count(), 0);
+  EXPECT_TRUE(adapter.launches().empty());
+}
+
+TEST(RecordingCudaHostAdapter, launch_status_and_counting_only) {
+  cutlass::RecordingCudaHostAdapter::Options options;
+  options.record = false;
+  options.launch_status = cutlass::Status::kErrorInternal;
+  cutlass::RecordingCudaHostAdapter adapter(options);
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(adapter.launch(dim3(1, 1, 1), dim3(32, 1, 1), 0, nullptr, nullptr, 0),
+              cutlass::Status::kErrorInternal);
+  }
+  EXPECT_EQ(adapter.launch_count(), 3);
+  EXPECT_TRUE(adapter.launches().empty());
+}
+
+TEST(RecordingCudaHostAdapter, query_occupancy) {
+  cutlass::RecordingCudaHostAdapter::Options options;
+  options.device_sms = 148;
+  options.sm_occupancy = 2;
+  cutlass::RecordingCudaHostAdapter adapter(options);
+
+  int32_t device_sms = 0;
+  int32_t sm_occupancy = 0;
+  EXPECT_EQ(adapter.query_occupancy(&device_sms, &sm_occupancy, 0, 128, 0), cutlass::Status::kSuccess);
+  EXPECT_EQ(device_sms, 148);
+  EXPECT_EQ(sm_occupancy, 2);
+  EXPECT_EQ(adapter.occupancy_query_count(), 1);
+}
+
+TEST(RecordingCudaHostAdapter, workspace_fill) {
+  cutlass::RecordingCudaHostAdapter::Options options;
+  options.apply_memset = true;
+  cutlass::RecordingCudaHostAdapter adapter(options);
+
+  std::vector<uint32_t> workspace(64, 0xdeadbeef);
+  EXPECT_EQ(cutlass::zero_workspace(workspace.data(), 32 * sizeof(uint32_t), nullptr, &adapter),
+            cutlass::Status::kSuccess);
+  EXPECT_EQ(cutlass::fill_workspace(workspace.data() + 32, uint32_t(7), 32, nullptr, &adapter),
+            cutlass::Status::kSuccess);
+
+  for (int i = 0; i < 32; ++i) {
+    EXPECT_EQ(workspace[i], 0u);
+    EXPECT_EQ(workspace[32 + i], 7u);
+  }
+
+  ASSERT_EQ(adapter.memset_count(), 2);
+  auto memsets = adapter.memsets();
+  ASSERT_EQ(memsets.size(), 2u);
+  EXPECT_EQ(memsets[0].destination, static_cast<void *>(workspace.data()));
+  EXPECT_EQ(memsets[0].fill_value.size(), 1u);
+  EXPECT_EQ(memsets[0].count, 32 * sizeof(uint32_t));
+  EXPECT_EQ(memsets[1].fill_value.size(), sizeof(uint32_t));
+  EXPECT_EQ(memsets[1].count, 32u);
+}
+
+TEST(RecordingCudaHostAdapter, concurrent_launches) {
+  cutlass::RecordingCudaHostAdapter adapter;
+
+  int const kThreads = 4;
+  int const kLaunchesPerThread = 1000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&adapter, t]() {
+      for (int i = 0; i < kLaunchesPerThread; ++i) {
+        adapter.launch(dim3(t + 1, 1, 1), dim3(128, 1, 1), 0, nullptr, nullptr, 0);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(adapter.launch_count(), kThreads * kLaunchesPerThread);
+  auto launches = adapter.launches();
+  ASSERT_EQ(launches.size(), size_t(kThreads * kLaunchesPerThread));
+  std::vector<int> per_thread(kThreads, 0);
+  for (auto const &launch : launches) {
+    ++per_thread[launch.grid_dims.x - 1];
+  }
+  for (int t = 0; t < kThreads; ++t) {
+    EXPECT_EQ(per_thread[t], kLaunchesPerThread);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
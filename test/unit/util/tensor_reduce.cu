@@ -29,6 +29,8 @@
  *
  **************************************************************************************************/
 #include <complex>
+#include <random>
+#include <vector>
 
 #include "../common/cutlass_unit_test.h"
 
@@ -37,6 +39,7 @@
 
 #include "cutlass/util/reference/device/tensor_reduce.h"
 #include "cutlass/util/reference/host/tensor_norm.h"
+#include "cutlass/util/reference/host/tensor_reduce.hpp"
 #include "cutlass/util/host_tensor.h"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,3 +245,169 @@ TEST(TensorReduce, norm_diff_nhwc_f16) {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+
+namespace {
+
+using RowMajorView = cutlass::TensorView<float, cutlass::layout::RowMajor>;
+
+/// Uniformly distributed values in [0, 1) of a fixed seed
+std::vector<float> make_uniform(int64_t count, unsigned seed) {
+  std::mt19937 engine(seed);
+  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+  std::vector<float> values(count);
+  for (float &x : values) {
+    x = dist(engine);
+  }
+  return values;
+}
+
+double exact_sum(std::vector<float> const &values) {
+  long double sum = 0;
+  for (float x : values) {
+    sum += x;
+  }
+  return double(sum);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TensorReduce, host_deterministic_across_thread_counts) {
+
+  int const kM = 517;
+  int const kN = 1031;
+
+  std::vector<float> values = make_uniform(int64_t(kM) * kN, 2024);
+  RowMajorView view(values.data(), cutlass::layout::RowMajor(kN), {kM, kN});
+
+  using cutlass::reference::host::TensorReduceOptions;
+  using cutlass::reference::host::ReductionOrder;
+  using cutlass::reference::host::SummationMode;
+
+  for (SummationMode summation : {SummationMode::kDefault, SummationMode::kPairwise, SummationMode::kKahan}) {
+
+    float reference = cutlass::reference::host::TensorSum(
+      view, 0.0f, TensorReduceOptions(ReductionOrder::kDeterministic, summation, 1));
+
+    for (int thread_count : {2, 3, 8}) {
+      float sum = cutlass::reference::host::TensorSum(
+        view, 0.0f, TensorReduceOptions(ReductionOrder::kDeterministic, summation, thread_count));
+
+      EXPECT_EQ(sum, reference) << "summation: " << int(summation) << ", threads: " << thread_count;
+    }
+
+    // The CuTe overload visits the same memory in the same order
+    auto tensor = cute::make_tensor(values.data(), cute::make_layout(cute::make_shape(kN, kM)));
+    float cute_sum = cutlass::reference::host::TensorSum(
+      tensor, 0.0f, TensorReduceOptions(ReductionOrder::kDeterministic, summation, 4));
+
+    EXPECT_EQ(cute_sum, reference) << "summation: " << int(summation);
+  }
+}
+
+TEST(TensorReduce, host_summation_accuracy) {
+
+  std::vector<float> values = make_uniform(int64_t(1) << 21, 7);
+  RowMajorView view(values.data(), cutlass::layout::RowMajor(1024), {int(values.size() / 1024), 1024});
+
+  double expected = exact_sum(values);
+
+  using cutlass::reference::host::TensorReduceOptions;
+  using cutlass::reference::host::ReductionOrder;
+  using cutlass::reference::host::SummationMode;
+
+  for (ReductionOrder order : {ReductionOrder::kSerial, ReductionOrder::kDeterministic, ReductionOrder::kUnordered}) {
+    for (SummationMode summation : {SummationMode::kPairwise, SummationMode::kKahan}) {
+
+      float sum = cutlass::reference::host::TensorSum(
+        view, 0.0f, TensorReduceOptions(order, summation, 4));
+
+      EXPECT_LT(std::abs(double(sum) - expected) / expected, 1.0e-6)
+        << "order: " << int(order) << ", summation: " << int(summation);
+    }
+  }
+}
+
+TEST(TensorReduce, host_serial_matches_left_fold) {
+
+  int const kM = 300;
+  int const kN = 500;
+
+  std::vector<float> values = make_uniform(int64_t(kM) * kN, 11);
+  RowMajorView view(values.data(), cutlass::layout::RowMajor(kN), {kM, kN});
+
+  float expected = 1.5f;
+  for (float x : values) {
+    expected += x * x;
+  }
+
+  float sum_sq = cutlass::reference::host::TensorSumSq(
+    view, 1.5f, cutlass::reference::host::TensorReduceOptions(cutlass::reference::host::ReductionOrder::kSerial));
+
+  EXPECT_EQ(sum_sq, expected);
+}
+
+TEST(TensorReduce, host_unordered_and_strided) {
+
+  int const kM = 700;
+  int const kN = 301;
+  int const kLdm = 320;
+
+  // Padding holds values that must not contribute
+  std::vector<float> values(int64_t(kM) * kLdm, 1.0e6f);
+  std::vector<float> packed = make_uniform(int64_t(kM) * kN, 5);
+  for (int m = 0; m < kM; ++m) {
+    for (int n = 0; n < kN; ++n) {
+      values[int64_t(m) * kLdm + n] = packed[int64_t(m) * kN + n];
+    }
+  }
+
+  RowMajorView strided(values.data(), cutlass::layout::RowMajor(kLdm), {kM, kN});
+  RowMajorView contiguous(packed.data(), cutlass::layout::RowMajor(kN), {kM, kN});
+
+  double expected = exact_sum(packed);
+
+  using cutlass::reference::host::TensorReduceOptions;
+  using cutlass::reference::host::ReductionOrder;
+
+  for (int thread_count : {1, 3}) {
+    TensorReduceOptions options(ReductionOrder::kUnordered, cutlass::reference::host::SummationMode::kDefault, thread_count);
+
+    double strided_sum = cutlass::reference::host::TensorSum(strided, 0.0, options);
+    double contiguous_sum = cutlass::reference::host::TensorSum(contiguous, 0.0, options);
+
+    EXPECT_LT(std::abs(strided_sum - expected), 1.0e-6 * expected);
+    EXPECT_LT(std::abs(contiguous_sum - expected), 1.0e-6 * expected);
+
+    double norm_diff = cutlass::reference::host::TensorNormDiff(strided, contiguous, 0.0, options);
+    EXPECT_EQ(norm_diff, 0.0);
+  }
+}
+
+TEST(TensorReduce, host_abs_max) {
+
+  int const kM = 400;
+  int const kN = 333;
+
+  std::vector<float> values = make_uniform(int64_t(kM) * kN, 3);
+  for (float &x : values) {
+    x -= 0.5f;
+  }
+  values[12345] = -3.25f;
+
+  RowMajorView view(values.data(), cutlass::layout::RowMajor(kN), {kM, kN});
+  auto tensor = cute::make_tensor(values.data(), cute::make_shape(kN, kM));
+
+  for (int thread_count : {1, 4}) {
+    cutlass::reference::host::TensorReduceOptions options(
+      cutlass::reference::host::ReductionOrder::kDeterministic,
+      cutlass::reference::host::SummationMode::kDefault,
+      thread_count);
+
+    EXPECT_EQ(cutlass::reference::host::TensorAbsMax(view, options), 3.25f);
+    EXPECT_EQ(cutlass::reference::host::TensorAbsMax(tensor, options), 3.25f);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,222 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host-side tile scheduler simulator
+*/
+
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/tile_scheduler_simulator.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using Simulator = cutlass::TileSchedulerSimulator;
+using DecompositionMode = Simulator::DecompositionMode;
+
+/// Checks that the recorded work covers the K extent of every output tile exactly once
+bool work_covers_each_k_tile_once(Simulator::Result const &result) {
+  std::map<std::tuple<int, int, int>, std::vector<std::pair<uint32_t, uint32_t>>> ranges;
+  for (Simulator::Work const &work : result.work) {
+    // Separate-reduction units compute no K tiles
+    if (work.separate_reduction) {
+      continue;
+    }
+    ranges[std::make_tuple(work.m, work.n, work.l)].emplace_back(work.k_begin, work.k_begin + work.k_tiles);
+  }
+
+  if (ranges.size() != result.output_tiles()) {
+    return false;
+  }
+
+  for (auto &tile : ranges) {
+    std::sort(tile.second.begin(), tile.second.end());
+    uint32_t k = 0;
+    for (auto const &range : tile.second) {
+      if (range.first != k || range.second <= range.first) {
+        return false;
+      }
+      k = range.second;
+    }
+    if (k != result.k_tiles_per_output_tile) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TileSchedulerSimulator, persistent_covers_each_tile_once) {
+  Simulator::Arguments args;
+  args.scheduler = cutlass::SimulatedTileScheduler::kPersistent;
+
+  for (int m : {128, 1000, 4096}) {
+    for (int cluster_m : {1, 2}) {
+      for (int swizzle : {1, 4}) {
+        args.problem_size = cutlass::gemm::BatchedGemmCoord(m, 3000, 512, 2);
+        args.cluster_shape = cutlass::gemm::GemmCoord(cluster_m, 1, 1);
+        args.max_swizzle_size = swizzle;
+
+        Simulator::Result result = Simulator::run(args);
+
+        EXPECT_TRUE(result.coverage_ok());
+        EXPECT_TRUE(work_covers_each_k_tile_once(result));
+        EXPECT_EQ(result.max_peers(), 1u);
+        EXPECT_LE(result.grid_ctas(), uint64_t(args.sm_count));
+      }
+    }
+  }
+}
+
+TEST(TileSchedulerSimulator, persistent_grid_truncated_to_problem) {
+  Simulator::Arguments args;
+  args.scheduler = cutlass::SimulatedTileScheduler::kPersistent;
+  args.problem_size = cutlass::gemm::BatchedGemmCoord(256, 256, 1024, 1);
+
+  Simulator::Result result = Simulator::run(args);
+
+  EXPECT_EQ(result.output_tiles(), 4u);
+  EXPECT_EQ(result.grid_ctas(), 4u);
+  EXPECT_EQ(result.waves(), 1u);
+  EXPECT_DOUBLE_EQ(result.load_imbalance(), 1.0);
+}
+
+TEST(TileSchedulerSimulator, stream_k_covers_each_k_tile_once) {
+  Simulator::Arguments args;
+
+  for (auto mode : {DecompositionMode::Heuristic, DecompositionMode::DataParallel,
+                    DecompositionMode::SplitK, DecompositionMode::StreamK}) {
+    for (int m : {1000, 2176, 8192}) {
+      for (int k : {256, 4096, 8000}) {
+        for (auto cluster : {cutlass::gemm::GemmCoord(1, 1, 1), cutlass::gemm::GemmCoord(2, 1, 1),
+                             cutlass::gemm::GemmCoord(1, 2, 1)}) {
+          args.problem_size = cutlass::gemm::BatchedGemmCoord(m, 1024, k, 1);
+          args.cluster_shape = cluster;
+          args.decomposition_mode = mode;
+          args.splits = mode == DecompositionMode::SplitK ? 3 : 1;
+
+          Simulator::Result result = Simulator::run(args);
+
+          EXPECT_TRUE(result.coverage_ok());
+          EXPECT_TRUE(work_covers_each_k_tile_once(result));
+        }
+      }
+    }
+  }
+}
+
+TEST(TileSchedulerSimulator, stream_k_reduces_tail_wave_imbalance) {
+  Simulator::Arguments args;
+  // 17 x 8 = 136 output tiles on 132 SMs leaves a 4-tile tail wave
+  args.problem_size = cutlass::gemm::BatchedGemmCoord(2176, 1024, 4096, 1);
+
+  args.decomposition_mode = DecompositionMode::DataParallel;
+  Simulator::Result data_parallel = Simulator::run(args);
+
+  args.decomposition_mode = DecompositionMode::Heuristic;
+  Simulator::Result heuristic = Simulator::run(args);
+
+  EXPECT_EQ(data_parallel.decomposition, DecompositionMode::DataParallel);
+  EXPECT_EQ(data_parallel.waves(), 2u);
+  EXPECT_EQ(data_parallel.max_cta_k_tiles(), 2u * data_parallel.k_tiles_per_output_tile);
+
+  EXPECT_EQ(heuristic.decomposition, DecompositionMode::StreamK);
+  EXPECT_EQ(heuristic.sk_units, 132u);
+  EXPECT_EQ(heuristic.sk_tiles, 136u);
+  EXPECT_EQ(heuristic.waves(), 1u);
+  EXPECT_LT(heuristic.max_cta_k_tiles(), data_parallel.max_cta_k_tiles());
+  EXPECT_LT(heuristic.load_imbalance(), data_parallel.load_imbalance());
+  EXPECT_GT(heuristic.split_tiles(), 0u);
+}
+
+TEST(TileSchedulerSimulator, split_k_peers) {
+  Simulator::Arguments args;
+  args.problem_size = cutlass::gemm::BatchedGemmCoord(1024, 1024, 4096, 1);
+  args.decomposition_mode = DecompositionMode::SplitK;
+  args.splits = 4;
+
+  Simulator::Result result = Simulator::run(args);
+
+  EXPECT_EQ(result.decomposition, DecompositionMode::SplitK);
+  EXPECT_EQ(result.splits, 4u);
+  EXPECT_EQ(result.units, 4u * result.output_tiles());
+  EXPECT_EQ(result.max_peers(), 4u);
+  EXPECT_EQ(result.split_tiles(), result.output_tiles());
+  EXPECT_TRUE(result.coverage_ok());
+}
+
+TEST(TileSchedulerSimulator, separate_reduction_units_are_not_peers) {
+  Simulator::Arguments args;
+  // 136 stream-K tiles on 132 SMs, as in stream_k_reduces_tail_wave_imbalance
+  args.problem_size = cutlass::gemm::BatchedGemmCoord(2176, 1024, 4096, 1);
+  args.decomposition_mode = DecompositionMode::StreamK;
+
+  Simulator::Result stream_k = Simulator::run(args);
+
+  args.separate_reduction_subtiles = 4;
+  Simulator::Result separate_reduction = Simulator::run(args);
+
+  EXPECT_EQ(stream_k.reduction_units, 0u);
+  EXPECT_EQ(separate_reduction.reduction_units, 4u * separate_reduction.sk_tiles);
+  EXPECT_EQ(separate_reduction.units, stream_k.units + separate_reduction.reduction_units);
+
+  // Reduction units are issued for every epilogue subtile of every stream-K tile
+  std::map<std::tuple<int, int, int>, std::vector<uint32_t>> subtiles;
+  for (Simulator::Work const &work : separate_reduction.work) {
+    if (work.separate_reduction) {
+      EXPECT_EQ(work.k_tiles, 0u);
+      subtiles[std::make_tuple(work.m, work.n, work.l)].push_back(static_cast<uint32_t>(work.unit));
+    }
+  }
+  EXPECT_EQ(subtiles.size(), separate_reduction.sk_tiles);
+  for (auto const &tile : subtiles) {
+    EXPECT_EQ(tile.second.size(), 4u);
+  }
+
+  // ... but don't reduce into the tiles like the units computing their K tiles
+  EXPECT_GT(separate_reduction.split_tiles(), 0u);
+  EXPECT_EQ(separate_reduction.max_peers(), stream_k.max_peers());
+  EXPECT_EQ(separate_reduction.split_tiles(), stream_k.split_tiles());
+  EXPECT_EQ(separate_reduction.tile_peers, stream_k.tile_peers);
+  EXPECT_TRUE(separate_reduction.coverage_ok());
+  EXPECT_TRUE(work_covers_each_k_tile_once(separate_reduction));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +125,28 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Class of math throughput bounding a kernel on the roofline
+enum class RooflineMathClass {
+  kF64,         ///< double-precision FMA, SIMT or tensor core
+  kF32,         ///< single-precision SIMT FMA
+  kTF32,        ///< tensor core operating on TF32 inputs
+  kF16,         ///< tensor core operating on F16 or BF16 inputs
+  kF8,          ///< tensor core operating on 8-bit or 6-bit floating-point inputs
+  kS8,          ///< tensor core operating on 8-bit or 2-bit integer inputs
+  kS4,          ///< tensor core operating on 4-bit integer inputs
+  kF4,          ///< tensor core operating on 4-bit floating-point inputs
+  kInvalid
+};
+
+/// Converts a RooflineMathClass enumerant to a string
+char const *to_string(RooflineMathClass math_class, bool pretty = false);
+
+/// Parses a RooflineMathClass enumerant from a string
+template <>
+RooflineMathClass from_string<RooflineMathClass>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Indicates the type of kernel argument
 // ArgumentType can be both ScalarType or NumericType. Thus, enums kScalar and kNumeric
 // 1) kScalar: e.g. of a Scalar ArgumentType is u32 is a Scalar type.
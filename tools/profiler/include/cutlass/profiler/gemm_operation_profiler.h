@@ -309,6 +309,15 @@ protected:
     cutlass::library::NumericTypeID element_A,
     cutlass::library::NumericTypeID element_B);
 
+  /// Snapshots the workspace to host memory and enqueues host reference verification on
+  /// the verification pipeline
+  void enqueue_host_reference_(
+    Options const &options,
+    library::GemmDescription const &gemm_desc,
+    GemmWorkspace &gemm_workspace,
+    cutlass::library::NumericTypeID element_A,
+    cutlass::library::NumericTypeID element_B);
+
   /// Method to profile a CUTLASS Operation
   Status profile_cutlass_(
     PerformanceResult &result,
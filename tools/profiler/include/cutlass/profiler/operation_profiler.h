@@ -53,6 +53,8 @@
 #include "performance_result.h"
 #include "performance_report.h"
 #include "problem_space.h"
+#include "sweep_journal.h"
+#include "verification_pipeline.h"
 #include "debug.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +93,10 @@ protected:
   /// Performance result vector constructed by profiling the operation
   PerformanceResultVector results_;
 
+  /// If not null, host reference verification may be enqueued here instead of running
+  /// synchronously. Valid only during profile_all().
+  VerificationPipeline *verification_pipeline_;
+
 public:
 
   //
@@ -131,11 +137,13 @@ public:
   /// Prints examples
   virtual void print_examples(std::ostream &out) const =0;
 
-  /// Entry point to profile all operations in the manifest
+  /// Entry point to profile all operations in the manifest. If a journal is given, work it
+  /// records as completed is skipped and newly completed work is recorded.
   virtual int profile_all(
     Options const &options, 
     library::Manifest const &manifest, 
-    DeviceContext &device_context);
+    DeviceContext &device_context,
+    SweepJournal *journal = nullptr);
 
 public:
 
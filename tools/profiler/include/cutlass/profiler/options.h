@@ -45,6 +45,7 @@
 #include "cutlass/library/library.h"
 
 #include "enumerated_types.h"
+#include "roofline.h"
 
 namespace cutlass {
 namespace profiler {
@@ -94,6 +95,12 @@ public:
     /// Total memory allocation on each device
     size_t maximum_capacity;
 
+    /// Peak throughputs of the selected devices used for roofline metrics
+    DeviceSpec spec;
+
+    /// Error encountered reading the file given by --device-spec, empty if none
+    std::string spec_error;
+
   private:
     /// SM Count
     /// Limits the number of SMs to use on each device 
@@ -181,6 +188,13 @@ public:
     /// Indicates when to save the workspace
     SaveWorkspace save_workspace;
 
+    /// Number of CPU threads running host reference verification concurrently with profiling.
+    /// If zero, host verification runs synchronously before each kernel is profiled.
+    int host_threads;
+
+    /// Upper bound on host memory (in MiB) held by tensors awaiting host verification
+    int64_t host_memory_mb;
+
     //
     // Methods
     //
@@ -277,6 +291,13 @@ public:
     /// Path to a file containing junit xml results
     std::string junit_output_path;
 
+    /// Path to a journal recording sweep progress
+    std::string journal_path;
+
+    /// If true, resumes a previous sweep by skipping work recorded in the journal and
+    /// appending to the existing reports
+    bool resume;
+
     /// Sequence of tags to attach to each result
     std::vector<std::pair<std::string, std::string>> pivot_tags;
 
@@ -293,6 +314,9 @@ public:
     /// Sort results by flops-per-second
     bool sort_flops_per_sec;
 
+    /// Percentage of the roofline below which results are flagged in the summary
+    double roofline_threshold;
+
     /// Prints the name of the kernel being profiled before running the kernel.
     /// This is useful for determining which kernel is causing a run of the profiler to hang
     bool print_kernel_before_running;
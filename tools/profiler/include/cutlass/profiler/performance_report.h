@@ -83,6 +83,13 @@ private:
   /// Collection of all results
   PerformanceResultVector concatenated_results_;
 
+  /// Results bucketed by their position on the roofline
+  RooflineSummary roofline_summary_;
+
+  /// Flag indicating the CSV report carries the roofline columns. Cleared when appending to a
+  /// report whose header predates them, so that rows keep matching the existing header.
+  bool roofline_columns_;
+
 public:
 
   PerformanceReport(Options const &options, std::vector<std::string> const &argument_names, library::OperationKind const &op_kind);
@@ -90,11 +97,19 @@ public:
 
   bool good() const { return good_; }
 
+  /// Index of the current problem
+  size_t problem_index() const { return problem_index_; }
+
   void next_problem();
   void append_result(PerformanceResult result);
+
+  /// Appends a result belonging to a problem visited earlier, such as one held back until
+  /// deferred verification completed
+  void append_result(PerformanceResult result, size_t problem_index);
   void sort_flops_per_byte(PerformanceResultVector &results);
   void sort_flops_per_sec(PerformanceResultVector &results);
   void append_results(PerformanceResultVector const &results);
+  void append_results(PerformanceResultVector const &results, size_t problem_index);
 
 public:
 
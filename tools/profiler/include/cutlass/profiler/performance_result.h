@@ -40,6 +40,7 @@
 
 // CUTLASS Profiler includes
 #include "enumerated_types.h"
+#include "roofline.h"
 
 // CUTLASS Library includes
 #include "cutlass/library/library.h"
@@ -89,6 +90,9 @@ struct PerformanceResult {
   /// Average runtime in ms per device
   std::vector<double> runtime_vector;
 
+  /// Position on the roofline of the device
+  RooflineMetrics roofline;
+
   //
   // Members
   //
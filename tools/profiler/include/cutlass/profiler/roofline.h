@@ -0,0 +1,224 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Roofline model relating measured performance to the peak throughputs of a device.
+
+   Each result is placed on the roofline of the device it ran on: its arithmetic intensity
+   (FLOPs per byte of algorithmic memory traffic) determines whether the kernel is bounded by
+   memory bandwidth or by the math throughput of the instructions it uses, and the measured
+   runtime is reported as a percentage of that bound.
+*/
+
+#pragma once
+
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <vector>
+
+// CUTLASS Profiler includes
+#include "enumerated_types.h"
+
+// CUTLASS Library includes
+#include "cutlass/library/library.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Nominal peak throughputs of a device
+struct DeviceSpec {
+
+  /// Name of the device
+  std::string name;
+
+  /// Compute capability (e.g. 80, 90)
+  int compute_capability;
+
+  /// DRAM bandwidth in units of GB/s (10^9 bytes per second)
+  double memory_bandwidth;
+
+  /// Dense math throughput in units of GFLOP/s for each class of math instruction
+  std::map<RooflineMathClass, double> peak_math;
+
+  //
+  // Methods
+  //
+
+  DeviceSpec(): compute_capability(0), memory_bandwidth(0) { }
+
+  /// Returns the dense math throughput of the given class in GFLOP/s, or zero if unknown
+  double peak(RooflineMathClass math_class) const;
+
+  /// Returns true if the memory bandwidth is known
+  bool good() const {
+    return memory_bandwidth > 0;
+  }
+};
+
+/// Returns the built-in table of device specs
+std::vector<DeviceSpec> const &device_spec_table();
+
+/// Finds the spec for a device. Entries whose name appears in 'device_name' are preferred among
+/// those matching the compute capability. Returns false if no entry matches.
+bool find_device_spec(DeviceSpec &spec, std::string const &device_name, int compute_capability);
+
+/// Parses a device spec from JSON of the form
+///
+///   {
+///     "name": "NVIDIA H100 SXM5",
+///     "compute_capability": 90,
+///     "memory_bandwidth": 3350,
+///     "peak_math": { "f64": 67000, "tf32": 494700, "f16": 989400, "f8": 1978900 }
+///   }
+///
+/// with bandwidth in GB/s and math throughput in GFLOP/s. Throws std::runtime_error on error.
+DeviceSpec parse_device_spec(std::istream &in);
+
+/// Reads a device spec from a JSON file. Throws std::runtime_error on error.
+DeviceSpec load_device_spec(std::string const &path);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Classifies the math instructions used by a kernel with the given operand types. Mixed-input
+/// kernels are classified by the operand with the lowest math throughput.
+RooflineMathClass roofline_math_class(
+  library::OpcodeClassID opcode_class,
+  library::MathOperationID math_operation,
+  library::NumericTypeID element_A,
+  library::NumericTypeID element_B);
+
+/// Classifies the math instructions used by an operation
+RooflineMathClass roofline_math_class(library::OperationDescription const &desc);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Position of a result on the roofline
+struct RooflineMetrics {
+
+  /// Class of math instruction bounding the kernel
+  RooflineMathClass math_class;
+
+  /// FLOPs per byte of algorithmic memory traffic
+  double arithmetic_intensity;
+
+  /// Attainable throughput at this arithmetic intensity in GFLOP/s
+  double bound_gflops;
+
+  /// Measured performance as a percentage of the attainable performance
+  double percent_of_bound;
+
+  /// True if memory bandwidth rather than math throughput bounds the kernel
+  bool memory_bound;
+
+  //
+  // Methods
+  //
+
+  RooflineMetrics():
+    math_class(RooflineMathClass::kInvalid),
+    arithmetic_intensity(0),
+    bound_gflops(0),
+    percent_of_bound(0),
+    memory_bound(false) { }
+
+  /// Returns true if the result could be placed on the roofline
+  bool good() const {
+    return percent_of_bound > 0;
+  }
+};
+
+/// Places a result performing 'flops' and moving 'bytes' in 'runtime' milliseconds on the
+/// roofline of 'spec'. Metrics are left invalid if the spec lacks the required peaks.
+RooflineMetrics compute_roofline(
+  DeviceSpec const &spec,
+  RooflineMathClass math_class,
+  int64_t flops,
+  int64_t bytes,
+  double runtime);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Aggregates results into memory-bound and compute-bound buckets and collects those performing
+/// below a threshold of their roofline
+class RooflineSummary {
+public:
+
+  /// Result performing below the threshold
+  struct Entry {
+    size_t problem_index;
+    std::string operation_name;
+    RooflineMetrics metrics;
+  };
+
+private:
+
+  /// Percentage of the roofline below which results are flagged
+  double threshold_;
+
+  /// Number of results in each bucket
+  size_t memory_bound_count_;
+  size_t compute_bound_count_;
+
+  /// Sum of percent_of_bound in each bucket
+  double memory_bound_percent_;
+  double compute_bound_percent_;
+
+  /// Results below the threshold
+  std::vector<Entry> flagged_;
+
+public:
+
+  explicit RooflineSummary(double threshold = 50);
+
+  /// Adds a result. Results that could not be placed on the roofline are ignored.
+  void add(size_t problem_index, std::string const &operation_name, RooflineMetrics const &metrics);
+
+  /// Number of results added
+  size_t count() const { return memory_bound_count_ + compute_bound_count_; }
+
+  size_t memory_bound_count() const { return memory_bound_count_; }
+  size_t compute_bound_count() const { return compute_bound_count_; }
+
+  /// Results below the threshold, in the order they were added
+  std::vector<Entry> const &flagged() const { return flagged_; }
+
+  /// Prints the summary in human readable form
+  std::ostream &print(std::ostream &out) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Journal recording the progress of a profiling sweep so that it may be resumed.
+
+   The journal is an append-only text file. Each line is a tab-separated record:
+
+     cutlass_profiler_journal  <version>  <fingerprint>
+     done      <operation_kind>  <problem_index>  <operation_name>
+     complete  <operation_kind>  <problem_index>
+
+   'done' records that an operation's results for that problem have been written to the
+   report, and 'complete' records that every operation was visited for the problem. Records
+   are flushed as they are written, and a torn trailing line left by a crash is ignored on load.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SweepJournal {
+public:
+
+  /// Version of the on-disk format
+  static int const kVersion = 2;
+
+private:
+
+  /// Path to journal file
+  std::string path_;
+
+  /// Fingerprint of the profiler configuration which produced the journal
+  std::string fingerprint_;
+
+  /// Output stream to which new records are appended
+  std::ofstream output_;
+
+  /// Set of (operation kind, problem index) for which all operations were visited
+  std::set<std::pair<std::string, size_t>> completed_problems_;
+
+  /// Set of operations recorded as done, keyed by (operation kind, problem index)
+  std::map<std::pair<std::string, size_t>, std::set<std::string>> completed_operations_;
+
+  /// Number of records recovered from an existing journal
+  size_t recovered_records_;
+
+  /// Flag indicating the journal is valid
+  bool good_;
+
+public:
+
+  /// Opens a journal at the given path. If 'resume' is true, any existing records with a
+  /// matching fingerprint are loaded and new records are appended. Otherwise, the journal
+  /// is truncated.
+  SweepJournal(std::string const &path, std::string const &fingerprint, bool resume);
+
+  ~SweepJournal();
+
+  /// Returns true if the journal file could be opened and any existing journal was consistent
+  bool good() const { return good_; }
+
+  /// Path to the journal file
+  std::string const &path() const { return path_; }
+
+  /// Number of records recovered from a previous run
+  size_t recovered_records() const { return recovered_records_; }
+
+  /// Returns true if every operation was visited for the given problem in a previous run
+  bool problem_completed(std::string const &operation_kind, size_t problem_index) const;
+
+  /// Returns true if the operation's results for the given problem were written in a previous run
+  bool operation_completed(
+    std::string const &operation_kind,
+    size_t problem_index,
+    std::string const &operation_name) const;
+
+  /// Records that an operation's results were written to the report
+  void operation_done(
+    std::string const &operation_kind,
+    size_t problem_index,
+    std::string const &operation_name);
+
+  /// Records that all operations were visited for a problem
+  void problem_done(std::string const &operation_kind, size_t problem_index);
+
+  /// Computes a fingerprint of a configuration from (key, value) pairs. Pairs are sorted
+  /// before hashing so the result does not depend on the order of command line arguments.
+  static std::string compute_fingerprint(
+    std::string const &prefix,
+    std::vector<std::pair<std::string, std::string>> key_values);
+
+private:
+
+  /// Loads records from an existing journal. Returns false if the journal is inconsistent.
+  bool load_(std::istream &in);
+
+  /// Writes a single record and flushes it to disk
+  void write_record_(std::string const &record);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,189 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Pipeline overlapping host-side verification with profiling of subsequent kernels.
+
+   Host reference computations are slow relative to the kernels they verify. Rather than blocking
+   profiling on them, the verification phase snapshots the tensors it needs into host memory and
+   enqueues the reference computation and comparison on a pool of CPU workers. Results whose
+   verification is still in flight are held back and forwarded to the report, in their original
+   order, once every outstanding disposition has been merged into them.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// CUTLASS Profiler includes
+#include "enumerated_types.h"
+#include "performance_result.h"
+
+// CUTLASS Library includes
+#include "cutlass/library/library.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class VerificationPipeline {
+public:
+
+  /// Reference computation and comparison executed by a worker
+  using Task = std::function<Disposition()>;
+
+  /// Snapshots the state needed for verification on the calling thread and returns the task
+  /// to execute on a worker. Invoked only after the requested host memory has been reserved.
+  using Snapshot = std::function<Task()>;
+
+  /// Receives results once all of their verification has completed
+  using Sink = std::function<void(PerformanceResultVector const &)>;
+
+private:
+
+  /// Verification of a single result by a single provider
+  struct Check {
+    library::Provider provider;
+    std::future<Disposition> disposition;
+  };
+
+  /// Results held back until their checks complete
+  struct Entry {
+    PerformanceResultVector results;
+    std::vector<Check> checks;
+    Sink sink;
+  };
+
+  /// Work item queued for the workers. The task is held apart from the promise so that the
+  /// snapshot it owns is released as soon as it has executed.
+  struct Job {
+    Task task;
+    std::promise<Disposition> disposition;
+    size_t bytes;
+  };
+
+  /// Upper bound on the host memory held by snapshots which have not been verified yet
+  size_t max_bytes_in_flight_;
+
+  /// Host memory currently held by snapshots
+  size_t bytes_in_flight_;
+
+  /// Worker threads
+  std::vector<std::thread> workers_;
+
+  /// Jobs waiting for a worker
+  std::deque<Job> jobs_;
+
+  /// Guards jobs_, bytes_in_flight_ and stop_
+  std::mutex mutex_;
+
+  /// Signaled when a job is queued or the pipeline stops
+  std::condition_variable job_available_;
+
+  /// Signaled when a job completes
+  std::condition_variable job_finished_;
+
+  /// Set when workers should exit
+  bool stop_;
+
+  /// Checks enqueued for the operation currently being verified
+  std::vector<Check> staged_;
+
+  /// Results awaiting completion of their checks, in the order they were appended
+  std::deque<Entry> pending_;
+
+public:
+
+  /// Creates a pipeline with the given number of workers. With zero workers, tasks execute
+  /// synchronously on the calling thread.
+  VerificationPipeline(int thread_count, size_t max_bytes_in_flight);
+
+  /// Completes outstanding work and joins the workers. Results that were not flushed are dropped.
+  ~VerificationPipeline();
+
+  VerificationPipeline(VerificationPipeline const &) = delete;
+  VerificationPipeline &operator=(VerificationPipeline const &) = delete;
+
+  /// Number of worker threads
+  int thread_count() const { return int(workers_.size()); }
+
+  /// Host memory currently held by snapshots
+  size_t bytes_in_flight();
+
+  /// Number of appended results batches that are still waiting on verification
+  size_t pending() const { return pending_.size(); }
+
+  /// Reserves 'bytes' of host memory, waiting for in-flight checks to release memory if needed,
+  /// invokes 'snapshot' and queues the returned task. The check applies to the next results
+  /// passed to append_results().
+  void enqueue(library::Provider provider, size_t bytes, Snapshot const &snapshot);
+
+  /// Forwards 'results' to 'sink' once all checks enqueued since the previous call complete,
+  /// merging their dispositions into each result produced by the CUTLASS provider. Results are
+  /// always delivered in the order they are appended.
+  void append_results(PerformanceResultVector const &results, Sink sink);
+
+  /// Delivers results whose checks are complete. If 'wait' is true, blocks until every pending
+  /// result has been delivered and all snapshots have been released.
+  void flush(bool wait = false);
+
+  /// Merges a verification outcome into a result, updating its disposition to the worst
+  /// outcome among all verification providers as verify_cutlass() does.
+  static void merge_disposition(
+    PerformanceResult &result,
+    library::Provider provider,
+    Disposition disposition);
+
+private:
+
+  /// Worker main loop
+  void worker_();
+
+  /// Executes a job, fulfilling its promise and destroying its task
+  static void run_(Job &job);
+
+  /// Delivers the front entry, blocking until its checks complete
+  void deliver_front_();
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
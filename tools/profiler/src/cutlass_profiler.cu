@@ -33,6 +33,7 @@
 */
 
 #include <iostream>
+#include <memory>
 #include <stdexcept>
 
 // Profiler includes
@@ -46,9 +47,12 @@
 #include "cutlass/profiler/rank_2k_operation_profiler.h"
 #include "cutlass/profiler/rank_k_operation_profiler.h"
 #include "cutlass/profiler/sparse_gemm_operation_profiler.h"
+#include "cutlass/profiler/sweep_journal.h"
 #include "cutlass/profiler/symm_operation_profiler.h"
 #include "cutlass/profiler/trmm_operation_profiler.h"
 
+#include "cutlass/version.h"
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
@@ -102,6 +106,11 @@ int CutlassProfiler::operator()() {
     return 1;
   }
 
+  if (!options_.device.spec_error.empty()) {
+    std::cerr << "Invalid --device-spec: " << options_.device.spec_error << "\n";
+    return 1;
+  }
+
   if (options_.about.help) {
     if (options_.operation_kind == library::OperationKind::kInvalid) {
       print_usage_(std::cout);
@@ -155,6 +164,41 @@ int CutlassProfiler::profile_() {
   // Keep track of all device memory tensor in map
   DeviceContext device_context;
 
+  // Journal of completed work, used to resume interrupted sweeps
+  std::unique_ptr<SweepJournal> journal;
+
+  if (!options_.report.journal_path.empty()) {
+
+    // Arguments which only affect where and how results are reported may change between runs
+    std::vector<std::pair<std::string, std::string>> key_values;
+    for (size_t i = 0; i < options_.cmdline.keys.size(); ++i) {
+      std::string const &key = options_.cmdline.keys[i];
+      if (key == "resume" || key == "journal" || key == "append" || key == "verbose" ||
+          key == "junit-output" || key == "print-kernel-before-running") {
+        continue;
+      }
+      key_values.emplace_back(key, options_.cmdline.values[i]);
+    }
+
+    journal = std::make_unique<SweepJournal>(
+      options_.report.journal_path,
+      SweepJournal::compute_fingerprint(cutlass::getVersionString(), key_values),
+      options_.report.resume);
+
+    if (!journal->good()) {
+      return 1;
+    }
+
+    if (options_.report.verbose && journal->recovered_records()) {
+      std::cout << "Resuming from journal '" << journal->path() << "' with "
+                << journal->recovered_records() << " records." << std::endl;
+    }
+  }
+  else if (options_.report.resume) {
+    std::cerr << "--resume requires --journal=<path> or --output=<path>." << std::endl;
+    return 1;
+  }
+
   int result = 0;
   // For all profilers (e.g. gemm/sparse_gemm/conv2d...)
   for (auto & profiler : operation_profilers_) {
@@ -162,7 +206,7 @@ int CutlassProfiler::profile_() {
     if (options_.operation_kind == library::OperationKind::kInvalid ||
         options_.operation_kind == profiler->kind()) {
 
-      result = profiler->profile_all(options_, library::Singleton::get().manifest, device_context);
+      result = profiler->profile_all(options_, library::Singleton::get().manifest, device_context, journal.get());
 
       // If some profile failed, terminate immediately
       if (result) {
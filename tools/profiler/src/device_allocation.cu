@@ -40,6 +40,7 @@
 
 #include "cutlass/util/reference/device/tensor_compare.h"
 #include "cutlass/util/reference/device/tensor_fill.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
 #include "cutlass/util/reference/host/tensor_fill.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/tensor_view_io.h"
@@ -2090,6 +2091,188 @@ bool DeviceAllocation::block_compare_relatively_equal(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+template <typename Element>
+bool host_block_compare_equal_(
+  void const *ptr_A,
+  void const *ptr_B,
+  size_t capacity) {
+
+  return reference::host::BlockCompareEqual<Element>(
+    reinterpret_cast<Element const *>(ptr_A),
+    reinterpret_cast<Element const *>(ptr_B),
+    capacity);
+}
+
+template <typename Element>
+bool host_block_compare_relatively_equal_(
+  void const *ptr_A,
+  void const *ptr_B,
+  size_t capacity,
+  double epsilon,
+  double nonzero_floor) {
+
+  return reference::host::BlockCompareRelativelyEqual<Element>(
+    reinterpret_cast<Element const *>(ptr_A),
+    reinterpret_cast<Element const *>(ptr_B),
+    capacity,
+    static_cast<Element>(epsilon),
+    static_cast<Element>(nonzero_floor));
+}
+
+} // namespace
+
+/// Returns true if two blocks in host memory have exactly the same value
+bool DeviceAllocation::host_block_compare_equal(
+  library::NumericTypeID numeric_type,
+  void const *ptr_A,
+  void const *ptr_B,
+  size_t capacity) {
+
+  switch (numeric_type) {
+  case library::NumericTypeID::kFE4M3:
+    return host_block_compare_equal_<float_e4m3_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kFE5M2:
+    return host_block_compare_equal_<float_e5m2_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kFUE4M3:
+    return host_block_compare_equal_<float_ue4m3_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kFUE8M0:
+    return host_block_compare_equal_<float_ue8m0_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kFE2M3:
+    return host_block_compare_equal_<float_e2m3_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kFE3M2:
+    return host_block_compare_equal_<float_e3m2_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kFE2M1:
+    return host_block_compare_equal_<float_e2m1_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kF16:
+    return host_block_compare_equal_<half_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kBF16:
+    return host_block_compare_equal_<bfloat16_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kTF32:
+    return host_block_compare_equal_<tfloat32_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kF32:
+    return host_block_compare_equal_<float>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kF64:
+    return host_block_compare_equal_<double>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kS2:
+    return host_block_compare_equal_<int2b_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kS4:
+    return host_block_compare_equal_<int4b_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kS8:
+    return host_block_compare_equal_<int8_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kS16:
+    return host_block_compare_equal_<int16_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kS32:
+    return host_block_compare_equal_<int32_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kS64:
+    return host_block_compare_equal_<int64_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kB1:
+    return host_block_compare_equal_<uint1b_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kU2:
+    return host_block_compare_equal_<uint2b_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kU4:
+    return host_block_compare_equal_<uint4b_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kU8:
+    return host_block_compare_equal_<uint8_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kU16:
+    return host_block_compare_equal_<uint16_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kU32:
+    return host_block_compare_equal_<uint32_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kU64:
+    return host_block_compare_equal_<uint64_t>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCBF16:
+    return host_block_compare_equal_<complex<bfloat16_t>>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCTF32:
+    return host_block_compare_equal_<complex<tfloat32_t>>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCF16:
+    return host_block_compare_equal_<complex<half_t>>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCF32:
+    return host_block_compare_equal_<complex<float>>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCF64:
+    return host_block_compare_equal_<complex<double>>(ptr_A, ptr_B, capacity);
+
+  default:
+    throw std::runtime_error(std::string("Unsupported numeric type: ") + to_string(numeric_type));
+  }
+}
+
+/// Returns true if two blocks in host memory have approximately the same value
+bool DeviceAllocation::host_block_compare_relatively_equal(
+  library::NumericTypeID numeric_type,
+  void const *ptr_A,
+  void const *ptr_B,
+  size_t capacity,
+  double epsilon,
+  double nonzero_floor) {
+
+  switch (numeric_type) {
+  case library::NumericTypeID::kFE4M3:
+    return host_block_compare_relatively_equal_<float_e4m3_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kFE5M2:
+    return host_block_compare_relatively_equal_<float_e5m2_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kFUE4M3:
+    return host_block_compare_relatively_equal_<float_ue4m3_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kFUE8M0:
+    return host_block_compare_relatively_equal_<float_ue8m0_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kFE2M3:
+    return host_block_compare_relatively_equal_<float_e2m3_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kFE3M2:
+    return host_block_compare_relatively_equal_<float_e3m2_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kFE2M1:
+    return host_block_compare_relatively_equal_<float_e2m1_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kF16:
+    return host_block_compare_relatively_equal_<half_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kBF16:
+    return host_block_compare_relatively_equal_<bfloat16_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kTF32:
+    return host_block_compare_relatively_equal_<tfloat32_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kF32:
+    return host_block_compare_relatively_equal_<float>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kF64:
+    return host_block_compare_relatively_equal_<double>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kS2:
+    return host_block_compare_relatively_equal_<int2b_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kS4:
+    return host_block_compare_relatively_equal_<int4b_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kS8:
+    return host_block_compare_relatively_equal_<int8_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kS16:
+    return host_block_compare_relatively_equal_<int16_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kS32:
+    return host_block_compare_relatively_equal_<int32_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kS64:
+    return host_block_compare_relatively_equal_<int64_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kB1:
+    return host_block_compare_relatively_equal_<uint1b_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kU2:
+    return host_block_compare_relatively_equal_<uint2b_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kU4:
+    return host_block_compare_relatively_equal_<uint4b_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kU8:
+    return host_block_compare_relatively_equal_<uint8_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kU16:
+    return host_block_compare_relatively_equal_<uint16_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kU32:
+    return host_block_compare_relatively_equal_<uint32_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+  case library::NumericTypeID::kU64:
+    return host_block_compare_relatively_equal_<uint64_t>(ptr_A, ptr_B, capacity, epsilon, nonzero_floor);
+
+  // As with block_compare_relatively_equal(), complex numbers require bitwise equality.
+  case library::NumericTypeID::kCF16:
+    return host_block_compare_equal_<complex<half_t>>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCF32:
+    return host_block_compare_equal_<complex<float>>(ptr_A, ptr_B, capacity);
+  case library::NumericTypeID::kCF64:
+    return host_block_compare_equal_<complex<double>>(ptr_A, ptr_B, capacity);
+
+  default:
+    throw std::runtime_error(std::string("Unsupported numeric type: ") + to_string(numeric_type));
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Permits copying dynamic vectors into static-length vectors
 template <typename TensorCoord, int Rank>
 struct vector_to_coord {
@@ -221,6 +221,55 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+static struct {
+  char const *text;
+  char const *pretty;
+  RooflineMathClass enumerant;
+}
+RooflineMathClass_enumerants[] = {
+  {"f64", "F64", RooflineMathClass::kF64},
+  {"f32", "F32", RooflineMathClass::kF32},
+  {"tf32", "TF32", RooflineMathClass::kTF32},
+  {"f16", "F16", RooflineMathClass::kF16},
+  {"f8", "F8", RooflineMathClass::kF8},
+  {"s8", "S8", RooflineMathClass::kS8},
+  {"s4", "S4", RooflineMathClass::kS4},
+  {"f4", "F4", RooflineMathClass::kF4}
+};
+
+/// Converts a RooflineMathClass enumerant to a string
+char const *to_string(RooflineMathClass math_class, bool pretty) {
+
+  for (auto const & possible : RooflineMathClass_enumerants) {
+    if (math_class == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses a RooflineMathClass enumerant from a string
+template <>
+RooflineMathClass from_string<RooflineMathClass>(std::string const &str) {
+
+  for (auto const & possible : RooflineMathClass_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return RooflineMathClass::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 static struct {
   char const *text;
   char const *pretty;
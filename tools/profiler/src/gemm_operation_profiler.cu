@@ -37,6 +37,7 @@
 #include <iomanip>
 #include <ios>
 #include <vector>
+#include <memory>
 
 #include "cutlass/core_io.h"
 #include <cuda_runtime_api.h>
@@ -1444,6 +1445,20 @@ bool GemmOperationProfiler::verify_with_reference_(
         }
       }
 
+      // Host references run on the verification pipeline, if enabled, while profiling continues
+      if (provider == library::Provider::kReferenceHost && verification_pipeline_) {
+        enqueue_host_reference_(
+          options,
+          gemm_desc,
+          gemm_workspace_[i],
+          element_A_for_reference,
+          element_B_for_reference);
+
+        // Placeholder until the pipeline merges the outcome into the result
+        results_.back().verification_map[provider] = Disposition::kNotVerified;
+        continue;
+      }
+
       // To support the host-side reference, conditionally allocate and
       // copy tensors to host memory.
       std::vector<uint8_t> host_data_A;
@@ -1565,6 +1580,140 @@ bool GemmOperationProfiler::verify_with_reference_(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Snapshots the workspace to host memory and enqueues host reference verification
+void GemmOperationProfiler::enqueue_host_reference_(
+  Options const &options,
+  library::GemmDescription const &gemm_desc,
+  GemmWorkspace &gemm_workspace,
+  cutlass::library::NumericTypeID element_A,
+  cutlass::library::NumericTypeID element_B) {
+
+  size_t bytes =
+    gemm_workspace.A->bytes() +
+    gemm_workspace.B->bytes() +
+    gemm_workspace.C->bytes() +
+    gemm_workspace.Computed->bytes() +
+    gemm_workspace.Reference->bytes();
+
+  // Runs on the profiling thread once host memory is reserved. Tensors are copied out of device
+  // memory here because the workspace is reused by the next operation.
+  auto snapshot = [&options, &gemm_desc, &gemm_workspace, element_A, element_B, this]() {
+
+    auto host_data_A = std::make_shared<std::vector<uint8_t>>(gemm_workspace.A->bytes());
+    auto host_data_B = std::make_shared<std::vector<uint8_t>>(gemm_workspace.B->bytes());
+    auto host_data_C = std::make_shared<std::vector<uint8_t>>(gemm_workspace.C->bytes());
+    auto host_data_computed = std::make_shared<std::vector<uint8_t>>(gemm_workspace.Computed->bytes());
+
+    gemm_workspace.A->copy_to_host(host_data_A->data());
+    gemm_workspace.B->copy_to_host(host_data_B->data());
+    gemm_workspace.C->copy_to_host(host_data_C->data());
+    gemm_workspace.Computed->copy_to_host(host_data_computed->data());
+
+    // Constructed here since the handle queries the current device. Host references need
+    // no device workspace.
+    auto handle = std::make_shared<library::Handle>(nullptr, 0);
+    handle->set_provider(library::Provider::kReferenceHost);
+
+    library::GemmUniversalMode mode = problem_.mode;
+    library::GemmUniversalConfiguration configuration = gemm_workspace.configuration;
+    std::vector<uint8_t> alpha = problem_.alpha;
+    std::vector<uint8_t> beta = problem_.beta;
+
+    size_t reference_bytes = gemm_workspace.Reference->bytes();
+    int64_t batch_stride_A = gemm_workspace.A->batch_stride();
+    int64_t batch_stride_B = gemm_workspace.B->batch_stride();
+    int64_t batch_stride_C = gemm_workspace.C->batch_stride();
+    int64_t batch_stride_D = gemm_workspace.Reference->batch_stride();
+    int64_t compare_count = gemm_workspace.Computed->batch_stride();
+
+    double epsilon = options.verification.epsilon;
+    double nonzero_floor = options.verification.nonzero_floor;
+    library::GemmDescription desc = gemm_desc;
+
+    return VerificationPipeline::Task([=]() {
+
+      std::vector<uint8_t> host_data_D(reference_bytes);
+
+      Status status = handle->gemm_universal(
+        mode,
+        configuration.problem_size.m(),
+        configuration.problem_size.n(),
+        configuration.problem_size.k(),
+
+        configuration.cluster_shape.m(),
+        configuration.cluster_shape.n(),
+        configuration.cluster_shape.k(),
+        configuration.cluster_shape_fallback.m(),
+        configuration.cluster_shape_fallback.n(),
+        configuration.cluster_shape_fallback.k(),
+
+        desc.tile_description.math_instruction.element_accumulator,
+        desc.element_epilogue,
+
+        alpha.data(),
+
+        element_A,
+        desc.A.layout,
+        desc.transform_A,
+        host_data_A->data(),
+        int(configuration.lda),
+
+        element_B,
+        desc.B.layout,
+        desc.transform_B,
+        host_data_B->data(),
+        int(configuration.ldb),
+
+        beta.data(),
+
+        desc.C.element,
+        desc.C.layout,
+        host_data_C->data(),
+        int(configuration.ldc),
+
+        desc.D.element,
+        desc.D.layout,
+        host_data_D.data(),
+        int(configuration.ldd),
+
+        configuration.batch_count,
+        batch_stride_A,
+        batch_stride_B,
+        batch_stride_C,
+        batch_stride_D);
+
+      if (status != Status::kSuccess) {
+        return Disposition::kNotRun;
+      }
+
+      bool passed = false;
+
+      if (epsilon == 0) {
+        passed = DeviceAllocation::host_block_compare_equal(
+          desc.D.element,
+          host_data_computed->data(),
+          host_data_D.data(),
+          compare_count);
+      }
+      else {
+        passed = DeviceAllocation::host_block_compare_relatively_equal(
+          desc.D.element,
+          host_data_computed->data(),
+          host_data_D.data(),
+          compare_count,
+          epsilon,
+          nonzero_floor);
+      }
+
+      return passed ? Disposition::kPassed : Disposition::kIncorrect;
+    });
+  };
+
+  verification_pipeline_->enqueue(library::Provider::kReferenceHost, bytes, snapshot);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Measures performance results
 bool GemmOperationProfiler::profile(
   Options const &options,
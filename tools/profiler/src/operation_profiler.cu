@@ -61,7 +61,7 @@ namespace cutlass {
 namespace profiler {
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-OperationProfiler::OperationProfiler(): kind_(library::OperationKind::kInvalid) { }
+OperationProfiler::OperationProfiler(): kind_(library::OperationKind::kInvalid), verification_pipeline_(nullptr) { }
 
 /// Ctor
 OperationProfiler::OperationProfiler(
@@ -70,7 +70,7 @@ OperationProfiler::OperationProfiler(
   ArgumentDescriptionVector const &arguments,
   ProviderVector const & verification_providers
 ):
-  kind_(kind), arguments_(arguments) {
+  kind_(kind), arguments_(arguments), verification_pipeline_(nullptr) {
 
   ArgumentDescriptionVector tile_description_arguments{
     {ArgumentTypeID::kEnumerated, {"op_class", "opcode-class"}, "Class of math instruction (simt, tensorop, wmmatensorop, wmma)"},
@@ -347,7 +347,8 @@ std::ostream& operator<<(std::ostream& out, library::OperationKind op_kind) {
 int OperationProfiler::profile_all(
   Options const &options,
   library::Manifest const &manifest,
-  DeviceContext &device_context) {
+  DeviceContext &device_context,
+  SweepJournal *journal) {
   ProblemSpace cmdline_problem_space(arguments_, options.cmdline);
 
   bool do_testlist_run = !options.operation_problems.empty();
@@ -364,6 +365,84 @@ int OperationProfiler::profile_all(
   // 1. Construct performance report
   PerformanceReport report(options, cmdline_problem_space.argument_names(), kind_);
 
+  std::string const kind_str = library::to_string(kind_);
+
+  // Host reference verification may overlap with profiling. The pipeline is declared after the
+  // report so that it is destroyed first.
+  std::unique_ptr<VerificationPipeline> verification_pipeline;
+
+  if (options.verification.enabled &&
+      options.verification.host_threads > 0 &&
+      options.verification.provider_enabled(library::Provider::kReferenceHost) &&
+      options.verification.save_workspace == SaveWorkspace::kNever &&
+      options.execution_mode == ExecutionMode::kProfile) {
+
+    verification_pipeline = std::make_unique<VerificationPipeline>(
+      options.verification.host_threads,
+      size_t(options.verification.host_memory_mb) << 20);
+  }
+
+  verification_pipeline_ = verification_pipeline.get();
+
+  // Places results of an operation on the device roofline and writes them to the report, once
+  // any verification still in flight for them completes. If 'record' is true, the operation is
+  // then recorded in the journal.
+  auto append_results = [&](
+    PerformanceResultVector results,
+    library::Operation const *operation,
+    std::string const &operation_name,
+    bool record) {
+
+    RooflineMathClass math_class = roofline_math_class(operation->description());
+
+    for (auto &result : results) {
+      result.roofline = compute_roofline(
+        options.device.spec, math_class, result.flops, result.bytes, result.runtime);
+    }
+
+    size_t problem_index = report.problem_index();
+
+    auto sink = [&report, &kind_str, journal, problem_index, operation_name, record](
+      PerformanceResultVector const &ready) {
+
+      report.append_results(ready, problem_index);
+
+      // Recorded after the report is written, so an interruption in between repeats the
+      // operation rather than losing its result.
+      if (journal && record) {
+        journal->operation_done(kind_str, problem_index, operation_name);
+      }
+    };
+
+    if (verification_pipeline) {
+      verification_pipeline->append_results(results, sink);
+    }
+    else {
+      sink(results);
+    }
+  };
+
+  // Records that every operation was visited for the current problem, after its results are written
+  auto complete_problem = [&]() {
+
+    if (!journal) {
+      return;
+    }
+
+    size_t problem_index = report.problem_index();
+
+    auto sink = [&kind_str, journal, problem_index](PerformanceResultVector const &) {
+      journal->problem_done(kind_str, problem_index);
+    };
+
+    if (verification_pipeline) {
+      verification_pipeline->append_results(PerformanceResultVector(), sink);
+    }
+    else {
+      sink(PerformanceResultVector());
+    }
+  };
+
   //
   int retval = 0;
 
@@ -384,6 +463,12 @@ int OperationProfiler::profile_all(
       ProblemSpace::Problem problem = problem_it.at();
       report.next_problem();
 
+      // Skip problems fully covered by a previous run. Problem indices are stable because the
+      // journal fingerprint guarantees the same problem space and testlist.
+      if (journal && journal->problem_completed(kind_str, report.problem_index())) {
+        continue;
+      }
+
       // For each operation in manifest
       int matched_operation_count = 0;
       int profiled_operation_count = 0;
@@ -467,6 +552,12 @@ int OperationProfiler::profile_all(
           // we have found a kernel match, so increment the counter for match kernels
           ++matched_operation_count;
 
+          // Results of this operation were already written to the report by a previous run
+          if (journal && journal->operation_completed(kind_str, report.problem_index(), operation_name)) {
+            ++profiled_operation_count;
+            continue;
+          }
+
           // A. Initialize configuration
           Status status = this->initialize_configuration(
             options,
@@ -481,7 +572,7 @@ int OperationProfiler::profile_all(
             // If there was an internal error, consume the CUDA error and move to the next operation.
             (void)cudaGetLastError();
 
-            report.append_result(model_result_);
+            append_results(PerformanceResultVector(1, model_result_), operation, operation_name, true);
             continue;
           }
           else if (status != Status::kSuccess) {
@@ -510,7 +601,7 @@ int OperationProfiler::profile_all(
               // If there was an internal error, consume the CUDA error and move to the next operation.
               (void)cudaGetLastError();
 
-              report.append_results(results_);
+              append_results(results_, operation, operation_name, true);
               continue;
             }
             else if (status != Status::kSuccess) {
@@ -539,7 +630,7 @@ int OperationProfiler::profile_all(
           }
 
           if (options.execution_mode == ExecutionMode::kDryRun) {
-            report.append_results(results_);
+            append_results(results_, operation, operation_name, true);
             results_.clear();
             continue;
           }
@@ -574,7 +665,7 @@ int OperationProfiler::profile_all(
             profiled_operation_count++;
           }
 
-          report.append_results(results_);
+          append_results(results_, operation, operation_name, continue_profiling);
           results_.clear();
         } // if op satisfied compute capacity
 
@@ -585,6 +676,10 @@ int OperationProfiler::profile_all(
         }
       } // for op in manifest
 
+      if (continue_profiling) {
+        complete_problem();
+      }
+
       // If we did not find any kernels that match our filters and error_on_no_match was set, report an error
       if (options.profiling.error_on_no_match && matched_operation_count <= 0) {
         #if !NDEBUG
@@ -607,6 +702,13 @@ int OperationProfiler::profile_all(
     } // for each problem in problem space
   }
 
+  // Wait for outstanding host verification before the report is closed
+  if (verification_pipeline) {
+    verification_pipeline->flush(true);
+  }
+
+  verification_pipeline_ = nullptr;
+
   return retval;
 }
 
@@ -144,6 +144,21 @@ Options::Device::Device(cutlass::CommandLine const &cmdline) {
     // Permit overriding the sm_count
     cmdline.get_cmd_line_argument("sm-count", sm_count, 0);
   }
+
+  // Peak throughputs from a user-provided file take precedence over the built-in table
+  if (cmdline.check_cmd_line_flag("device-spec")) {
+    std::string spec_path;
+    cmdline.get_cmd_line_argument("device-spec", spec_path);
+    try {
+      spec = load_device_spec(spec_path);
+    }
+    catch (std::exception const &e) {
+      spec_error = e.what();
+    }
+  }
+  else if (!properties.empty()) {
+    find_device_spec(spec, properties[0].name, compute_capability(0));
+  }
 }
 
 int Options::Device::get_sm_count(int device_index) const {
@@ -199,7 +214,12 @@ void Options::Device::print_usage(std::ostream &out) const {
      << "  --sm-count=<int>                             "
      << "    Override the number of SMs. This is used to limit the number of " << end_of_line
      << "      during profiling. If this is set, profiling attempts to limit the sm_count " << end_of_line
-     << "      to user-set value. This is not possible on all architectures and all kernel types. \n\n";
+     << "      to user-set value. This is not possible on all architectures and all kernel types. \n\n"
+
+     << "  --device-spec=<path>                         "
+     << "    JSON file describing the memory bandwidth and peak math throughput of the device" << end_of_line
+     << "      used for roofline metrics. If omitted, nominal values are looked up by device name" << end_of_line
+     << "      and compute capability.\n\n";
 
 }
 
@@ -207,7 +227,7 @@ void Options::Device::print_device_info(std::ostream &out) const {
   cudaDeviceProp props;
   cudaError_t result;
 
-  out << "Device Name,SM,CUDA Device ID,Phy Device ID" << std::endl;
+  out << "Device Name,SM,CUDA Device ID,Phy Device ID,Roofline Spec" << std::endl;
 
   for (int device = 0; device < num_devices; device++) {
     result = cudaSetDevice(device);
@@ -220,8 +240,12 @@ void Options::Device::print_device_info(std::ostream &out) const {
       throw std::runtime_error("cudaGetDeviceProperties failed for device");
     }
 
+    DeviceSpec device_spec;
+    bool has_spec = find_device_spec(device_spec, props.name, props.major * 10 + props.minor);
+
     out << props.name << "," << props.major << props.minor << ","
-      << device << "," << props.multiGpuBoardGroupID << std::endl;
+      << device << "," << props.multiGpuBoardGroupID << ","
+      << (has_spec ? device_spec.name : "unknown") << std::endl;
 
   }
 }
@@ -238,7 +262,8 @@ void Options::Device::print_options(std::ostream &out, int indent) const {
   out
     << "\n"
     << indent_str(indent) << "clock: " << int(double(clock_KHz) / 1000.0) << "\n"
-    << indent_str(indent) << "compute-capability: " << compute_capability(0) << "\n";
+    << indent_str(indent) << "compute-capability: " << compute_capability(0) << "\n"
+    << indent_str(indent) << "device-spec: " << (spec.good() ? spec.name : "unknown") << "\n";
 }
 
 /// Returns the device ID from a device index
@@ -613,6 +638,9 @@ Options::Verification::Verification(cutlass::CommandLine const &cmdline) {
     save_workspace = SaveWorkspace::kNever;
   }
 
+  cmdline.get_cmd_line_argument("verification-host-threads", host_threads, 0);
+  cmdline.get_cmd_line_argument("verification-host-memory", host_memory_mb, int64_t(4096));
+
   if (cmdline.check_cmd_line_flag("verification-providers")) {
 
     std::vector<std::string> tokens;
@@ -655,6 +683,14 @@ void Options::Verification::print_usage(std::ostream &out) const {
     << "       --save-workspace=incorrect  save workspace for incorrect results" << end_of_line
     << "       --save-workspace=always     always save workspace\n\n"
 
+    << "  --verification-host-threads=<int>            "
+    << "    Number of CPU threads running host reference verification while subsequent" << end_of_line
+    << "      kernels are profiled. If zero (default), host verification is synchronous." << end_of_line
+    << "      Ignored when --save-workspace is set.\n\n"
+
+    << "  --verification-host-memory=<MiB>             "
+    << "    Upper bound on host memory held by tensors awaiting host verification. (default: 4096)\n\n"
+
     << "  --verification-providers=<providers>         "
     << "    List of providers used to verify result. (default: '*')" << end_of_line
     << "      Gemm verification-providers {cublas*}" << end_of_line
@@ -668,6 +704,8 @@ void Options::Verification::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "verification_enabled: " << enabled << "\n"
     << indent_str(indent) << "epsilon: " << epsilon << "\n"
     << indent_str(indent) << "save_workspace: " << to_string(save_workspace) << "\n"
+    << indent_str(indent) << "verification_host_threads: " << host_threads << "\n"
+    << indent_str(indent) << "verification_host_memory: " << host_memory_mb << "\n"
     << indent_str(indent) << "verification_providers: [";
 
   int j = 0;
@@ -701,6 +739,13 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("append", append, false);
   cmdline.get_cmd_line_argument("output", output_path);
   cmdline.get_cmd_line_argument("junit-output", junit_output_path);
+  cmdline.get_cmd_line_argument("journal", journal_path);
+  cmdline.get_cmd_line_argument("resume", resume, false);
+
+  // Default the journal to sit next to the CSV report when resuming
+  if (resume && journal_path.empty() && !output_path.empty()) {
+    journal_path = output_path.substr(0, output_path.rfind(".csv")) + ".journal";
+  }
 
   if (cmdline.check_cmd_line_flag("tags")) {
     cmdline.get_cmd_line_argument_pairs("tags", pivot_tags);
@@ -714,6 +759,8 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
 
   cmdline.get_cmd_line_argument("sort-results-flops-per-sec", sort_flops_per_sec, false);
 
+  cmdline.get_cmd_line_argument("roofline-threshold", roofline_threshold, 50.0);
+
   cmdline.get_cmd_line_argument("print-kernel-before-running", print_kernel_before_running, false);
 }
 
@@ -731,6 +778,14 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "  --junit-output=<path>                        "
     << "    Path to junit output file for result reporting. Operation kind and '.junit.xml' is appended.\n\n"
 
+    << "  --journal=<path>                             "
+    << "    Path to a journal recording each completed (operation, problem) pair. Defaults to" << end_of_line
+    << "      the --output path with '.journal' in place of '.csv' when --resume is given.\n\n"
+
+    << "  --resume=<bool>                              "
+    << "    If true, skips work recorded in the journal by a previous, interrupted run with the" << end_of_line
+    << "      same arguments and appends to the existing reports.\n\n"
+
     << "  --print-kernel-before-running=<bool>                "
     << "    Prints the name of the kernel being profiled before running the kernel." << end_of_line
     << "      This is useful for determining which kernel is causing a run of the profiler to hang\n\n"
@@ -739,6 +794,10 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "    If true, reports the status of all kernels including those that" << end_of_line
     << "      do not satisfy the given arguments.\n\n"
 
+    << "  --roofline-threshold=<percent>               "
+    << "    Results achieving less than this percentage of their roofline are listed in the" << end_of_line
+    << "      roofline summary. (default: 50)\n\n"
+
     << "  --tags=<column:tag,...>                      "
     << "    Inserts leading columns in output table and uniform values for each" << end_of_line
     << "      column. Useful for generating pivot tables.\n\n"
@@ -756,8 +815,11 @@ void Options::Report::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "append: " << append << "\n"
     << indent_str(indent) << "output: " << output_path << "\n"
     << indent_str(indent) << "junit-output: " << junit_output_path << "\n"
+    << indent_str(indent) << "journal: " << journal_path << "\n"
+    << indent_str(indent) << "resume: " << resume << "\n"
     << indent_str(indent) << "print-kernel-before-running: " << print_kernel_before_running << "\n"
     << indent_str(indent) << "report-not-run: " << report_not_run << "\n"
+    << indent_str(indent) << "roofline-threshold: " << roofline_threshold << "\n"
     << indent_str(indent) << "tags:\n";
 
   for (auto const & tag : pivot_tags) {
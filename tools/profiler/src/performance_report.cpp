@@ -72,7 +72,8 @@ PerformanceReport::PerformanceReport(
   std::vector<std::string> const &argument_names,
   library::OperationKind const &op_kind
 ):
-  options_(options), argument_names_(argument_names), problem_index_(0), good_(true), op_kind_(op_kind) {
+  options_(options), argument_names_(argument_names), problem_index_(0), good_(true), op_kind_(op_kind),
+  roofline_summary_(options.report.roofline_threshold), roofline_columns_(true) {
 
   // Strip '.csv' if present
   std::string base_path = options_.report.output_path;
@@ -91,12 +92,24 @@ PerformanceReport::PerformanceReport(
 
     bool print_header = true;
 
-    if (options_.report.append) {
+    // A resumed sweep continues the report written by the interrupted run
+    if (options_.report.append || options_.report.resume) {
 
       std::ifstream test_output_file(op_file_name_);
 
       if (test_output_file.is_open()) {
         print_header = false;
+
+        std::string header;
+        if (std::getline(test_output_file, header) && !header.empty() &&
+            header.find(",RooflineGFLOPs") == std::string::npos) {
+
+          std::cerr << "Appending to '" << op_file_name_ << "' written without roofline columns; "
+            << "roofline metrics are omitted from it." << std::endl;
+
+          roofline_columns_ = false;
+        }
+
         test_output_file.close();
       }
 
@@ -140,8 +153,16 @@ void PerformanceReport::next_problem() {
 }
 
 void PerformanceReport::append_result(PerformanceResult result) {
+  append_result(result, problem_index_);
+}
 
-  result.problem_index = problem_index_;
+void PerformanceReport::append_result(PerformanceResult result, size_t problem_index) {
+
+  result.problem_index = problem_index;
+
+  if (result.provider == library::Provider::kCUTLASS) {
+    roofline_summary_.add(problem_index, result.operation_name, result.roofline);
+  }
 
   if (options_.report.verbose) {
     std::cout << "\n";
@@ -201,6 +222,17 @@ void PerformanceReport::append_results(PerformanceResultVector const &results) {
   }
 }
 
+void PerformanceReport::append_results(PerformanceResultVector const &results, size_t problem_index) {
+
+  if (options_.report.verbose) {
+    std::cout << "\n\n";
+  }
+
+  for (auto const & result : results) {
+    append_result(result, problem_index);
+  }
+}
+
 PerformanceReport::~PerformanceReport() {
 
   //
@@ -230,6 +262,11 @@ PerformanceReport::~PerformanceReport() {
     std::cout << "\nWrote results to '" << op_file_name_ << "'" << std::endl;
   }
 
+  if (options_.report.verbose && roofline_summary_.count()) {
+    std::cout << "\n=============================\n\n";
+    roofline_summary_.print(std::cout) << std::flush;
+  }
+
   if (output_file_.is_open()) {
     output_file_.close();
   }
@@ -326,6 +363,13 @@ std::ostream & PerformanceReport::print_result_pretty_(
       << "          Memory: " << result.gbytes_per_sec() << " GiB/s\n"
       << "\n            Math: " << result.gflops_per_sec() << " GFLOP/s\n";
 
+    if (result.roofline.good()) {
+      out
+        << "        Roofline: " << result.roofline.bound_gflops << " GFLOP/s ("
+        << (result.roofline.memory_bound ? "memory-bound" : "compute-bound") << ", "
+        << to_string(result.roofline.math_class) << ")\n"
+        << "     Of Roofline: " << result.roofline.percent_of_bound << " %\n";
+    }
   }
 
   return out;
@@ -367,6 +411,15 @@ std::ostream & PerformanceReport::print_csv_header_(
     << ",GFLOPs"
     ;
 
+  if (roofline_columns_) {
+    out
+      << ",Intensity"
+      << ",RooflineGFLOPs"
+      << ",PercentOfRoofline"
+      << ",Bound"
+      ;
+  }
+
   return out;
 }
 
@@ -425,6 +478,25 @@ std::ostream & PerformanceReport::print_result_csv_(
     );
   }
 
+  if (!roofline_columns_) {
+    return out;
+  }
+
+  out << ",";
+  if (result.bytes > 0) {
+    out << result.roofline.arithmetic_intensity;
+  }
+
+  if (result.roofline.good()) {
+    out
+      << "," << result.roofline.bound_gflops
+      << "," << result.roofline.percent_of_bound
+      << "," << (result.roofline.memory_bound ? "memory" : "compute");
+  }
+  else {
+    out << std::string(3, ',');
+  }
+
   return out;
 }
 
@@ -0,0 +1,647 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Roofline model relating measured performance to the peak throughputs of a device.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+#include "cutlass/profiler/roofline.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+double DeviceSpec::peak(RooflineMathClass math_class) const {
+  auto it = peak_math.find(math_class);
+  if (it != peak_math.end()) {
+    return it->second;
+  }
+
+  // Devices without 4-bit integer tensor core instructions run int4 operands at the int8 rate
+  return math_class == RooflineMathClass::kS4 ? peak(RooflineMathClass::kS8) : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Row of the built-in table. Throughputs are dense, in TFLOP/s, and zero where the device
+/// has no such instructions.
+struct DeviceSpecRow {
+  int compute_capability;
+  char const *name;
+  double memory_bandwidth;
+  double f64;
+  double f32;
+  double tf32;
+  double f16;
+  double f8;
+  double s8;
+  double s4;
+  double f4;
+};
+
+/// Nominal datasheet values of one representative part per compute capability. Entries with
+/// the same compute capability are distinguished by name; the first is the default.
+DeviceSpecRow const kDeviceSpecRows[] = {
+  // cc   name          GB/s      f64    f32    tf32     f16      f8      s8      s4      f4
+  {  70, "V100",         900,     7.8,   15.7,      0,    125,      0,      0,      0,      0 },
+  {  75, "T4",           320,    0.25,    8.1,      0,     65,      0,    130,    260,      0 },
+  {  80, "A100 SXM",    2039,    19.5,   19.5,    156,    312,      0,    624,   1248,      0 },
+  {  80, "A100 PCIe",   1935,    19.5,   19.5,    156,    312,      0,    624,   1248,      0 },
+  {  86, "A10",          600,    0.98,   31.2,   62.5,    125,      0,    250,    500,      0 },
+  {  89, "L40S",         864,    1.41,   91.6,  183.2,  366.5,    733,    733,   1466,      0 },
+  {  90, "H100 SXM",    3350,      67,     67,  494.7,  989.4, 1978.9, 1978.9,      0,      0 },
+  {  90, "H100 PCIe",   2000,      51,     51,    378,    756,   1513,   1513,      0,      0 },
+  { 100, "B200",        8000,      40,     80,   1100,   2250,   4500,   4500,      0,   9000 },
+};
+
+/// Lower-cases a string for case-insensitive matching
+std::string to_lower_(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+  return str;
+}
+
+DeviceSpec make_device_spec_(DeviceSpecRow const &row) {
+
+  DeviceSpec spec;
+  spec.name = row.name;
+  spec.compute_capability = row.compute_capability;
+  spec.memory_bandwidth = row.memory_bandwidth;
+
+  std::pair<RooflineMathClass, double> const peaks[] = {
+    {RooflineMathClass::kF64, row.f64},
+    {RooflineMathClass::kF32, row.f32},
+    {RooflineMathClass::kTF32, row.tf32},
+    {RooflineMathClass::kF16, row.f16},
+    {RooflineMathClass::kF8, row.f8},
+    {RooflineMathClass::kS8, row.s8},
+    {RooflineMathClass::kS4, row.s4},
+    {RooflineMathClass::kF4, row.f4}
+  };
+
+  for (auto const &peak : peaks) {
+    if (peak.second > 0) {
+      spec.peak_math[peak.first] = peak.second * 1000.0;
+    }
+  }
+
+  return spec;
+}
+
+} // namespace
+
+std::vector<DeviceSpec> const &device_spec_table() {
+
+  static std::vector<DeviceSpec> const table = [] {
+    std::vector<DeviceSpec> specs;
+    for (auto const &row : kDeviceSpecRows) {
+      specs.push_back(make_device_spec_(row));
+    }
+    return specs;
+  }();
+
+  return table;
+}
+
+bool find_device_spec(DeviceSpec &spec, std::string const &device_name, int compute_capability) {
+
+  std::string name = to_lower_(device_name);
+
+  // Device names differ in spacing and punctuation ("A100-SXM4-80GB", "A100 80GB PCIe"), so
+  // each word of the table entry is matched separately.
+  auto name_matches = [&name](std::string const &entry) {
+    std::istringstream words(to_lower_(entry));
+    std::string word;
+    while (words >> word) {
+      if (name.find(word) == std::string::npos) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  DeviceSpec const *match = nullptr;
+
+  for (auto const &candidate : device_spec_table()) {
+    if (candidate.compute_capability != compute_capability) {
+      continue;
+    }
+    if (name_matches(candidate.name)) {
+      match = &candidate;
+      break;
+    }
+    if (!match) {
+      match = &candidate;
+    }
+  }
+
+  if (!match) {
+    return false;
+  }
+
+  spec = *match;
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Minimal reader for the JSON subset describing a device spec
+class JsonReader {
+public:
+
+  explicit JsonReader(std::istream &in):
+    text_(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()), pos_(0) { }
+
+  /// Returns true and consumes 'c' if it is the next non-whitespace character
+  bool accept(char c) {
+    skip_whitespace_();
+    if (pos_ < text_.size() && text_[pos_] == c) {
+      ++pos_;
+      return true;
+    }
+    return false;
+  }
+
+  void expect(char c) {
+    if (!accept(c)) {
+      error_(std::string("expected '") + c + "'");
+    }
+  }
+
+  /// Throws unless only whitespace remains
+  void expect_end() {
+    skip_whitespace_();
+    if (pos_ != text_.size()) {
+      error_("unexpected trailing characters");
+    }
+  }
+
+  std::string read_string() {
+    expect('"');
+    std::string str;
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      char c = text_[pos_++];
+      if (c == '\\') {
+        if (pos_ >= text_.size()) {
+          break;
+        }
+        c = text_[pos_++];
+        switch (c) {
+          case 'n': c = '\n'; break;
+          case 't': c = '\t'; break;
+          case 'r': c = '\r'; break;
+          case 'b': c = '\b'; break;
+          case 'f': c = '\f'; break;
+          case 'u': error_("unicode escapes are not supported"); break;
+          default: break;
+        }
+      }
+      str.push_back(c);
+    }
+    expect('"');
+    return str;
+  }
+
+  double read_number() {
+    skip_whitespace_();
+    size_t end = pos_;
+    while (end < text_.size() && (std::isdigit((unsigned char)text_[end]) ||
+      text_[end] == '-' || text_[end] == '+' || text_[end] == '.' || text_[end] == 'e' || text_[end] == 'E')) {
+      ++end;
+    }
+    if (end == pos_) {
+      error_("expected a number");
+    }
+    std::istringstream ss(text_.substr(pos_, end - pos_));
+    double value = 0;
+    if (!(ss >> value) || !ss.eof()) {
+      error_("invalid number");
+    }
+    pos_ = end;
+    return value;
+  }
+
+  /// Reads the members of an object, invoking 'member' with each key
+  template <typename Member>
+  void read_object(Member member) {
+    expect('{');
+    if (accept('}')) {
+      return;
+    }
+    do {
+      std::string key = read_string();
+      expect(':');
+      member(key);
+    } while (accept(','));
+    expect('}');
+  }
+
+  /// Skips a value of any type
+  void skip_value() {
+    skip_whitespace_();
+    if (pos_ >= text_.size()) {
+      error_("unexpected end of input");
+    }
+    char c = text_[pos_];
+    if (c == '"') {
+      read_string();
+    }
+    else if (c == '{') {
+      read_object([this](std::string const &) { skip_value(); });
+    }
+    else if (c == '[') {
+      expect('[');
+      if (!accept(']')) {
+        do {
+          skip_value();
+        } while (accept(','));
+        expect(']');
+      }
+    }
+    else if (std::isalpha((unsigned char)c)) {
+      while (pos_ < text_.size() && std::isalpha((unsigned char)text_[pos_])) {
+        ++pos_;
+      }
+    }
+    else {
+      read_number();
+    }
+  }
+
+private:
+
+  std::string text_;
+  size_t pos_;
+
+  void skip_whitespace_() {
+    while (pos_ < text_.size() && std::isspace((unsigned char)text_[pos_])) {
+      ++pos_;
+    }
+  }
+
+  [[noreturn]] void error_(std::string const &message) const {
+    throw std::runtime_error("Device spec: " + message + " at offset " + std::to_string(pos_));
+  }
+};
+
+} // namespace
+
+DeviceSpec parse_device_spec(std::istream &in) {
+
+  JsonReader reader(in);
+  DeviceSpec spec;
+
+  reader.read_object([&](std::string const &key) {
+    if (key == "name") {
+      spec.name = reader.read_string();
+    }
+    else if (key == "compute_capability") {
+      spec.compute_capability = int(reader.read_number());
+    }
+    else if (key == "memory_bandwidth") {
+      spec.memory_bandwidth = reader.read_number();
+    }
+    else if (key == "peak_math") {
+      reader.read_object([&](std::string const &math) {
+        RooflineMathClass math_class = from_string<RooflineMathClass>(math);
+        if (math_class == RooflineMathClass::kInvalid) {
+          throw std::runtime_error("Device spec: unknown math class '" + math + "'");
+        }
+        spec.peak_math[math_class] = reader.read_number();
+      });
+    }
+    else {
+      reader.skip_value();
+    }
+  });
+
+  reader.expect_end();
+
+  if (!spec.good()) {
+    throw std::runtime_error("Device spec: 'memory_bandwidth' must be positive");
+  }
+
+  return spec;
+}
+
+DeviceSpec load_device_spec(std::string const &path) {
+
+  std::ifstream file(path);
+  if (!file.is_open()) {
+    throw std::runtime_error("Could not open device spec '" + path + "'");
+  }
+
+  return parse_device_spec(file);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Classifies the math performed on operands of the given type by tensor cores
+RooflineMathClass tensor_op_math_class_(
+  library::MathOperationID math_operation,
+  library::NumericTypeID element) {
+
+  switch (element) {
+    case library::NumericTypeID::kF64:
+    case library::NumericTypeID::kCF64:
+      return RooflineMathClass::kF64;
+
+    case library::NumericTypeID::kF32:
+    case library::NumericTypeID::kCF32:
+      // F32 operands are rounded to F16 or BF16 by the fast math operations
+      if (math_operation == library::MathOperationID::kMultiplyAddFastF16 ||
+          math_operation == library::MathOperationID::kMultiplyAddFastBF16) {
+        return RooflineMathClass::kF16;
+      }
+      return RooflineMathClass::kTF32;
+
+    case library::NumericTypeID::kTF32:
+    case library::NumericTypeID::kCTF32:
+      return RooflineMathClass::kTF32;
+
+    case library::NumericTypeID::kF16:
+    case library::NumericTypeID::kBF16:
+    case library::NumericTypeID::kCF16:
+    case library::NumericTypeID::kCBF16:
+      return RooflineMathClass::kF16;
+
+    case library::NumericTypeID::kFE4M3:
+    case library::NumericTypeID::kFE5M2:
+    case library::NumericTypeID::kFE2M3:
+    case library::NumericTypeID::kFE3M2:
+    case library::NumericTypeID::kF8:
+    case library::NumericTypeID::kF6:
+      return RooflineMathClass::kF8;
+
+    case library::NumericTypeID::kFE2M1:
+    case library::NumericTypeID::kF4:
+      return RooflineMathClass::kF4;
+
+    case library::NumericTypeID::kS4:
+    case library::NumericTypeID::kU4:
+      return RooflineMathClass::kS4;
+
+    case library::NumericTypeID::kS8:
+    case library::NumericTypeID::kU8:
+    case library::NumericTypeID::kS2:
+    case library::NumericTypeID::kU2:
+      return RooflineMathClass::kS8;
+
+    default:
+      break;
+  }
+
+  return RooflineMathClass::kInvalid;
+}
+
+/// Orders math classes by increasing throughput
+int math_class_rank_(RooflineMathClass math_class) {
+  switch (math_class) {
+    case RooflineMathClass::kF64: return 0;
+    case RooflineMathClass::kF32: return 1;
+    case RooflineMathClass::kTF32: return 2;
+    case RooflineMathClass::kF16: return 3;
+    case RooflineMathClass::kF8: return 4;
+    case RooflineMathClass::kS8: return 5;
+    case RooflineMathClass::kS4: return 6;
+    case RooflineMathClass::kF4: return 7;
+    default: break;
+  }
+  return 8;
+}
+
+} // namespace
+
+RooflineMathClass roofline_math_class(
+  library::OpcodeClassID opcode_class,
+  library::MathOperationID math_operation,
+  library::NumericTypeID element_A,
+  library::NumericTypeID element_B) {
+
+  switch (opcode_class) {
+    case library::OpcodeClassID::kSimt:
+      return (element_A == library::NumericTypeID::kF64 || element_A == library::NumericTypeID::kCF64)
+        ? RooflineMathClass::kF64 : RooflineMathClass::kF32;
+
+    case library::OpcodeClassID::kTensorOp:
+    case library::OpcodeClassID::kWmmaTensorOp:
+    case library::OpcodeClassID::kSparseTensorOp:
+    case library::OpcodeClassID::kBlockScaledOp: {
+
+      RooflineMathClass class_A = tensor_op_math_class_(math_operation, element_A);
+      RooflineMathClass class_B = tensor_op_math_class_(math_operation, element_B);
+
+      if (class_A == RooflineMathClass::kInvalid || class_B == RooflineMathClass::kInvalid) {
+        return RooflineMathClass::kInvalid;
+      }
+
+      return math_class_rank_(class_A) < math_class_rank_(class_B) ? class_A : class_B;
+    }
+
+    default:
+      break;
+  }
+
+  return RooflineMathClass::kInvalid;
+}
+
+RooflineMathClass roofline_math_class(library::OperationDescription const &desc) {
+
+  library::MathInstructionDescription const &math = desc.tile_description.math_instruction;
+
+  auto classify = [&math](library::TensorDescription const &A, library::TensorDescription const &B) {
+    return roofline_math_class(math.opcode_class, math.math_operation, A.element, B.element);
+  };
+
+  switch (desc.kind) {
+    case library::OperationKind::kGemm:
+    case library::OperationKind::kEqGemm:
+    case library::OperationKind::kSparseGemm: {
+      auto const &gemm_desc = static_cast<library::GemmDescription const &>(desc);
+      return classify(gemm_desc.A, gemm_desc.B);
+    }
+    case library::OperationKind::kBlockScaledGemm: {
+      auto const &gemm_desc = static_cast<library::BlockScaledGemmDescription const &>(desc);
+      return classify(gemm_desc.A, gemm_desc.B);
+    }
+    case library::OperationKind::kBlockwiseGemm: {
+      auto const &gemm_desc = static_cast<library::BlockwiseGemmDescription const &>(desc);
+      return classify(gemm_desc.A, gemm_desc.B);
+    }
+    case library::OperationKind::kGroupedGemm: {
+      auto const &gemm_desc = static_cast<library::GroupedGemmDescription const &>(desc);
+      return classify(gemm_desc.gemm.A, gemm_desc.gemm.B);
+    }
+    case library::OperationKind::kRankK:
+    case library::OperationKind::kRank2K: {
+      auto const &rank_k_desc = static_cast<library::RankKDescription const &>(desc);
+      return classify(rank_k_desc.A, rank_k_desc.A);
+    }
+    case library::OperationKind::kTrmm: {
+      auto const &trmm_desc = static_cast<library::TrmmDescription const &>(desc);
+      return classify(trmm_desc.A, trmm_desc.B);
+    }
+    case library::OperationKind::kSymm: {
+      auto const &symm_desc = static_cast<library::SymmDescription const &>(desc);
+      return classify(symm_desc.A, symm_desc.B);
+    }
+    case library::OperationKind::kConv2d:
+    case library::OperationKind::kConv3d: {
+      auto const &conv_desc = static_cast<library::ConvDescription const &>(desc);
+      return classify(conv_desc.A, conv_desc.B);
+    }
+    default:
+      break;
+  }
+
+  return RooflineMathClass::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+RooflineMetrics compute_roofline(
+  DeviceSpec const &spec,
+  RooflineMathClass math_class,
+  int64_t flops,
+  int64_t bytes,
+  double runtime) {
+
+  RooflineMetrics metrics;
+  metrics.math_class = math_class;
+
+  if (bytes > 0) {
+    metrics.arithmetic_intensity = double(flops) / double(bytes);
+  }
+
+  double peak_gflops = spec.peak(math_class);
+
+  if (!spec.good() || runtime <= 0 || bytes <= 0 || (flops > 0 && peak_gflops <= 0)) {
+    return metrics;
+  }
+
+  // Minimum runtimes in ms permitted by memory bandwidth and by math throughput
+  double memory_time = double(bytes) / spec.memory_bandwidth / 1.0e6;
+  double math_time = flops > 0 ? double(flops) / peak_gflops / 1.0e6 : 0;
+
+  double bound_time = std::max(memory_time, math_time);
+
+  metrics.memory_bound = memory_time >= math_time;
+  metrics.bound_gflops = double(flops) / bound_time / 1.0e6;
+  metrics.percent_of_bound = bound_time / runtime * 100.0;
+
+  return metrics;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+RooflineSummary::RooflineSummary(double threshold):
+  threshold_(threshold),
+  memory_bound_count_(0),
+  compute_bound_count_(0),
+  memory_bound_percent_(0),
+  compute_bound_percent_(0) { }
+
+void RooflineSummary::add(
+  size_t problem_index,
+  std::string const &operation_name,
+  RooflineMetrics const &metrics) {
+
+  if (!metrics.good()) {
+    return;
+  }
+
+  if (metrics.memory_bound) {
+    ++memory_bound_count_;
+    memory_bound_percent_ += metrics.percent_of_bound;
+  }
+  else {
+    ++compute_bound_count_;
+    compute_bound_percent_ += metrics.percent_of_bound;
+  }
+
+  if (metrics.percent_of_bound < threshold_) {
+    flagged_.push_back(Entry{problem_index, operation_name, metrics});
+  }
+}
+
+std::ostream &RooflineSummary::print(std::ostream &out) const {
+
+  auto mean = [](double sum, size_t count) {
+    return count ? sum / double(count) : 0.0;
+  };
+
+  out << "Roofline Summary:\n\n"
+    << "   Memory-bound: " << memory_bound_count_ << " results, "
+    << std::fixed << std::setprecision(1) << mean(memory_bound_percent_, memory_bound_count_)
+    << "% of roofline on average\n"
+    << "  Compute-bound: " << compute_bound_count_ << " results, "
+    << mean(compute_bound_percent_, compute_bound_count_) << "% of roofline on average\n\n";
+
+  out << "  " << flagged_.size() << " results below " << threshold_ << "% of roofline";
+
+  if (!flagged_.empty()) {
+    out << ":\n\n";
+    for (auto const &entry : flagged_) {
+      out << "    Problem " << entry.problem_index << "  "
+        << std::setw(5) << entry.metrics.percent_of_bound << "%  "
+        << (entry.metrics.memory_bound ? "memory " : "compute") << "  "
+        << std::setw(4) << to_string(entry.metrics.math_class) << "  "
+        << entry.operation_name << "\n";
+    }
+  }
+  else {
+    out << "\n";
+  }
+
+  out << std::defaultfloat << std::setprecision(6);
+
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,281 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Journal recording the progress of a profiling sweep so that it may be resumed.
+*/
+
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "cutlass/profiler/sweep_journal.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+  char const *kJournalMagic = "cutlass_profiler_journal";
+
+  /// Splits a record into tab-separated fields
+  std::vector<std::string> split_record(std::string const &line) {
+    std::vector<std::string> fields;
+    std::string field;
+    std::istringstream ss(line);
+    while (std::getline(ss, field, '\t')) {
+      fields.push_back(field);
+    }
+    return fields;
+  }
+
+  /// Parses a problem index field
+  bool parse_index(std::string const &str, size_t &index) {
+    if (str.empty() || !std::all_of(str.begin(), str.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+      return false;
+    }
+    index = static_cast<size_t>(std::stoull(str));
+    return true;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+SweepJournal::SweepJournal(
+  std::string const &path,
+  std::string const &fingerprint,
+  bool resume
+):
+  path_(path), fingerprint_(fingerprint), recovered_records_(0), good_(true) {
+
+  bool write_header = true;
+
+  if (resume) {
+
+    std::ifstream input(path_, std::ios::binary);
+
+    if (input.is_open()) {
+
+      std::string contents(
+        (std::istreambuf_iterator<char>(input)),
+        std::istreambuf_iterator<char>());
+
+      input.close();
+
+      // Discard a torn trailing record left by an interrupted write
+      size_t valid_size = contents.rfind('\n');
+      valid_size = (valid_size == std::string::npos ? 0 : valid_size + 1);
+
+      if (valid_size != contents.size()) {
+        contents.resize(valid_size);
+
+        std::error_code ec;
+        std::filesystem::resize_file(path_, valid_size, ec);
+        if (ec) {
+          std::cerr << "Could not truncate journal at path '" << path_ << "': " << ec.message() << std::endl;
+          good_ = false;
+          return;
+        }
+      }
+
+      if (!contents.empty()) {
+        std::istringstream ss(contents);
+        if (!load_(ss)) {
+          good_ = false;
+          return;
+        }
+        write_header = false;
+      }
+    }
+
+    output_.open(path_, std::ios::app);
+  }
+  else {
+    output_.open(path_, std::ios::trunc);
+  }
+
+  if (!output_.good()) {
+    std::cerr << "Could not open journal at path '" << path_ << "'" << std::endl;
+    good_ = false;
+    return;
+  }
+
+  if (write_header) {
+    std::ostringstream ss;
+    ss << kJournalMagic << "\t" << kVersion << "\t" << fingerprint_;
+    write_record_(ss.str());
+  }
+}
+
+SweepJournal::~SweepJournal() {
+  if (output_.is_open()) {
+    output_.close();
+  }
+}
+
+bool SweepJournal::load_(std::istream &in) {
+
+  std::string line;
+  size_t line_number = 0;
+
+  while (std::getline(in, line)) {
+    ++line_number;
+
+    if (line.empty()) {
+      continue;
+    }
+
+    std::vector<std::string> fields = split_record(line);
+
+    if (line_number == 1) {
+      if (fields.size() != 3 || fields[0] != kJournalMagic) {
+        std::cerr << "Journal at path '" << path_ << "' is not a cutlass_profiler journal." << std::endl;
+        return false;
+      }
+      if (fields[1] != std::to_string(kVersion)) {
+        std::cerr << "Journal at path '" << path_ << "' has unsupported version " << fields[1] << "." << std::endl;
+        return false;
+      }
+      if (fields[2] != fingerprint_) {
+        std::cerr << "Journal at path '" << path_ << "' was produced with different profiler arguments." << std::endl;
+        return false;
+      }
+      continue;
+    }
+
+    size_t problem_index = 0;
+
+    if (fields.size() < 3 || !parse_index(fields[2], problem_index)) {
+      std::cerr << "Malformed record at line " << line_number << " of journal '" << path_ << "'." << std::endl;
+      return false;
+    }
+
+    auto key = std::make_pair(fields[1], problem_index);
+
+    if (fields[0] == "done" && fields.size() == 4) {
+      completed_operations_[key].insert(fields[3]);
+    }
+    else if (fields[0] == "complete" && fields.size() == 3) {
+      completed_problems_.insert(key);
+    }
+    else {
+      std::cerr << "Malformed record at line " << line_number << " of journal '" << path_ << "'." << std::endl;
+      return false;
+    }
+
+    ++recovered_records_;
+  }
+
+  return true;
+}
+
+void SweepJournal::write_record_(std::string const &record) {
+  if (!output_.is_open()) {
+    return;
+  }
+  output_ << record << "\n";
+  output_.flush();
+}
+
+bool SweepJournal::problem_completed(std::string const &operation_kind, size_t problem_index) const {
+  return completed_problems_.count(std::make_pair(operation_kind, problem_index)) != 0;
+}
+
+bool SweepJournal::operation_completed(
+  std::string const &operation_kind,
+  size_t problem_index,
+  std::string const &operation_name) const {
+
+  auto it = completed_operations_.find(std::make_pair(operation_kind, problem_index));
+  if (it == completed_operations_.end()) {
+    return false;
+  }
+  return it->second.count(operation_name) != 0;
+}
+
+void SweepJournal::operation_done(
+  std::string const &operation_kind,
+  size_t problem_index,
+  std::string const &operation_name) {
+
+  completed_operations_[std::make_pair(operation_kind, problem_index)].insert(operation_name);
+
+  std::ostringstream ss;
+  ss << "done\t" << operation_kind << "\t" << problem_index << "\t" << operation_name;
+  write_record_(ss.str());
+}
+
+void SweepJournal::problem_done(std::string const &operation_kind, size_t problem_index) {
+  completed_problems_.insert(std::make_pair(operation_kind, problem_index));
+
+  std::ostringstream ss;
+  ss << "complete\t" << operation_kind << "\t" << problem_index;
+  write_record_(ss.str());
+}
+
+std::string SweepJournal::compute_fingerprint(
+  std::string const &prefix,
+  std::vector<std::pair<std::string, std::string>> key_values) {
+
+  std::sort(key_values.begin(), key_values.end());
+
+  // 64-bit FNV-1a
+  uint64_t hash = 0xcbf29ce484222325ull;
+  auto update = [&hash](std::string const &str) {
+    for (unsigned char c : str) {
+      hash ^= c;
+      hash *= 0x100000001b3ull;
+    }
+    // Separator so that ("ab", "c") and ("a", "bc") hash differently
+    hash ^= 0xff;
+    hash *= 0x100000001b3ull;
+  };
+
+  update(prefix);
+  for (auto const &kv : key_values) {
+    update(kv.first);
+    update(kv.second);
+  }
+
+  std::ostringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
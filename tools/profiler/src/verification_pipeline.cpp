@@ -0,0 +1,246 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Pipeline overlapping host-side verification with profiling of subsequent kernels.
+*/
+
+#include <chrono>
+#include <exception>
+#include <utility>
+
+#include "cutlass/profiler/verification_pipeline.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+VerificationPipeline::VerificationPipeline(int thread_count, size_t max_bytes_in_flight):
+  max_bytes_in_flight_(max_bytes_in_flight), bytes_in_flight_(0), stop_(false) {
+
+  for (int i = 0; i < thread_count; ++i) {
+    workers_.emplace_back([this] { worker_(); });
+  }
+}
+
+VerificationPipeline::~VerificationPipeline() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  job_available_.notify_all();
+
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+size_t VerificationPipeline::bytes_in_flight() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_in_flight_;
+}
+
+void VerificationPipeline::worker_() {
+
+  for (;;) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      job_available_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+
+      // Remaining jobs are drained before exiting
+      if (jobs_.empty()) {
+        return;
+      }
+
+      job = std::move(jobs_.front());
+      jobs_.pop_front();
+    }
+
+    run_(job);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_in_flight_ -= job.bytes;
+    }
+    job_finished_.notify_all();
+  }
+}
+
+void VerificationPipeline::run_(Job &job) {
+
+  try {
+    job.disposition.set_value(job.task());
+  }
+  catch (...) {
+    job.disposition.set_exception(std::current_exception());
+  }
+
+  // Destroy the task, and with it the snapshot, before its reservation is released
+  job.task = nullptr;
+}
+
+void VerificationPipeline::enqueue(
+  library::Provider provider,
+  size_t bytes,
+  Snapshot const &snapshot) {
+
+  {
+    // A snapshot larger than the budget is admitted once nothing else is in flight
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_finished_.wait(lock, [this, bytes] {
+      return bytes_in_flight_ == 0 || bytes_in_flight_ + bytes <= max_bytes_in_flight_;
+    });
+    bytes_in_flight_ += bytes;
+  }
+
+  Job job;
+  job.bytes = bytes;
+
+  try {
+    job.task = snapshot();
+  }
+  catch (...) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_in_flight_ -= bytes;
+    }
+    job_finished_.notify_all();
+    throw;
+  }
+
+  staged_.push_back(Check{provider, job.disposition.get_future()});
+
+  if (workers_.empty()) {
+    run_(job);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_in_flight_ -= bytes;
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push_back(std::move(job));
+  }
+  job_available_.notify_one();
+}
+
+void VerificationPipeline::append_results(PerformanceResultVector const &results, Sink sink) {
+
+  Entry entry{results, std::move(staged_), std::move(sink)};
+  staged_.clear();
+
+  pending_.push_back(std::move(entry));
+
+  flush(false);
+}
+
+void VerificationPipeline::flush(bool wait) {
+
+  while (!pending_.empty()) {
+
+    if (!wait) {
+      for (auto &check : pending_.front().checks) {
+        if (check.disposition.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+          return;
+        }
+      }
+    }
+
+    deliver_front_();
+  }
+
+  if (wait) {
+    // Workers release reservations after fulfilling their promises
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_finished_.wait(lock, [this] { return bytes_in_flight_ == 0; });
+  }
+}
+
+void VerificationPipeline::deliver_front_() {
+
+  Entry entry = std::move(pending_.front());
+  pending_.pop_front();
+
+  for (auto &check : entry.checks) {
+
+    Disposition disposition;
+
+    try {
+      disposition = check.disposition.get();
+    }
+    catch (...) {
+      disposition = Disposition::kFailed;
+    }
+
+    for (auto &result : entry.results) {
+      if (result.provider == library::Provider::kCUTLASS) {
+        merge_disposition(result, check.provider, disposition);
+      }
+    }
+  }
+
+  if (entry.sink) {
+    entry.sink(entry.results);
+  }
+}
+
+void VerificationPipeline::merge_disposition(
+  PerformanceResult &result,
+  library::Provider provider,
+  Disposition disposition) {
+
+  result.verification_map[provider] = disposition;
+
+  bool is_any_verification_run_passed = false;
+
+  for (auto const &m : result.verification_map) {
+    if (m.second == Disposition::kFailed || m.second == Disposition::kIncorrect) {
+      result.disposition = m.second;
+      return;
+    }
+    if (m.second == Disposition::kPassed) {
+      is_any_verification_run_passed = true;
+    }
+  }
+
+  if (is_any_verification_run_passed) {
+    result.disposition = Disposition::kPassed;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,452 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Command line front end for cutlass::DistGemmScheduleSimulator.
+
+    Validates the built-in 1-D, 2-D and hierarchical Distributed GEMM schedules for a problem shape
+    and tensor parallelism, and reports the bytes each device receives and how much communication
+    is hidden behind compute, without requiring a GPU. Lists of values may be given for the problem
+    extents, schedules and TP sizes, in which case every combination is simulated and one CSV row is
+    written per configuration.
+*/
+
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/dist_gemm_schedule_simulator.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static std::vector<std::string> const kSchedules{
+  "AllGather1D_TilingCD_RotatingA",
+  "AllGather1D_TilingCD_RotatingB",
+  "ReduceScatter1D_TilingA_RotatingC",
+  "ReduceScatter1D_TilingB_RotatingC",
+  "SUMMA2D_TilingCD_RotatingAB",
+  "AllGatherReduceScatter2D_TilingB_RotatingAC",
+  "AllGatherHierarchical_TilingCD_RotatingA",
+  "AllGatherHierarchical_TilingCD_RotatingB"
+};
+
+static std::vector<int> const kTensorParallelism{2, 4, 8, 16};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Command line options
+struct Options {
+
+  bool help = false;
+  bool error = false;
+
+  std::vector<int> m{16384};
+  std::vector<int> n{16384};
+  std::vector<int> k{16384};
+  std::vector<int> l{1};
+
+  std::vector<std::string> schedules = kSchedules;
+  std::vector<int> tp{8};
+
+  int element_bits = 16;
+  double tflops = 800.0;
+  double bandwidth = 400.0;
+  int domain_size = 0;
+  double inter_domain_bandwidth = 50.0;
+
+  bool steps = false;
+  bool csv = false;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_arguments("m", m);
+    cmd.get_cmd_line_arguments("n", n);
+    cmd.get_cmd_line_arguments("k", k);
+    cmd.get_cmd_line_arguments("l", l);
+    cmd.get_cmd_line_arguments("tp", tp);
+    cmd.get_cmd_line_argument("element-bits", element_bits);
+    cmd.get_cmd_line_argument("tflops", tflops);
+    cmd.get_cmd_line_argument("bandwidth", bandwidth);
+    cmd.get_cmd_line_argument("domain-size", domain_size);
+    cmd.get_cmd_line_argument("inter-domain-bandwidth", inter_domain_bandwidth);
+    cmd.get_cmd_line_argument("steps", steps, false);
+    cmd.get_cmd_line_argument("csv", csv, false);
+
+    std::vector<std::string> names;
+    cmd.get_cmd_line_arguments("schedule", names);
+    if (!names.empty()) {
+      schedules = names;
+    }
+
+    for (std::string const &name : schedules) {
+      if (std::find(kSchedules.begin(), kSchedules.end(), name) == kSchedules.end()) {
+        std::cerr << "Invalid --schedule: " << name << "\n";
+        error = true;
+      }
+    }
+    for (int value : tp) {
+      if (std::find(kTensorParallelism.begin(), kTensorParallelism.end(), value) == kTensorParallelism.end()) {
+        std::cerr << "Invalid --tp: " << value << "\n";
+        error = true;
+      }
+    }
+    if (element_bits <= 0 || tflops <= 0 || bandwidth <= 0 || domain_size < 0 || inter_domain_bandwidth <= 0) {
+      std::cerr << "Expected a positive --element-bits, --tflops, --bandwidth and --inter-domain-bandwidth\n";
+      error = true;
+    }
+  }
+
+  /// Number of configurations described by the options
+  size_t configurations() const {
+    return m.size() * n.size() * k.size() * l.size() * schedules.size() * tp.size();
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "cutlass_dist_gemm_schedule_simulator\n\n"
+      << "  Validates Distributed GEMM schedules and models their communication on the host.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>[,<int>...]        M extent(s) of the global GEMM\n"
+      << "  --n=<int>[,<int>...]        N extent(s) of the global GEMM\n"
+      << "  --k=<int>[,<int>...]        K extent(s) of the global GEMM\n"
+      << "  --l=<int>[,<int>...]        Batch count(s)\n\n"
+      << "  --schedule=<str>[,...]      Schedule(s) to simulate (default: all of)\n";
+
+    for (std::string const &name : kSchedules) {
+      out << "                                " << name << "\n";
+    }
+
+    out
+      << "  --tp=<int>[,<int>...]       Tensor parallelism: 2, 4, 8 or 16 (default: 8). SUMMA\n"
+      << "                              requires a square TP (4 or 16), AllGatherReduceScatter2D\n"
+      << "                              uses the squarest grid of G x R devices with G >= R > 1, and\n"
+      << "                              hierarchical schedules use two domains of TP / 2 devices.\n\n"
+      << "  --element-bits=<int>        Bits per element of A, B, C and D (default: 16)\n"
+      << "  --tflops=<double>           Math throughput of one device in TFLOP/s (default: 800)\n"
+      << "  --bandwidth=<double>        Peer bandwidth of one device in GB/s (default: 400)\n"
+      << "  --domain-size=<int>         Devices per NVLink domain, 0 if all devices share one (default)\n"
+      << "  --inter-domain-bandwidth=<double>\n"
+      << "                              Bandwidth to peers in other domains in GB/s (default: 50)\n\n"
+      << "  --steps=<bool>              Lists the GEMM run by each device in each iteration\n"
+      << "  --csv=<bool>                Writes one CSV row per configuration. Implied when more\n"
+      << "                              than one configuration is given.\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ cutlass_dist_gemm_schedule_simulator --m=16384 --n=106496 --k=16384 "
+      << "--schedule=AllGather1D_TilingCD_RotatingA --steps=true\n\n"
+      << "$ cutlass_dist_gemm_schedule_simulator --tp=16 --domain-size=8 "
+      << "--schedule=AllGather1D_TilingCD_RotatingA,AllGatherHierarchical_TilingCD_RotatingA,SUMMA2D_TilingCD_RotatingAB\n\n"
+      << "$ cutlass_dist_gemm_schedule_simulator --m=8192,16384 --n=8192 --k=8192 --tp=2,4,8,16\n\n";
+
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Configuration-independent view of a simulation
+struct Report {
+  std::string schedule;
+  int tp = 0;
+  cutlass::gemm::BatchedGemmCoord problem_size;
+  cutlass::gemm::BatchedGemmCoord tiles;
+
+  bool supported = true;           ///< whether the schedule can be instantiated for TP
+  bool can_implement = false;
+  bool valid = false;
+  int error_count = 0;
+  std::vector<std::string> errors;
+
+  uint64_t total_bytes = 0;
+  uint64_t inter_domain_bytes = 0;
+  double end_us = 0;
+  double compute_us = 0;           ///< of the slowest device
+  double exposed_us = 0;           ///< of the slowest device
+  double overlap = 1.0;            ///< of the least overlapped device
+
+  std::vector<std::string> steps;
+};
+
+template <class Schedule>
+static Report simulate(std::string const &name, Options const &options, cutlass::gemm::BatchedGemmCoord problem_size) {
+  using Simulator = cutlass::DistGemmScheduleSimulator<Schedule>;
+
+  typename Simulator::Arguments args;
+  args.problem_size = problem_size;
+  args.element_bits_a = args.element_bits_b = args.element_bits_c = args.element_bits_d = options.element_bits;
+  args.device_tflops = options.tflops;
+  args.peer_bandwidth_gbps = options.bandwidth;
+  args.domain_size = options.domain_size;
+  args.inter_domain_bandwidth_gbps = options.inter_domain_bandwidth;
+
+  typename Simulator::Result result = Simulator::run(args);
+
+  Report report;
+  report.schedule = name;
+  report.tp = Simulator::TP;
+  report.problem_size = problem_size;
+  report.tiles = result.tiles;
+  report.can_implement = result.can_implement;
+  report.valid = result.valid();
+  report.error_count = result.error_count;
+  report.errors = result.errors;
+  report.total_bytes = result.total_bytes();
+  report.inter_domain_bytes = result.inter_domain_bytes();
+  report.end_us = result.end_us();
+
+  for (auto const &device : result.devices) {
+    if (device.end_us >= report.end_us) {
+      report.compute_us = device.compute_us;
+      report.exposed_us = device.exposed_communication_us();
+    }
+    report.overlap = std::min(report.overlap, device.overlap());
+  }
+
+  if (options.steps) {
+    for (auto const &step : result.steps) {
+      std::ostringstream out;
+      out << std::fixed << std::setprecision(1)
+          << "  iteration " << step.iteration << "  device " << step.device << "  peer " << step.peer
+          << "  tile (" << step.m << ", " << step.n << ", " << step.k << ", " << step.l << ")"
+          << "  copied " << step.bytes_copied << " B";
+      if (step.peer_a >= 0) {
+        out << " A from " << step.peer_a;
+      }
+      if (step.peer_b >= 0) {
+        out << " B from " << step.peer_b;
+      }
+      if (step.copy_source_iteration > 0) {
+        out << " (received in iteration " << step.copy_source_iteration << ")";
+      }
+      out << "  peer reads " << step.bytes_peer_read << " B"
+          << "  [" << step.start_us << ", " << step.end_us << ") us";
+      report.steps.push_back(out.str());
+    }
+  }
+
+  return report;
+}
+
+template <template <class> class Schedule>
+static Report simulate(std::string const &name, int tp, Options const &options, cutlass::gemm::BatchedGemmCoord problem_size) {
+  switch (tp) {
+    case 2: return simulate<Schedule<cute::_2>>(name, options, problem_size);
+    case 4: return simulate<Schedule<cute::_4>>(name, options, problem_size);
+    case 8: return simulate<Schedule<cute::_8>>(name, options, problem_size);
+    default: return simulate<Schedule<cute::_16>>(name, options, problem_size);
+  }
+}
+
+/// Report for a TP the schedule can't be instantiated with
+static Report unsupported(std::string const &name, int tp, cutlass::gemm::BatchedGemmCoord problem_size, std::string const &reason) {
+  Report report;
+  report.schedule = name;
+  report.tp = tp;
+  report.problem_size = problem_size;
+  report.supported = false;
+  report.error_count = 1;
+  report.errors.push_back(reason);
+  return report;
+}
+
+template <template <class> class Schedule>
+static Report simulate_square(std::string const &name, int tp, Options const &options, cutlass::gemm::BatchedGemmCoord problem_size) {
+  switch (tp) {
+    case 4: return simulate<Schedule<cute::_2>>(name, options, problem_size);
+    case 16: return simulate<Schedule<cute::_4>>(name, options, problem_size);
+    default: return unsupported(name, tp, problem_size, "TP must be a square (4 or 16)");
+  }
+}
+
+template <template <class, class> class Schedule>
+static Report simulate_2d(std::string const &name, int tp, Options const &options, cutlass::gemm::BatchedGemmCoord problem_size) {
+  switch (tp) {
+    case 4: return simulate<Schedule<cute::_2, cute::_2>>(name, options, problem_size);
+    case 8: return simulate<Schedule<cute::_4, cute::_2>>(name, options, problem_size);
+    case 16: return simulate<Schedule<cute::_4, cute::_4>>(name, options, problem_size);
+    default: return unsupported(name, tp, problem_size, "TP must have a G x R grid with G, R > 1 (4, 8 or 16)");
+  }
+}
+
+template <template <class, class> class Schedule>
+static Report simulate_hierarchical(std::string const &name, int tp, Options const &options, cutlass::gemm::BatchedGemmCoord problem_size) {
+  switch (tp) {
+    case 2: return simulate<Schedule<cute::_1, cute::_2>>(name, options, problem_size);
+    case 4: return simulate<Schedule<cute::_2, cute::_2>>(name, options, problem_size);
+    case 8: return simulate<Schedule<cute::_4, cute::_2>>(name, options, problem_size);
+    default: return simulate<Schedule<cute::_8, cute::_2>>(name, options, problem_size);
+  }
+}
+
+static Report simulate(std::string const &name, int tp, Options const &options, cutlass::gemm::BatchedGemmCoord problem_size) {
+  using namespace cutlass::distributed::schedules;
+
+  if (name == "AllGather1D_TilingCD_RotatingA") {
+    return simulate<AllGather1D_TilingCD_RotatingA>(name, tp, options, problem_size);
+  }
+  if (name == "AllGather1D_TilingCD_RotatingB") {
+    return simulate<AllGather1D_TilingCD_RotatingB>(name, tp, options, problem_size);
+  }
+  if (name == "ReduceScatter1D_TilingA_RotatingC") {
+    return simulate<ReduceScatter1D_TilingA_RotatingC>(name, tp, options, problem_size);
+  }
+  if (name == "ReduceScatter1D_TilingB_RotatingC") {
+    return simulate<ReduceScatter1D_TilingB_RotatingC>(name, tp, options, problem_size);
+  }
+  if (name == "SUMMA2D_TilingCD_RotatingAB") {
+    return simulate_square<SUMMA2D_TilingCD_RotatingAB>(name, tp, options, problem_size);
+  }
+  if (name == "AllGatherReduceScatter2D_TilingB_RotatingAC") {
+    return simulate_2d<AllGatherReduceScatter2D_TilingB_RotatingAC>(name, tp, options, problem_size);
+  }
+  if (name == "AllGatherHierarchical_TilingCD_RotatingA") {
+    return simulate_hierarchical<AllGatherHierarchical_TilingCD_RotatingA>(name, tp, options, problem_size);
+  }
+  return simulate_hierarchical<AllGatherHierarchical_TilingCD_RotatingB>(name, tp, options, problem_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void print_csv_header(std::ostream &out) {
+  out << "Schedule,TP,M,N,K,L,CanImplement,Valid,Errors,TotalBytes,InterDomainBytes,EndUs,ComputeUs,ExposedUs,MinOverlap\n";
+}
+
+static void print_csv_row(std::ostream &out, Report const &report) {
+  out << report.schedule << "," << report.tp << ","
+      << report.problem_size.m() << "," << report.problem_size.n() << ","
+      << report.problem_size.k() << "," << report.problem_size.batch() << ","
+      << report.can_implement << "," << report.valid << "," << report.error_count << ","
+      << report.total_bytes << "," << report.inter_domain_bytes << "," << report.end_us << "," << report.compute_us << ","
+      << report.exposed_us << "," << report.overlap << "\n";
+}
+
+static void print_summary(std::ostream &out, Report const &report) {
+  out
+    << "          Schedule: " << report.schedule << " (TP = " << report.tp << ")\n"
+    << "           Problem: " << report.problem_size.m() << "x" << report.problem_size.n() << "x"
+                              << report.problem_size.k() << "x" << report.problem_size.batch() << "\n"
+    << "             Tiles: " << report.tiles.m() << "x" << report.tiles.n() << "x"
+                              << report.tiles.k() << "x" << report.tiles.batch() << "\n"
+    << "     Can implement: " << (report.can_implement ? "yes" : "no") << "\n"
+    << "          Coverage: " << (report.error_count == 0 ? "ok" : "FAILED") << "\n"
+    << "      Peer traffic: " << report.total_bytes << " bytes (" << report.inter_domain_bytes
+                              << " across domains)\n"
+    << std::fixed << std::setprecision(1)
+    << "          Makespan: " << report.end_us << " us (compute " << report.compute_us
+                              << " us, exposed communication " << report.exposed_us << " us)\n"
+    << std::setprecision(3)
+    << "           Overlap: " << report.overlap << " (least overlapped device)\n"
+    << std::defaultfloat;
+
+  for (std::string const &error : report.errors) {
+    out << "\n  ERROR: " << error;
+  }
+  if (report.error_count > int(report.errors.size())) {
+    out << "\n  ... and " << report.error_count - int(report.errors.size()) << " more";
+  }
+  if (!report.errors.empty()) {
+    out << "\n";
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    options.print_usage(std::cerr) << std::endl;
+    return -1;
+  }
+
+  bool csv = options.csv || options.configurations() > 1;
+
+  if (csv) {
+    print_csv_header(std::cout);
+  }
+
+  bool all_valid = true;
+
+  for (int m : options.m) {
+    for (int n : options.n) {
+      for (int k : options.k) {
+        for (int l : options.l) {
+          for (std::string const &schedule : options.schedules) {
+            for (int tp : options.tp) {
+
+              Report report = simulate(schedule, tp, options, cutlass::gemm::BatchedGemmCoord(m, n, k, l));
+              all_valid &= report.valid || !report.supported;
+
+              if (csv) {
+                print_csv_row(std::cout, report);
+              }
+              else {
+                print_summary(std::cout, report);
+              }
+
+              for (std::string const &step : report.steps) {
+                std::cout << step << "\n";
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return all_valid ? 0 : 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,405 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Command line front end for cutlass::TileSchedulerSimulator.
+
+    Reports how the SM90 persistent and stream-K tile schedulers decompose a GEMM on a device with
+    a given SM count, without requiring a GPU. Lists of values may be given for the problem extents
+    and scheduler knobs, in which case every combination is simulated and one CSV row is written
+    per configuration.
+*/
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/tile_scheduler_simulator.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Simulator = cutlass::TileSchedulerSimulator;
+using RasterOrder = Simulator::RasterOrder;
+using RasterOrderOptions = Simulator::RasterOrderOptions;
+using DecompositionMode = Simulator::DecompositionMode;
+using ReductionMode = Simulator::ReductionMode;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static char const *to_string(cutlass::SimulatedTileScheduler scheduler) {
+  return scheduler == cutlass::SimulatedTileScheduler::kPersistent ? "persistent" : "stream-k";
+}
+
+static char const *to_string(DecompositionMode mode) {
+  switch (mode) {
+    case DecompositionMode::Heuristic: return "heuristic";
+    case DecompositionMode::DataParallel: return "data-parallel";
+    case DecompositionMode::SplitK: return "split-k";
+    case DecompositionMode::StreamK: return "stream-k";
+  }
+  return "invalid";
+}
+
+static char const *to_string(RasterOrder order) {
+  return order == RasterOrder::AlongM ? "along-m" : "along-n";
+}
+
+static bool from_string(std::string const &str, DecompositionMode &mode) {
+  for (DecompositionMode candidate : {DecompositionMode::Heuristic, DecompositionMode::DataParallel,
+                                      DecompositionMode::SplitK, DecompositionMode::StreamK}) {
+    if (str == to_string(candidate)) {
+      mode = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Command line options
+struct Options {
+
+  bool help = false;
+  bool error = false;
+
+  std::vector<int> m{4096};
+  std::vector<int> n{4096};
+  std::vector<int> k{4096};
+  std::vector<int> l{1};
+
+  std::vector<int> tile{128, 128, 64};
+  std::vector<int> cluster{1, 1};
+
+  int sm_count = 132;
+  int max_active_clusters = 0;
+
+  cutlass::SimulatedTileScheduler scheduler = cutlass::SimulatedTileScheduler::kStreamK;
+  RasterOrderOptions raster = RasterOrderOptions::Heuristic;
+  ReductionMode reduction = ReductionMode::Deterministic;
+
+  std::vector<DecompositionMode> decomposition{DecompositionMode::Heuristic};
+  std::vector<int> splits{1};
+  std::vector<int> swizzle{1};
+
+  bool assignment = false;
+  bool csv = false;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_arguments("m", m);
+    cmd.get_cmd_line_arguments("n", n);
+    cmd.get_cmd_line_arguments("k", k);
+    cmd.get_cmd_line_arguments("l", l);
+    cmd.get_cmd_line_arguments("tile", tile, 'x');
+    cmd.get_cmd_line_arguments("cluster", cluster, 'x');
+    cmd.get_cmd_line_argument("sm-count", sm_count);
+    cmd.get_cmd_line_argument("max-active-clusters", max_active_clusters);
+    cmd.get_cmd_line_arguments("splits", splits);
+    cmd.get_cmd_line_arguments("swizzle", swizzle);
+    cmd.get_cmd_line_argument("assignment", assignment, false);
+    cmd.get_cmd_line_argument("csv", csv, false);
+
+    std::string str;
+
+    cmd.get_cmd_line_argument("scheduler", str, std::string("stream-k"));
+    if (str == "persistent") {
+      scheduler = cutlass::SimulatedTileScheduler::kPersistent;
+    }
+    else if (str == "stream-k") {
+      scheduler = cutlass::SimulatedTileScheduler::kStreamK;
+    }
+    else {
+      std::cerr << "Invalid --scheduler: " << str << "\n";
+      error = true;
+    }
+
+    cmd.get_cmd_line_argument("raster", str, std::string("heuristic"));
+    if (str == "along-m") {
+      raster = RasterOrderOptions::AlongM;
+    }
+    else if (str == "along-n") {
+      raster = RasterOrderOptions::AlongN;
+    }
+    else if (str == "heuristic") {
+      raster = RasterOrderOptions::Heuristic;
+    }
+    else {
+      std::cerr << "Invalid --raster: " << str << "\n";
+      error = true;
+    }
+
+    cmd.get_cmd_line_argument("reduction", str, std::string("deterministic"));
+    if (str == "deterministic") {
+      reduction = ReductionMode::Deterministic;
+    }
+    else if (str == "nondeterministic") {
+      reduction = ReductionMode::Nondeterministic;
+    }
+    else {
+      std::cerr << "Invalid --reduction: " << str << "\n";
+      error = true;
+    }
+
+    std::vector<std::string> modes;
+    cmd.get_cmd_line_arguments("decomposition", modes);
+    if (!modes.empty()) {
+      decomposition.clear();
+      for (std::string const &mode_str : modes) {
+        DecompositionMode mode;
+        if (!from_string(mode_str, mode)) {
+          std::cerr << "Invalid --decomposition: " << mode_str << "\n";
+          error = true;
+        }
+        decomposition.push_back(mode);
+      }
+    }
+
+    if (tile.size() != 3 || cluster.size() != 2 || sm_count <= 0) {
+      std::cerr << "Expected --tile=<m>x<n>x<k>, --cluster=<m>x<n> and a positive --sm-count\n";
+      error = true;
+    }
+  }
+
+  /// Number of configurations described by the options
+  size_t configurations() const {
+    return m.size() * n.size() * k.size() * l.size() *
+      decomposition.size() * splits.size() * swizzle.size();
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "cutlass_scheduler_simulator\n\n"
+      << "  Simulates the SM90 persistent and stream-K tile schedulers on the host.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>[,<int>...]        M extent(s) of the GEMM\n"
+      << "  --n=<int>[,<int>...]        N extent(s) of the GEMM\n"
+      << "  --k=<int>[,<int>...]        K extent(s) of the GEMM\n"
+      << "  --l=<int>[,<int>...]        Batch count(s)\n\n"
+      << "  --tile=<m>x<n>x<k>          CTA tile shape (default: 128x128x64)\n"
+      << "  --cluster=<m>x<n>           Cluster shape (default: 1x1)\n"
+      << "  --sm-count=<int>            Number of SMs (default: 132)\n"
+      << "  --max-active-clusters=<int> Result of cudaOccupancyMaxActiveClusters(), 0 to estimate\n\n"
+      << "  --scheduler=<str>           persistent or stream-k (default)\n"
+      << "  --decomposition=<str>[,...] heuristic, data-parallel, split-k or stream-k\n"
+      << "  --splits=<int>[,<int>...]   Split-K factor(s)\n"
+      << "  --swizzle=<int>[,<int>...]  Maximum swizzle size(s)\n"
+      << "  --raster=<str>              heuristic, along-m or along-n\n"
+      << "  --reduction=<str>           deterministic or nondeterministic\n\n"
+      << "  --assignment=<bool>         Lists the output tiles computed by each CTA\n"
+      << "  --csv=<bool>                Writes one CSV row per configuration. Implied when more\n"
+      << "                              than one configuration is given.\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ cutlass_scheduler_simulator --m=2176 --n=1024 --k=4096 --assignment=true\n\n"
+      << "$ cutlass_scheduler_simulator --m=1024,2048,4096 --n=4096 --k=8192 --cluster=2x1 "
+      << "--decomposition=data-parallel,stream-k --swizzle=1,2,4,8\n\n";
+
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void print_csv_header(std::ostream &out) {
+  out << "Scheduler,M,N,K,L,TileM,TileN,TileK,ClusterM,ClusterN,SMs,RequestedDecomposition,"
+      << "RequestedSplits,MaxSwizzle,Decomposition,Splits,Raster,LogSwizzle,GridX,GridY,"
+      << "OutputTiles,KTilesPerTile,Units,DataParallelUnits,StreamKUnits,StreamKTiles,StreamKGroups,"
+      << "Waves,DataParallelWaveEfficiency,MaxCtaKTiles,MeanCtaKTiles,LoadImbalance,MaxPeers,SplitTiles\n";
+}
+
+static void print_csv_row(std::ostream &out, Simulator::Arguments const &args,
+                          Simulator::Result const &result) {
+  out << to_string(args.scheduler) << ","
+      << args.problem_size.m() << "," << args.problem_size.n() << ","
+      << args.problem_size.k() << "," << args.problem_size.batch() << ","
+      << args.tile_shape.m() << "," << args.tile_shape.n() << "," << args.tile_shape.k() << ","
+      << args.cluster_shape.m() << "," << args.cluster_shape.n() << ","
+      << args.sm_count << ","
+      << to_string(args.decomposition_mode) << "," << args.splits << "," << args.max_swizzle_size << ","
+      << to_string(result.decomposition) << "," << result.splits << ","
+      << to_string(result.raster_order) << "," << result.log_swizzle_size << ","
+      << result.grid.x << "," << result.grid.y << ","
+      << result.output_tiles() << "," << result.k_tiles_per_output_tile << ","
+      << result.units << "," << result.dp_units << "," << result.sk_units << ","
+      << result.sk_tiles << "," << result.sk_groups << ","
+      << result.waves() << "," << result.data_parallel_wave_efficiency() << ","
+      << result.max_cta_k_tiles() << "," << result.mean_cta_k_tiles() << ","
+      << result.load_imbalance() << "," << result.max_peers() << "," << result.split_tiles() << "\n";
+}
+
+static void print_summary(std::ostream &out, Simulator::Arguments const &args,
+                          Simulator::Result const &result) {
+  out
+    << "         Scheduler: " << to_string(args.scheduler) << "\n"
+    << "           Problem: " << args.problem_size.m() << "x" << args.problem_size.n() << "x"
+                              << args.problem_size.k() << "x" << args.problem_size.batch() << "\n"
+    << "    Tile / Cluster: " << args.tile_shape.m() << "x" << args.tile_shape.n() << "x"
+                              << args.tile_shape.k() << " / " << args.cluster_shape.m() << "x"
+                              << args.cluster_shape.n() << "\n"
+    << "              Grid: " << result.grid.x << "x" << result.grid.y << " (" << result.grid_ctas()
+                              << " CTAs on " << args.sm_count << " SMs)\n"
+    << "            Raster: " << to_string(result.raster_order) << ", log2(swizzle) = "
+                              << result.log_swizzle_size << "\n"
+    << "      Output tiles: " << result.output_tiles_mnl.x << "x" << result.output_tiles_mnl.y << "x"
+                              << result.output_tiles_mnl.z << " (" << result.output_tiles() << "), "
+                              << result.k_tiles_per_output_tile << " K tiles each\n"
+    << "     Decomposition: " << to_string(result.decomposition);
+
+  if (result.decomposition == DecompositionMode::SplitK) {
+    out << " (" << result.splits << " splits)";
+  }
+
+  out << "\n"
+    << "             Units: " << result.units << " (data-parallel: " << result.dp_units
+                              << ", stream-K: " << result.sk_units << " over " << result.sk_tiles
+                              << " tiles in " << result.sk_groups << " groups)\n"
+    << "             Waves: " << result.waves() << " (data-parallel wave efficiency: "
+                              << std::fixed << std::setprecision(3)
+                              << result.data_parallel_wave_efficiency() << ")\n"
+    << "       CTA K tiles: max " << result.max_cta_k_tiles() << ", mean " << result.mean_cta_k_tiles()
+                              << ", imbalance " << result.load_imbalance() << "\n"
+    << "   Reduction peers: max " << result.max_peers() << ", " << result.split_tiles()
+                              << " tiles computed by more than one unit\n"
+    << std::defaultfloat;
+
+  if (!result.coverage_ok()) {
+    out << "\n  WARNING: some output tiles were not covered exactly once along K\n";
+  }
+}
+
+static void print_assignment(std::ostream &out, Simulator::Result const &result) {
+  out << "\nCTA assignment (unit: tile (m, n, l) [k_begin, k_end)):\n";
+
+  for (uint32_t cta = 0; cta < result.ctas.size(); ++cta) {
+    Simulator::Cta const &totals = result.ctas[cta];
+    out << "  CTA " << std::setw(4) << cta << "  units " << std::setw(3) << totals.units
+        << "  k_tiles " << std::setw(6) << totals.k_tiles << " :";
+
+    for (Simulator::Work const &work : result.work) {
+      if (work.cta != cta) {
+        continue;
+      }
+      out << "  " << work.unit << ": (" << work.m << ", " << work.n << ", " << work.l << ")";
+      if (work.separate_reduction) {
+        out << " reduction";
+      }
+      else {
+        out << " [" << work.k_begin << ", " << work.k_begin + work.k_tiles << ")";
+      }
+    }
+    out << "\n";
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **argv) {
+
+  Options options;
+  options.parse(argc, argv);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    options.print_usage(std::cerr) << std::endl;
+    return -1;
+  }
+
+  bool csv = options.csv || options.configurations() > 1;
+
+  if (csv) {
+    print_csv_header(std::cout);
+  }
+
+  Simulator::Arguments args;
+  args.scheduler = options.scheduler;
+  args.tile_shape = cutlass::gemm::GemmCoord(options.tile[0], options.tile[1], options.tile[2]);
+  args.cluster_shape = cutlass::gemm::GemmCoord(options.cluster[0], options.cluster[1], 1);
+  args.sm_count = options.sm_count;
+  args.max_active_clusters = options.max_active_clusters;
+  args.raster_order = options.raster;
+  args.reduction_mode = options.reduction;
+  args.record_work = options.assignment;
+
+  for (int m : options.m) {
+    for (int n : options.n) {
+      for (int k : options.k) {
+        for (int l : options.l) {
+          for (DecompositionMode mode : options.decomposition) {
+            for (int splits : options.splits) {
+              for (int swizzle : options.swizzle) {
+
+                args.problem_size = cutlass::gemm::BatchedGemmCoord(m, n, k, l);
+                args.decomposition_mode = mode;
+                args.splits = splits;
+                args.max_swizzle_size = swizzle;
+
+                Simulator::Result result = Simulator::run(args);
+
+                if (csv) {
+                  print_csv_row(std::cout, args, result);
+                }
+                else {
+                  print_summary(std::cout, args, result);
+                }
+
+                if (options.assignment) {
+                  print_assignment(std::cout, result);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
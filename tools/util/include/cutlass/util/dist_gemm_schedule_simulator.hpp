@@ -0,0 +1,767 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host-side simulation and validation of Distributed GEMM schedules.
+
+    The simulator instantiates a schedule derived from cutlass::distributed::schedules::BaseSchedule
+    and replays, for every device and iteration, the operand selection of DistributedGemmUniversalAdapter:
+    the schedule's own get_device_slice_*, get_tensor_* and get_remote_peer_id*() pick the local,
+    buffered and peer tensors, buffered operands are filled by the peer copies the adapter issues
+    (including copies forwarded from a peer's buffers), and reductions read the peer's output
+    buffers or the device's own output. Operands are simulated at the granularity of the
+    schedule's tiles and carry the global coordinates of the tile they hold instead of values, which
+    makes it possible to check without a GPU that
+
+      - every (M, N, K, L) tile product is computed exactly once,
+      - every output tile ends up on exactly one device with its reduction over K complete,
+      - GEMMs only consume operand tiles that agree on K and L, and
+      - peer outputs are only read after the iteration that produces them, and are not
+        overwritten in the iteration that reads them.
+
+    For the actual problem shape, the simulator also reports the bytes each device receives in each
+    iteration and estimates how much of that communication is hidden behind compute, optionally
+    distinguishing traffic within and across NVLink domains of consecutive devices.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cutlass/gemm_coord.h"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Simulates a Distributed GEMM schedule on the host
+template <class Schedule>
+class DistGemmScheduleSimulator {
+public:
+
+  static constexpr int TP = int(typename Schedule::TP{});
+
+  /// Every schedule runs one GEMM per device and iteration
+  static constexpr int Iterations = int(typename Schedule::Iterations{});
+
+  /// Problem and machine description
+  struct Arguments {
+    /// Global GEMM extents
+    gemm::BatchedGemmCoord problem_size{16384, 16384, 16384, 1};
+
+    int element_bits_a = 16;
+    int element_bits_b = 16;
+    int element_bits_c = 16;
+    int element_bits_d = 16;
+
+    /// Sustained math throughput of one device, in TFLOP/s
+    double device_tflops = 800.0;
+
+    /// Bandwidth at which a device can receive from or read its peers, in GB/s
+    double peer_bandwidth_gbps = 400.0;
+
+    /// Number of consecutive devices sharing an NVLink domain, or 0 if all devices share one
+    int domain_size = 0;
+
+    /// Bandwidth at which a device can receive from or read peers in other domains, in GB/s
+    double inter_domain_bandwidth_gbps = 50.0;
+
+    /// Maximum number of errors recorded in Result::errors
+    int max_errors = 32;
+  };
+
+  /// The GEMM run by one device in one iteration
+  struct Step {
+    int device = 0;
+    int iteration = 0;
+    int peer = 0;                     ///< get_remote_peer_id(device, iteration)
+    int peer_a = -1;                  ///< device A is copied from ahead of this GEMM, or -1
+    int peer_b = -1;                  ///< device B is copied from ahead of this GEMM, or -1
+    int copy_source_iteration = 0;    ///< iteration in which the copy source received its slice
+
+    /// Tile coordinates of the product computed, in units of the schedule's tiles along each mode
+    /// (-1 if the operands do not designate a single tile)
+    int32_t m = -1;
+    int32_t n = -1;
+    int32_t k = -1;
+    int32_t l = -1;
+
+    bool accumulates_peer = false;    ///< epilogue source is a peer's partial output
+    bool accumulates_local = false;   ///< epilogue source is the device's own output
+    bool inter_domain = false;        ///< some of the traffic comes from another domain
+
+    double flops = 0;
+    uint64_t bytes_copied = 0;        ///< operand bytes copied from the peer ahead of this GEMM
+    uint64_t bytes_peer_read = 0;     ///< bytes of peer output read by this GEMM's epilogue
+    uint64_t bytes_inter_domain = 0;  ///< part of the above coming from another domain
+
+    /// Modeled timeline, in microseconds from the start of the Distributed GEMM
+    double start_us = 0;
+    double end_us = 0;
+    double compute_us = 0;
+    double copy_us = 0;               ///< time spent copying operands from the peer
+    double communication_us = 0;      ///< time spent copying from and reading the peer
+  };
+
+  /// Per-device totals
+  struct Device {
+    double flops = 0;
+    uint64_t bytes = 0;               ///< bytes received or read from peers
+    double compute_us = 0;
+    double communication_us = 0;
+    double end_us = 0;                ///< completion time of the last GEMM
+
+    /// Time the device spent waiting on communication rather than computing
+    double exposed_communication_us() const {
+      return std::max(0.0, end_us - compute_us);
+    }
+
+    /// Fraction of the communication time hidden behind compute (1.0 if there is none)
+    double overlap() const {
+      if (communication_us <= 0) {
+        return 1.0;
+      }
+      return std::max(0.0, 1.0 - exposed_communication_us() / communication_us);
+    }
+  };
+
+  /// Outcome of a simulation
+  struct Result {
+    bool can_implement = false;       ///< Schedule::can_implement_global() for the problem
+    std::vector<std::string> errors;  ///< coverage, consistency and ordering violations
+    int error_count = 0;              ///< total number of violations, including unrecorded ones
+
+    std::vector<Step> steps;          ///< indexed by iteration * TP + device
+    std::vector<Device> devices;
+
+    gemm::BatchedGemmCoord tiles{0, 0, 0, 0};   ///< schedule tiles along M, N, K and L
+
+    /// True if the schedule covers the problem exactly
+    bool valid() const {
+      return can_implement && error_count == 0;
+    }
+
+    Step const &step(int device, int iteration) const {
+      return steps.at(size_t(iteration) * TP + device);
+    }
+
+    /// Bytes moved between devices in one iteration, summed over devices
+    uint64_t iteration_bytes(int iteration) const {
+      uint64_t bytes = 0;
+      for (int device = 0; device < TP; ++device) {
+        bytes += step(device, iteration).bytes_copied + step(device, iteration).bytes_peer_read;
+      }
+      return bytes;
+    }
+
+    /// Bytes moved between devices over the whole GEMM
+    uint64_t total_bytes() const {
+      uint64_t bytes = 0;
+      for (int iteration = 0; iteration < Iterations; ++iteration) {
+        bytes += iteration_bytes(iteration);
+      }
+      return bytes;
+    }
+
+    /// Bytes moved between devices of different domains over the whole GEMM
+    uint64_t inter_domain_bytes() const {
+      uint64_t bytes = 0;
+      for (Step const &step : steps) {
+        bytes += step.bytes_inter_domain;
+      }
+      return bytes;
+    }
+
+    /// Modeled completion time of the slowest device
+    double end_us() const {
+      double result = 0;
+      for (Device const &device : devices) {
+        result = std::max(result, device.end_us);
+      }
+      return result;
+    }
+  };
+
+  /// Runs the simulation
+  static Result run(Arguments const &args) {
+    Simulation simulation(args);
+    simulation.run();
+    return simulation.result;
+  }
+
+private:
+
+  /// Operand tile: holds the global coordinates (m or n, k, l) of an A or B tile
+  struct OperandTile {
+    int32_t mn = -1;
+    int32_t k = -1;
+    int32_t l = -1;
+
+    bool empty() const { return mn < 0; }
+  };
+
+  /// Output tile: index of a partial result, or -1 if nothing was written
+  struct OutputTile {
+    int32_t partial = -1;
+  };
+
+  /// Accumulated tile product: output coordinates and the number of products summed per K tile
+  struct Partial {
+    int32_t m = -1;
+    int32_t n = -1;
+    int32_t l = -1;
+    std::vector<uint16_t> k_count;
+  };
+
+  /// Last write to an element of an output buffer
+  struct WriteRecord {
+    int device = -1;
+    int iteration = -1;
+    int read_by = -1;                 ///< device that last read it
+    int read_iteration = -1;          ///< iteration in which it was last read
+  };
+
+  class Simulation {
+  public:
+
+    Arguments args;
+    Result result;
+
+    int tiles_m, tiles_n, tiles_k, tiles_l;
+
+    // Global operands, at tile granularity
+    std::vector<OperandTile> global_a, global_b;
+    std::vector<OutputTile> global_d;
+
+    // Per-device tensors and buffers
+    std::vector<std::vector<OperandTile>> local_a, local_b, buffer_a, buffer_b;
+    std::vector<std::vector<OutputTile>> local_c, local_d, buffer_d;
+    std::vector<std::vector<WriteRecord>> local_d_writes, buffer_d_writes;
+
+    std::vector<Partial> partials;
+    std::vector<uint16_t> products;   ///< times each (m, n, k, l) product was computed
+
+    explicit Simulation(Arguments const &args_): args(args_) {
+      using namespace cute;
+
+      auto processor_tiler = typename Schedule::ProcessorTiler{};
+      auto iteration_tiler = typename Schedule::IterationTiler{};
+      tiles_m = int(get<0>(processor_tiler)) * int(get<0>(iteration_tiler));
+      tiles_n = int(get<1>(processor_tiler)) * int(get<1>(iteration_tiler));
+      tiles_k = int(get<2>(processor_tiler)) * int(get<2>(iteration_tiler));
+      tiles_l = int(get<3>(processor_tiler)) * int(get<3>(iteration_tiler));
+      result.tiles = gemm::BatchedGemmCoord(tiles_m, tiles_n, tiles_k, tiles_l);
+      result.steps.resize(size_t(TP) * Iterations);
+      result.devices.resize(TP);
+    }
+
+    bool crosses_domain(int device, int peer) const {
+      return args.domain_size > 0 && device / args.domain_size != peer / args.domain_size;
+    }
+
+    void error(int device, int iteration, std::string const &message) {
+      if (result.error_count++ < args.max_errors) {
+        std::ostringstream out;
+        if (device >= 0) {
+          out << "device " << device << ", iteration " << iteration << ": ";
+        }
+        out << message;
+        result.errors.push_back(out.str());
+      }
+    }
+
+    auto tile_problem_shape() const {
+      return cute::make_shape(tiles_m, tiles_n, tiles_k, tiles_l);
+    }
+
+    auto problem_shape() const {
+      return cute::make_shape(
+        args.problem_size.m(), args.problem_size.n(), args.problem_size.k(), args.problem_size.batch());
+    }
+
+    void run() {
+      result.can_implement = Schedule::can_implement_global(problem_shape());
+
+      initialize();
+      for (int iteration = 0; iteration < Iterations; ++iteration) {
+        if (Schedule::HasMemcpy && Schedule::copies_operands(iteration)) {
+          copy_from_peers(iteration);
+        }
+        compute(iteration);
+      }
+      gather_output();
+      model_timeline();
+    }
+
+    /// Creates the global operands and distributes their slices as the adapter's users do
+    void initialize() {
+      using namespace cute;
+
+      global_a.resize(size_t(tiles_m) * tiles_k * tiles_l);
+      global_b.resize(size_t(tiles_n) * tiles_k * tiles_l);
+      global_d.resize(size_t(tiles_m) * tiles_n * tiles_l);
+      products.assign(size_t(tiles_m) * tiles_n * tiles_k * tiles_l, 0);
+
+      Tensor tensor_a = make_tensor(global_a.data(), make_layout(make_shape(tiles_m, tiles_k, tiles_l)));
+      Tensor tensor_b = make_tensor(global_b.data(), make_layout(make_shape(tiles_n, tiles_k, tiles_l)));
+      for (int l = 0; l < tiles_l; ++l) {
+        for (int k = 0; k < tiles_k; ++k) {
+          for (int m = 0; m < tiles_m; ++m) {
+            tensor_a(m, k, l) = OperandTile{m, k, l};
+          }
+          for (int n = 0; n < tiles_n; ++n) {
+            tensor_b(n, k, l) = OperandTile{n, k, l};
+          }
+        }
+      }
+
+      auto shape = tile_problem_shape();
+      size_t size_a = size(Schedule::get_local_a_shape(shape));
+      size_t size_b = size(Schedule::get_local_b_shape(shape));
+      size_t size_c = size(Schedule::get_local_c_shape(shape));
+      size_t size_d = size(Schedule::get_local_d_shape(shape));
+
+      local_a.assign(TP, std::vector<OperandTile>(size_a));
+      local_b.assign(TP, std::vector<OperandTile>(size_b));
+      local_c.assign(TP, std::vector<OutputTile>(size_c));
+      local_d.assign(TP, std::vector<OutputTile>(size_d));
+      buffer_a.assign(TP, std::vector<OperandTile>(size_t(Schedule::NumBuffersA) * size_a));
+      buffer_b.assign(TP, std::vector<OperandTile>(size_t(Schedule::NumBuffersB) * size_b));
+      buffer_d.assign(TP, std::vector<OutputTile>(size_t(Schedule::NumBuffersD) * size_d));
+      local_d_writes.assign(TP, std::vector<WriteRecord>(size_d));
+      buffer_d_writes.assign(TP, std::vector<WriteRecord>(size_t(Schedule::NumBuffersD) * size_d));
+
+      for (int device = 0; device < TP; ++device) {
+        Tensor slice_a = Schedule::get_device_slice_A(tensor_a, device);
+        Tensor slice_b = Schedule::get_device_slice_B(tensor_b, device);
+        Tensor device_a = make_local_a(device);
+        Tensor device_b = make_local_b(device);
+        if (size(slice_a) != size(device_a) || size(slice_b) != size(device_b)) {
+          error(device, 0, "device slice of A or B does not match the local operand shape");
+          continue;
+        }
+        for (int i = 0; i < size(slice_a); ++i) {
+          device_a(i) = slice_a(i);
+        }
+        for (int i = 0; i < size(slice_b); ++i) {
+          device_b(i) = slice_b(i);
+        }
+      }
+    }
+
+    auto make_local_a(int device) {
+      return cute::make_tensor(local_a[device].data(), cute::make_layout(Schedule::get_local_a_shape(tile_problem_shape())));
+    }
+
+    auto make_local_b(int device) {
+      return cute::make_tensor(local_b[device].data(), cute::make_layout(Schedule::get_local_b_shape(tile_problem_shape())));
+    }
+
+    auto make_local_c(int device) {
+      return cute::make_tensor(local_c[device].data(), cute::make_layout(Schedule::get_local_c_shape(tile_problem_shape())));
+    }
+
+    auto make_local_d(int device) {
+      return cute::make_tensor(local_d[device].data(), cute::make_layout(Schedule::get_local_d_shape(tile_problem_shape())));
+    }
+
+    // Operands of a device in an iteration, selected as in DistributedGemmUniversalAdapter
+
+    auto tensor_a(int device, int iteration) {
+      return Schedule::get_tensor_A(make_local_a(device), buffer_a[device].data(), device, iteration);
+    }
+
+    auto tensor_b(int device, int iteration) {
+      return Schedule::get_tensor_B(make_local_b(device), buffer_b[device].data(), device, iteration);
+    }
+
+    auto tensor_c(int device, int iteration) {
+      int peer = Schedule::get_remote_peer_id(device, iteration);
+      // With a remote C, the C buffers alias the peer's D buffers
+      void *buffer = Schedule::RemoteC ? buffer_d[peer].data() : nullptr;
+      return Schedule::get_tensor_C(make_local_c(device), buffer, device, iteration);
+    }
+
+    auto tensor_d(int device, int iteration) {
+      return Schedule::get_tensor_D(make_local_d(device), buffer_d[device].data(), device, iteration);
+    }
+
+    /// Locates an output tile within the device-local D tensors and buffers
+    WriteRecord *find_write_record(OutputTile const *ptr) {
+      for (int device = 0; device < TP; ++device) {
+        if (!local_d[device].empty() && ptr >= local_d[device].data() && ptr < local_d[device].data() + local_d[device].size()) {
+          return &local_d_writes[device][ptr - local_d[device].data()];
+        }
+        if (!buffer_d[device].empty() && ptr >= buffer_d[device].data() && ptr < buffer_d[device].data() + buffer_d[device].size()) {
+          return &buffer_d_writes[device][ptr - buffer_d[device].data()];
+        }
+      }
+      return nullptr;
+    }
+
+    template <class Tensor>
+    bool in_bounds(Tensor const &tensor, void const *begin, size_t bytes) {
+      auto const *first = reinterpret_cast<uint8_t const *>(tensor.data());
+      auto const *last = reinterpret_cast<uint8_t const *>(&tensor(cute::size(tensor) - 1));
+      auto const *lo = reinterpret_cast<uint8_t const *>(begin);
+      return cute::size(tensor) == 0 || (first >= lo && last < lo + bytes);
+    }
+
+    /// Copies the peers' slices of the rotated operands into the buffers used in this iteration
+    void copy_from_peers(int iteration) {
+      using namespace cute;
+
+      for (int device = 0; device < TP; ++device) {
+        int source_iteration = Schedule::get_copy_source_iteration(device, iteration);
+        Step &step = result.steps[size_t(iteration) * TP + device];
+        step.copy_source_iteration = source_iteration;
+
+        if (source_iteration >= iteration) {
+          error(device, iteration, "copies a slice the peer only receives in iteration " + std::to_string(source_iteration));
+          continue;
+        }
+
+        auto copy = [&](int peer, auto destination, auto source, auto const &buffer, double bits) {
+          if (size(destination) != size(source)) {
+            error(device, iteration, "peer copy source and destination differ in size");
+            return;
+          }
+          if (!in_bounds(destination, buffer.data(), buffer.size() * sizeof(OperandTile))) {
+            error(device, iteration, "peer copy destination is outside of the device's buffers");
+            return;
+          }
+          for (int i = 0; i < size(destination); ++i) {
+            destination(i) = source(i);
+          }
+          uint64_t bytes = uint64_t(double(size(destination)) * bits / 8);
+          step.bytes_copied += bytes;
+          if (crosses_domain(device, peer)) {
+            step.bytes_inter_domain += bytes;
+            step.inter_domain = true;
+          }
+        };
+
+        if constexpr (Schedule::MemcpyA) {
+          step.peer_a = Schedule::get_remote_peer_id_a(device, iteration);
+          copy(step.peer_a, tensor_a(device, iteration), tensor_a(step.peer_a, source_iteration), buffer_a[device],
+               tile_elements_a() * args.element_bits_a);
+        }
+        if constexpr (Schedule::MemcpyB) {
+          step.peer_b = Schedule::get_remote_peer_id_b(device, iteration);
+          copy(step.peer_b, tensor_b(device, iteration), tensor_b(step.peer_b, source_iteration), buffer_b[device],
+               tile_elements_b() * args.element_bits_b);
+        }
+      }
+    }
+
+    double tile_elements_a() const {
+      return double(args.problem_size.m()) / tiles_m * double(args.problem_size.k()) / tiles_k *
+             double(args.problem_size.batch()) / tiles_l;
+    }
+
+    double tile_elements_b() const {
+      return double(args.problem_size.n()) / tiles_n * double(args.problem_size.k()) / tiles_k *
+             double(args.problem_size.batch()) / tiles_l;
+    }
+
+    double tile_elements_c() const {
+      return double(args.problem_size.m()) / tiles_m * double(args.problem_size.n()) / tiles_n *
+             double(args.problem_size.batch()) / tiles_l;
+    }
+
+    /// Runs the local GEMM of every device. All reads of an iteration are simulated before its
+    /// writes, and tiles both read and written within the same iteration are reported as races
+    /// since devices run their GEMMs concurrently.
+    void compute(int iteration) {
+      using namespace cute;
+
+      struct Write {
+        OutputTile *destination;
+        int32_t partial;
+        int device;
+      };
+      std::vector<Write> writes;
+
+      for (int device = 0; device < TP; ++device) {
+        Step &step = result.steps[size_t(iteration) * TP + device];
+        step.device = device;
+        step.iteration = iteration;
+        step.peer = Schedule::get_remote_peer_id(device, iteration);
+        step.accumulates_peer = Schedule::accumulates_peer_output(iteration);
+        step.accumulates_local = Schedule::accumulates_local_output(iteration);
+        bool accumulates = step.accumulates_peer || step.accumulates_local;
+
+        Tensor A = tensor_a(device, iteration);
+        Tensor B = tensor_b(device, iteration);
+        Tensor D = tensor_d(device, iteration);
+        // With local reduction, the adapter points the epilogue source at D itself
+        Tensor C = [&] {
+          if constexpr (Schedule::LocalReduction) {
+            return D;
+          }
+          else {
+            return tensor_c(device, iteration);
+          }
+        }();
+
+        auto [M, N, K, L] = Schedule::get_local_gemm_shape(tile_problem_shape());
+        if (size<0>(A) != M || size<1>(A) != K || size<2>(A) != L ||
+            size<0>(B) != N || size<1>(B) != K || size<2>(B) != L ||
+            size<0>(D) != M || size<1>(D) != N || size<2>(D) != L ||
+            (accumulates && (size<0>(C) != M || size<1>(C) != N || size<2>(C) != L))) {
+          error(device, iteration, "operand shapes do not match the local GEMM shape");
+          continue;
+        }
+
+        step.flops = 2.0 * double(args.problem_size.m()) / tiles_m * double(args.problem_size.n()) / tiles_n *
+                     double(args.problem_size.k()) / tiles_k * double(args.problem_size.batch()) / tiles_l *
+                     double(M) * double(N) * double(K) * double(L);
+        if (step.accumulates_peer) {
+          step.bytes_peer_read = uint64_t(tile_elements_c() * args.element_bits_c / 8 * double(M) * double(N) * double(L));
+          if (crosses_domain(device, step.peer)) {
+            step.bytes_inter_domain += step.bytes_peer_read;
+            step.inter_domain = true;
+          }
+        }
+
+        bool first_tile = true;
+        for (int l = 0; l < int(L); ++l) {
+          for (int n = 0; n < int(N); ++n) {
+            for (int m = 0; m < int(M); ++m) {
+              Partial partial;
+              if (accumulates) {
+                OutputTile const &source = C(m, n, l);
+                WriteRecord *record = find_write_record(&source);
+                if (record == nullptr) {
+                  error(device, iteration, "epilogue source is not an output or output buffer");
+                }
+                else if (source.partial < 0) {
+                  error(device, iteration, "reads an output that was never written");
+                }
+                else {
+                  record->read_by = device;
+                  record->read_iteration = iteration;
+                  partial = partials[source.partial];
+                }
+              }
+              if (partial.k_count.empty()) {
+                partial.k_count.assign(tiles_k, 0);
+              }
+
+              for (int k = 0; k < int(K); ++k) {
+                OperandTile a = A(m, k, l);
+                OperandTile b = B(n, k, l);
+                if (a.empty() || b.empty()) {
+                  error(device, iteration, "reads an A or B tile that was never received");
+                  continue;
+                }
+                if (a.k != b.k || a.l != b.l) {
+                  error(device, iteration, "multiplies A and B tiles of different K or L coordinates");
+                  continue;
+                }
+                if (!merge_coordinate(partial.m, a.mn) || !merge_coordinate(partial.n, b.mn) ||
+                    !merge_coordinate(partial.l, a.l)) {
+                  error(device, iteration, "accumulates products of different output tiles");
+                  continue;
+                }
+                ++partial.k_count[a.k];
+                ++products[((size_t(a.l) * tiles_k + a.k) * tiles_n + b.mn) * tiles_m + a.mn];
+                if (first_tile) {
+                  step.m = a.mn;
+                  step.n = b.mn;
+                  step.k = a.k;
+                  step.l = a.l;
+                  first_tile = false;
+                }
+              }
+
+              partials.push_back(std::move(partial));
+              writes.push_back(Write{&D(m, n, l), int32_t(partials.size() - 1), device});
+            }
+          }
+        }
+      }
+
+      for (Write const &write : writes) {
+        WriteRecord *record = find_write_record(write.destination);
+        if (record == nullptr) {
+          error(write.device, iteration, "writes outside of the device outputs and buffers");
+          continue;
+        }
+        if (record->iteration == iteration) {
+          error(write.device, iteration, "writes an output tile also written by device " + std::to_string(record->device));
+        }
+        // A GEMM may accumulate its own output in place, but not one that another device reads
+        if (record->read_iteration == iteration && record->read_by != write.device) {
+          error(write.device, iteration, "overwrites an output tile read by device " + std::to_string(record->read_by) +
+                                         " in the same iteration");
+        }
+        write.destination->partial = write.partial;
+        record->device = write.device;
+        record->iteration = iteration;
+      }
+    }
+
+    static bool merge_coordinate(int32_t &coordinate, int32_t value) {
+      if (coordinate < 0) {
+        coordinate = value;
+      }
+      return coordinate == value;
+    }
+
+    /// Collects the final outputs of every device into the global D and checks its coverage
+    void gather_output() {
+      using namespace cute;
+
+      std::vector<uint16_t> owners(global_d.size(), 0);
+      Tensor tensor_d = make_tensor(global_d.data(), make_layout(make_shape(tiles_m, tiles_n, tiles_l)));
+      Tensor tensor_owners = make_tensor(owners.data(), make_layout(make_shape(tiles_m, tiles_n, tiles_l)));
+
+      for (int device = 0; device < TP; ++device) {
+        Tensor final_d = make_local_d(device);
+        Tensor slice_d = Schedule::get_device_slice_D(tensor_d, device);
+        Tensor slice_owners = Schedule::get_device_slice_D(tensor_owners, device);
+        if (size(slice_d) != size(final_d)) {
+          error(device, Iterations - 1, "device slice of D does not match the local output shape");
+          continue;
+        }
+        for (int i = 0; i < size(final_d); ++i) {
+          slice_d(i) = final_d(i);
+          ++slice_owners(i);
+        }
+      }
+
+      int missing = 0, duplicated = 0, misplaced = 0, incomplete = 0, redundant = 0;
+      for (int l = 0; l < tiles_l; ++l) {
+        for (int n = 0; n < tiles_n; ++n) {
+          for (int m = 0; m < tiles_m; ++m) {
+            if (tensor_owners(m, n, l) != 1) {
+              ++duplicated;
+              continue;
+            }
+            int32_t index = tensor_d(m, n, l).partial;
+            if (index < 0) {
+              ++missing;
+              continue;
+            }
+            Partial const &partial = partials[index];
+            if (partial.m != m || partial.n != n || partial.l != l) {
+              ++misplaced;
+            }
+            else if (std::any_of(partial.k_count.begin(), partial.k_count.end(), [](uint16_t c) { return c != 1; })) {
+              ++incomplete;
+            }
+          }
+        }
+      }
+      for (uint16_t count : products) {
+        redundant += count > 1;
+      }
+
+      auto report = [&](int count, char const *what) {
+        if (count > 0) {
+          error(-1, 0, std::to_string(count) + " " + what);
+        }
+      };
+      report(duplicated, "output tiles are owned by zero or several devices");
+      report(missing, "output tiles are never written");
+      report(misplaced, "output tiles hold the product of another tile");
+      report(incomplete, "output tiles do not sum every K tile exactly once");
+      report(redundant, "tile products are computed more than once");
+    }
+
+    /// Models the timeline of every device. Peer copies are issued back to back from the start,
+    /// forwarded copies wait for the copy that brought their source to the peer, and each GEMM
+    /// waits for its copies, its own previous GEMM and the peers producing its epilogue source.
+    /// Reading peer outputs is assumed to overlap the GEMM's own math. Traffic between domains
+    /// runs at the inter-domain bandwidth.
+    void model_timeline() {
+      double const flops_per_us = args.device_tflops * 1.0e6;
+      double const intra_bytes_per_us = args.peer_bandwidth_gbps * 1.0e3;
+      double const inter_bytes_per_us = args.inter_domain_bandwidth_gbps * 1.0e3;
+
+      std::vector<double> copy_end(TP, 0.0);
+      std::vector<double> copy_done(size_t(TP) * Iterations, 0.0);
+      for (int iteration = 0; iteration < Iterations; ++iteration) {
+        std::vector<double> start(TP, 0.0);
+        for (int device = 0; device < TP; ++device) {
+          Step &step = result.steps[size_t(iteration) * TP + device];
+          uint64_t read_inter_domain = crosses_domain(device, step.peer) ? step.bytes_peer_read : 0;
+          uint64_t copied_inter_domain = step.bytes_inter_domain - read_inter_domain;
+          step.compute_us = step.flops / flops_per_us;
+          double copy_us = double(step.bytes_copied - copied_inter_domain) / intra_bytes_per_us +
+                           double(copied_inter_domain) / inter_bytes_per_us;
+          double read_us = double(step.bytes_peer_read - read_inter_domain) / intra_bytes_per_us +
+                           double(read_inter_domain) / inter_bytes_per_us;
+          step.copy_us = copy_us;
+          step.communication_us = copy_us + read_us;
+
+          if (step.copy_source_iteration > 0) {
+            int source = step.peer_a >= 0 ? step.peer_a : step.peer_b;
+            copy_end[device] = std::max(copy_end[device], copy_done[size_t(step.copy_source_iteration) * TP + source]);
+          }
+          copy_end[device] += copy_us;
+          copy_done[size_t(iteration) * TP + device] = copy_end[device];
+          double ready = std::max(copy_end[device], iteration > 0 ? result.step(device, iteration - 1).end_us : 0.0);
+          if (step.accumulates_peer) {
+            ready = std::max(ready, result.step(step.peer, iteration - 1).end_us);
+          }
+          start[device] = ready;
+        }
+        for (int device = 0; device < TP; ++device) {
+          Step &step = result.steps[size_t(iteration) * TP + device];
+          double read_us = step.communication_us - step.copy_us;
+          step.start_us = start[device];
+          step.end_us = step.start_us + std::max(step.compute_us, read_us);
+
+          Device &totals = result.devices[device];
+          totals.flops += step.flops;
+          totals.bytes += step.bytes_copied + step.bytes_peer_read;
+          totals.compute_us += step.compute_us;
+          totals.communication_us += step.communication_us;
+          totals.end_us = step.end_us;
+        }
+      }
+    }
+  };
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
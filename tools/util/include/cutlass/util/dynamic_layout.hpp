@@ -0,0 +1,1220 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host-side layout algebra on layouts whose shapes and strides are only known at runtime.
+
+    cutlass::dynamic_layout mirrors the CuTe layout algebra of cute/layout.hpp and cute/swizzle.hpp
+    for tooling that manipulates layouts chosen at runtime (autotuners, schedule simulators, layout
+    validators) without instantiating CuTe templates per shape.
+
+    Integer tuples are immutable nodes interned in a Context: structurally equal tuples share one
+    node, so equality is a comparison of node ids and the Context can memoize the algebra on them.
+    IntTuple and Layout are small handles into their Context, which must outlive them. A Context
+    is not thread-safe; use one per thread.
+
+    Every value is treated as known, so results match CuTe for fully static layouts. CuTe treats
+    dynamic values conservatively (e.g. coalesce does not merge dynamic modes), so results on
+    partially dynamic CuTe layouts may differ while describing the same function. CuTe's static
+    assertions (divisibility and injectivity conditions) become std::invalid_argument exceptions.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cute/layout.hpp"
+#include "cute/layout_composed.hpp"
+#include "cute/swizzle.hpp"
+
+namespace cutlass {
+namespace dynamic_layout {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Context;
+
+/// Handle to an immutable hierarchical integer tuple owned by a Context
+class IntTuple {
+public:
+
+  IntTuple() = default;
+
+  /// True for a single integer, false for a (possibly empty) tuple
+  bool is_integral() const;
+
+  /// Value of an integral IntTuple
+  int64_t value() const;
+
+  /// Number of top-level modes. An integer has rank 1.
+  int rank() const;
+
+  /// I-th top-level mode. Mode 0 of an integer is the integer itself.
+  IntTuple operator[](int i) const;
+
+  /// Product of all integers
+  int64_t product() const;
+
+  Context *context() const { return ctx_; }
+  uint32_t id() const { return id_; }
+  bool valid() const { return ctx_ != nullptr; }
+
+  /// Structural equality, which interning reduces to identity
+  bool operator==(IntTuple const &other) const { return ctx_ == other.ctx_ && id_ == other.id_; }
+  bool operator!=(IntTuple const &other) const { return !(*this == other); }
+
+private:
+  friend class Context;
+
+  IntTuple(Context *ctx, uint32_t id): ctx_(ctx), id_(id) { }
+
+  Context *ctx_ = nullptr;
+  uint32_t id_ = 0;
+};
+
+/// A function from coordinates to indices defined by congruent shape and stride IntTuples
+struct Layout {
+  IntTuple shape;
+  IntTuple stride;
+
+  int rank() const { return shape.rank(); }
+
+  /// I-th top-level mode as a layout
+  Layout operator[](int i) const { return Layout{shape[i], stride[i]}; }
+
+  /// Maps a 1-D (colexicographic) coordinate to an index
+  int64_t operator()(int64_t coord) const;
+
+  /// Maps a hierarchical coordinate to an index
+  int64_t operator()(IntTuple const &coord) const;
+
+  bool operator==(Layout const &other) const { return shape == other.shape && stride == other.stride; }
+  bool operator!=(Layout const &other) const { return !(*this == other); }
+};
+
+/// Runtime counterpart of cute::Swizzle<BBits, MBase, SShift>
+struct Swizzle {
+  int bits  = 0;
+  int base  = 0;
+  int shift = 0;
+
+  Swizzle() = default;
+
+  Swizzle(int bits_, int base_, int shift_): bits(bits_), base(base_), shift(shift_) {
+    if (bits < 0 || base < 0 || std::abs(shift) < bits) {
+      throw std::invalid_argument("Swizzle requires BBits >= 0, MBase >= 0 and abs(SShift) >= BBits");
+    }
+  }
+
+  /// ZZZ ^= YYY
+  int64_t operator()(int64_t offset) const {
+    int64_t bit_msk = (int64_t(1) << bits) - 1;
+    int64_t yyy_msk = bit_msk << (base + std::max(0, shift));
+    int64_t yyy = offset & yyy_msk;
+    return offset ^ (shift >= 0 ? (yyy >> shift) : (yyy << -shift));
+  }
+
+  bool operator==(Swizzle const &other) const {
+    return bits == other.bits && base == other.base && shift == other.shift;
+  }
+};
+
+/// Runtime counterpart of cute::ComposedLayout<Swizzle, Offset, Layout>: swizzle(offset + layout(c))
+struct SwizzledLayout {
+  Swizzle swizzle;
+  int64_t offset = 0;
+  Layout layout;
+
+  int64_t operator()(int64_t coord) const { return swizzle(offset + layout(coord)); }
+  int64_t operator()(IntTuple const &coord) const { return swizzle(offset + layout(coord)); }
+};
+
+/// Tiler applied mode-by-mode, the runtime counterpart of a cute::tuple of layouts
+using Tiler = std::vector<Layout>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Owns interned IntTuple nodes and caches the results of layout algebra
+class Context {
+public:
+
+  /// Memoized operations
+  enum class Op : uint8_t {
+    kCoalesce,
+    kFilter,
+    kComposition,
+    kComplement,
+    kRightInverse,
+    kLeftInverse,
+    kLogicalDivide,
+    kLogicalProduct
+  };
+
+  Context() {
+    nodes_.reserve(256);
+    children_.reserve(1024);
+  }
+
+  Context(Context const &) = delete;
+  Context &operator=(Context const &) = delete;
+
+  //
+  // Construction
+  //
+
+  IntTuple make_int(int64_t value) {
+    return intern(-1, value, nullptr);
+  }
+
+  IntTuple make_tuple(std::vector<IntTuple> const &elements) {
+    std::vector<uint32_t> ids;
+    ids.reserve(elements.size());
+    for (IntTuple const &e : elements) {
+      check_owned(e);
+      ids.push_back(e.id_);
+    }
+    return intern(int32_t(ids.size()), 0, ids.data());
+  }
+
+  IntTuple make_tuple(std::initializer_list<IntTuple> elements) {
+    return make_tuple(std::vector<IntTuple>(elements));
+  }
+
+  IntTuple make_tuple(std::vector<int64_t> const &values) {
+    std::vector<IntTuple> elements;
+    elements.reserve(values.size());
+    for (int64_t v : values) {
+      elements.push_back(make_int(v));
+    }
+    return make_tuple(elements);
+  }
+
+  /// Parses an IntTuple such as "8", "(2,(4,_8))" or "()". A leading '_' on integers is ignored,
+  /// so that the output of cute::print can be read back.
+  IntTuple parse(std::string const &text) {
+    size_t pos = 0;
+    IntTuple result = parse_element(text, pos);
+    skip_space(text, pos);
+    if (pos != text.size()) {
+      throw std::invalid_argument("Unexpected trailing characters in IntTuple: " + text);
+    }
+    return result;
+  }
+
+  /// Parses a layout "shape:stride", or "shape" for a compact column-major layout
+  Layout parse_layout(std::string const &text);
+
+  //
+  // Operation cache
+  //
+
+  /// Returns the cached result of (op, a, b), computing and caching it with f() on a miss
+  template <class F>
+  Layout memoize(Op op, IntTuple a0, IntTuple a1, IntTuple b0, IntTuple b1, F &&f) {
+    OpKey key{op, {a0.id_, a1.id_, b0.valid() ? b0.id_ : kNone, b1.valid() ? b1.id_ : kNone}};
+    auto it = cache_.find(key);
+    if (it != cache_.end()) {
+      ++cache_hits_;
+      return Layout{IntTuple(this, it->second.first), IntTuple(this, it->second.second)};
+    }
+    ++cache_misses_;
+    Layout result = f();
+    cache_.emplace(key, std::make_pair(result.shape.id_, result.stride.id_));
+    return result;
+  }
+
+  /// Drops memoized results. Interned nodes, and so all handles, remain valid.
+  void clear_cache() {
+    cache_.clear();
+    cache_hits_ = 0;
+    cache_misses_ = 0;
+  }
+
+  size_t node_count() const { return nodes_.size(); }
+  uint64_t cache_hits() const { return cache_hits_; }
+  uint64_t cache_misses() const { return cache_misses_; }
+
+private:
+  friend class IntTuple;
+
+  static constexpr uint32_t kNone = ~uint32_t(0);
+
+  struct Node {
+    int64_t value;      ///< integer value, or 0 for tuples
+    int64_t product;    ///< product of all integers in the subtree
+    uint32_t begin;     ///< offset of the children in children_
+    int32_t rank;       ///< number of children, or -1 for an integer
+  };
+
+  struct OpKey {
+    Op op;
+    uint32_t ids[4];
+
+    bool operator==(OpKey const &other) const {
+      return op == other.op && std::equal(ids, ids + 4, other.ids);
+    }
+  };
+
+  struct OpKeyHash {
+    size_t operator()(OpKey const &key) const {
+      uint64_t h = uint64_t(key.op);
+      for (uint32_t id : key.ids) {
+        h = mix(h ^ id);
+      }
+      return size_t(h);
+    }
+  };
+
+  static uint64_t mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  IntTuple intern(int32_t rank, int64_t value, uint32_t const *ids) {
+    uint64_t h = mix(uint64_t(int64_t(rank)) * 0x9e3779b97f4a7c15ull ^ uint64_t(value));
+    for (int32_t i = 0; i < rank; ++i) {
+      h = mix(h ^ ids[i]);
+    }
+
+    auto range = intern_.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+      Node const &node = nodes_[it->second];
+      if (node.rank == rank && node.value == value &&
+          (rank <= 0 || std::equal(ids, ids + rank, children_.begin() + node.begin))) {
+        return IntTuple(this, it->second);
+      }
+    }
+
+    Node node{value, value, uint32_t(children_.size()), rank};
+    if (rank >= 0) {
+      node.product = 1;
+      for (int32_t i = 0; i < rank; ++i) {
+        node.product *= nodes_[ids[i]].product;
+        children_.push_back(ids[i]);
+      }
+    }
+    uint32_t id = uint32_t(nodes_.size());
+    nodes_.push_back(node);
+    intern_.emplace(h, id);
+    return IntTuple(this, id);
+  }
+
+  void check_owned(IntTuple const &t) const {
+    if (t.ctx_ != this) {
+      throw std::invalid_argument("IntTuple belongs to a different dynamic_layout::Context");
+    }
+  }
+
+  static void skip_space(std::string const &text, size_t &pos) {
+    while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t')) {
+      ++pos;
+    }
+  }
+
+  IntTuple parse_element(std::string const &text, size_t &pos) {
+    skip_space(text, pos);
+    if (pos < text.size() && text[pos] == '(') {
+      ++pos;
+      std::vector<IntTuple> elements;
+      skip_space(text, pos);
+      if (pos < text.size() && text[pos] == ')') {
+        ++pos;
+        return make_tuple(elements);
+      }
+      while (true) {
+        elements.push_back(parse_element(text, pos));
+        skip_space(text, pos);
+        if (pos < text.size() && text[pos] == ',') {
+          ++pos;
+        } else if (pos < text.size() && text[pos] == ')') {
+          ++pos;
+          return make_tuple(elements);
+        } else {
+          throw std::invalid_argument("Expected ',' or ')' in IntTuple: " + text);
+        }
+      }
+    }
+
+    if (pos < text.size() && text[pos] == '_') {
+      ++pos;
+    }
+    size_t end = pos;
+    if (end < text.size() && text[end] == '-') {
+      ++end;
+    }
+    while (end < text.size() && text[end] >= '0' && text[end] <= '9') {
+      ++end;
+    }
+    if (end == pos || (end == pos + 1 && text[pos] == '-')) {
+      throw std::invalid_argument("Expected an integer in IntTuple: " + text);
+    }
+    int64_t value = std::stoll(text.substr(pos, end - pos));
+    pos = end;
+    return make_int(value);
+  }
+
+  std::vector<Node> nodes_;
+  std::vector<uint32_t> children_;
+  std::unordered_multimap<uint64_t, uint32_t> intern_;
+
+  std::unordered_map<OpKey, std::pair<uint32_t, uint32_t>, OpKeyHash> cache_;
+  uint64_t cache_hits_ = 0;
+  uint64_t cache_misses_ = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// IntTuple
+//
+
+inline bool IntTuple::is_integral() const {
+  return ctx_->nodes_[id_].rank < 0;
+}
+
+inline int64_t IntTuple::value() const {
+  return ctx_->nodes_[id_].value;
+}
+
+inline int IntTuple::rank() const {
+  int32_t r = ctx_->nodes_[id_].rank;
+  return r < 0 ? 1 : int(r);
+}
+
+inline IntTuple IntTuple::operator[](int i) const {
+  Context::Node const &node = ctx_->nodes_[id_];
+  if (node.rank < 0) {
+    if (i != 0) {
+      throw std::out_of_range("Mode index out of range for an integral IntTuple");
+    }
+    return *this;
+  }
+  if (i < 0 || i >= node.rank) {
+    throw std::out_of_range("Mode index out of range for IntTuple");
+  }
+  return IntTuple(ctx_, ctx_->children_[node.begin + i]);
+}
+
+inline int64_t IntTuple::product() const {
+  return ctx_->nodes_[id_].product;
+}
+
+/// Maximum nesting depth. An integer has depth 0.
+inline int depth(IntTuple const &t) {
+  if (t.is_integral()) {
+    return 0;
+  }
+  int d = 0;
+  for (int i = 0; i < t.rank(); ++i) {
+    d = std::max(d, depth(t[i]));
+  }
+  return d + 1;
+}
+
+/// True if a and b have the same hierarchical structure
+inline bool congruent(IntTuple const &a, IntTuple const &b) {
+  if (a.is_integral() || b.is_integral()) {
+    return a.is_integral() && b.is_integral();
+  }
+  if (a.rank() != b.rank()) {
+    return false;
+  }
+  for (int i = 0; i < a.rank(); ++i) {
+    if (!congruent(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace detail {
+
+inline void flatten_into(IntTuple const &t, std::vector<int64_t> &out) {
+  if (t.is_integral()) {
+    out.push_back(t.value());
+    return;
+  }
+  for (int i = 0; i < t.rank(); ++i) {
+    flatten_into(t[i], out);
+  }
+}
+
+inline int64_t ceil_div(int64_t a, int64_t b) {
+  return (a + b - 1) / b;
+}
+
+inline int64_t signum(int64_t a) {
+  return (a > 0) - (a < 0);
+}
+
+/// Single-element vectors become the element, as cute::unwrap
+inline IntTuple unwrap(Context &ctx, std::vector<int64_t> const &values) {
+  return values.size() == 1 ? ctx.make_int(values[0]) : ctx.make_tuple(values);
+}
+
+inline Context &context_of(IntTuple const &a, IntTuple const &b) {
+  if (a.context() == nullptr || a.context() != b.context()) {
+    throw std::invalid_argument("dynamic_layout operands must belong to the same Context");
+  }
+  return *a.context();
+}
+
+inline Context &context_of(Layout const &layout) {
+  return context_of(layout.shape, layout.stride);
+}
+
+} // namespace detail
+
+/// Leaves of t in order
+inline std::vector<int64_t> flatten_values(IntTuple const &t) {
+  std::vector<int64_t> out;
+  detail::flatten_into(t, out);
+  return out;
+}
+
+/// Depth-1 tuple of the leaves of t; an integer is returned unchanged
+inline IntTuple flatten(IntTuple const &t) {
+  if (t.is_integral()) {
+    return t;
+  }
+  return t.context()->make_tuple(flatten_values(t));
+}
+
+/// Compact column-major strides for shape, starting at current
+inline IntTuple compact_col_major(IntTuple const &shape, int64_t current = 1) {
+  Context &ctx = *shape.context();
+  std::function<IntTuple(IntTuple const &)> impl = [&](IntTuple const &s) {
+    if (s.is_integral()) {
+      // Size-1 modes get stride 0, as for static _1 in CuTe
+      IntTuple d = ctx.make_int(s.value() == 1 ? 0 : current);
+      current *= s.value();
+      return d;
+    }
+    std::vector<IntTuple> strides;
+    for (int i = 0; i < s.rank(); ++i) {
+      strides.push_back(impl(s[i]));
+    }
+    return ctx.make_tuple(strides);
+  };
+  return impl(shape);
+}
+
+/// Compact row-major strides for shape, starting at current
+inline IntTuple compact_row_major(IntTuple const &shape, int64_t current = 1) {
+  Context &ctx = *shape.context();
+  std::function<IntTuple(IntTuple const &)> impl = [&](IntTuple const &s) {
+    if (s.is_integral()) {
+      // Size-1 modes get stride 0, as for static _1 in CuTe
+      IntTuple d = ctx.make_int(s.value() == 1 ? 0 : current);
+      current *= s.value();
+      return d;
+    }
+    std::vector<IntTuple> strides(s.rank());
+    for (int i = s.rank() - 1; i >= 0; --i) {
+      strides[i] = impl(s[i]);
+    }
+    return ctx.make_tuple(strides);
+  };
+  return impl(shape);
+}
+
+/// cute::ceil_div for an IntTuple dividend and an integer divisor
+inline IntTuple ceil_div(IntTuple const &a, int64_t b) {
+  if (a.is_integral()) {
+    return a.context()->make_int(detail::ceil_div(a.value(), b));
+  }
+  std::vector<IntTuple> result;
+  for (int i = 0; i < a.rank(); ++i) {
+    result.push_back(ceil_div(a[i], b));
+    b = detail::ceil_div(b, a[i].product());
+  }
+  return a.context()->make_tuple(result);
+}
+
+/// Index of a 1-D (colexicographic) coordinate within shape via the strides
+inline int64_t crd2idx(int64_t coord, IntTuple const &shape, IntTuple const &stride) {
+  if (shape.is_integral()) {
+    return coord * stride.value();
+  }
+  // Split the coordinate across the modes; the last mode takes the rest
+  int64_t result = 0;
+  int R = shape.rank();
+  for (int i = 0; i < R - 1; ++i) {
+    int64_t p = shape[i].product();
+    result += crd2idx(coord % p, shape[i], stride[i]);
+    coord /= p;
+  }
+  return R > 0 ? result + crd2idx(coord, shape[R - 1], stride[R - 1]) : result;
+}
+
+/// Index of a hierarchical coordinate within shape via the strides
+inline int64_t crd2idx(IntTuple const &coord, IntTuple const &shape, IntTuple const &stride) {
+  if (coord.is_integral()) {
+    return crd2idx(coord.value(), shape, stride);
+  }
+  if (shape.is_integral() || coord.rank() != shape.rank()) {
+    throw std::invalid_argument("crd2idx: coordinate is not compatible with the shape");
+  }
+  int64_t result = 0;
+  for (int i = 0; i < coord.rank(); ++i) {
+    result += crd2idx(coord[i], shape[i], stride[i]);
+  }
+  return result;
+}
+
+/// Hierarchical coordinate of idx within shape, colexicographically; the last mode takes the rest.
+/// Each distinct coordinate is interned, so prefer Layout evaluation in tight loops.
+inline IntTuple idx2crd(int64_t idx, IntTuple const &shape) {
+  Context &ctx = *shape.context();
+  if (shape.is_integral()) {
+    return ctx.make_int(idx);
+  }
+  std::vector<IntTuple> coord;
+  int R = shape.rank();
+  for (int i = 0; i < R; ++i) {
+    if (i == R - 1) {
+      coord.push_back(idx2crd(idx, shape[i]));
+    } else {
+      int64_t p = shape[i].product();
+      coord.push_back(idx2crd(idx % p, shape[i]));
+      idx /= p;
+    }
+  }
+  return ctx.make_tuple(coord);
+}
+
+inline std::ostream &operator<<(std::ostream &out, IntTuple const &t) {
+  if (t.is_integral()) {
+    return out << t.value();
+  }
+  out << "(";
+  for (int i = 0; i < t.rank(); ++i) {
+    out << (i ? "," : "") << t[i];
+  }
+  return out << ")";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Layout construction and properties
+//
+
+inline int64_t Layout::operator()(int64_t coord) const {
+  return crd2idx(coord, shape, stride);
+}
+
+inline int64_t Layout::operator()(IntTuple const &coord) const {
+  return crd2idx(coord, shape, stride);
+}
+
+/// Layout with the given shape and stride, which must be congruent
+inline Layout make_layout(IntTuple const &shape, IntTuple const &stride) {
+  detail::context_of(shape, stride);
+  if (!congruent(shape, stride)) {
+    throw std::invalid_argument("make_layout: shape and stride are not congruent");
+  }
+  return Layout{shape, stride};
+}
+
+/// Compact column-major layout of the given shape
+inline Layout make_layout(IntTuple const &shape) {
+  return Layout{shape, compact_col_major(shape)};
+}
+
+/// Layout whose modes are the given layouts
+inline Layout make_layout(std::vector<Layout> const &modes) {
+  if (modes.empty()) {
+    throw std::invalid_argument("make_layout: at least one mode is required");
+  }
+  Context &ctx = detail::context_of(modes.front());
+  std::vector<IntTuple> shapes, strides;
+  for (Layout const &m : modes) {
+    shapes.push_back(m.shape);
+    strides.push_back(m.stride);
+  }
+  return Layout{ctx.make_tuple(shapes), ctx.make_tuple(strides)};
+}
+
+inline Layout make_layout(Layout const &a, Layout const &b) {
+  return make_layout(std::vector<Layout>{a, b});
+}
+
+inline Layout Context::parse_layout(std::string const &text) {
+  size_t colon = text.find(':');
+  if (colon == std::string::npos) {
+    return make_layout(parse(text));
+  }
+  return make_layout(parse(text.substr(0, colon)), parse(text.substr(colon + 1)));
+}
+
+/// Size of the domain
+inline int64_t size(Layout const &layout) {
+  return layout.shape.product();
+}
+
+/// Size of the codomain
+inline int64_t cosize(Layout const &layout) {
+  return layout(size(layout) - 1) + 1;
+}
+
+inline int rank(Layout const &layout) {
+  return layout.rank();
+}
+
+inline int depth(Layout const &layout) {
+  return depth(layout.shape);
+}
+
+inline std::ostream &operator<<(std::ostream &out, Layout const &layout) {
+  return out << layout.shape << ":" << layout.stride;
+}
+
+inline std::ostream &operator<<(std::ostream &out, Swizzle const &swizzle) {
+  return out << "Sw<" << swizzle.bits << "," << swizzle.base << "," << swizzle.shift << ">";
+}
+
+inline std::ostream &operator<<(std::ostream &out, SwizzledLayout const &layout) {
+  return out << layout.swizzle << " o " << layout.offset << " o " << layout.layout;
+}
+
+/// Printable string of an IntTuple, Layout or SwizzledLayout
+template <class T>
+std::string to_string(T const &value) {
+  std::ostringstream out;
+  out << value;
+  return out.str();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Coalesce and filter
+//
+
+namespace detail {
+
+// Follows cute::detail::bw_coalesce: walks the flat modes from the back, skipping size-1 modes and
+// merging a mode into the front of the result when its shape*stride equals the front stride.
+// With @a keep_last_stride the last mode behaves as if it had size 2, as in cute::detail::coalesce_x,
+// so the function is preserved outside the domain as well.
+inline Layout bw_coalesce(Context &ctx, std::vector<int64_t> const &shape,
+                          std::vector<int64_t> const &stride, bool keep_last_stride) {
+  int R = int(shape.size());
+  if (R == 0) {
+    return Layout{ctx.make_int(1), ctx.make_int(0)};
+  }
+
+  // Result modes are accumulated back to front
+  std::vector<int64_t> new_shape{shape[R - 1]};
+  std::vector<int64_t> new_stride{stride[R - 1]};
+  if (keep_last_stride && shape[R - 1] == 1) {
+    new_shape.back() = 2;
+  }
+
+  for (int i = R - 2; i >= 0; --i) {
+    if (shape[i] == 1) {
+      continue;
+    }
+    if (new_shape.size() == 1 && new_shape.back() == 1) {
+      new_shape.back() = shape[i];
+      new_stride.back() = stride[i];
+    } else if (shape[i] * stride[i] == new_stride.back()) {
+      new_shape.back() *= shape[i];
+      new_stride.back() = stride[i];
+    } else {
+      new_shape.push_back(shape[i]);
+      new_stride.push_back(stride[i]);
+    }
+  }
+
+  std::reverse(new_shape.begin(), new_shape.end());
+  std::reverse(new_stride.begin(), new_stride.end());
+  if (new_shape.size() == 1 && new_shape[0] == 1) {
+    return Layout{ctx.make_int(1), ctx.make_int(0)};
+  }
+  return Layout{unwrap(ctx, new_shape), unwrap(ctx, new_stride)};
+}
+
+/// Flat modes of layout without any size-1 placeholder, as cute::detail::coalesce_x
+inline Layout coalesce_x(Layout const &layout) {
+  return bw_coalesce(context_of(layout), flatten_values(layout.shape), flatten_values(layout.stride), true);
+}
+
+/// Applies f to the first rank(tiler) modes of layout, keeping the remaining modes unchanged
+template <class F>
+Layout transform_layout(Layout const &layout, Tiler const &tiler, F &&f) {
+  if (int(tiler.size()) > layout.rank()) {
+    throw std::invalid_argument("Too many modes in tiler");
+  }
+  std::vector<Layout> modes;
+  for (int i = 0; i < layout.rank(); ++i) {
+    modes.push_back(i < int(tiler.size()) ? f(layout[i], tiler[i]) : layout[i]);
+  }
+  return make_layout(modes);
+}
+
+} // namespace detail
+
+/// Combines as many modes as possible while preserving the function on the domain.
+/// @post depth(result) <= 1 and result(i) == layout(i) for all 0 <= i < size(layout)
+inline Layout coalesce(Layout const &layout) {
+  Context &ctx = detail::context_of(layout);
+  return ctx.memoize(Context::Op::kCoalesce, layout.shape, layout.stride, IntTuple(), IntTuple(), [&] {
+    return detail::bw_coalesce(ctx, flatten_values(layout.shape), flatten_values(layout.stride), false);
+  });
+}
+
+/// Applies coalesce to each of the modes of layout selected by profile (an integer selects all)
+inline Layout coalesce(Layout const &layout, IntTuple const &profile) {
+  if (profile.is_integral()) {
+    return coalesce(layout);
+  }
+  if (profile.rank() > layout.rank()) {
+    throw std::invalid_argument("coalesce: too many modes in profile");
+  }
+  std::vector<Layout> modes;
+  for (int i = 0; i < layout.rank(); ++i) {
+    modes.push_back(i < profile.rank() ? coalesce(layout[i], profile[i]) : layout[i]);
+  }
+  return make_layout(modes);
+}
+
+/// Replaces the modes of layout with a 0-stride by a 1-size
+inline Layout filter_zeros(Layout const &layout) {
+  Context &ctx = detail::context_of(layout);
+  std::function<IntTuple(IntTuple const &, IntTuple const &)> impl = [&](IntTuple const &s, IntTuple const &d) {
+    if (s.is_integral()) {
+      return d.value() == 0 ? ctx.make_int(1) : s;
+    }
+    std::vector<IntTuple> modes;
+    for (int i = 0; i < s.rank(); ++i) {
+      modes.push_back(impl(s[i], d[i]));
+    }
+    return ctx.make_tuple(modes);
+  };
+  return Layout{impl(layout.shape, layout.stride), layout.stride};
+}
+
+/// Removes all 0-strides and 1-sizes; returns 1:0 if nothing remains
+inline Layout filter(Layout const &layout) {
+  Context &ctx = detail::context_of(layout);
+  return ctx.memoize(Context::Op::kFilter, layout.shape, layout.stride, IntTuple(), IntTuple(), [&] {
+    return coalesce(filter_zeros(layout));
+  });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Composition
+//
+
+namespace detail {
+
+inline Layout composition_impl(Context &ctx, Layout const &lhs, IntTuple const &rhs_shape, IntTuple const &rhs_stride) {
+  // Right-distributivity of composition for a tuple RHS
+  if (!rhs_shape.is_integral()) {
+    std::vector<Layout> modes;
+    for (int i = 0; i < rhs_shape.rank(); ++i) {
+      modes.push_back(composition_impl(ctx, lhs, rhs_shape[i], rhs_stride[i]));
+    }
+    return make_layout(modes);
+  }
+
+  int64_t rhs_d = rhs_stride.value();
+  if (rhs_d == 0) {
+    return Layout{rhs_shape, rhs_stride};
+  }
+  if (lhs.shape.is_integral()) {
+    return Layout{rhs_shape, ctx.make_int(rhs_d * lhs.stride.value())};
+  }
+
+  // General case: flat LHS tuple, integral RHS
+  std::vector<int64_t> lshape = flatten_values(lhs.shape);
+  std::vector<int64_t> lstride = flatten_values(lhs.stride);
+  int R = int(lshape.size());
+
+  std::vector<int64_t> result_shape, result_stride;
+  int64_t rest_shape = rhs_shape.value();
+  int64_t rest_stride = rhs_d;
+
+  for (int i = 0; i < R - 1; ++i) {
+    int64_t curr_shape = lshape[i];
+    int64_t curr_stride = lstride[i];
+
+    if (!((rest_stride % curr_shape) == 0 || rest_stride < curr_shape)) {
+      throw std::invalid_argument("composition: stride divisibility condition violated");
+    }
+
+    int64_t next_shape = ceil_div(curr_shape, std::abs(rest_stride));
+    int64_t next_stride = ceil_div(std::abs(rest_stride), curr_shape) * signum(rest_stride);
+
+    if (next_shape == 1 || rest_shape == 1) {
+      rest_stride = next_stride;
+      continue;
+    }
+
+    int64_t new_shape = std::min(next_shape, rest_shape);
+    if (rest_shape % new_shape != 0) {
+      throw std::invalid_argument("composition: shape divisibility condition violated");
+    }
+    result_shape.push_back(new_shape);
+    result_stride.push_back(rest_stride * curr_stride);
+    rest_shape /= new_shape;
+    rest_stride = next_stride;
+  }
+
+  if (result_shape.empty()) {
+    return Layout{ctx.make_int(rest_shape), ctx.make_int(rest_stride * lstride[R - 1])};
+  }
+  if (rest_shape != 1) {
+    result_shape.push_back(rest_shape);
+    result_stride.push_back(rest_stride * lstride[R - 1]);
+  }
+  return Layout{unwrap(ctx, result_shape), unwrap(ctx, result_stride)};
+}
+
+} // namespace detail
+
+/// lhs o rhs
+/// @post result(c) == lhs(rhs(c)) for all c in the domain of rhs
+inline Layout composition(Layout const &lhs, Layout const &rhs) {
+  Context &ctx = detail::context_of(lhs);
+  detail::context_of(lhs.shape, rhs.shape);
+  return ctx.memoize(Context::Op::kComposition, lhs.shape, lhs.stride, rhs.shape, rhs.stride, [&] {
+    return detail::composition_impl(ctx, detail::coalesce_x(lhs), rhs.shape, rhs.stride);
+  });
+}
+
+/// lhs o tile, where tile is an integer size
+inline Layout composition(Layout const &lhs, int64_t tile) {
+  Context &ctx = detail::context_of(lhs);
+  return composition(lhs, Layout{ctx.make_int(tile), ctx.make_int(1)});
+}
+
+/// Mode-by-mode composition. As in CuTe, modes of lhs not covered by the tiler are dropped.
+inline Layout composition(Layout const &lhs, Tiler const &tiler) {
+  if (int(tiler.size()) > lhs.rank()) {
+    throw std::invalid_argument("composition: too many modes in tiler");
+  }
+  std::vector<Layout> modes;
+  for (size_t i = 0; i < tiler.size(); ++i) {
+    modes.push_back(composition(lhs[int(i)], tiler[i]));
+  }
+  return make_layout(modes);
+}
+
+/// swizzle o layout
+inline SwizzledLayout composition(Swizzle const &swizzle, Layout const &layout) {
+  return SwizzledLayout{swizzle, 0, layout};
+}
+
+/// (swizzle o offset o layout) o rhs, which composes rhs into the inner layout
+inline SwizzledLayout composition(SwizzledLayout const &lhs, Layout const &rhs) {
+  return SwizzledLayout{lhs.swizzle, lhs.offset, composition(lhs.layout, rhs)};
+}
+
+inline SwizzledLayout composition(SwizzledLayout const &lhs, Tiler const &tiler) {
+  return SwizzledLayout{lhs.swizzle, lhs.offset, composition(lhs.layout, tiler)};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Complement
+//
+
+/// Layout of the indices in [0, size(cotarget)) not reached by layout, ordered as in CuTe
+/// @post result(i) != layout(j) for all 0 < i < size(result), 0 <= j < size(layout)
+inline Layout complement(Layout const &layout, IntTuple const &cotarget) {
+  Context &ctx = detail::context_of(layout);
+  detail::context_of(layout.shape, cotarget);
+  return ctx.memoize(Context::Op::kComplement, layout.shape, layout.stride, cotarget, IntTuple(), [&] {
+    Layout filtered = filter(layout);
+    std::vector<int64_t> shape = flatten_values(filtered.shape);
+    std::vector<int64_t> stride = flatten_values(filtered.stride);
+
+    if (filtered.stride.is_integral() && filtered.stride.value() == 0) {
+      // Irreducible rank-1 stride-0 layout
+      return make_layout(ctx.make_int(cotarget.product()));
+    }
+
+    // Repeatedly take the mode with the smallest stride
+    std::vector<int64_t> result_shape;
+    std::vector<int64_t> result_stride{1};
+    while (true) {
+      size_t min_idx = size_t(std::min_element(stride.begin(), stride.end()) - stride.begin());
+      int64_t min_stride = stride[min_idx];
+      int64_t new_shape = min_stride / result_stride.back();
+      if (new_shape == 0) {
+        throw std::invalid_argument("complement: non-injective layout");
+      }
+      result_shape.push_back(new_shape);
+      int64_t new_stride = min_stride * shape[min_idx];
+      if (shape.size() == 1) {
+        // Append the rest of the cotarget after the last mode
+        IntTuple rest_shape = ceil_div(cotarget, new_stride);
+        std::vector<int64_t> rest = flatten_values(rest_shape);
+        std::vector<int64_t> rest_stride = flatten_values(compact_col_major(rest_shape, new_stride));
+        result_shape.insert(result_shape.end(), rest.begin(), rest.end());
+        result_stride.insert(result_stride.end(), rest_stride.begin(), rest_stride.end());
+        break;
+      }
+      result_stride.push_back(new_stride);
+      shape.erase(shape.begin() + min_idx);
+      stride.erase(stride.begin() + min_idx);
+    }
+
+    return coalesce(Layout{ctx.make_tuple(result_shape), ctx.make_tuple(result_stride)});
+  });
+}
+
+inline Layout complement(Layout const &layout, int64_t cotarget) {
+  return complement(layout, detail::context_of(layout).make_int(cotarget));
+}
+
+/// Complement within the cosize of the layout
+inline Layout complement(Layout const &layout) {
+  return complement(layout, cosize(filter(layout)));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Right-inverse and left-inverse
+//
+
+namespace detail {
+
+struct FlatModes {
+  std::vector<int64_t> shape;
+  std::vector<int64_t> stride;
+  std::vector<int64_t> prefix;      ///< exclusive prefix product of shape
+  std::vector<size_t> by_stride;    ///< mode indices in ascending order of stride
+};
+
+inline FlatModes sorted_modes(Layout const &clayout) {
+  FlatModes m;
+  m.shape = flatten_values(clayout.shape);
+  m.stride = flatten_values(clayout.stride);
+  int64_t p = 1;
+  for (size_t i = 0; i < m.shape.size(); ++i) {
+    m.prefix.push_back(p);
+    p *= m.shape[i];
+    m.by_stride.push_back(i);
+  }
+  std::stable_sort(m.by_stride.begin(), m.by_stride.end(),
+                   [&](size_t a, size_t b) { return m.stride[a] < m.stride[b]; });
+  return m;
+}
+
+} // namespace detail
+
+/// @post layout(result(i)) == i for all 0 <= i < size(result)
+inline Layout right_inverse(Layout const &layout) {
+  Context &ctx = detail::context_of(layout);
+  return ctx.memoize(Context::Op::kRightInverse, layout.shape, layout.stride, IntTuple(), IntTuple(), [&] {
+    detail::FlatModes m = detail::sorted_modes(coalesce(layout));
+    std::vector<int64_t> result_shape{1}, result_stride{0};
+    int64_t curr = 1;
+    for (size_t i : m.by_stride) {
+      if (m.stride[i] == curr) {
+        result_shape.push_back(m.shape[i]);
+        result_stride.push_back(m.prefix[i]);
+        curr = m.shape[i] * m.stride[i];
+      }
+    }
+    return coalesce(Layout{ctx.make_tuple(result_shape), ctx.make_tuple(result_stride)});
+  });
+}
+
+/// Quasi-inverse; the left-inverse when layout is injective
+/// @post layout(result(layout(i))) == layout(i) for all 0 <= i < size(layout)
+inline Layout left_inverse(Layout const &layout) {
+  Context &ctx = detail::context_of(layout);
+  return ctx.memoize(Context::Op::kLeftInverse, layout.shape, layout.stride, IntTuple(), IntTuple(), [&] {
+    detail::FlatModes m = detail::sorted_modes(coalesce(layout));
+    std::vector<int64_t> result_shape, result_stride{0};
+    int64_t result_size = 1;
+    for (size_t i : m.by_stride) {
+      if (m.stride[i] == 0) {
+        continue;
+      }
+      if (m.stride[i] % result_size != 0) {
+        throw std::invalid_argument("left_inverse: divisibility condition violated");
+      }
+      result_shape.push_back(m.stride[i] / result_size);
+      result_stride.push_back(m.prefix[i]);
+      result_size *= result_shape.back();
+    }
+    result_shape.push_back(m.shape[m.by_stride.back()]);
+    return coalesce(Layout{ctx.make_tuple(result_shape), ctx.make_tuple(result_stride)});
+  });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Divide and product
+//
+
+/// Splits layout into (tile, rest) by composition with (tiler, complement(tiler))
+inline Layout logical_divide(Layout const &layout, Layout const &tiler) {
+  Context &ctx = detail::context_of(layout);
+  return ctx.memoize(Context::Op::kLogicalDivide, layout.shape, layout.stride, tiler.shape, tiler.stride, [&] {
+    return composition(layout, make_layout(tiler, complement(tiler, coalesce(layout).shape)));
+  });
+}
+
+inline Layout logical_divide(Layout const &layout, int64_t tile) {
+  return logical_divide(layout, make_layout(detail::context_of(layout).make_int(tile)));
+}
+
+/// Mode-by-mode logical_divide; modes not covered by the tiler are kept
+inline Layout logical_divide(Layout const &layout, Tiler const &tiler) {
+  return detail::transform_layout(layout, tiler, [](Layout const &l, Layout const &t) { return logical_divide(l, t); });
+}
+
+/// Reproduces block over the layout of tiler: (block, rest)
+inline Layout logical_product(Layout const &block, Layout const &tiler) {
+  Context &ctx = detail::context_of(block);
+  return ctx.memoize(Context::Op::kLogicalProduct, block.shape, block.stride, tiler.shape, tiler.stride, [&] {
+    return make_layout(block, composition(complement(block, size(block) * cosize(tiler)), tiler));
+  });
+}
+
+/// Mode-by-mode logical_product; modes not covered by the tiler are kept
+inline Layout logical_product(Layout const &block, Tiler const &tiler) {
+  return detail::transform_layout(block, tiler, [](Layout const &l, Layout const &t) { return logical_product(l, t); });
+}
+
+namespace detail {
+
+/// Gathers the rank-2 modes (tile_i, rest_i) of a mode-by-mode divide or product into
+/// ((tile_0,tile_1,...),(rest_0,rest_1,...,remaining modes))
+inline Layout tile_unzip(Layout const &layout, size_t tiler_rank) {
+  std::vector<Layout> tiles, rests;
+  for (int i = 0; i < layout.rank(); ++i) {
+    if (size_t(i) < tiler_rank) {
+      tiles.push_back(layout[i][0]);
+      rests.push_back(layout[i][1]);
+    } else {
+      rests.push_back(layout[i]);
+    }
+  }
+  return make_layout(make_layout(tiles), make_layout(rests));
+}
+
+/// (A, (b0, b1, ...)) -> (A, b0, b1, ...)
+inline Layout unpack_rest(Layout const &layout) {
+  std::vector<Layout> modes{layout[0]};
+  Layout rest = layout[1];
+  for (int i = 0; i < rest.rank(); ++i) {
+    modes.push_back(rest[i]);
+  }
+  return make_layout(modes);
+}
+
+} // namespace detail
+
+/// ((tile),(rest))
+inline Layout zipped_divide(Layout const &layout, Layout const &tiler) {
+  return logical_divide(layout, tiler);
+}
+
+/// ((tile_0,tile_1,...),(rest_0,rest_1,...))
+inline Layout zipped_divide(Layout const &layout, Tiler const &tiler) {
+  return detail::tile_unzip(logical_divide(layout, tiler), tiler.size());
+}
+
+/// ((tile_0,tile_1,...),rest_0,rest_1,...)
+inline Layout tiled_divide(Layout const &layout, Tiler const &tiler) {
+  return detail::unpack_rest(zipped_divide(layout, tiler));
+}
+
+inline Layout zipped_product(Layout const &block, Layout const &tiler) {
+  return logical_product(block, tiler);
+}
+
+inline Layout zipped_product(Layout const &block, Tiler const &tiler) {
+  return detail::tile_unzip(logical_product(block, tiler), tiler.size());
+}
+
+inline Layout tiled_product(Layout const &block, Tiler const &tiler) {
+  return detail::unpack_rest(zipped_product(block, tiler));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Conversion from static CuTe types
+//
+
+/// IntTuple with the values of a cute IntTuple (static or dynamic)
+template <class T>
+IntTuple make_int_tuple(Context &ctx, T const &t) {
+  if constexpr (cute::is_tuple<T>::value) {
+    std::vector<IntTuple> elements;
+    cute::for_each(t, [&](auto const &e) { elements.push_back(make_int_tuple(ctx, e)); });
+    return ctx.make_tuple(elements);
+  } else {
+    return ctx.make_int(int64_t(t));
+  }
+}
+
+template <class Shape, class Stride>
+Layout make_layout(Context &ctx, cute::Layout<Shape, Stride> const &layout) {
+  return make_layout(make_int_tuple(ctx, layout.shape()), make_int_tuple(ctx, layout.stride()));
+}
+
+template <int B, int M, int S>
+Swizzle make_swizzle(cute::Swizzle<B, M, S> const &) {
+  return Swizzle(B, M, S);
+}
+
+template <int B, int M, int S, class Offset, class Shape, class Stride>
+SwizzledLayout make_layout(Context &ctx,
+                           cute::ComposedLayout<cute::Swizzle<B, M, S>, Offset, cute::Layout<Shape, Stride>> const &layout) {
+  return SwizzledLayout{Swizzle(B, M, S), int64_t(layout.offset()), make_layout(ctx, layout.layout_b())};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace dynamic_layout
+} // namespace cutlass
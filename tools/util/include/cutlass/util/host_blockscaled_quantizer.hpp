@@ -0,0 +1,332 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Multithreaded host quantizer for block-scaled (MX and NV) GEMM operands.
+
+    Converts a dense float or bfloat16 tensor to narrow data elements (e.g. float_e2m1_t) and one
+    scale factor (float_ue4m3_t or float_ue8m0_t) per SFVecSize consecutive elements along K. Scale
+    factors are written directly in the interleaved layouts of
+    Sm1xxBlockScaledConfig::tile_atom_to_shape_SFA() and tile_atom_to_shape_SFB(), and are computed
+    as in compute_1d_scaling_factor_and_quantized_output() of the host GETT reference, without its
+    tiling: each vector is scaled so that its largest magnitude maps to the largest data value.
+
+    Rows are quantized independently across host threads in blocks of 128, the rows covered by one
+    scale factor atom. Sub-byte data whose blocks do not each start on a byte of their own (e.g.
+    K-major batches of odd MN*K) is quantized on a single thread instead. Each row is converted to
+    float, scaled and quantized in loops over K that the compiler vectorizes: float_e2m1_t data is
+    encoded by comparison against its rounding thresholds and, in K-major tensors, packed two
+    elements per byte.
+*/
+
+#pragma once
+
+#include <algorithm>                           // std::min, std::max, std::fill
+#include <cmath>                               // std::fabs
+#include <cstdint>                             // int64_t, uint8_t, uint32_t
+#include <cstring>                             // std::memcpy
+#include <limits>                              // std::numeric_limits
+#include <numeric>                             // std::gcd
+#include <vector>                              // std::vector
+
+#include "cute/tensor.hpp"                     // cute::Tensor, cute::size, cute::stride
+#include "cutlass/cutlass.h"
+#include "cutlass/detail/sm100_blockscaled_layout.hpp" // cutlass::detail::Sm1xxBlockScaledConfig
+#include "cutlass/numeric_conversion.h"        // cutlass::NumericConverter
+#include "cutlass/numeric_types.h"             // cutlass::float_e2m1_t, cutlass::float_ue8m0_t
+
+#include "cutlass/util/reference/detail/host_parallel_for.h" // host_worker_count, host_parallel_for
+
+namespace cutlass {
+
+template<
+  class ElementData_,
+  class ElementSF_,
+  int SFVecSize_
+>
+class HostBlockScaledQuantizer {
+public:
+  using ElementData = ElementData_;
+  using ElementSF = ElementSF_;
+  static constexpr int SFVecSize = SFVecSize_;
+
+  /// Provides tile_atom_to_shape_SFA() and tile_atom_to_shape_SFB() for the scale factor tensors
+  using SfConfig = cutlass::detail::Sm1xxBlockScaledConfig<SFVecSize>;
+
+  static_assert(SFVecSize == 16 || SFVecSize == 32, "HostBlockScaledQuantizer supports vectors of 16 or 32 elements");
+
+  /// Rows quantized together by one host thread: the rows of one scale factor atom, so that no
+  /// atom is written by two threads. Bytes of sub-byte data are shared by two blocks only in
+  /// layouts where a block starts inside a byte, which quantize() then processes serially.
+  static constexpr int kRowsPerBlock = 128;
+
+  /// Alignment in elements of a byte boundary of the data
+  static constexpr int kElementsPerByteBoundary = 8 / std::gcd(cute::sizeof_bits_v<ElementData>, 8);
+
+  /// Minimum elements quantized per host thread before additional threads are used
+  static constexpr int64_t kMinElementsPerThread = int64_t(1) << 16;
+
+  /// True if data elements are converted by the threshold fast path
+  static constexpr bool kIsFp4 = cute::is_same_v<ElementData, cutlass::float_e2m1_t>;
+
+public:
+
+  /// `thread_count` bounds the host threads used per call (0 selects std::thread::hardware_concurrency())
+  explicit HostBlockScaledQuantizer(int thread_count = 0) : thread_count_(thread_count) {}
+
+  /// Quantizes the (MN,K,L) tensor `src` to `data` of the same shape, and writes the scale factor
+  /// of element (mn,k,l) to `sf(mn,k,l)`. `sf` is typically laid out by
+  /// SfConfig::tile_atom_to_shape_SFA() (or _SFB()); its padding past MN and K is zero filled.
+  ///
+  /// `global_scale` is the `st` of the GETT reference: scale factors hold amax * st / max(ElementData)
+  /// and data holds src * st / sf.
+  template <class TensorSrc, class TensorData, class TensorSF>
+  void
+  quantize(TensorSrc const& src, TensorData&& data, TensorSF&& sf, float global_scale = 1.0f) const {
+    int const MN = int(cute::size<0>(src));
+    int const K  = int(cute::size<1>(src));
+    int const L  = int(cute::size<2>(src));
+    int const MN_sf = int(cute::size<0>(sf));
+    int const K_sf  = int(cute::size<1>(sf));
+    int const vector_count = cutlass::ceil_div(K, SFVecSize);
+
+    float const scale_down = global_scale * (1.0f / float(std::numeric_limits<ElementData>::max()));
+
+    bool const parallel = blocks_are_byte_aligned(data.layout(), MN, K, L);
+
+    for_each_block(MN_sf, K, L, parallel, [&](int mn0, int mn1, int l) {
+      // One row at a time, padded with zeros to whole vectors, so that each step is a loop over K
+      std::vector<float> row(size_t(vector_count) * SFVecSize);
+      std::vector<float> row_scale(vector_count);
+      std::vector<uint8_t> codes(kIsFp4 ? row.size() : 0);
+
+      for (int mn = mn0; mn < mn1; ++mn) {
+        if (mn >= MN) {
+          for (int k0 = 0; k0 < K_sf; k0 += SFVecSize) {
+            sf(mn, k0, l) = ElementSF{0};
+          }
+          continue;
+        }
+        load_row(src, mn, l, K, row.data(), int(row.size()));
+
+        for (int vector = 0; vector < vector_count; ++vector) {
+          float const* values = row.data() + vector * SFVecSize;
+          // Largest magnitude of the vector, with NaN propagation
+          float amax = 0.0f;
+          bool has_nan = false;
+          for (int v = 0; v < SFVecSize; ++v) {
+            amax = std::max(amax, std::fabs(values[v]));
+            has_nan |= values[v] != values[v];
+          }
+          if (has_nan) {
+            amax = std::numeric_limits<float>::quiet_NaN();
+          }
+
+          ElementSF const scale = static_cast<ElementSF>(amax * scale_down);
+          sf(mn, vector * SFVecSize, l) = scale;
+
+          // Map INF (a zero scale factor) to the largest float; std::min keeps a NaN first argument
+          float const scale_rcp = global_scale * (1.0f / NumericConverter<float, ElementSF>{}(scale));
+          row_scale[vector] = std::min(scale_rcp, std::numeric_limits<float>::max());
+        }
+        for (int k0 = vector_count * SFVecSize; k0 < K_sf; k0 += SFVecSize) {
+          sf(mn, k0, l) = ElementSF{0};
+        }
+
+        for (int vector = 0; vector < vector_count; ++vector) {
+          for (int v = 0; v < SFVecSize; ++v) {
+            row[vector * SFVecSize + v] *= row_scale[vector];
+          }
+        }
+        store_row(data, mn, l, K, row.data(), codes.data());
+      }
+    });
+  }
+
+  /// Reconstructs `dst` = data * sf / global_scale from the outputs of quantize()
+  template <class TensorData, class TensorSF, class TensorDst>
+  void
+  dequantize(TensorData const& data, TensorSF const& sf, TensorDst&& dst, float global_scale = 1.0f) const {
+    using ElementDst = typename cute::remove_cvref_t<TensorDst>::value_type;
+    using Storage = cute::uint_bit_t<cute::sizeof_bits_v<ElementData>>;
+    int const MN = int(cute::size<0>(data));
+    int const K  = int(cute::size<1>(data));
+    int const L  = int(cute::size<2>(data));
+
+    // Data elements are decoded by lookup of their encoding
+    float values[1 << cute::sizeof_bits_v<ElementData>];
+    for (int code = 0; code < int(sizeof(values) / sizeof(float)); ++code) {
+      values[code] = NumericConverter<float, ElementData>{}(ElementData::bitcast(Storage(code)));
+    }
+    float const scale_down = 1.0f / global_scale;
+
+    for_each_block(MN, K, L, true, [&](int mn0, int mn1, int l) {
+      NumericConverter<ElementDst, float> to_dst;
+      for (int mn = mn0; mn < mn1; ++mn) {
+        for (int k0 = 0; k0 < K; k0 += SFVecSize) {
+          float const scale = NumericConverter<float, ElementSF>{}(sf(mn, k0, l)) * scale_down;
+          int const count = std::min(SFVecSize, K - k0);
+          for (int v = 0; v < count; ++v) {
+            dst(mn, k0 + v, l) = to_dst(values[ElementData(data(mn, k0 + v, l)).raw()] * scale);
+          }
+        }
+      }
+    });
+  }
+
+  /// Converts a float to the bits of a float_e2m1_t, rounding to nearest even and saturating to
+  /// +-6 as NumericConverter does. Branch-free, so that loops over it vectorize.
+  static uint8_t
+  quantize_e2m1(float x) {
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    float const a = std::fabs(x);
+    // Ties round to the even code: 0.25 -> 0, 0.75 -> 1.0, 1.25 -> 1.0, 1.75 -> 2, 2.5 -> 2, 3.5 -> 4, 5 -> 4
+    uint32_t code = uint32_t(a > 0.25f) + uint32_t(a >= 0.75f) + uint32_t(a > 1.25f) + uint32_t(a >= 1.75f)
+                  + uint32_t(a > 2.5f) + uint32_t(a >= 3.5f) + uint32_t(a > 5.0f);
+    // NaN fails every comparison above and saturates to the largest code, as in NumericConverter
+    code |= uint32_t(a != a) * 7u;
+    return uint8_t(((bits >> 28) & 0x8u) | code);
+  }
+
+private:
+
+  /// Invokes `fn(mn_begin, mn_end, l)` on blocks of kRowsPerBlock rows, across host threads if
+  /// `parallel` is true
+  template <class Fn>
+  void
+  for_each_block(int MN, int K, int L, bool parallel, Fn&& fn) const {
+    int const blocks_per_batch = cutlass::ceil_div(MN, kRowsPerBlock);
+    int64_t const block_count = int64_t(blocks_per_batch) * L;
+    int const workers = parallel ? reference::host::detail::host_worker_count(
+      thread_count_, int64_t(MN) * K * L, kMinElementsPerThread) : 1;
+
+    reference::host::detail::host_parallel_for(workers, block_count, [&](int64_t block_begin, int64_t block_end) {
+      for (int64_t block = block_begin; block < block_end; ++block) {
+        int const l = int(block / blocks_per_batch);
+        int const mn0 = int(block % blocks_per_batch) * kRowsPerBlock;
+        fn(mn0, std::min(mn0 + kRowsPerBlock, MN), l);
+      }
+    });
+  }
+
+  /// Returns true if no byte of data in `layout` holds elements of two blocks of rows. Rows of
+  /// K-major data (columns of MN-major data) are runs of consecutive elements; a byte is shared by
+  /// two blocks only if a run starting inside a byte follows a run of another block, which cannot
+  /// happen when runs are packed back to back or each start on a byte boundary, and every block
+  /// starts on a byte boundary.
+  template <class Layout>
+  static bool
+  blocks_are_byte_aligned(Layout const& layout, int MN, int K, int L) {
+    if constexpr (kElementsPerByteBoundary == 1) {
+      return true;
+    }
+    else {
+      int64_t const origin = int64_t(layout(0, 0, 0));
+      int64_t const mn_step = MN > 1 ? int64_t(layout(1, 0, 0)) - origin : K;
+      int64_t const k_step  = K > 1  ? int64_t(layout(0, 1, 0)) - origin : MN;
+
+      bool const runs_aligned =
+        (k_step == 1 && (mn_step == K || mn_step % kElementsPerByteBoundary == 0)) ||
+        (mn_step == 1 && (k_step == MN || k_step % kElementsPerByteBoundary == 0));
+      if (!runs_aligned) {
+        return false;
+      }
+
+      for (int l = 0; l < L; ++l) {
+        for (int mn0 = 0; mn0 < MN; mn0 += kRowsPerBlock) {
+          if (int64_t(layout(mn0, 0, l)) % kElementsPerByteBoundary != 0) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+  }
+
+  /// Loads the `K` elements of row `mn` to float, padding the row with zeros up to `K_padded`
+  template <class TensorSrc>
+  static void
+  load_row(TensorSrc const& src, int mn, int l, int K, float* row, int K_padded) {
+    using ElementSrc = typename cute::remove_cvref_t<TensorSrc>::value_type;
+    NumericConverter<float, ElementSrc> to_float;
+    if (cute::stride<1>(src) == 1) {
+      ElementSrc const* ptr = &src(mn, 0, l);
+      for (int k = 0; k < K; ++k) {
+        row[k] = to_float(ptr[k]);
+      }
+    }
+    else {
+      for (int k = 0; k < K; ++k) {
+        row[k] = to_float(src(mn, k, l));
+      }
+    }
+    std::fill(row + K, row + K_padded, 0.0f);
+  }
+
+  /// Stores the `K` scaled values of `row` to row `mn` of `data`
+  template <class TensorData>
+  static void
+  store_row(TensorData& data, int mn, int l, int K, float const* row, uint8_t* codes) {
+    if constexpr (kIsFp4) {
+      for (int k = 0; k < K; ++k) {
+        codes[k] = quantize_e2m1(row[k]);
+      }
+
+      // K-major rows starting on a byte are packed directly, two elements per byte
+      int64_t const offset = int64_t(data.layout()(mn, 0, l));
+      if (cute::stride<1>(data) == 1 && offset % 2 == 0) {
+        auto* bytes = reinterpret_cast<uint8_t*>(cute::raw_pointer_cast(data.data())) + offset / 2;
+        for (int k = 0; k < K / 2; ++k) {
+          bytes[k] = uint8_t(codes[2 * k] | (codes[2 * k + 1] << 4));
+        }
+        if (K % 2 != 0) {
+          data(mn, K - 1, l) = ElementData::bitcast(codes[K - 1]);
+        }
+      }
+      else {
+        for (int k = 0; k < K; ++k) {
+          data(mn, k, l) = ElementData::bitcast(codes[k]);
+        }
+      }
+    }
+    else {
+      NumericConverter<ElementData, float> to_data;
+      for (int k = 0; k < K; ++k) {
+        data(mn, k, l) = to_data(row[k]);
+      }
+    }
+  }
+
+  int thread_count_ = 0;
+};
+
+} // namespace cutlass
@@ -31,24 +31,247 @@
 
 /*! \file
     \brief reorder data from the host side 
+
+    The reorderings are expressed as a map from each element of a rows x columns source domain to
+    a destination offset. The domain is traversed by recursively halving its longer side, so both
+    the source and the destination are accessed in cache-sized tiles whatever their layouts, and
+    the outermost stripes run on separate host threads. Sub-byte elements are packed into the
+    destination bytes with bit operations; when several threads write them, they do so through
+    atomic words holding a packed copy of the destination.
+
+    Destination offsets outside the destination tensor are reported as
+    Status::kErrorInvalidProblem.
 */
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "cute/tensor.hpp"
+
 #include "cutlass/coord.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/tensor_view.h"
 #include "cutlass/util/tensor_view_io.h"
 #include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/detail/host_parallel_for.h"
 
 namespace cutlass {
 
+namespace detail {
+
+/// Invokes `fn(i, j)` for each (i, j) in [row_begin, row_end) x [column_begin, column_end),
+/// recursively halving the longer side until a tile holds at most 32 x 32 elements.
+template <typename Fn>
+void host_reorder_visit(
+  int64_t row_begin, int64_t row_end,
+  int64_t column_begin, int64_t column_end,
+  Fn &fn) {
+
+  constexpr int64_t kTileElements = 32 * 32;
+
+  int64_t rows = row_end - row_begin;
+  int64_t columns = column_end - column_begin;
+
+  if (rows * columns <= kTileElements || rows == 1 || columns == 1) {
+    for (int64_t j = column_begin; j < column_end; ++j) {
+      for (int64_t i = row_begin; i < row_end; ++i) {
+        fn(i, j);
+      }
+    }
+    return;
+  }
+
+  if (rows >= columns) {
+    int64_t row_mid = row_begin + rows / 2;
+    host_reorder_visit(row_begin, row_mid, column_begin, column_end, fn);
+    host_reorder_visit(row_mid, row_end, column_begin, column_end, fn);
+  }
+  else {
+    int64_t column_mid = column_begin + columns / 2;
+    host_reorder_visit(row_begin, row_end, column_begin, column_mid, fn);
+    host_reorder_visit(row_begin, row_end, column_mid, column_end, fn);
+  }
+}
+
+/// Invokes `fn(i, j)` for each (i, j) in [0, rows) x [0, columns), splitting the longer side into
+/// one stripe per worker.
+template <typename Fn>
+void host_reorder_for_each(int64_t rows, int64_t columns, int thread_count, Fn fn) {
+
+  using cutlass::reference::host::detail::host_parallel_for;
+  using cutlass::reference::host::detail::host_worker_count;
+
+  int workers = host_worker_count(thread_count, rows * columns, int64_t(1) << 16);
+
+  if (rows >= columns) {
+    host_parallel_for(workers, rows, [&](int64_t row_begin, int64_t row_end) {
+      host_reorder_visit(row_begin, row_end, 0, columns, fn);
+    });
+  }
+  else {
+    host_parallel_for(workers, columns, [&](int64_t column_begin, int64_t column_end) {
+      host_reorder_visit(0, rows, column_begin, column_end, fn);
+    });
+  }
+}
+
+/// Destination of sub-byte elements packed back to back in bytes: element `offset` occupies bits
+/// [offset * kBits, (offset + 1) * kBits) of the byte array, and may straddle two bytes.
+template <typename Element>
+struct HostReorderPackedBits {
+
+  static constexpr int kBits = sizeof_bits<Element>::value;
+  static constexpr uint64_t kMask = (uint64_t(1) << kBits) - 1;
+
+  static_assert(kBits < 8 && sizeof(Element) == 1, "Sub-byte elements are stored in the low bits of a byte");
+
+  /// Bits of an element
+  static uint64_t code(Element const &value) {
+    uint8_t storage;
+    std::memcpy(&storage, &value, 1);
+    return storage & kMask;
+  }
+
+  /// Writes an element to its bits of `bytes`
+  static void write(uint8_t *bytes, int64_t offset, Element const &value) {
+    int64_t bit = offset * kBits;
+    uint8_t *ptr = bytes + bit / 8;
+    int shift = int(bit % 8);
+    uint64_t field = kMask << shift;
+    uint64_t bits = code(value) << shift;
+    ptr[0] = uint8_t((ptr[0] & ~field) | bits);
+    if (shift + kBits > 8) {
+      ptr[1] = uint8_t((ptr[1] & ~(field >> 8)) | (bits >> 8));
+    }
+  }
+
+  /// Writes an element to its bits of `words`, which threads may update concurrently as long as
+  /// they write distinct elements
+  static void write(std::atomic<uint32_t> *words, int64_t offset, Element const &value) {
+    int64_t bit = offset * kBits;
+    std::atomic<uint32_t> *ptr = words + bit / 32;
+    int shift = int(bit % 32);
+    uint64_t field = kMask << shift;
+    uint64_t bits = code(value) << shift;
+    ptr[0].fetch_and(~uint32_t(field), std::memory_order_relaxed);
+    ptr[0].fetch_or(uint32_t(bits), std::memory_order_relaxed);
+    if (shift + kBits > 32) {
+      ptr[1].fetch_and(~uint32_t(field >> 32), std::memory_order_relaxed);
+      ptr[1].fetch_or(uint32_t(bits >> 32), std::memory_order_relaxed);
+    }
+  }
+};
+
+/// Writes `src(i, j)` to the destination element `dst[dst_offset(i, j)]` for each (i, j) in
+/// [0, rows) x [0, columns). The destination map must be injective. Returns
+/// Status::kErrorInvalidProblem, without writing the offending elements, if any offset falls
+/// outside [0, dst_capacity).
+template <
+  typename Element,
+  typename SrcFn,
+  typename DstOffsetFn
+>
+Status host_reorder(
+  int64_t rows,
+  int64_t columns,
+  SrcFn src,
+  DstOffsetFn dst_offset,
+  Element *dst,
+  int64_t dst_capacity,
+  int thread_count) {
+
+  using cutlass::reference::host::detail::host_parallel_for;
+  using cutlass::reference::host::detail::host_worker_count;
+
+  if (rows <= 0 || columns <= 0) {
+    return Status::kSuccess;
+  }
+
+  std::atomic<bool> out_of_bounds(false);
+
+  auto in_bounds = [&](int64_t offset) {
+    if (offset < 0 || offset >= dst_capacity) {
+      out_of_bounds.store(true, std::memory_order_relaxed);
+      return false;
+    }
+    return true;
+  };
+
+  if constexpr (sizeof_bits<Element>::value >= 8) {
+    host_reorder_for_each(rows, columns, thread_count, [&](int64_t i, int64_t j) {
+      int64_t offset = dst_offset(i, j);
+      if (in_bounds(offset)) {
+        dst[offset] = src(i, j);
+      }
+    });
+  }
+  else {
+    using Packed = HostReorderPackedBits<Element>;
+
+    uint8_t *dst_bytes = reinterpret_cast<uint8_t *>(dst);
+    int64_t bytes = (dst_capacity * Packed::kBits + 7) / 8;
+
+    if (host_worker_count(thread_count, rows * columns, int64_t(1) << 16) == 1) {
+      host_reorder_for_each(rows, columns, 1, [&](int64_t i, int64_t j) {
+        int64_t offset = dst_offset(i, j);
+        if (in_bounds(offset)) {
+          Packed::write(dst_bytes, offset, src(i, j));
+        }
+      });
+    }
+    else {
+      // Neighboring sub-byte elements share a byte, so threads pack them into atomic words holding
+      // a copy of the packed destination, which is then written back
+      int64_t word_count = (bytes + 3) / 4;
+      std::vector<std::atomic<uint32_t>> words(word_count);
+
+      int workers = host_worker_count(thread_count, word_count, int64_t(1) << 14);
+
+      host_parallel_for(workers, word_count, [&](int64_t word_begin, int64_t word_end) {
+        for (int64_t w = word_begin; w < word_end; ++w) {
+          uint32_t word = 0;
+          for (int64_t b = 0; b < 4 && w * 4 + b < bytes; ++b) {
+            word |= uint32_t(dst_bytes[w * 4 + b]) << (8 * b);
+          }
+          words[w].store(word, std::memory_order_relaxed);
+        }
+      });
+
+      host_reorder_for_each(rows, columns, thread_count, [&](int64_t i, int64_t j) {
+        int64_t offset = dst_offset(i, j);
+        if (in_bounds(offset)) {
+          Packed::write(words.data(), offset, src(i, j));
+        }
+      });
+
+      host_parallel_for(workers, word_count, [&](int64_t word_begin, int64_t word_end) {
+        for (int64_t w = word_begin; w < word_end; ++w) {
+          uint32_t word = words[w].load(std::memory_order_relaxed);
+          for (int64_t b = 0; b < 4 && w * 4 + b < bytes; ++b) {
+            dst_bytes[w * 4 + b] = uint8_t(word >> (8 * b));
+          }
+        }
+      });
+    }
+  }
+
+  return out_of_bounds.load() ? Status::kErrorInvalidProblem : Status::kSuccess;
+}
+
+} // namespace detail
+
 /// This is needed for the interleaved integer tensor core kernels.  The purpose
 /// is to use skip the shared memory part in the epilogue.
 template <int Interleaved, typename Element, typename Layout>
-void reorder_column(TensorRef<Element, Layout> dest,
+Status reorder_column(TensorRef<Element, Layout> dest,
                     TensorRef<Element, Layout> src,
-                    cutlass::gemm::GemmCoord problem_size) {
+                    cutlass::gemm::GemmCoord problem_size,
+                    int thread_count = 0) {
   const int InstructionShapeCol = 8;
   // 4 threads per Quad
   const int ElementsPerThread = InstructionShapeCol / 4;
@@ -56,56 +279,138 @@ void reorder_column(TensorRef<Element, Layout> dest,
   const int ReorderedElementsPerThread =
       Interleaved / 4;
 
-  for (int n = 0; n < problem_size.n(); n++) {
-    for (int k = 0; k < problem_size.k(); k++) {
-      dest.at({k, (n / Interleaved) * Interleaved +
-                      ((n % ReorderedElementsPerThread) / ElementsPerThread) *
-                          InstructionShapeCol +
-                      ((n % Interleaved) / ReorderedElementsPerThread) *
-                          ElementsPerThread +
-                      (n % ElementsPerThread)}) = src.at({k, n});
-    }
-  }
+  auto dest_column = [=](int n) {
+    return (n / Interleaved) * Interleaved +
+           ((n % ReorderedElementsPerThread) / ElementsPerThread) *
+               InstructionShapeCol +
+           ((n % Interleaved) / ReorderedElementsPerThread) *
+               ElementsPerThread +
+           (n % ElementsPerThread);
+  };
+
+  return detail::host_reorder<Element>(
+    problem_size.k(), problem_size.n(),
+    [&](int64_t k, int64_t n) { return Element(src.at({int(k), int(n)})); },
+    [&](int64_t k, int64_t n) { return int64_t(dest.offset({int(k), dest_column(int(n))})); },
+    dest.data(),
+    int64_t(dest.layout().capacity({problem_size.k(), problem_size.n()})),
+    thread_count);
 }
 
 template <int ColumnInterleaved, int LayoutInterleaved = ColumnInterleaved, typename Element, typename Layout>
-void reorder_convK(TensorRef<Element, Layout> dest,
+Status reorder_convK(TensorRef<Element, Layout> dest,
                     TensorRef<Element, Layout> src,
-                    cutlass::gemm::GemmCoord problem_size) {
+                    cutlass::gemm::GemmCoord problem_size,
+                    int thread_count = 0) {
 
     TensorRef<Element, layout::RowMajorInterleaved<LayoutInterleaved>> mappedDest(dest.data(), dest.stride(0));
     TensorRef<Element, layout::RowMajorInterleaved<LayoutInterleaved>> mappedSrc(src.data(), src.stride(0));
     
-    reorder_column<ColumnInterleaved>(
-        mappedDest, mappedSrc, problem_size);
+    return reorder_column<ColumnInterleaved>(
+        mappedDest, mappedSrc, problem_size, thread_count);
 }
 
 /// This is needed for the sparse tensor core kernels.  The purpose
 /// is to use ldmatrix to load from shared memory to the register file.
 template <typename Element, typename LayoutDest, typename LayoutSrc>
-void reorder_meta(TensorRef<Element, LayoutDest> dest,
+Status reorder_meta(TensorRef<Element, LayoutDest> dest,
                   TensorRef<Element, LayoutSrc> src,
-                  cutlass::gemm::GemmCoord problem_size) {
-  for (int m = 0; m < problem_size.m(); m++) {
-    for (int k = 0; k < problem_size.k(); k++) {
-      // First reorder the rows.
-      int group = (sizeof(Element) == 2) ? 32 : 16;
-      int interweave = (sizeof(Element) == 2) ? 4 : 2;
-
-      int dest_row = m / group * group + (m % 8) * interweave + (m % group) / 8;
-      int dest_col = k;
-
-      // Next swizzle the 2x2 blocks from Z to N.
-      if (((dest_row % 2) == 0) && ((dest_col % 2) == 1)) {
-        ++dest_row;
-        --dest_col;
-      } else if (((dest_row % 2) == 1) && ((dest_col % 2) == 0)) {
-        --dest_row;
-        ++dest_col;
-      }
+                  cutlass::gemm::GemmCoord problem_size,
+                  int thread_count = 0) {
+
+  // First reorder the rows.
+  int const group = (sizeof(Element) == 2) ? 32 : 16;
+  int const interweave = (sizeof(Element) == 2) ? 4 : 2;
+
+  auto dest_coord = [=](int m, int k) {
+    int dest_row = m / group * group + (m % 8) * interweave + (m % group) / 8;
+    int dest_col = k;
 
-      dest.at({dest_row, dest_col}) = src.at({m, k});
+    // Next swizzle the 2x2 blocks from Z to N.
+    if (((dest_row % 2) == 0) && ((dest_col % 2) == 1)) {
+      ++dest_row;
+      --dest_col;
+    } else if (((dest_row % 2) == 1) && ((dest_col % 2) == 0)) {
+      --dest_row;
+      ++dest_col;
     }
+
+    return MatrixCoord(dest_row, dest_col);
+  };
+
+  return detail::host_reorder<Element>(
+    problem_size.m(), problem_size.k(),
+    [&](int64_t m, int64_t k) { return Element(src.at({int(m), int(k)})); },
+    [&](int64_t m, int64_t k) { return int64_t(dest.offset(dest_coord(int(m), int(k)))); },
+    dest.data(),
+    int64_t(dest.layout().capacity({problem_size.m(), problem_size.k()})),
+    thread_count);
+}
+
+namespace reference {
+namespace host {
+
+/// Host counterpart of cutlass::reorder_tensor() in mixed_dtype_utils.hpp: D(i) = S(i) for each
+/// logical index i of two host tensors of equal size. The traversal is tiled over the first mode
+/// of D and the product of its remaining modes. Returns Status::kErrorInvalidProblem if the sizes
+/// of S and D differ.
+template <class EngineSrc, class LayoutSrc, class EngineDst, class LayoutDst>
+Status reorder_tensor(
+  cute::Tensor<EngineSrc, LayoutSrc> S,
+  cute::Tensor<EngineDst, LayoutDst> D,
+  int thread_count = 0)
+{
+  using T = typename EngineDst::value_type;
+  static_assert(cute::is_same_v<cute::remove_const_t<typename EngineSrc::value_type>, T>, "Type mismatch");
+  if (int64_t(cute::size(S)) != int64_t(cute::size(D))) {
+    return Status::kErrorInvalidProblem;
   }
+
+  int64_t rows = int64_t(cute::size<0>(D));
+  int64_t columns = rows > 0 ? int64_t(cute::size(D)) / rows : 0;
+
+  return cutlass::detail::host_reorder<T>(
+    rows, columns,
+    [&](int64_t i, int64_t j) { return T(S(i + j * rows)); },
+    [&](int64_t i, int64_t j) { return int64_t(D.layout()(i + j * rows)); },
+    cute::raw_pointer_cast(D.data()),
+    int64_t(cute::cosize(D.layout())),
+    thread_count);
 }
+
+template <class T, class LayoutSrc, class LayoutDst>
+Status reorder_tensor(
+  T const* src,
+  LayoutSrc const& layout_src,
+  T * dst,
+  LayoutDst const& layout_dst,
+  int thread_count = 0)
+{
+  using namespace cute;
+  return reorder_tensor(make_tensor(make_gmem_ptr<T>(src), layout_src),
+                 make_tensor(make_gmem_ptr<T>(dst), layout_dst),
+                 thread_count);
+}
+
+// In-place version
+template <class T, class LayoutSrc, class LayoutDst>
+Status reorder_tensor(
+  T * data,
+  LayoutSrc const& layout_src,
+  LayoutDst const& layout_dst,
+  int thread_count = 0)
+{
+  using namespace cute;
+  size_t bytes = (size_t(cosize(layout_dst)) * sizeof_bits<T>::value + 7) / 8;
+  std::vector<uint8_t> temp(bytes);
+  Status status = reorder_tensor(data, layout_src, reinterpret_cast<T *>(temp.data()), layout_dst, thread_count);
+  if (status == Status::kSuccess) {
+    std::memcpy(data, temp.data(), (size_t(size(layout_src)) * sizeof_bits<T>::value + 7) / 8);
+  }
+  return status;
+}
+
+} // namespace host
+} // namespace reference
+
 } // namespace cutlass
@@ -0,0 +1,457 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Multithreaded host compressor for structured sparse GEMM operands.
+
+    Produces the same compressed A and metadata E tensors as the device compressor in
+    cutlass/transform/kernel/sm90_sparse_gemm_compressor.hpp, in the layouts given by
+    SparseConfig::fill_layoutA() and SparseConfig::fill_layoutE(). Each chunk of A is encoded by a
+    single lookup of its nonzero mask in a table derived from the device kernel's rules, and rows
+    are compressed independently across host threads.
+
+    Inputs larger than host memory can be compressed in blocks of rows with compress_rows().
+*/
+
+#pragma once
+
+#include <algorithm>                           // std::min, std::max
+#include <array>                               // std::array
+#include <atomic>                              // std::atomic
+#include <cstdint>                             // int64_t, uint8_t
+#include <cstring>                             // std::memset
+#include <thread>                              // std::thread
+#include <vector>                              // std::vector
+
+#include "cute/numeric/numeric_types.hpp"      // cute::sizeof_bits_v, cute::uint_bit_t
+#include "cute/tensor.hpp"                     // cute::Layout, cute::stride
+#include "cutlass/cutlass.h"                   // cutlass::Status
+#include "cutlass/fast_math.h"                 // cutlass::ceil_div, cutlass::round_up
+#include "cutlass/gemm/gemm.h"                 // cutlass::TagToStrideA_t
+#include "cutlass/layout/matrix.h"             // cutlass::layout::RowMajor
+#include "cutlass/numeric_types.h"             // cutlass::has_negative_zero_v
+
+#include "cutlass/transform/kernel/sparse_gemm_compressor.hpp" // StructuredSparseCompressorUtility
+
+namespace cutlass {
+
+template<
+  class ProblemShape_,
+  class ElementA_,
+  class LayoutATag_,
+  class SparseConfig_
+>
+class HostStructuredSparseCompressor {
+public:
+  using SparseConfig = SparseConfig_;
+  using ProblemShape = ProblemShape_;
+
+  // * EltA
+  using ElementA = ElementA_;
+  using LayoutATag = LayoutATag_;
+  using StrideA = cutlass::gemm::TagToStrideA_t<LayoutATag>;
+  using ElementAMmaRaw = typename SparseConfig::ElementAMmaRaw;
+  using ElementAMmaRawUnit = cute::uint_bit_t<cute::sizeof_bits_v<ElementAMmaRaw>>;
+  using ElementASparsity = typename SparseConfig::ElementASparsity;
+
+  // * EltE
+  using ElementEMmaRaw = typename SparseConfig::ElementEMmaRaw;
+  using ElementEMmaSparsity = typename SparseConfig::ElementEMmaSparsity;
+  static constexpr int ElementEBitsPerChunk = typename SparseConfig::ElementEBitsPerChunk{};
+  static constexpr int ElementESparsityPerChunk = ElementEMmaSparsity{} / (cute::sizeof_bits_v<ElementEMmaRaw> / ElementEBitsPerChunk);
+
+  // * AtomE
+  using TensorEAtomK = typename SparseConfig::TensorEAtomK;
+
+  using Utility = cutlass::transform::kernel::StructuredSparseCompressorUtility<
+                    ProblemShape,
+                    ElementA,
+                    LayoutATag,
+                    SparseConfig>;
+
+  static constexpr int ElemsARawPerElementAMmaRaw = typename SparseConfig::ElemsARawPerElementAMmaRaw{};
+  static constexpr int LogicalElemsAPerChunk = typename SparseConfig::LogicalElemsAPerChunk{};
+  static constexpr int LogicalElemsAMmaRawPerChunk = cutlass::ceil_div(LogicalElemsAPerChunk, ElemsARawPerElementAMmaRaw);
+  static constexpr int PhysicalElemsAMmaRawPerChunk = cutlass::ceil_div(int(typename SparseConfig::PhysicalElemsAPerChunk{}), ElemsARawPerElementAMmaRaw);
+
+  // Nibble of a metadata row holding chunk `i` of the corresponding row of A is `i * OneChunkSizeE`
+  static constexpr int OneChunkSizeE = LogicalElemsAPerChunk / ElementESparsityPerChunk;
+  static constexpr int NumOneChunkK = cutlass::ceil_div(int(TensorEAtomK{}), LogicalElemsAPerChunk);
+
+  static_assert(ElemsARawPerElementAMmaRaw == 1 && cute::sizeof_bits_v<ElementA> == cute::sizeof_bits_v<ElementAMmaRaw>,
+    "HostStructuredSparseCompressor requires one ElementA per ElementAMmaRaw");
+  static_assert(cute::sizeof_bits_v<ElementA> % 8 == 0, "HostStructuredSparseCompressor requires byte-sized ElementA");
+  static_assert(cute::sizeof_bits_v<ElementEMmaRaw> == 8 && ElementEBitsPerChunk == 4,
+    "HostStructuredSparseCompressor expects 4-bit metadata chunks packed in bytes");
+
+  /// Rows of A compressed together by one host thread. Column-major A is read one column of
+  /// the block at a time, so that consecutive loads fall on the same cache lines.
+  static constexpr int kRowsPerBlock = 64;
+
+  /// Minimum elements of A compressed per host thread before additional threads are used
+  static constexpr int64_t kMinElementsPerThread = int64_t(1) << 18;
+
+  /// Encoding of one chunk of A, selected by the bit mask of its nonzero elements
+  struct ChunkEncoding {
+    // Position within the chunk of A of each compressed element, or -1 for a zero
+    int8_t source[PhysicalElemsAMmaRawPerChunk];
+    // Metadata bits of the chunk
+    uint8_t metadata;
+    // False if the chunk has more nonzero elements than the sparsity allows
+    bool valid;
+  };
+
+  using ChunkEncodingTable = std::array<ChunkEncoding, (1 << LogicalElemsAMmaRawPerChunk)>;
+
+public:
+
+  HostStructuredSparseCompressor() = default;
+
+  /// `thread_count` bounds the host threads used per call (0 selects std::thread::hardware_concurrency())
+  explicit HostStructuredSparseCompressor(ProblemShape problem_shape, int thread_count = 0) {
+    set_problem_size(problem_shape, thread_count);
+  }
+
+  void set_problem_size(ProblemShape problem_shape, int thread_count = 0) {
+    problem_shape_ = problem_shape;
+    M_ = cute::size<0>(problem_shape);
+    K_ = cute::size<2>(problem_shape);
+    L_ = cute::size<3>(problem_shape);
+
+    thread_count_ = thread_count > 0 ? thread_count : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+
+    auto layout_AC = SparseConfig::fill_layoutA(problem_shape);
+    auto layout_E = SparseConfig::fill_layoutE(problem_shape);
+
+    M_alignedA_ = cute::size<0>(layout_AC);
+    M_alignedE_ = cute::size<0>(layout_E);
+    K_physicalA_ = cute::size<1>(layout_AC) / ElementASparsity{};
+    K_physicalE_ = cute::size<1>(layout_E) / ElementEMmaSparsity{};
+
+    // Offsets are in units of the sparse element, i.e. of logical elements of the operand
+    stride_AC_m_ = int64_t(cute::stride<0>(layout_AC)) / ElementASparsity{};
+    stride_AC_k_ = int64_t(cute::stride<1,1>(layout_AC)) / ElementASparsity{};
+    stride_AC_l_ = int64_t(cute::stride<2>(layout_AC)) / ElementASparsity{};
+
+    // Metadata is tiled by TensorEAtom, so offsets along M and K are tabulated once per problem
+    offset_E_m_.resize(M_alignedE_);
+    for (int m = 0; m < M_alignedE_; ++m) {
+      offset_E_m_[m] = int64_t(layout_E(m, 0, 0));
+    }
+    offset_E_k_.resize(K_physicalE_);
+    for (int k = 0; k < K_physicalE_; ++k) {
+      offset_E_k_[k] = int64_t(layout_E(0, k * ElementEMmaSparsity{}, 0));
+    }
+    stride_E_l_ = int64_t(cute::stride<2>(layout_E));
+  }
+
+  static Status
+  can_implement(ProblemShape problem_shape) {
+    if (cute::size<2>(problem_shape) % LogicalElemsAPerChunk != 0) {
+      CUTLASS_TRACE_HOST("HostStructuredSparseCompressor CAN NOT IMPLEMENT: GemmK not multiplier of logical chunk size");
+      return Status::kErrorInvalidProblem;
+    }
+    return Status::kSuccess;
+  }
+
+  /// Compresses the whole (M,K,L) tensor A with strides `dA`, in units of ElementA.
+  ///
+  /// `ptr_ACompress` and `ptr_E` must hold Utility::get_compressed_tensor_A_bytes() and
+  /// Utility::get_tensor_E_bytes(); every byte of both, including the alignment padding, is written.
+  ///
+  /// Returns Status::kErrorInvalidProblem if a chunk of A has more nonzeros than the sparsity
+  /// allows. The contents of the compressed tensors are then unspecified.
+  Status
+  compress(void const* ptr_A, StrideA dA, void* ptr_ACompress, void* ptr_E) const {
+    return compress_range(static_cast<ElementAMmaRawUnit const*>(ptr_A), dA, 0, M_, 0, L_,
+                          static_cast<ElementAMmaRawUnit*>(ptr_ACompress), static_cast<uint8_t*>(ptr_E));
+  }
+
+  /// Compresses rows [m_begin, m_end) of batch `l` of A, where `ptr_A_rows` points to row
+  /// `m_begin` and `dA_rows` holds the strides of the block (the batch stride is unused).
+  /// Successive blocks of a tensor too large for host memory can thus be read, compressed and
+  /// released in turn, while the compressed tensors, a quarter of A with its metadata, stay resident.
+  ///
+  /// The call whose block ends at row M also writes the alignment padding rows of batch `l`.
+  Status
+  compress_rows(void const* ptr_A_rows, StrideA dA_rows, int m_begin, int m_end, int l,
+                void* ptr_ACompress, void* ptr_E) const {
+    if (m_begin < 0 || m_end > M_ || m_begin > m_end || l < 0 || l >= L_) {
+      return Status::kErrorInvalidProblem;
+    }
+    // Rebase the block so that it is addressed with global row indices
+    auto const* ptr_A = static_cast<ElementAMmaRawUnit const*>(ptr_A_rows) - int64_t(m_begin) * int64_t(cute::get<0>(dA_rows));
+    cute::get<2>(dA_rows) = 0;
+    return compress_range(ptr_A, dA_rows, m_begin, m_end, l, l + 1,
+                          static_cast<ElementAMmaRawUnit*>(ptr_ACompress), static_cast<uint8_t*>(ptr_E));
+  }
+
+  /// Table of the encodings of every nonzero mask of a chunk, following the device compressor:
+  /// nonzeros are packed in order, a chunk with a single nonzero element of fewer than 32 bits is
+  /// padded to two positions, and the metadata records the position of each packed element.
+  static constexpr ChunkEncodingTable
+  make_chunk_encoding_table() {
+    ChunkEncodingTable table{};
+    for (int mask = 0; mask < int(table.size()); ++mask) {
+      ChunkEncoding encoding{};
+      encoding.valid = true;
+      int non_zero_cnt = 0;
+      int non_zero_elt_log_idx[PhysicalElemsAMmaRawPerChunk] = {};
+      for (int elt_phy_idx = 0; elt_phy_idx < PhysicalElemsAMmaRawPerChunk; ++elt_phy_idx) {
+        encoding.source[elt_phy_idx] = -1;
+      }
+
+      for (int elt_log_idx = 0; elt_log_idx < LogicalElemsAMmaRawPerChunk; ++elt_log_idx) {
+        if (mask & (1 << elt_log_idx)) {
+          if (non_zero_cnt == PhysicalElemsAMmaRawPerChunk) {
+            encoding.valid = false;
+            break;
+          }
+          non_zero_elt_log_idx[non_zero_cnt] = elt_log_idx;
+          encoding.source[non_zero_cnt] = int8_t(elt_log_idx);
+          ++non_zero_cnt;
+        }
+      }
+
+      if constexpr (cute::sizeof_bits_v<ElementAMmaRawUnit> < 32 && PhysicalElemsAMmaRawPerChunk == 2) {
+        // i.e. [0 0 0 x] -> [(0) 0 0 x]
+        if (non_zero_cnt == 1 && non_zero_elt_log_idx[0] == 3) {
+          encoding.source[1] = encoding.source[0];
+          encoding.source[0] = -1;
+          non_zero_elt_log_idx[0] = 0;
+          non_zero_elt_log_idx[1] = 3;
+        }
+        // i.e. [0 x 0 0] -> [0 x 0 (0)]
+        else if (non_zero_cnt == 1) {
+          non_zero_elt_log_idx[1] = 3;
+        }
+      }
+
+      int metadata = 0;
+      for (int elt_phy_idx = 0; elt_phy_idx < PhysicalElemsAMmaRawPerChunk; ++elt_phy_idx) {
+        if constexpr (SparseConfig::IsTF32) {
+          metadata |= (non_zero_elt_log_idx[elt_phy_idx] == 0 ? 0b0100 : 0b1110) << (4 * elt_phy_idx);
+        }
+        else {
+          metadata |= non_zero_elt_log_idx[elt_phy_idx] << (2 * elt_phy_idx);
+        }
+      }
+      encoding.metadata = uint8_t(metadata & 0xF);
+      table[mask] = encoding;
+    }
+    return table;
+  }
+
+private:
+
+  /// Bits of an element that must be set for it to count as nonzero, so that -0 is treated as zero
+  static constexpr ElementAMmaRawUnit
+  nonzero_mask() {
+    if constexpr (has_negative_zero_v<ElementA>) {
+      return static_cast<ElementAMmaRawUnit>(~(ElementAMmaRawUnit{1} << (cute::sizeof_bits_v<ElementA> - 1)));
+    }
+    else {
+      return static_cast<ElementAMmaRawUnit>(~ElementAMmaRawUnit{0});
+    }
+  }
+
+  Status
+  compress_range(ElementAMmaRawUnit const* ptr_A, StrideA dA, int m_begin, int m_end, int l_begin, int l_end,
+                 ElementAMmaRawUnit* ptr_AC, uint8_t* ptr_E) const {
+    Status status = can_implement(problem_shape_);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    int blocks_per_batch = cutlass::ceil_div(m_end - m_begin, kRowsPerBlock);
+    int64_t block_count = int64_t(blocks_per_batch) * (l_end - l_begin);
+    int64_t elements = int64_t(m_end - m_begin) * K_ * (l_end - l_begin);
+    int workers = static_cast<int>(std::max<int64_t>(1,
+      std::min<int64_t>({thread_count_, elements / kMinElementsPerThread, block_count})));
+
+    std::atomic<bool> valid{true};
+    host_parallel_for(workers, block_count, [&](int64_t block_begin, int64_t block_end) {
+      std::vector<uint8_t> metadata(size_t(kRowsPerBlock) * K_physicalE_);
+      bool block_valid = true;
+      for (int64_t block = block_begin; block < block_end; ++block) {
+        int l = l_begin + int(block / blocks_per_batch);
+        int m0 = m_begin + int(block % blocks_per_batch) * kRowsPerBlock;
+        int m1 = std::min(m0 + kRowsPerBlock, m_end);
+        block_valid &= compress_block(ptr_A, dA, m0, m1, l, ptr_AC, ptr_E, metadata.data());
+      }
+      if (!block_valid) {
+        valid = false;
+      }
+    });
+
+    // Rows of the aligned tensors past the end of A
+    if (m_end == M_) {
+      for (int l = l_begin; l < l_end; ++l) {
+        for (int m = M_; m < M_alignedA_; ++m) {
+          for (int k = 0; k < K_physicalA_; ++k) {
+            ptr_AC[m * stride_AC_m_ + k * stride_AC_k_ + l * stride_AC_l_] = ElementAMmaRawUnit{0};
+          }
+        }
+        for (int m = M_; m < M_alignedE_; ++m) {
+          for (int k = 0; k < K_physicalE_; ++k) {
+            ptr_E[metadata_offset(m, k, l)] = 0;
+          }
+        }
+      }
+    }
+
+    return valid ? Status::kSuccess : Status::kErrorInvalidProblem;
+  }
+
+  /// Compresses rows [m0, m1) of batch l, staging the metadata of each row in `metadata`
+  bool
+  compress_block(ElementAMmaRawUnit const* ptr_A, StrideA dA, int m0, int m1, int l,
+                 ElementAMmaRawUnit* ptr_AC, uint8_t* ptr_E, uint8_t* metadata) const {
+    static constexpr ChunkEncodingTable table = make_chunk_encoding_table();
+    constexpr ElementAMmaRawUnit mask = nonzero_mask();
+
+    // The unit stride of A stays static, so that loads along it are contiguous to the compiler
+    auto const stride_m = cute::get<0>(dA);
+    auto const stride_k = cute::get<1>(dA);
+    ElementAMmaRawUnit const* ptr_A_batch = ptr_A + int64_t(l) * int64_t(cute::get<2>(dA));
+    ElementAMmaRawUnit* ptr_AC_batch = ptr_AC + l * stride_AC_l_;
+
+    int const chunk_count = K_ / LogicalElemsAPerChunk;
+    bool valid = true;
+
+    std::memset(metadata, 0, size_t(m1 - m0) * K_physicalE_);
+
+    auto compress_chunk = [&](int m, int chunk) {
+      ElementAMmaRawUnit const* src = ptr_A_batch + int64_t(m) * stride_m + int64_t(chunk) * LogicalElemsAMmaRawPerChunk * stride_k;
+      ElementAMmaRawUnit elem[LogicalElemsAMmaRawPerChunk];
+      int nonzeros = 0;
+      for (int i = 0; i < LogicalElemsAMmaRawPerChunk; ++i) {
+        elem[i] = src[i * stride_k];
+        nonzeros |= int((elem[i] & mask) != 0) << i;
+      }
+
+      ChunkEncoding const& encoding = table[nonzeros];
+      valid &= encoding.valid;
+
+      ElementAMmaRawUnit* dst = ptr_AC_batch + m * stride_AC_m_ + int64_t(chunk) * PhysicalElemsAMmaRawPerChunk * stride_AC_k_;
+      for (int i = 0; i < PhysicalElemsAMmaRawPerChunk; ++i) {
+        int source = encoding.source[i];
+        dst[i * stride_AC_k_] = source < 0 ? ElementAMmaRawUnit{0} : elem[source];
+      }
+
+      // Chunks are placed along K within each TensorEAtom-wide tile of the metadata row
+      int tile = chunk / NumOneChunkK;
+      int nibble = (chunk % NumOneChunkK) * OneChunkSizeE;
+      int byte = tile * (TensorEAtomK{} / ElementEMmaSparsity{}) + nibble / 2;
+      metadata[size_t(m - m0) * K_physicalE_ + byte] |= uint8_t(encoding.metadata << (4 * (nibble % 2)));
+    };
+
+    if constexpr (cute::is_same_v<LayoutATag, cutlass::layout::RowMajor>) {
+      for (int m = m0; m < m1; ++m) {
+        for (int chunk = 0; chunk < chunk_count; ++chunk) {
+          compress_chunk(m, chunk);
+        }
+      }
+    }
+    else {
+      for (int chunk = 0; chunk < chunk_count; ++chunk) {
+        for (int m = m0; m < m1; ++m) {
+          compress_chunk(m, chunk);
+        }
+      }
+    }
+
+    for (int m = m0; m < m1; ++m) {
+      // Padding of the compressed row up to the aligned K
+      for (int k = chunk_count * PhysicalElemsAMmaRawPerChunk; k < K_physicalA_; ++k) {
+        ptr_AC_batch[m * stride_AC_m_ + k * stride_AC_k_] = ElementAMmaRawUnit{0};
+      }
+      uint8_t const* row = metadata + size_t(m - m0) * K_physicalE_;
+      for (int k = 0; k < K_physicalE_; ++k) {
+        ptr_E[metadata_offset(m, k, l)] = row[k];
+      }
+    }
+
+    return valid;
+  }
+
+  /// Byte offset in E of byte `k` of metadata row `m` of batch `l`
+  int64_t
+  metadata_offset(int m, int k, int l) const {
+    return (offset_E_m_[m] + offset_E_k_[k] + l * stride_E_l_) / ElementEMmaSparsity{};
+  }
+
+  /// Splits [0, item_count) into `workers` contiguous ranges and invokes `fn(begin, end)` on
+  /// each, running all but the first on separate host threads.
+  template <typename Fn>
+  static void
+  host_parallel_for(int workers, int64_t item_count, Fn fn) {
+    if (workers <= 1 || item_count <= 1) {
+      fn(int64_t(0), item_count);
+      return;
+    }
+
+    auto range_begin = [&](int worker) {
+      return (item_count * worker) / workers;
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (int worker = 1; worker < workers; ++worker) {
+      threads.emplace_back(fn, range_begin(worker), range_begin(worker + 1));
+    }
+    fn(int64_t(0), range_begin(1));
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  ProblemShape problem_shape_{};
+  int M_{0};
+  int K_{0};
+  int L_{0};
+  int thread_count_{1};
+
+  int M_alignedA_{0};
+  int M_alignedE_{0};
+  int K_physicalA_{0};
+  int K_physicalE_{0};
+
+  int64_t stride_AC_m_{0};
+  int64_t stride_AC_k_{0};
+  int64_t stride_AC_l_{0};
+
+  std::vector<int64_t> offset_E_m_;
+  std::vector<int64_t> offset_E_k_;
+  int64_t stride_E_l_{0};
+};
+
+} // namespace cutlass
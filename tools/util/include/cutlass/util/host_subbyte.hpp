@@ -0,0 +1,355 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Bulk host operations on packed sub-byte data: fill, copy, generate, and conversion from
+    and to float.
+
+    Element-wise access to int4b_t, uint2b_t, float_e2m1_t and other sub-byte types goes through
+    SubbyteReference, which reads, masks and writes back the containing byte for every element.
+    These functions instead pack and unpack whole bytes in loops the compiler vectorizes, fill with
+    std::memset and copy with std::memcpy. They apply to types whose width divides 8; other sub-byte
+    types (e.g., the 6-bit floating-point types, whose elements straddle bytes) fall back to
+    SubbyteReference and types of 8 bits or more to plain loops, so callers need not distinguish.
+
+    Elements are addressed as in SubbyteReference: a pointer to the first byte and an offset in
+    elements. Overloads take cutlass::Array and cute::array_subbyte containers directly.
+*/
+
+#pragma once
+
+#include <algorithm>                           // std::fill, std::min
+#include <cstddef>                             // size_t
+#include <cstdint>                             // uint8_t
+#include <cstring>                             // std::memcpy, std::memset
+
+#include "cute/container/array_subbyte.hpp"    // cute::array_subbyte
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"                     // cutlass::Array
+#include "cutlass/numeric_conversion.h"        // cutlass::NumericConverter
+#include "cutlass/numeric_types.h"             // cutlass::sizeof_bits
+#include "cutlass/subbyte_reference.h"         // cutlass::ReferenceFactory
+
+namespace cutlass {
+
+/// Whether the bulk operations pack T a byte at a time
+template <class T>
+constexpr bool is_subbyte_packable_v =
+  sizeof_bits<T>::value < 8 && 8 % sizeof_bits<T>::value == 0 && sizeof(T) == 1;
+
+namespace detail {
+
+/// Packing and unpacking of the B-bit codes of a sub-byte type, kPerByte to a byte
+template <class T>
+struct SubbytePacking {
+  static constexpr int kBits = sizeof_bits<T>::value;
+  static constexpr int kPerByte = 8 / kBits;
+  static constexpr uint8_t kMask = uint8_t((1u << kBits) - 1);
+
+  /// Codes staged on the stack by the chunked operations
+  static constexpr size_t kChunk = 2048;
+
+  static uint8_t code(T const &x) {
+    return uint8_t(reinterpret_cast<uint8_t const &>(x) & kMask);
+  }
+
+  static T value(uint8_t code) {
+    T x;
+    reinterpret_cast<uint8_t &>(x) = code;
+    return x;
+  }
+
+  static uint8_t get(uint8_t const *src, size_t idx) {
+    return uint8_t((src[idx / kPerByte] >> (int(idx % kPerByte) * kBits)) & kMask);
+  }
+
+  static void set(uint8_t *dst, size_t idx, uint8_t code) {
+    int shift = int(idx % kPerByte) * kBits;
+    uint8_t &byte = dst[idx / kPerByte];
+    byte = uint8_t((byte & ~(kMask << shift)) | ((code & kMask) << shift));
+  }
+
+  /// Number of elements from `offset` up to the next byte boundary, at most `count`
+  static size_t head(size_t offset, size_t count) {
+    return std::min(count, size_t((kPerByte - offset % kPerByte) % kPerByte));
+  }
+
+  /// Writes `count` codes to the elements of `dst` starting at `offset`
+  static void pack(uint8_t *dst, size_t offset, uint8_t const *codes, size_t count) {
+    size_t i = head(offset, count);
+    for (size_t j = 0; j < i; ++j) {
+      set(dst, offset + j, codes[j]);
+    }
+
+    uint8_t *out = dst + (offset + i) / kPerByte;
+    size_t bytes = (count - i) / kPerByte;
+    uint8_t const *in = codes + i;
+    for (size_t b = 0; b < bytes; ++b) {
+      uint8_t byte = 0;
+      for (int j = 0; j < kPerByte; ++j) {
+        byte |= uint8_t((in[b * kPerByte + j] & kMask) << (j * kBits));
+      }
+      out[b] = byte;
+    }
+
+    for (i += bytes * kPerByte; i < count; ++i) {
+      set(dst, offset + i, codes[i]);
+    }
+  }
+
+  /// Reads `count` codes from the elements of `src` starting at `offset`
+  static void unpack(uint8_t *codes, uint8_t const *src, size_t offset, size_t count) {
+    size_t i = head(offset, count);
+    for (size_t j = 0; j < i; ++j) {
+      codes[j] = get(src, offset + j);
+    }
+
+    uint8_t const *in = src + (offset + i) / kPerByte;
+    size_t bytes = (count - i) / kPerByte;
+    uint8_t *out = codes + i;
+    for (size_t b = 0; b < bytes; ++b) {
+      uint8_t byte = in[b];
+      for (int j = 0; j < kPerByte; ++j) {
+        out[b * kPerByte + j] = uint8_t((byte >> (j * kBits)) & kMask);
+      }
+    }
+
+    for (i += bytes * kPerByte; i < count; ++i) {
+      codes[i] = get(src, offset + i);
+    }
+  }
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Sets `count` elements starting at element `offset` of `ptr` to `value`
+template <class T>
+void subbyte_fill(T *ptr, size_t count, T const &value, size_t offset = 0) {
+  if constexpr (is_subbyte_packable_v<T>) {
+    using Packing = detail::SubbytePacking<T>;
+    auto *bytes = reinterpret_cast<uint8_t *>(ptr);
+    uint8_t code = Packing::code(value);
+
+    size_t i = Packing::head(offset, count);
+    for (size_t j = 0; j < i; ++j) {
+      Packing::set(bytes, offset + j, code);
+    }
+
+    // Replicates the code across a byte: 0x11 * code for 4 bits, 0x55 * code for 2, 0xff * code for 1
+    uint8_t pattern = uint8_t(code * (0xff / Packing::kMask));
+    size_t full = (count - i) / Packing::kPerByte;
+    std::memset(bytes + (offset + i) / Packing::kPerByte, pattern, full);
+
+    for (i += full * Packing::kPerByte; i < count; ++i) {
+      Packing::set(bytes, offset + i, code);
+    }
+  }
+  else if constexpr (sizeof_bits<T>::value < 8) {
+    for (size_t i = 0; i < count; ++i) {
+      ReferenceFactory<T>::get(ptr, int64_t(offset + i)) = value;
+    }
+  }
+  else {
+    std::fill(ptr + offset, ptr + offset + count, value);
+  }
+}
+
+/// Copies `count` elements from element `src_offset` of `src` to element `dst_offset` of `dst`.
+/// The ranges must not overlap.
+template <class T>
+void subbyte_copy(T *dst, T const *src, size_t count, size_t dst_offset = 0, size_t src_offset = 0) {
+  if constexpr (is_subbyte_packable_v<T>) {
+    using Packing = detail::SubbytePacking<T>;
+    auto *out = reinterpret_cast<uint8_t *>(dst);
+    auto const *in = reinterpret_cast<uint8_t const *>(src);
+
+    if (dst_offset % Packing::kPerByte == src_offset % Packing::kPerByte) {
+      // Same position within a byte: whole bytes are copied as is
+      size_t i = Packing::head(dst_offset, count);
+      for (size_t j = 0; j < i; ++j) {
+        Packing::set(out, dst_offset + j, Packing::get(in, src_offset + j));
+      }
+      size_t full = (count - i) / Packing::kPerByte;
+      std::memcpy(out + (dst_offset + i) / Packing::kPerByte, in + (src_offset + i) / Packing::kPerByte, full);
+      for (i += full * Packing::kPerByte; i < count; ++i) {
+        Packing::set(out, dst_offset + i, Packing::get(in, src_offset + i));
+      }
+    }
+    else {
+      uint8_t codes[Packing::kChunk];
+      for (size_t i = 0; i < count; i += Packing::kChunk) {
+        size_t n = std::min(Packing::kChunk, count - i);
+        Packing::unpack(codes, in, src_offset + i, n);
+        Packing::pack(out, dst_offset + i, codes, n);
+      }
+    }
+  }
+  else if constexpr (sizeof_bits<T>::value < 8) {
+    for (size_t i = 0; i < count; ++i) {
+      ReferenceFactory<T>::get(dst, int64_t(dst_offset + i)) =
+        T(ReferenceFactory<T>::get(src, int64_t(src_offset + i)));
+    }
+  }
+  else {
+    std::copy(src + src_offset, src + src_offset + count, dst + dst_offset);
+  }
+}
+
+/// Sets `count` elements starting at element `offset` of `ptr` to successive results of
+/// `generator()`, which are converted to T. The generator is called in element order.
+template <class T, class Generator>
+void subbyte_generate(T *ptr, size_t count, Generator &&generator, size_t offset = 0) {
+  if constexpr (is_subbyte_packable_v<T>) {
+    using Packing = detail::SubbytePacking<T>;
+    auto *bytes = reinterpret_cast<uint8_t *>(ptr);
+    uint8_t codes[Packing::kChunk];
+    for (size_t i = 0; i < count; i += Packing::kChunk) {
+      size_t n = std::min(Packing::kChunk, count - i);
+      for (size_t j = 0; j < n; ++j) {
+        codes[j] = Packing::code(T(generator()));
+      }
+      Packing::pack(bytes, offset + i, codes, n);
+    }
+  }
+  else if constexpr (sizeof_bits<T>::value < 8) {
+    for (size_t i = 0; i < count; ++i) {
+      ReferenceFactory<T>::get(ptr, int64_t(offset + i)) = T(generator());
+    }
+  }
+  else {
+    for (size_t i = 0; i < count; ++i) {
+      ptr[offset + i] = T(generator());
+    }
+  }
+}
+
+/// Converts `count` floats to T with NumericConverter<T, float> and stores them starting at
+/// element `offset` of `dst`
+template <class T>
+void subbyte_from_float(T *dst, float const *src, size_t count, size_t offset = 0) {
+  NumericConverter<T, float> convert;
+  if constexpr (is_subbyte_packable_v<T>) {
+    using Packing = detail::SubbytePacking<T>;
+    auto *bytes = reinterpret_cast<uint8_t *>(dst);
+    uint8_t codes[Packing::kChunk];
+    for (size_t i = 0; i < count; i += Packing::kChunk) {
+      size_t n = std::min(Packing::kChunk, count - i);
+      for (size_t j = 0; j < n; ++j) {
+        codes[j] = Packing::code(convert(src[i + j]));
+      }
+      Packing::pack(bytes, offset + i, codes, n);
+    }
+  }
+  else {
+    size_t i = 0;
+    subbyte_generate(dst, count, [&]() { return convert(src[i++]); }, offset);
+  }
+}
+
+/// Converts `count` elements starting at element `offset` of `src` to float
+template <class T>
+void subbyte_to_float(float *dst, T const *src, size_t count, size_t offset = 0) {
+  if constexpr (is_subbyte_packable_v<T>) {
+    using Packing = detail::SubbytePacking<T>;
+    NumericConverter<float, T> convert;
+
+    // Every code is decoded once, into a table holding the kPerByte floats of each byte value
+    float code_table[1 << Packing::kBits];
+    for (int code = 0; code < (1 << Packing::kBits); ++code) {
+      code_table[code] = convert(Packing::value(uint8_t(code)));
+    }
+    float byte_table[256 * Packing::kPerByte];
+    for (int byte = 0; byte < 256; ++byte) {
+      for (int j = 0; j < Packing::kPerByte; ++j) {
+        byte_table[byte * Packing::kPerByte + j] = code_table[(byte >> (j * Packing::kBits)) & Packing::kMask];
+      }
+    }
+
+    auto const *bytes = reinterpret_cast<uint8_t const *>(src);
+    size_t i = Packing::head(offset, count);
+    for (size_t j = 0; j < i; ++j) {
+      dst[j] = code_table[Packing::get(bytes, offset + j)];
+    }
+
+    uint8_t const *in = bytes + (offset + i) / Packing::kPerByte;
+    size_t full = (count - i) / Packing::kPerByte;
+    for (size_t b = 0; b < full; ++b) {
+      std::memcpy(dst + i + b * Packing::kPerByte, byte_table + in[b] * Packing::kPerByte,
+                  sizeof(float) * Packing::kPerByte);
+    }
+
+    for (i += full * Packing::kPerByte; i < count; ++i) {
+      dst[i] = code_table[Packing::get(bytes, offset + i)];
+    }
+  }
+  else {
+    NumericConverter<float, T> convert;
+    for (size_t i = 0; i < count; ++i) {
+      if constexpr (sizeof_bits<T>::value < 8) {
+        dst[i] = convert(T(ReferenceFactory<T>::get(src, int64_t(offset + i))));
+      }
+      else {
+        dst[i] = convert(src[offset + i]);
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class T, int N>
+void subbyte_from_float(Array<T, N> &dst, float const *src) {
+  subbyte_from_float(dst.data(), src, size_t(N));
+}
+
+template <class T, int N>
+void subbyte_to_float(float *dst, Array<T, N> const &src) {
+  subbyte_to_float(dst, src.data(), size_t(N));
+}
+
+template <class T, size_t N>
+void subbyte_fill(cute::array_subbyte<T, N> &dst, T const &value) {
+  subbyte_fill(cute::raw_pointer_cast(dst.begin()), N, value);
+}
+
+template <class T, size_t N>
+void subbyte_from_float(cute::array_subbyte<T, N> &dst, float const *src) {
+  subbyte_from_float(cute::raw_pointer_cast(dst.begin()), src, N);
+}
+
+template <class T, size_t N>
+void subbyte_to_float(float *dst, cute::array_subbyte<T, N> const &src) {
+  subbyte_to_float(dst, cute::raw_pointer_cast(src.begin()), N);
+}
+
+} // namespace cutlass
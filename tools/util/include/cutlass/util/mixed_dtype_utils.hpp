@@ -35,6 +35,12 @@
 #pragma once
 
 #include <cuda.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
 #include "cute/layout.hpp"
 #include "cute/tensor.hpp"
 #include "cute/arch/mma_sm90.hpp"
@@ -43,6 +49,7 @@
 #include "cutlass/util/reference/device/tensor_fill.h"
 #include "cute/util/type_traits.hpp"
 #include "cute/numeric/numeric_types.hpp"
+#include "cutlass/util/reference/detail/host_parallel_for.h"
 
 namespace cutlass {
 
@@ -267,6 +274,12 @@ private:
 // In the mainloop, PRMT selects 1 byte from only 8 bytes so the sign bit is handled in an extra PRMT.
 // Here the encodings of positive values and negative values are unified (except for the sign bit).
 // For instance, 1 becomes 0b0111, which is the same encoding as -1 (0b1111).
+CUTLASS_HOST_DEVICE
+constexpr uint8_t unified_encode_int4b_storage(uint8_t storage) {
+  // 1..7 take the 2's complement encoding of their negation; 0 and negative values are unchanged
+  return (storage >= 1 && storage <= 7) ? uint8_t(8 - storage) : storage;
+}
+
 static bool unified_encode_int4b(cutlass::int4b_t const *block_in, cutlass::int4b_t *block_out, const size_t block_size) {
 
   using StorageType = cutlass::int4b_t::Storage;
@@ -277,22 +290,8 @@ static bool unified_encode_int4b(cutlass::int4b_t const *block_in, cutlass::int4
 
   for (auto&& d : host_buf) {
     StorageType out = 0;
-    StorageType mask = 0x0f;
     for (int i = 0; i < pack; i++) {
-      cutlass::int4b_t curr;
-      curr.storage = (d >> (i * 4)) & 0x0f;
-      switch (curr) {
-        case 1: curr.storage = StorageType(0b0111); break; // 2's complement
-        case 2: curr.storage = StorageType(0b0110); break; // 2's complement
-        case 3: curr.storage = StorageType(0b0101); break; // 2's complement
-        case 4: curr.storage = StorageType(0b0100); break; // 2's complement
-        case 5: curr.storage = StorageType(0b0011); break; // 2's complement
-        case 6: curr.storage = StorageType(0b0010); break; // 2's complement
-        case 7: curr.storage = StorageType(0b0001); break; // 2's complement
-        default: break;
-      }
-      out |= (curr.storage << (4 * i)) & mask;
-      mask <<= 4;
+      out |= StorageType(unified_encode_int4b_storage((d >> (i * 4)) & 0x0f) << (4 * i));
     }
     d = out;
   }
@@ -465,6 +464,230 @@ void reorder_tensor(
   cutlass::device_memory::copy_device_to_device(data, temp.get(), static_cast<size_t>(size(layout_src)));
 }
 
+// Host pipeline preparing the narrow operand of a mixed-input GEMM in a single sweep. It produces
+// the same tensors as chaining unified_encode_int4b(), pack_scale_fp8() and reorder_tensor() into
+// tile_to_shape(LayoutAtomQuant{}, shape), and can also quantize a wide operand in the same sweep.
+//
+// The operand is swept in panels of size<0>(LayoutAtomQuant{}) rows, which own whole reordering
+// atoms of the destination and whole rows of scales, so panels are processed on independent host
+// threads. Each atom is assembled in a staging buffer, with sub-byte elements packed in place, and
+// written to its contiguous location in the destination.
+template <class ElementQuant_, class LayoutAtomQuant_>
+class HostMixedDtypePrepacker {
+public:
+  using ElementQuant = ElementQuant_;
+  using LayoutAtomQuant = LayoutAtomQuant_;
+
+  static constexpr int kBits = cute::sizeof_bits_v<ElementQuant>;
+  static constexpr int kAtomRows = cute::size<0>(LayoutAtomQuant{});
+  static constexpr int kAtomColumns = cute::size<1>(LayoutAtomQuant{});
+  static constexpr int kAtomSize = kAtomRows * kAtomColumns;
+
+  static_assert(kBits == 4 || kBits == 8, "HostMixedDtypePrepacker supports 4-bit and 8-bit integer operands");
+  static_assert(cute::cosize(LayoutAtomQuant{}) == kAtomSize, "LayoutAtomQuant must be a bijection");
+  static_assert(kAtomSize * kBits % 8 == 0, "Reordering atoms must span whole bytes");
+
+  /// Minimum elements prepacked per host thread before additional threads are used
+  static constexpr int64_t kMinElementsPerThread = int64_t(1) << 16;
+
+  /// `group_size` is the number of elements along K sharing a scale. `unified_encode` applies the
+  /// encoding of unified_encode_int4b(), as the int4 x fp8 mainloops expect. `thread_count` bounds
+  /// the host threads used per call (0 selects std::thread::hardware_concurrency()).
+  explicit HostMixedDtypePrepacker(int group_size, bool unified_encode = false, int thread_count = 0)
+    : group_size_(group_size), unified_encode_(unified_encode), thread_count_(thread_count) {
+    assert(!unified_encode || (kBits == 4 && is_signed()));
+  }
+
+  /// Layout of the prepacked operand of (MN,K,L) shape `shape`, as given to the mainloop
+  template <class Shape>
+  static auto layout_reordered(Shape const& shape) {
+    return cute::tile_to_shape(LayoutAtomQuant{}, shape);
+  }
+
+  /// Encodes and reorders the quantized (MN,K,L) operand `src` to `dst`, laid out by
+  /// layout_reordered(). If `scale_packed` is not null, the (MN,G,L) scales `scale` are packed as by
+  /// pack_scale_fp8() to the same offsets of `scale_packed`.
+  template <class LayoutSrc, class ElementScale = cutlass::float_e4m3_t, class LayoutScale = cute::Layout<cute::Shape<int,int,int>>>
+  void prepack(ElementQuant const* src, LayoutSrc const& layout_src, ElementQuant* dst,
+               LayoutScale const& layout_scale = {}, ElementScale const* scale = nullptr,
+               cutlass::Array<ElementScale, 8>* scale_packed = nullptr) const {
+    auto tensor_src = cute::make_tensor(cute::make_gmem_ptr<ElementQuant>(src), layout_src);
+
+    static_assert(cute::sizeof_bits_v<ElementScale> == 8, "Only 8-bit scales are packed");
+
+    sweep(cute::shape(layout_src), dst, [&](int mn0, int mn1, int l) {
+      if (scale_packed != nullptr) {
+        for (int mn = mn0; mn < mn1; ++mn) {
+          for (int g = 0; g < int(cute::size<1>(layout_scale)); ++g) {
+            int64_t offset = int64_t(layout_scale(mn, g, l));
+            scale_packed[offset] = pack_scale(scale[offset]);
+          }
+        }
+      }
+      return [&, l](int mn, int k) {
+        return storage_of(ElementQuant(tensor_src(mn, k, l)));
+      };
+    });
+  }
+
+  /// Quantizes the wide (MN,K,L) operand `src` with one scale per group of `group_size` elements
+  /// along K, and prepacks it to `dst` as prepack() does. The quantized operand dequantizes as
+  /// q * scale + zero, as in dequantize().
+  ///
+  /// Without `zero`, quantization is symmetric: scale = amax / max(ElementQuant). With `zero`, it
+  /// maps the range of each group onto the range of ElementQuant. Scales and zeros are written to
+  /// the (MN,G,L) `layout_scale` offsets of `scale`, `zero` and, if not null, `scale_packed`.
+  template <class ElementSrc, class LayoutSrc, class ElementScale, class LayoutScale, class ElementZero = ElementScale>
+  void quantize_and_prepack(ElementSrc const* src, LayoutSrc const& layout_src, ElementQuant* dst,
+                            LayoutScale const& layout_scale, ElementScale* scale,
+                            cutlass::Array<ElementScale, 8>* scale_packed = nullptr,
+                            ElementZero* zero = nullptr) const {
+    assert(is_signed() || zero != nullptr);
+    auto tensor_src = cute::make_tensor(src, layout_src);
+    int const K = int(cute::size<1>(layout_src));
+    int const groups = cutlass::ceil_div(K, group_size_);
+    float const q_min = float(int(cutlass::platform::numeric_limits<ElementQuant>::lowest()));
+    float const q_max = float(int(cutlass::platform::numeric_limits<ElementQuant>::max()));
+
+    sweep(cute::shape(layout_src), dst, [&, K, groups](int mn0, int mn1, int l) {
+      // Reciprocal of the scale and zero point of each group of the panel, as stored
+      std::vector<float> group_rcp(size_t(kAtomRows) * groups, 0.0f);
+      std::vector<float> group_zero(size_t(kAtomRows) * groups, 0.0f);
+
+      for (int mn = mn0; mn < mn1; ++mn) {
+        for (int g = 0; g < groups; ++g) {
+          float lo = 0.0f, hi = 0.0f;
+          for (int k = g * group_size_; k < std::min(K, (g + 1) * group_size_); ++k) {
+            float x = float(tensor_src(mn, k, l));
+            lo = std::min(lo, x);
+            hi = std::max(hi, x);
+          }
+
+          int64_t offset = int64_t(layout_scale(mn, g, l));
+          ElementScale s;
+          float z = 0.0f;
+          if (zero != nullptr) {
+            s = ElementScale((hi - lo) / (q_max - q_min));
+            zero[offset] = ElementZero(lo - q_min * float(s));
+            z = float(zero[offset]);
+          }
+          else {
+            s = ElementScale(std::max(hi, -lo) / q_max);
+          }
+          scale[offset] = s;
+          if constexpr (cute::sizeof_bits_v<ElementScale> == 8) {
+            if (scale_packed != nullptr) {
+              scale_packed[offset] = pack_scale(s);
+            }
+          }
+
+          size_t index = size_t(mn - mn0) * groups + g;
+          group_rcp[index] = float(s) == 0.0f ? 0.0f : 1.0f / float(s);
+          group_zero[index] = z;
+        }
+      }
+
+      return [&, l, mn0, group_rcp = std::move(group_rcp), group_zero = std::move(group_zero)](int mn, int k) {
+        size_t index = size_t(mn - mn0) * groups + k / group_size_;
+        float q = std::nearbyint((float(tensor_src(mn, k, l)) - group_zero[index]) * group_rcp[index]);
+        q = std::min(std::max(q, q_min), q_max);
+        return storage_of(ElementQuant(int(q)));
+      };
+    });
+  }
+
+private:
+
+  static bool is_signed() {
+    return int(cutlass::platform::numeric_limits<ElementQuant>::lowest()) < 0;
+  }
+
+  /// Storage bits of an element, in the low bits of a byte
+  static uint8_t storage_of(ElementQuant x) {
+    if constexpr (kBits == 4) {
+      return uint8_t(x.storage & 0x0f);
+    }
+    else {
+      uint8_t storage;
+      std::memcpy(&storage, &x, sizeof(storage));
+      return storage;
+    }
+  }
+
+  template <class ElementScale>
+  static cutlass::Array<ElementScale, 8> pack_scale(ElementScale s) {
+    cutlass::packed_scale_t<ElementScale> packed(s);
+    return reinterpret_cast<cutlass::Array<ElementScale, 8> const&>(packed);
+  }
+
+  /// Sweeps the (MN,K,L) operand in panels of kAtomRows rows across host threads. For each panel,
+  /// `begin_panel(mn0, mn1, l)` returns a function mapping (mn, k) to the storage of an element.
+  template <class Shape, class BeginPanel>
+  void sweep(Shape const& shape, ElementQuant* dst, BeginPanel&& begin_panel) const {
+    int const MN = int(cute::size<0>(shape));
+    int const K = int(cute::size<1>(shape));
+    int const L = int(cute::size<2>(shape));
+    auto const layout_dst = layout_reordered(cute::make_shape(MN, K, L));
+
+    // Offset within an atom of each of its elements, in (mn, k) row-major order
+    static std::vector<int> const atom_offset = [] {
+      std::vector<int> offset(kAtomSize);
+      for (int i = 0; i < kAtomRows; ++i) {
+        for (int j = 0; j < kAtomColumns; ++j) {
+          offset[i * kAtomColumns + j] = int(LayoutAtomQuant{}(i, j));
+        }
+      }
+      return offset;
+    }();
+
+    int const panels_per_batch = cutlass::ceil_div(MN, kAtomRows);
+    int const atoms_per_panel = cutlass::ceil_div(K, kAtomColumns);
+    int64_t const panel_count = int64_t(panels_per_batch) * L;
+    int const workers = reference::host::detail::host_worker_count(
+      thread_count_, int64_t(MN) * K * L, kMinElementsPerThread);
+    auto* dst_bytes = reinterpret_cast<uint8_t*>(dst);
+
+    reference::host::detail::host_parallel_for(workers, panel_count, [&](int64_t panel_begin, int64_t panel_end) {
+      uint8_t staged[kAtomSize * kBits / 8];
+      for (int64_t panel = panel_begin; panel < panel_end; ++panel) {
+        int const l = int(panel / panels_per_batch);
+        int const mn0 = int(panel % panels_per_batch) * kAtomRows;
+        int const mn1 = std::min(mn0 + kAtomRows, MN);
+        auto element = begin_panel(mn0, mn1, l);
+
+        for (int atom = 0; atom < atoms_per_panel; ++atom) {
+          int const k0 = atom * kAtomColumns;
+          int const k1 = std::min(k0 + kAtomColumns, K);
+          std::memset(staged, 0, sizeof(staged));
+          for (int mn = mn0; mn < mn1; ++mn) {
+            int const* row_offset = atom_offset.data() + (mn - mn0) * kAtomColumns;
+            for (int k = k0; k < k1; ++k) {
+              uint8_t storage = element(mn, k);
+              int offset = row_offset[k - k0];
+              if constexpr (kBits == 4) {
+                if (unified_encode_) {
+                  storage = unified_encode_int4b_storage(storage);
+                }
+                staged[offset / 2] |= uint8_t(storage << (4 * (offset % 2)));
+              }
+              else {
+                staged[offset] = storage;
+              }
+            }
+          }
+          // Atoms are contiguous in the destination, starting at the offset of their first element
+          int64_t const base = int64_t(layout_dst(mn0, k0, l));
+          std::memcpy(dst_bytes + base * kBits / 8, staged, sizeof(staged));
+        }
+      }
+    });
+  }
+
+  int group_size_ = 128;
+  bool unified_encode_ = false;
+  int thread_count_ = 0;
+};
+
 #undef CUDA_CHECK
 
 }  // namespace cutlass
@@ -0,0 +1,354 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief CudaHostAdapter that records calls instead of issuing them to CUDA.
+
+    RecordingCudaHostAdapter lets the host side of a device-wide operator (argument conversion,
+    workspace initialization, params construction and launch configuration) run and be inspected
+    on a machine without a GPU. Operators must be compiled with CUTLASS_ENABLE_CUDA_HOST_ADAPTER
+    set to true for them to route launches through the adapter.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cuda_host_adapter.hpp"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Host adapter recording each launch and memset, and answering occupancy queries with fixed
+/// values. Calls may be made concurrently from several threads.
+struct RecordingCudaHostAdapter : public CudaHostAdapter {
+
+  /// Behavior of the adapter
+  struct Options {
+    int32_t device_sms = 132;           ///< returned by query_occupancy()
+    int32_t sm_occupancy = 1;           ///< returned by query_occupancy()
+    bool record = true;                 ///< store each call; if false only the counters advance
+    bool apply_memset = false;          ///< perform memsets, treating destinations as host memory
+    size_t kernel_param_bytes = 0;      ///< bytes of kernel_params[0] copied into each launch record
+    Status launch_status = Status::kSuccess;  ///< returned by every launch()
+  };
+
+  /// A recorded launch. Cluster shapes are zero for launches without clusters.
+  struct Launch {
+    dim3 grid_dims;
+    dim3 cluster_dims;
+    dim3 fallback_cluster_dims;
+    dim3 block_dims;
+    size_t smem_size = 0;
+    cudaStream_t stream = nullptr;
+    int32_t kernel_index = 0;
+    std::vector<uint8_t> kernel_param;  ///< leading Options::kernel_param_bytes of kernel_params[0]
+  };
+
+  /// A recorded memset
+  struct Memset {
+    void* destination = nullptr;
+    std::vector<uint8_t> fill_value;
+    size_t count = 0;
+    cudaStream_t stream = nullptr;
+  };
+
+  //
+  // Methods
+  //
+
+  RecordingCudaHostAdapter(): RecordingCudaHostAdapter(Options()) { }
+
+  explicit RecordingCudaHostAdapter(Options const &options): options_(options) {
+    kernel_count = 1;
+    kernel_handles[0] = nullptr;
+  }
+
+  RecordingCudaHostAdapter(RecordingCudaHostAdapter const &) = delete;
+  RecordingCudaHostAdapter &operator=(RecordingCudaHostAdapter const &) = delete;
+
+  Options const &options() const {
+    return options_;
+  }
+
+  /// Number of launches since construction or the last clear()
+  int64_t launch_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return launch_count_;
+  }
+
+  /// Number of memsets since construction or the last clear()
+  int64_t memset_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memset_count_;
+  }
+
+  /// Number of occupancy queries since construction or the last clear()
+  int64_t occupancy_query_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return occupancy_query_count_;
+  }
+
+  /// Number of tensor map encodes and address replacements since construction or the last clear()
+  int64_t tensor_map_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tensor_map_count_;
+  }
+
+  /// Recorded launches, in call order
+  std::vector<Launch> launches() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return launches_;
+  }
+
+  /// Recorded memsets, in call order
+  std::vector<Memset> memsets() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return memsets_;
+  }
+
+  /// Discards the records and resets the counters
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    launches_.clear();
+    memsets_.clear();
+    launch_count_ = 0;
+    memset_count_ = 0;
+    occupancy_query_count_ = 0;
+    tensor_map_count_ = 0;
+  }
+
+  Status query_occupancy(
+    int32_t *device_sms,
+    int32_t *sm_occupancy,
+    int32_t /* kernel_index */,
+    int32_t /* thread_count */,
+    int32_t /* smem_size */) const override {
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++occupancy_query_count_;
+    if (device_sms) {
+      *device_sms = options_.device_sms;
+    }
+    if (sm_occupancy) {
+      *sm_occupancy = options_.sm_occupancy;
+    }
+    return Status::kSuccess;
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    return record_launch(grid_dims, dim3(0, 0, 0), dim3(0, 0, 0), block_dims,
+                         smem_size, cuda_stream, kernel_params, kernel_index);
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const cluster_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    return record_launch(grid_dims, cluster_dims, dim3(0, 0, 0), block_dims,
+                         smem_size, cuda_stream, kernel_params, kernel_index);
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const cluster_dims,
+    dim3 const fallback_cluster_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    return record_launch(grid_dims, cluster_dims, fallback_cluster_dims, block_dims,
+                         smem_size, cuda_stream, kernel_params, kernel_index);
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  /// Zeroes the descriptor and stores globalAddress in its leading bytes
+  CUresult tensorMapEncodeIm2col(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType,
+    cuuint32_t,
+    void* globalAddress,
+    const cuuint64_t*,
+    const cuuint64_t*,
+    const int*,
+    const int*,
+    cuuint32_t,
+    cuuint32_t,
+    const cuuint32_t*,
+    CUtensorMapInterleave,
+    CUtensorMapSwizzle,
+    CUtensorMapL2promotion,
+    CUtensorMapFloatOOBfill) const override {
+
+    encode_address(tensorMap, globalAddress, true);
+    return CUDA_SUCCESS;
+  }
+
+  /// Zeroes the descriptor and stores globalAddress in its leading bytes
+  CUresult tensorMapEncodeTiled(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType,
+    cuuint32_t,
+    void* globalAddress,
+    const cuuint64_t*,
+    const cuuint64_t*,
+    const cuuint32_t*,
+    const cuuint32_t*,
+    CUtensorMapInterleave,
+    CUtensorMapSwizzle,
+    CUtensorMapL2promotion,
+    CUtensorMapFloatOOBfill) const override {
+
+    encode_address(tensorMap, globalAddress, true);
+    return CUDA_SUCCESS;
+  }
+
+  /// Overwrites the address stored by a previous encode
+  CUresult tensorMapReplaceAddress(
+    CUtensorMap* tensorMap,
+    void* globalAddress) const override {
+
+    encode_address(tensorMap, globalAddress, false);
+    return CUDA_SUCCESS;
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+protected:
+
+  Status memsetDeviceImpl(
+    void* destination,
+    void const* fill_value,
+    size_t fill_size,
+    size_t count,
+    cudaStream_t stream) const override {
+
+    if (options_.apply_memset) {
+      uint8_t *bytes = static_cast<uint8_t *>(destination);
+      for (size_t i = 0; i < count; ++i) {
+        std::memcpy(bytes + i * fill_size, fill_value, fill_size);
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++memset_count_;
+    if (options_.record) {
+      Memset record;
+      record.destination = destination;
+      record.fill_value.assign(
+        static_cast<uint8_t const *>(fill_value), static_cast<uint8_t const *>(fill_value) + fill_size);
+      record.count = count;
+      record.stream = stream;
+      memsets_.push_back(std::move(record));
+    }
+    return Status::kSuccess;
+  }
+
+private:
+
+  Status record_launch(
+    dim3 grid_dims,
+    dim3 cluster_dims,
+    dim3 fallback_cluster_dims,
+    dim3 block_dims,
+    size_t smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const {
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++launch_count_;
+    if (options_.record) {
+      Launch record;
+      record.grid_dims = grid_dims;
+      record.cluster_dims = cluster_dims;
+      record.fallback_cluster_dims = fallback_cluster_dims;
+      record.block_dims = block_dims;
+      record.smem_size = smem_size;
+      record.stream = cuda_stream;
+      record.kernel_index = kernel_index;
+      if (options_.kernel_param_bytes > 0 && kernel_params && kernel_params[0]) {
+        uint8_t const *param = static_cast<uint8_t const *>(kernel_params[0]);
+        record.kernel_param.assign(param, param + options_.kernel_param_bytes);
+      }
+      launches_.push_back(std::move(record));
+    }
+    return options_.launch_status;
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+  void encode_address(CUtensorMap* tensorMap, void* globalAddress, bool reset) const {
+    if (tensorMap) {
+      if (reset) {
+        std::memset(tensorMap, 0, sizeof(CUtensorMap));
+      }
+      std::memcpy(tensorMap, &globalAddress, sizeof(globalAddress));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++tensor_map_count_;
+  }
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  Options options_;
+
+  mutable std::mutex mutex_;
+  mutable std::vector<Launch> launches_;
+  mutable std::vector<Memset> memsets_;
+  mutable int64_t launch_count_ = 0;
+  mutable int64_t memset_count_ = 0;
+  mutable int64_t occupancy_query_count_ = 0;
+  mutable int64_t tensor_map_count_ = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,89 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Splits host reference computations across std::thread workers.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace cutlass {
+namespace reference {
+namespace host {
+namespace detail {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Number of workers for `work` units of work such that each worker receives at least
+/// `min_work_per_worker` units. A `thread_count` of 0 selects std::thread::hardware_concurrency().
+inline int host_worker_count(int thread_count, int64_t work, int64_t min_work_per_worker) {
+  int64_t workers = thread_count > 0 ? thread_count : int64_t(std::thread::hardware_concurrency());
+  workers = std::min(workers, work / std::max<int64_t>(1, min_work_per_worker));
+  return int(std::max<int64_t>(1, workers));
+}
+
+/// Splits [0, item_count) into `workers` contiguous ranges and invokes `fn(begin, end)` on each,
+/// running all but the first on separate host threads.
+template <typename Fn>
+void host_parallel_for(int workers, int64_t item_count, Fn fn) {
+  if (workers <= 1 || item_count <= 1) {
+    fn(int64_t(0), item_count);
+    return;
+  }
+
+  workers = int(std::min<int64_t>(workers, item_count));
+
+  auto range_begin = [&](int worker) {
+    return (item_count * worker) / workers;
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(workers - 1);
+  for (int worker = 1; worker < workers; ++worker) {
+    threads.emplace_back(fn, range_begin(worker), range_begin(worker + 1));
+  }
+  fn(int64_t(0), range_begin(1));
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
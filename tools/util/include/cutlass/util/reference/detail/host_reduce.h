@@ -0,0 +1,313 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Multithreaded transform-reduce shared by the host tensor reductions.
+
+    Elements are folded in fixed-size blocks with several independent accumulators per block, so
+    the inner loop carries no serial dependence and the compiler may vectorize it. With the
+    default deterministic order, block partials are combined in a fixed binary tree whose shape
+    depends only on the number of elements, so results are bitwise reproducible for any thread
+    count.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/util/reference/detail/host_parallel_for.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Order in which a host reduction combines elements
+enum class ReductionOrder {
+  kSerial,          ///< single-threaded left fold in logical element order
+  kDeterministic,   ///< blocked tree reduction, identical result for every thread count
+  kUnordered        ///< one partial per thread; result may change with the thread count
+};
+
+/// Summation algorithm used when the reduction operator is cutlass::plus<ComputeType>
+enum class SummationMode {
+  kDefault,         ///< plain accumulation within each block
+  kPairwise,        ///< recursive pairwise summation within each block
+  kKahan            ///< compensated (Kahan) summation
+};
+
+/// Options controlling host tensor reductions
+struct TensorReduceOptions {
+  ReductionOrder order = ReductionOrder::kDeterministic;
+  SummationMode summation = SummationMode::kDefault;
+  int thread_count = 0;     ///< number of host threads; 0 selects std::thread::hardware_concurrency()
+
+  TensorReduceOptions() = default;
+
+  TensorReduceOptions(
+    ReductionOrder order_,
+    SummationMode summation_ = SummationMode::kDefault,
+    int thread_count_ = 0
+  ):
+    order(order_), summation(summation_), thread_count(thread_count_) { }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Accumulator applying the reduction operator directly
+template <typename ComputeType, typename ReduceOp>
+struct PlainAccumulator {
+
+  ComputeType value;
+
+  void add(ReduceOp &reduce, ComputeType const &x) {
+    value = reduce(value, x);
+  }
+
+  void merge(ReduceOp &reduce, PlainAccumulator const &other) {
+    value = reduce(value, other.value);
+  }
+
+  ComputeType result() const {
+    return value;
+  }
+
+  static PlainAccumulator make(ComputeType const &x) {
+    return PlainAccumulator{x};
+  }
+};
+
+/// Compensated sum. The represented value is (sum - compensation).
+template <typename ComputeType, typename ReduceOp>
+struct KahanAccumulator {
+
+  ComputeType sum;
+  ComputeType compensation;
+
+  void add(ReduceOp &, ComputeType const &x) {
+    ComputeType y = x - compensation;
+    ComputeType t = sum + y;
+    compensation = (t - sum) - y;
+    sum = t;
+  }
+
+  void merge(ReduceOp &reduce, KahanAccumulator const &other) {
+    add(reduce, other.sum);
+    add(reduce, ComputeType() - other.compensation);
+  }
+
+  ComputeType result() const {
+    return sum - compensation;
+  }
+
+  static KahanAccumulator make(ComputeType const &x) {
+    return KahanAccumulator{x, ComputeType()};
+  }
+};
+
+/// Multithreaded transform-reduce over the index range [0, count).
+///
+/// `element(idx)` returns the transformed element `idx`; it and `reduce` are invoked concurrently
+/// from several threads unless the order is kSerial. `identity` is applied exactly once.
+template <
+  typename ComputeType,
+  typename ReduceOp,
+  typename ElementFn
+>
+class HostTransformReduce {
+public:
+
+  /// Independent accumulators per block
+  static constexpr int kLanes = 8;
+
+  /// Elements per block of the deterministic order
+  static constexpr int64_t kBlockSize = 8192;
+
+  /// Pairwise summation recurses until ranges hold at most this many elements
+  static constexpr int64_t kPairwiseLeaf = kLanes * 16;
+
+  /// Reductions smaller than this per thread are not split further
+  static constexpr int64_t kMinElementsPerThread = int64_t(1) << 16;
+
+  static constexpr bool kIsSum = std::is_same<ReduceOp, cutlass::plus<ComputeType>>::value;
+
+  HostTransformReduce(ReduceOp reduce, ElementFn element, TensorReduceOptions const &options):
+    reduce_(reduce), element_(element), options_(options) { }
+
+  ComputeType operator()(int64_t count, ComputeType identity) {
+    if (count <= 0) {
+      return identity;
+    }
+
+    if (kIsSum && options_.summation == SummationMode::kKahan) {
+      return run<KahanAccumulator<ComputeType, ReduceOp>>(count, identity);
+    }
+    return run<PlainAccumulator<ComputeType, ReduceOp>>(count, identity);
+  }
+
+private:
+
+  template <typename Accumulator>
+  ComputeType run(int64_t count, ComputeType identity) {
+
+    if (options_.order == ReductionOrder::kSerial) {
+      if (options_.summation == SummationMode::kDefault) {
+        // Left fold from the identity, as computed by the original serial reduction
+        for (int64_t idx = 0; idx < count; ++idx) {
+          identity = reduce_(identity, element_(idx));
+        }
+        return identity;
+      }
+      Accumulator acc = Accumulator::make(identity);
+      acc.merge(reduce_, fold<Accumulator>(reduce_, 0, count));
+      return acc.result();
+    }
+
+    int workers = host_worker_count(options_.thread_count, count, kMinElementsPerThread);
+
+    Accumulator total = Accumulator::make(identity);
+
+    if (options_.order == ReductionOrder::kUnordered) {
+      std::vector<Accumulator> partials(workers, Accumulator::make(identity));
+      host_parallel_for(workers, workers, [&](int64_t worker_begin, int64_t worker_end) {
+        ReduceOp reduce = reduce_;
+        for (int64_t worker = worker_begin; worker < worker_end; ++worker) {
+          partials[worker] = fold<Accumulator>(
+            reduce, count * worker / workers, count * (worker + 1) / workers);
+        }
+      });
+      for (Accumulator const &partial : partials) {
+        total.merge(reduce_, partial);
+      }
+      return total.result();
+    }
+
+    // Deterministic order: fixed blocks, reduced by any thread, combined in a fixed tree
+    int64_t block_count = (count + kBlockSize - 1) / kBlockSize;
+    workers = int(std::min<int64_t>(workers, block_count));
+
+    std::vector<Accumulator> partials(block_count, Accumulator::make(identity));
+    host_parallel_for(workers, block_count, [&](int64_t block_begin, int64_t block_end) {
+      ReduceOp reduce = reduce_;
+      for (int64_t block = block_begin; block < block_end; ++block) {
+        partials[block] = fold<Accumulator>(
+          reduce, block * kBlockSize, std::min(count, (block + 1) * kBlockSize));
+      }
+    });
+
+    for (int64_t stride = 1; stride < block_count; stride *= 2) {
+      for (int64_t block = 0; block + stride < block_count; block += 2 * stride) {
+        partials[block].merge(reduce_, partials[block + stride]);
+      }
+    }
+
+    total.merge(reduce_, partials[0]);
+    return total.result();
+  }
+
+  /// Reduces the non-empty range [begin, end) without the identity
+  template <typename Accumulator>
+  Accumulator fold(ReduceOp &reduce, int64_t begin, int64_t end) const {
+
+    if (options_.summation == SummationMode::kPairwise && end - begin > kPairwiseLeaf) {
+      int64_t mid = begin + (end - begin) / 2;
+      Accumulator acc = fold<Accumulator>(reduce, begin, mid);
+      acc.merge(reduce, fold<Accumulator>(reduce, mid, end));
+      return acc;
+    }
+
+    if (end - begin < kLanes) {
+      Accumulator acc = Accumulator::make(element_(begin));
+      for (int64_t idx = begin + 1; idx < end; ++idx) {
+        acc.add(reduce, element_(idx));
+      }
+      return acc;
+    }
+
+    Accumulator lanes[kLanes];
+    for (int lane = 0; lane < kLanes; ++lane) {
+      lanes[lane] = Accumulator::make(element_(begin + lane));
+    }
+
+    int64_t idx = begin + kLanes;
+    for (; idx + kLanes <= end; idx += kLanes) {
+      for (int lane = 0; lane < kLanes; ++lane) {
+        lanes[lane].add(reduce, element_(idx + lane));
+      }
+    }
+    for (int lane = 0; idx < end; ++idx, ++lane) {
+      lanes[lane].add(reduce, element_(idx));
+    }
+
+    for (int stride = 1; stride < kLanes; stride *= 2) {
+      for (int lane = 0; lane + stride < kLanes; lane += 2 * stride) {
+        lanes[lane].merge(reduce, lanes[lane + stride]);
+      }
+    }
+    return lanes[0];
+  }
+
+  ReduceOp reduce_;
+  ElementFn element_;
+  TensorReduceOptions options_;
+};
+
+/// Reduces `element(idx)` for idx in [0, count) with `reduce`, starting from `identity`
+template <
+  typename ComputeType,
+  typename ReduceOp,
+  typename ElementFn
+>
+ComputeType host_transform_reduce(
+  int64_t count,
+  ComputeType identity,
+  ReduceOp reduce,
+  ElementFn element,
+  TensorReduceOptions const &options) {
+
+  return HostTransformReduce<ComputeType, ReduceOp, ElementFn>(reduce, element, options)(count, identity);
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
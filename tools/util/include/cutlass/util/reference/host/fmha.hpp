@@ -0,0 +1,619 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Multithreaded host references for fused multi-head attention: forward, backward and
+    multi-head latent attention (MLA) decoding.
+
+    The functions take the problem shapes, tensors and masks of the device references in
+    examples/77_blackwell_fmha/reference:
+
+      - forward and backward: problem shape (Q, K, D, D_VO, L) with L = ((H_R, H_K), B) or any
+        other shape, tensors Q (Q, D, L), K (K, D, L), V (K, D_VO, L), O (Q, D_VO, L) and
+        LSE (Q, L). Grouped-query attention is expressed by a zero stride over H_R in K and V.
+        For MLA, D = (D_latent, D_rope): Q and K have D_latent + D_rope columns and V has D_latent.
+      - variable sequence lengths: Q and K may be given by a type with `max_length` conversion to
+        int and a `cumulative_length` array (cutlass::fmha::collective::VariableLength). Sequence
+        b then occupies rows [cumulative_length[b], cumulative_length[b + 1]) of the tensors and
+        b is the last coordinate of L.
+      - masks: a mask type with a static `IsQBegin` member (CausalMask, CausalForBackwardMask) is
+        causal, with the queries aligned to the first (IsQBegin) or the last keys. Other masks
+        (NoMask, ResidualMask, ResidualMaskForBackward) keep every key of the sequence.
+
+    The softmax is evaluated online over blocks of keys, so the memory used by a worker is
+    independent of the sequence length. Work is split over blocks of queries (or keys for dK and
+    dV) of every head and batch, each converted once to the accumulator type, which is the value
+    type of LSE. P and dS are kept in the accumulator type, whereas the device references round
+    them to the element type. Queries without any visible key produce O = 0 and LSE = -inf.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "cute/tensor.hpp"
+
+#include "cutlass/util/reference/detail/host_parallel_for.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reference::host {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Queries and keys per block of the online softmax
+constexpr int kFmhaBlockQ = 16;
+constexpr int kFmhaBlockK = 64;
+
+template <class Extent, class = void>
+struct is_fmha_variable_length : std::false_type {};
+
+template <class Extent>
+struct is_fmha_variable_length<Extent, std::void_t<decltype(std::declval<Extent const &>().cumulative_length)>>
+    : std::true_type {};
+
+/// Length and first row of sequence `batch` along a Q or K mode of the problem shape
+template <class Extent>
+std::pair<int, int> fmha_sequence(Extent const &extent, int batch) {
+  if constexpr (is_fmha_variable_length<Extent>::value) {
+    return {extent.cumulative_length[batch + 1] - extent.cumulative_length[batch], extent.cumulative_length[batch]};
+  }
+  else {
+    return {int(extent), 0};
+  }
+}
+
+/// Batch index of the linear index `idx_L` of the L mode: its last coordinate
+template <class ShapeL>
+int fmha_batch_index(ShapeL const &shape_L, int idx_L) {
+  if constexpr (cute::is_tuple<ShapeL>::value) {
+    return int(cute::back(cute::idx2crd(idx_L, shape_L)));
+  }
+  else {
+    return idx_L;
+  }
+}
+
+template <class Mask, class = void>
+struct FmhaMaskTraits {
+  static constexpr bool kIsCausal = false;
+  static constexpr bool kIsQBegin = true;
+};
+
+template <class Mask>
+struct FmhaMaskTraits<Mask, std::void_t<decltype(Mask::IsQBegin)>> {
+  static constexpr bool kIsCausal = true;
+  static constexpr bool kIsQBegin = Mask::IsQBegin;
+};
+
+/// Query `q` attends to keys [0, fmha_key_end(q))
+template <class Mask>
+int fmha_key_end(int q, int seqlen_q, int seqlen_k) {
+  if constexpr (FmhaMaskTraits<Mask>::kIsCausal) {
+    int offset_q = FmhaMaskTraits<Mask>::kIsQBegin ? 0 : seqlen_k - seqlen_q;
+    return std::clamp(q + offset_q + 1, 0, seqlen_k);
+  }
+  else {
+    return seqlen_k;
+  }
+}
+
+/// Key `k` is attended by queries [fmha_query_begin(k), seqlen_q)
+template <class Mask>
+int fmha_query_begin(int k, int seqlen_q, int seqlen_k) {
+  if constexpr (FmhaMaskTraits<Mask>::kIsCausal) {
+    int offset_q = FmhaMaskTraits<Mask>::kIsQBegin ? 0 : seqlen_k - seqlen_q;
+    return std::clamp(k - offset_q, 0, seqlen_q);
+  }
+  else {
+    return 0;
+  }
+}
+
+/// Head dimensions (D, D_VO) of mode 2 and 3 of the problem shape; (D_latent + D_rope, D_latent) for MLA
+template <class ProblemShape>
+std::pair<int, int> fmha_head_dims(ProblemShape const &problem_shape) {
+  if constexpr (cute::is_tuple<cute::remove_cvref_t<decltype(cute::get<2>(problem_shape))>>::value) {
+    return {int(cute::size<2, 0>(problem_shape) + cute::size<2, 1>(problem_shape)), int(cute::size<2, 0>(problem_shape))};
+  }
+  else {
+    return {int(cute::size<2>(problem_shape)), int(cute::size<3>(problem_shape))};
+  }
+}
+
+/// Loads `rows` rows of `cols` columns of a (row, column, l) tensor into a dense row-major buffer
+template <class ElementAcc, class Tensor>
+void fmha_load_block(std::vector<ElementAcc> &block, Tensor const &tensor, int row_begin, int rows, int cols, int idx_L) {
+  block.resize(size_t(rows) * cols);
+  for (int i = 0; i < rows; ++i) {
+    for (int d = 0; d < cols; ++d) {
+      block[size_t(i) * cols + d] = static_cast<ElementAcc>(tensor(row_begin + i, d, idx_L));
+    }
+  }
+}
+
+template <class ElementAcc>
+ElementAcc fmha_dot(ElementAcc const *a, ElementAcc const *b, int count) {
+  ElementAcc acc = 0;
+  for (int d = 0; d < count; ++d) {
+    acc += a[d] * b[d];
+  }
+  return acc;
+}
+
+/// Running max, sum and unnormalized output of the rows of a query block
+template <class ElementAcc>
+struct FmhaOnlineSoftmax {
+  int head_v = 0;
+  std::vector<ElementAcc> row_max;
+  std::vector<ElementAcc> row_sum;
+  std::vector<ElementAcc> acc_o;
+  std::vector<ElementAcc> probs;
+
+  void reset(int rows, int head_v_) {
+    head_v = head_v_;
+    row_max.assign(rows, -std::numeric_limits<ElementAcc>::infinity());
+    row_sum.assign(rows, ElementAcc(0));
+    acc_o.assign(size_t(rows) * head_v, ElementAcc(0));
+  }
+
+  /// Folds the scaled scores of `count` keys, whose values are the rows of `v`, into `row`
+  void update(int row, ElementAcc const *scores, int count, ElementAcc const *v) {
+    if (count <= 0) {
+      return;
+    }
+    ElementAcc block_max = *std::max_element(scores, scores + count);
+    ElementAcc new_max = std::max(row_max[row], block_max);
+    ElementAcc correction = std::exp(row_max[row] - new_max);
+
+    probs.resize(count);
+    ElementAcc block_sum = 0;
+    for (int j = 0; j < count; ++j) {
+      probs[j] = std::exp(scores[j] - new_max);
+      block_sum += probs[j];
+    }
+
+    ElementAcc *o = acc_o.data() + size_t(row) * head_v;
+    for (int d = 0; d < head_v; ++d) {
+      o[d] *= correction;
+    }
+    for (int j = 0; j < count; ++j) {
+      ElementAcc const *v_row = v + size_t(j) * head_v;
+      for (int d = 0; d < head_v; ++d) {
+        o[d] += probs[j] * v_row[d];
+      }
+    }
+    row_sum[row] = row_sum[row] * correction + block_sum;
+    row_max[row] = new_max;
+  }
+
+  /// Writes O(row, d) with `store_o(d, value)` and returns the log-sum-exp of the row
+  template <class StoreO>
+  ElementAcc finalize(int row, StoreO &&store_o) const {
+    ElementAcc const *o = acc_o.data() + size_t(row) * head_v;
+    if (row_sum[row] == ElementAcc(0)) {
+      for (int d = 0; d < head_v; ++d) {
+        store_o(d, ElementAcc(0));
+      }
+      return -std::numeric_limits<ElementAcc>::infinity();
+    }
+    ElementAcc inv_sum = ElementAcc(1) / row_sum[row];
+    for (int d = 0; d < head_v; ++d) {
+      store_o(d, o[d] * inv_sum);
+    }
+    return std::log(row_sum[row]) + row_max[row];
+  }
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Forward attention O = softmax(scale * Q K^T) V and its log-sum-exp LSE, which may have a null
+/// data pointer. `softmax_scale` defaults to 1 / sqrt(D). A `thread_count` of 0 uses every
+/// hardware thread.
+template <
+  class ProblemShape,
+  class TensorQ, class TensorK, class TensorV,
+  class TensorO, class TensorLSE,
+  class Mask
+>
+void FmhaForward(
+    ProblemShape const &problem_shape,
+    TensorQ mQ, TensorK mK, TensorV mV,
+    TensorO mO, TensorLSE mLSE,
+    Mask const & /* mask */,
+    typename TensorLSE::value_type softmax_scale = 0,
+    int thread_count = 0) {
+
+  using ElementAcc = typename TensorLSE::value_type;
+  using ElementO = typename TensorO::value_type;
+
+  auto shape_L = cute::get<4>(problem_shape);
+  int const L = int(cute::size(shape_L));
+  int const max_seqlen_q = int(cute::get<0>(problem_shape));
+  int const max_seqlen_k = int(cute::get<1>(problem_shape));
+  int const head_qk = detail::fmha_head_dims(problem_shape).first;
+  int const head_v = detail::fmha_head_dims(problem_shape).second;
+  if (softmax_scale == ElementAcc(0)) {
+    softmax_scale = ElementAcc(1.0 / std::sqrt(double(head_qk)));
+  }
+  bool const has_lse = cute::raw_pointer_cast(mLSE.data()) != nullptr;
+
+  int const q_blocks = (max_seqlen_q + detail::kFmhaBlockQ - 1) / detail::kFmhaBlockQ;
+  int64_t const items = int64_t(L) * q_blocks;
+  int workers = detail::host_worker_count(
+    thread_count, items * detail::kFmhaBlockQ * max_seqlen_k * (head_qk + head_v), int64_t(1) << 18);
+
+  detail::host_parallel_for(workers, items, [&](int64_t item_begin, int64_t item_end) {
+    std::vector<ElementAcc> block_q, block_k, block_v, scores(detail::kFmhaBlockK);
+    detail::FmhaOnlineSoftmax<ElementAcc> softmax;
+
+    for (int64_t item = item_begin; item < item_end; ++item) {
+      int idx_L = int(item / q_blocks);
+      int batch = detail::fmha_batch_index(shape_L, idx_L);
+      auto [seqlen_q, offset_q] = detail::fmha_sequence(cute::get<0>(problem_shape), batch);
+      auto [seqlen_k, offset_k] = detail::fmha_sequence(cute::get<1>(problem_shape), batch);
+      int q_begin = int(item % q_blocks) * detail::kFmhaBlockQ;
+      if (q_begin >= seqlen_q) {
+        continue;
+      }
+      int rows = std::min(detail::kFmhaBlockQ, seqlen_q - q_begin);
+      int k_end = detail::fmha_key_end<Mask>(q_begin + rows - 1, seqlen_q, seqlen_k);
+
+      detail::fmha_load_block(block_q, mQ, offset_q + q_begin, rows, head_qk, idx_L);
+      softmax.reset(rows, head_v);
+
+      for (int k_begin = 0; k_begin < k_end; k_begin += detail::kFmhaBlockK) {
+        int keys = std::min(detail::kFmhaBlockK, k_end - k_begin);
+        detail::fmha_load_block(block_k, mK, offset_k + k_begin, keys, head_qk, idx_L);
+        detail::fmha_load_block(block_v, mV, offset_k + k_begin, keys, head_v, idx_L);
+
+        for (int i = 0; i < rows; ++i) {
+          int visible = std::min(keys, detail::fmha_key_end<Mask>(q_begin + i, seqlen_q, seqlen_k) - k_begin);
+          for (int j = 0; j < visible; ++j) {
+            scores[j] = softmax_scale * detail::fmha_dot(&block_q[size_t(i) * head_qk], &block_k[size_t(j) * head_qk], head_qk);
+          }
+          softmax.update(i, scores.data(), visible, block_v.data());
+        }
+      }
+
+      for (int i = 0; i < rows; ++i) {
+        int q = offset_q + q_begin + i;
+        ElementAcc lse = softmax.finalize(i, [&](int d, ElementAcc value) {
+          mO(q, d, idx_L) = static_cast<ElementO>(value);
+        });
+        if (has_lse) {
+          mLSE(q, idx_L) = lse;
+        }
+      }
+    }
+  });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Backward attention: dQ, dK and dV from Q, K, V, O, LSE and dO, with the conventions of
+/// FmhaForward. dK and dV are summed over the H_R query heads sharing a KV head (L of the form
+/// ((H_R, H_K), B)) and written at H_R = 0. `softmax_scale` defaults to 1 / sqrt(D).
+template <
+  class ProblemShape,
+  class TensorQ, class TensorK, class TensorV,
+  class TensorO, class TensorLSE, class TensorDO,
+  class TensorDQ, class TensorDK, class TensorDV,
+  class Mask
+>
+void FmhaBackward(
+    ProblemShape const &problem_shape,
+    TensorQ mQ, TensorK mK, TensorV mV,
+    TensorO mO, TensorLSE mLSE, TensorDO mDO,
+    TensorDQ mDQ, TensorDK mDK, TensorDV mDV,
+    Mask const & /* mask */,
+    typename TensorLSE::value_type softmax_scale = 0,
+    int thread_count = 0) {
+
+  using ElementAcc = typename TensorLSE::value_type;
+
+  auto shape_L = cute::get<4>(problem_shape);
+  int const L = int(cute::size(shape_L));
+  int H_R = 1;
+  if constexpr (cute::is_tuple<decltype(shape_L)>::value) {
+    if constexpr (cute::is_tuple<cute::remove_cvref_t<decltype(cute::get<0>(shape_L))>>::value) {
+      H_R = int(cute::size<0, 0>(shape_L));
+    }
+  }
+  int const max_seqlen_q = int(cute::get<0>(problem_shape));
+  int const max_seqlen_k = int(cute::get<1>(problem_shape));
+  int const head_qk = detail::fmha_head_dims(problem_shape).first;
+  int const head_v = detail::fmha_head_dims(problem_shape).second;
+  if (softmax_scale == ElementAcc(0)) {
+    softmax_scale = ElementAcc(1.0 / std::sqrt(double(head_qk)));
+  }
+  int64_t const work_per_row = int64_t(std::max(max_seqlen_q, max_seqlen_k)) * (head_qk + head_v);
+
+  // P(i, j) and dS(i, j) / scale of query i and key j, or zero if the key is masked
+  auto probabilities = [&](
+      ElementAcc const *q, ElementAcc const *k, ElementAcc const *v, ElementAcc const *d_o,
+      ElementAcc lse, ElementAcc dot_o) {
+    ElementAcc p = std::exp(softmax_scale * detail::fmha_dot(q, k, head_qk) - lse);
+    ElementAcc dp = detail::fmha_dot(d_o, v, head_v);
+    return std::make_pair(p, p * (dp - dot_o));
+  };
+
+  // Per query, the row sums of dO * O
+  auto load_dot_o = [&](std::vector<ElementAcc> &dot_o, std::vector<ElementAcc> const &block_do,
+                        std::vector<ElementAcc> const &block_o, int rows) {
+    dot_o.resize(rows);
+    for (int i = 0; i < rows; ++i) {
+      dot_o[i] = detail::fmha_dot(&block_do[size_t(i) * head_v], &block_o[size_t(i) * head_v], head_v);
+    }
+  };
+
+  //
+  // dQ: blocks of queries of every head
+  //
+
+  int const q_blocks = (max_seqlen_q + detail::kFmhaBlockQ - 1) / detail::kFmhaBlockQ;
+  int64_t const q_items = int64_t(L) * q_blocks;
+  int workers = detail::host_worker_count(thread_count, q_items * detail::kFmhaBlockQ * work_per_row, int64_t(1) << 18);
+
+  detail::host_parallel_for(workers, q_items, [&](int64_t item_begin, int64_t item_end) {
+    std::vector<ElementAcc> block_q, block_o, block_do, block_k, block_v, dot_o, acc_dq;
+
+    for (int64_t item = item_begin; item < item_end; ++item) {
+      int idx_L = int(item / q_blocks);
+      int batch = detail::fmha_batch_index(shape_L, idx_L);
+      auto [seqlen_q, offset_q] = detail::fmha_sequence(cute::get<0>(problem_shape), batch);
+      auto [seqlen_k, offset_k] = detail::fmha_sequence(cute::get<1>(problem_shape), batch);
+      int q_begin = int(item % q_blocks) * detail::kFmhaBlockQ;
+      if (q_begin >= seqlen_q) {
+        continue;
+      }
+      int rows = std::min(detail::kFmhaBlockQ, seqlen_q - q_begin);
+      int k_end = detail::fmha_key_end<Mask>(q_begin + rows - 1, seqlen_q, seqlen_k);
+
+      detail::fmha_load_block(block_q, mQ, offset_q + q_begin, rows, head_qk, idx_L);
+      detail::fmha_load_block(block_o, mO, offset_q + q_begin, rows, head_v, idx_L);
+      detail::fmha_load_block(block_do, mDO, offset_q + q_begin, rows, head_v, idx_L);
+      load_dot_o(dot_o, block_do, block_o, rows);
+      acc_dq.assign(size_t(rows) * head_qk, ElementAcc(0));
+
+      for (int k_begin = 0; k_begin < k_end; k_begin += detail::kFmhaBlockK) {
+        int keys = std::min(detail::kFmhaBlockK, k_end - k_begin);
+        detail::fmha_load_block(block_k, mK, offset_k + k_begin, keys, head_qk, idx_L);
+        detail::fmha_load_block(block_v, mV, offset_k + k_begin, keys, head_v, idx_L);
+
+        for (int i = 0; i < rows; ++i) {
+          ElementAcc lse = static_cast<ElementAcc>(mLSE(offset_q + q_begin + i, idx_L));
+          int visible = std::min(keys, detail::fmha_key_end<Mask>(q_begin + i, seqlen_q, seqlen_k) - k_begin);
+          ElementAcc *dq = &acc_dq[size_t(i) * head_qk];
+          for (int j = 0; j < visible; ++j) {
+            ElementAcc const *k = &block_k[size_t(j) * head_qk];
+            ElementAcc ds = probabilities(
+              &block_q[size_t(i) * head_qk], k, &block_v[size_t(j) * head_v], &block_do[size_t(i) * head_v],
+              lse, dot_o[i]).second * softmax_scale;
+            for (int d = 0; d < head_qk; ++d) {
+              dq[d] += ds * k[d];
+            }
+          }
+        }
+      }
+
+      for (int i = 0; i < rows; ++i) {
+        for (int d = 0; d < head_qk; ++d) {
+          mDQ(offset_q + q_begin + i, d, idx_L) = static_cast<typename TensorDQ::value_type>(acc_dq[size_t(i) * head_qk + d]);
+        }
+      }
+    }
+  });
+
+  //
+  // dK and dV: blocks of keys of every KV head, accumulated over its H_R query heads
+  //
+
+  int const k_blocks = (max_seqlen_k + detail::kFmhaBlockK - 1) / detail::kFmhaBlockK;
+  int64_t const k_items = int64_t(L / H_R) * k_blocks;
+  workers = detail::host_worker_count(thread_count, k_items * detail::kFmhaBlockK * H_R * work_per_row, int64_t(1) << 18);
+
+  detail::host_parallel_for(workers, k_items, [&](int64_t item_begin, int64_t item_end) {
+    std::vector<ElementAcc> block_q, block_o, block_do, block_k, block_v, dot_o, acc_dk, acc_dv;
+
+    for (int64_t item = item_begin; item < item_end; ++item) {
+      int idx_L_kv = int(item / k_blocks) * H_R;
+      int batch = detail::fmha_batch_index(shape_L, idx_L_kv);
+      auto [seqlen_q, offset_q] = detail::fmha_sequence(cute::get<0>(problem_shape), batch);
+      auto [seqlen_k, offset_k] = detail::fmha_sequence(cute::get<1>(problem_shape), batch);
+      int k_begin = int(item % k_blocks) * detail::kFmhaBlockK;
+      if (k_begin >= seqlen_k) {
+        continue;
+      }
+      int keys = std::min(detail::kFmhaBlockK, seqlen_k - k_begin);
+      int q_begin = detail::fmha_query_begin<Mask>(k_begin, seqlen_q, seqlen_k);
+      acc_dk.assign(size_t(keys) * head_qk, ElementAcc(0));
+      acc_dv.assign(size_t(keys) * head_v, ElementAcc(0));
+
+      for (int idx_H_R = 0; idx_H_R < H_R; ++idx_H_R) {
+        int idx_L = idx_L_kv + idx_H_R;
+        detail::fmha_load_block(block_k, mK, offset_k + k_begin, keys, head_qk, idx_L);
+        detail::fmha_load_block(block_v, mV, offset_k + k_begin, keys, head_v, idx_L);
+
+        for (int q_block = q_begin; q_block < seqlen_q; q_block += detail::kFmhaBlockQ) {
+          int rows = std::min(detail::kFmhaBlockQ, seqlen_q - q_block);
+          detail::fmha_load_block(block_q, mQ, offset_q + q_block, rows, head_qk, idx_L);
+          detail::fmha_load_block(block_o, mO, offset_q + q_block, rows, head_v, idx_L);
+          detail::fmha_load_block(block_do, mDO, offset_q + q_block, rows, head_v, idx_L);
+          load_dot_o(dot_o, block_do, block_o, rows);
+
+          for (int i = 0; i < rows; ++i) {
+            ElementAcc lse = static_cast<ElementAcc>(mLSE(offset_q + q_block + i, idx_L));
+            int visible = std::min(keys, detail::fmha_key_end<Mask>(q_block + i, seqlen_q, seqlen_k) - k_begin);
+            ElementAcc const *q = &block_q[size_t(i) * head_qk];
+            ElementAcc const *d_o = &block_do[size_t(i) * head_v];
+            for (int j = 0; j < visible; ++j) {
+              auto [p, ds] = probabilities(
+                q, &block_k[size_t(j) * head_qk], &block_v[size_t(j) * head_v], d_o, lse, dot_o[i]);
+              ds *= softmax_scale;
+              ElementAcc *dk = &acc_dk[size_t(j) * head_qk];
+              ElementAcc *dv = &acc_dv[size_t(j) * head_v];
+              for (int d = 0; d < head_qk; ++d) {
+                dk[d] += ds * q[d];
+              }
+              for (int d = 0; d < head_v; ++d) {
+                dv[d] += p * d_o[d];
+              }
+            }
+          }
+        }
+      }
+
+      for (int j = 0; j < keys; ++j) {
+        for (int d = 0; d < head_qk; ++d) {
+          mDK(offset_k + k_begin + j, d, idx_L_kv) = static_cast<typename TensorDK::value_type>(acc_dk[size_t(j) * head_qk + d]);
+        }
+        for (int d = 0; d < head_v; ++d) {
+          mDV(offset_k + k_begin + j, d, idx_L_kv) = static_cast<typename TensorDV::value_type>(acc_dv[size_t(j) * head_v + d]);
+        }
+      }
+    }
+  });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Multi-head latent attention decoding, with the conventions of fmha_mla_reference: problem
+/// shape (H, K, (D_latent, D_rope), B), queries QL (H, D_latent, B) and QR (H, D_rope, B), latent
+/// cache CL (K, D_latent, B) serving as keys and values and rope keys KR (K, D_rope, B). With a
+/// page table PT (pages, B), CL and KR are (page_size, D, page_count) and key k of batch b is
+/// row k % page_size of page PT(k / page_size, b). Seq (B) holds the number of keys of each batch.
+/// Seq and PT may have null data pointers. All the heads of a batch share the key blocks.
+template <
+  class ProblemShape,
+  class TensorSeq, class TensorPageTable,
+  class TensorQL, class TensorQR,
+  class TensorCL, class TensorKR,
+  class TensorO, class TensorLSE
+>
+void FmhaMlaDecode(
+    ProblemShape const &problem_shape,
+    TensorSeq mSeq, TensorPageTable mPT,
+    TensorQL mQL, TensorQR mQR,
+    TensorCL mCL, TensorKR mKR,
+    TensorO mO, TensorLSE mLSE,
+    typename TensorLSE::value_type softmax_scale,
+    int thread_count = 0) {
+
+  using ElementAcc = typename TensorLSE::value_type;
+  using ElementO = typename TensorO::value_type;
+
+  int const H = int(cute::get<0>(problem_shape));
+  int const K = int(cute::get<1>(problem_shape));
+  int const D_latent = int(cute::get<2, 0>(problem_shape));
+  int const D_rope = int(cute::get<2, 1>(problem_shape));
+  int const B = int(cute::get<3>(problem_shape));
+  int const head_qk = D_latent + D_rope;
+  bool const has_seq = cute::raw_pointer_cast(mSeq.data()) != nullptr;
+  bool const has_page_table = cute::raw_pointer_cast(mPT.data()) != nullptr;
+  int const page_size = int(cute::size<0>(mCL));
+
+  int const h_blocks = (H + detail::kFmhaBlockQ - 1) / detail::kFmhaBlockQ;
+  int64_t const items = int64_t(B) * h_blocks;
+  int workers = detail::host_worker_count(
+    thread_count, items * detail::kFmhaBlockQ * int64_t(K) * (head_qk + D_latent), int64_t(1) << 18);
+
+  detail::host_parallel_for(workers, items, [&](int64_t item_begin, int64_t item_end) {
+    std::vector<ElementAcc> block_q, block_k, block_v, scores(detail::kFmhaBlockK);
+    detail::FmhaOnlineSoftmax<ElementAcc> softmax;
+
+    for (int64_t item = item_begin; item < item_end; ++item) {
+      int idx_B = int(item / h_blocks);
+      int h_begin = int(item % h_blocks) * detail::kFmhaBlockQ;
+      int rows = std::min(detail::kFmhaBlockQ, H - h_begin);
+      int seqlen_k = has_seq ? int(mSeq(idx_B)) : K;
+
+      block_q.resize(size_t(rows) * head_qk);
+      for (int i = 0; i < rows; ++i) {
+        for (int d = 0; d < D_latent; ++d) {
+          block_q[size_t(i) * head_qk + d] = static_cast<ElementAcc>(mQL(h_begin + i, d, idx_B));
+        }
+        for (int d = 0; d < D_rope; ++d) {
+          block_q[size_t(i) * head_qk + D_latent + d] = static_cast<ElementAcc>(mQR(h_begin + i, d, idx_B));
+        }
+      }
+      softmax.reset(rows, D_latent);
+
+      for (int k_begin = 0; k_begin < seqlen_k; k_begin += detail::kFmhaBlockK) {
+        int keys = std::min(detail::kFmhaBlockK, seqlen_k - k_begin);
+        block_k.resize(size_t(keys) * head_qk);
+        block_v.resize(size_t(keys) * D_latent);
+        for (int j = 0; j < keys; ++j) {
+          int k = k_begin + j;
+          int page_k = has_page_table ? k % page_size : k;
+          int page_b = has_page_table ? int(mPT(k / page_size, idx_B)) : idx_B;
+          for (int d = 0; d < D_latent; ++d) {
+            ElementAcc c = static_cast<ElementAcc>(mCL(page_k, d, page_b));
+            block_k[size_t(j) * head_qk + d] = c;
+            block_v[size_t(j) * D_latent + d] = c;
+          }
+          for (int d = 0; d < D_rope; ++d) {
+            block_k[size_t(j) * head_qk + D_latent + d] = static_cast<ElementAcc>(mKR(page_k, d, page_b));
+          }
+        }
+
+        for (int i = 0; i < rows; ++i) {
+          for (int j = 0; j < keys; ++j) {
+            scores[j] = softmax_scale * detail::fmha_dot(&block_q[size_t(i) * head_qk], &block_k[size_t(j) * head_qk], head_qk);
+          }
+          softmax.update(i, scores.data(), keys, block_v.data());
+        }
+      }
+
+      for (int i = 0; i < rows; ++i) {
+        ElementAcc lse = softmax.finalize(i, [&](int d, ElementAcc value) {
+          mO(h_begin + i, d, idx_B) = static_cast<ElementO>(value);
+        });
+        mLSE(h_begin + i, idx_B) = lse;
+      }
+    }
+  });
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::reference::host
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,383 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host-side driver verifying the groups of a grouped (e.g. MoE) GEMM in parallel.
+
+    Groups are verified by a user-provided function, typically loading the operands of the group,
+    running Gett() or Gemm3x() on them, comparing against the device result and releasing the
+    buffers before returning. The driver runs these functions on a pool of host threads, starting
+    groups in decreasing order of estimated cost, and optionally bounds the bytes held by groups in
+    flight, so that only a few groups need to be resident at once.
+
+    MappedFile provides read-only access to operands stored in a file without reading it into
+    memory; pages of a group can be dropped from the resident set once the group is verified.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "cutlass/gemm_coord.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reference::host {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Read-only mapping of a file, e.g. holding the operands of every group of a grouped GEMM.
+/// Pages are read on first access and can be dropped again with release(). Where memory mapping
+/// is unavailable, the file is read into memory instead and release() has no effect.
+class MappedFile {
+public:
+
+  MappedFile() = default;
+
+  explicit MappedFile(std::string const &path) {
+#if defined(_WIN32)
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+      throw std::runtime_error("MappedFile: cannot open " + path);
+    }
+    buffer_.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(buffer_.data(), buffer_.size());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      throw std::runtime_error("MappedFile: cannot open " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+      ::close(fd);
+      throw std::runtime_error("MappedFile: cannot stat " + path);
+    }
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ > 0) {
+      void *data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+      if (data == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("MappedFile: cannot map " + path);
+      }
+      data_ = static_cast<char const *>(data);
+    }
+    // The mapping remains valid after the descriptor is closed
+    ::close(fd);
+#endif
+  }
+
+  MappedFile(MappedFile const &) = delete;
+  MappedFile &operator=(MappedFile const &) = delete;
+
+  MappedFile(MappedFile &&other) noexcept {
+    *this = std::move(other);
+  }
+
+  MappedFile &operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      unmap();
+      data_ = other.data_;
+      size_ = other.size_;
+#if defined(_WIN32)
+      buffer_ = std::move(other.buffer_);
+      data_ = buffer_.data();
+#endif
+      other.data_ = nullptr;
+      other.size_ = 0;
+    }
+    return *this;
+  }
+
+  ~MappedFile() {
+    unmap();
+  }
+
+  void const *data() const {
+    return data_;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  /// Elements of type T starting `offset` bytes into the file
+  template <class T>
+  T const *data_at(size_t offset) const {
+    return reinterpret_cast<T const *>(data_ + offset);
+  }
+
+  /// Drops the pages overlapping bytes [offset, offset + bytes) from the resident set. They are
+  /// read from the file again if accessed later, so releasing pages shared with another group
+  /// still in flight costs time but not correctness.
+  void release(size_t offset, size_t bytes) const {
+#if !defined(_WIN32)
+    if (data_ == nullptr || bytes == 0 || offset >= size_) {
+      return;
+    }
+    size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    size_t begin = offset / page * page;
+    size_t end = std::min(size_, offset + bytes);
+    ::madvise(const_cast<char *>(data_) + begin, end - begin, MADV_DONTNEED);
+#else
+    (void)offset;
+    (void)bytes;
+#endif
+  }
+
+private:
+
+  void unmap() {
+#if !defined(_WIN32)
+    if (data_ != nullptr) {
+      ::munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  char const *data_ = nullptr;
+  size_t size_ = 0;
+#if defined(_WIN32)
+  std::vector<char> buffer_;
+#endif
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Multiply-adds of a GEMM of shape (M,N,K[,L]), used to order groups by cost
+template <class ProblemShape>
+double gemm_cost(ProblemShape const &problem_shape) {
+  auto [M, N, K, L] = cute::append<4>(problem_shape, 1);
+  return double(M) * double(N) * double(K) * double(L);
+}
+
+inline double gemm_cost(cutlass::gemm::GemmCoord const &problem_size) {
+  return double(problem_size.m()) * double(problem_size.n()) * double(problem_size.k());
+}
+
+/// Indices of `costs` in decreasing order of cost, ties in increasing order of index
+inline std::vector<int> longest_first_order(std::vector<double> const &costs) {
+  std::vector<int> order(costs.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return costs[a] > costs[b]; });
+  return order;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct GroupedReferenceOptions {
+  /// Host threads verifying groups concurrently (0 selects std::thread::hardware_concurrency())
+  int thread_count = 0;
+
+  /// Upper bound on the sum of the resident bytes of the groups in flight (0 for no bound).
+  /// A group larger than the bound is verified alone.
+  size_t max_resident_bytes = 0;
+};
+
+struct GroupedReferenceResult {
+  /// Groups whose verification function returned false, in increasing order
+  std::vector<int> failed_groups;
+
+  /// Largest sum of the resident bytes of groups in flight
+  size_t peak_resident_bytes = 0;
+
+  double elapsed_seconds = 0;
+
+  bool passed() const {
+    return failed_groups.empty();
+  }
+};
+
+/// Calls `verify_group(group_idx)` for every group in [0, costs.size()) and collects the groups
+/// for which it returns false.
+///
+/// Groups are started in decreasing order of `costs` by up to `options.thread_count` host threads,
+/// so that the most expensive groups do not trail at the end. If `options.max_resident_bytes` is
+/// nonzero, a group only starts once the sum of `resident_bytes` over the groups in flight, its
+/// own included, fits in the bound; `resident_bytes` may be empty when no bound is given.
+///
+/// `verify_group` is called concurrently for distinct groups and must only share state that is
+/// safe to access from several threads. The first exception it throws stops further groups from
+/// starting and is rethrown once the groups in flight complete.
+///
+/// Gett() parallelizes each group with OpenMP when it is enabled; running several groups at once
+/// is then best combined with OMP_NUM_THREADS=1.
+template <class VerifyGroup>
+GroupedReferenceResult run_grouped_reference(
+    std::vector<double> const &costs,
+    std::vector<size_t> const &resident_bytes,
+    VerifyGroup &&verify_group,
+    GroupedReferenceOptions const &options = {}) {
+
+  int group_count = static_cast<int>(costs.size());
+  if (options.max_resident_bytes != 0 && resident_bytes.size() != costs.size()) {
+    throw std::invalid_argument("run_grouped_reference: resident_bytes must hold one entry per group");
+  }
+
+  int thread_count = options.thread_count > 0
+    ? options.thread_count
+    : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  thread_count = std::max(1, std::min(thread_count, group_count));
+
+  std::vector<int> order = longest_first_order(costs);
+  std::vector<char> passed(group_count, 1);
+
+  auto bytes_of = [&](int group_idx) {
+    return resident_bytes.empty() ? size_t(0) : resident_bytes[group_idx];
+  };
+
+  GroupedReferenceResult result;
+  std::mutex mutex;
+  std::condition_variable released;
+  int next = 0;
+  size_t in_flight_bytes = 0;
+  int in_flight_groups = 0;
+  std::exception_ptr error;
+
+  auto start = std::chrono::steady_clock::now();
+
+  auto worker = [&]() {
+    while (true) {
+      int group_idx;
+      size_t bytes;
+      {
+        // Groups start in order; the next one waits until it fits alongside those in flight
+        std::unique_lock<std::mutex> lock(mutex);
+        released.wait(lock, [&]() {
+          if (error || next == group_count) {
+            return true;
+          }
+          size_t needed = bytes_of(order[next]);
+          return options.max_resident_bytes == 0 || in_flight_groups == 0 ||
+                 in_flight_bytes + needed <= options.max_resident_bytes;
+        });
+        if (error || next == group_count) {
+          return;
+        }
+        group_idx = order[next++];
+        bytes = bytes_of(group_idx);
+        in_flight_bytes += bytes;
+        ++in_flight_groups;
+        result.peak_resident_bytes = std::max(result.peak_resident_bytes, in_flight_bytes);
+      }
+
+      bool group_passed = true;
+      std::exception_ptr group_error;
+      try {
+        group_passed = static_cast<bool>(verify_group(group_idx));
+      }
+      catch (...) {
+        group_error = std::current_exception();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        passed[group_idx] = group_passed;
+        in_flight_bytes -= bytes;
+        --in_flight_groups;
+        if (group_error && !error) {
+          error = group_error;
+        }
+      }
+      released.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (int i = 1; i < thread_count; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  for (int group_idx = 0; group_idx < group_count; ++group_idx) {
+    if (!passed[group_idx]) {
+      result.failed_groups.push_back(group_idx);
+    }
+  }
+  result.elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
+
+/// Overload ordering the groups by the cost of their GEMM problem shapes
+template <class ProblemShape, class VerifyGroup>
+GroupedReferenceResult run_grouped_reference(
+    std::vector<ProblemShape> const &problem_shapes,
+    std::vector<size_t> const &resident_bytes,
+    VerifyGroup &&verify_group,
+    GroupedReferenceOptions const &options = {}) {
+
+  std::vector<double> costs;
+  costs.reserve(problem_shapes.size());
+  for (auto const &problem_shape : problem_shapes) {
+    costs.push_back(gemm_cost(problem_shape));
+  }
+  return run_grouped_reference(costs, resident_bytes, std::forward<VerifyGroup>(verify_group), options);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::reference::host
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
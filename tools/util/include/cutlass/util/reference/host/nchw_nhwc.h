@@ -0,0 +1,187 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host reference implementations of the NCHW <-> NHWC layout conversions.
+
+    Mirror nchw_to_nhwc() and nhwc_to_nchw() in device_nchw_to_nhwc.h and device_nhwc_to_nchw.h,
+    without the stream argument. Each (n, h) slice is a C x W transpose, performed by recursively
+    halving the longer side until a tile fits in cache, so no tile size needs to be tuned.
+*/
+#pragma once
+
+#include <cstdint>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+
+#include "cutlass/util/reference/detail/host_parallel_for.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Transposes may be split across threads once each thread receives this many elements
+constexpr int64_t kMinTransposeElementsPerThread = int64_t(1) << 16;
+
+/// Cache-oblivious transpose: dst[j * ld_dst + i] = src[i * ld_src + j] for i < rows, j < columns
+template <typename T>
+void host_transpose(
+  T const *src, int64_t ld_src,
+  T *dst, int64_t ld_dst,
+  int64_t rows, int64_t columns) {
+
+  constexpr int64_t kTileElements = 32 * 32;
+
+  if (rows * columns <= kTileElements || rows == 1 || columns == 1) {
+    for (int64_t i = 0; i < rows; ++i) {
+      for (int64_t j = 0; j < columns; ++j) {
+        dst[j * ld_dst + i] = src[i * ld_src + j];
+      }
+    }
+    return;
+  }
+
+  if (rows >= columns) {
+    int64_t half = rows / 2;
+    host_transpose(src, ld_src, dst, ld_dst, half, columns);
+    host_transpose(src + half * ld_src, ld_src, dst + half, ld_dst, rows - half, columns);
+  }
+  else {
+    int64_t half = columns / 2;
+    host_transpose(src, ld_src, dst, ld_dst, rows, half);
+    host_transpose(src + half, ld_src, dst + half * ld_dst, ld_dst, rows, columns - half);
+  }
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Converts an NCHW tensor to NHWC. As on the device, `input_tensor_size` holds the NCHW extent
+/// (N, C, H, W) in the (n, h, w, c) fields and `output_tensor_size` the NHWC extent (N, H, W, C).
+/// Returns kErrorInvalidProblem if the two extents are inconsistent.
+template <typename T>
+Status nchw_to_nhwc(cutlass::Tensor4DCoord input_tensor_size,
+                    cutlass::Tensor4DCoord output_tensor_size,
+                    TensorRef<T, layout::TensorNCHW> ref_input,
+                    TensorRef<T, layout::TensorNHWC> ref_output,
+                    int thread_count = 0) {
+
+  if (input_tensor_size.n() != output_tensor_size.n() ||
+      input_tensor_size.h() != output_tensor_size.c() ||
+      input_tensor_size.w() != output_tensor_size.h() ||
+      input_tensor_size.c() != output_tensor_size.w()) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  int const n = output_tensor_size.n();
+  int const h = output_tensor_size.h();
+  int const w = output_tensor_size.w();
+  int const c = output_tensor_size.c();
+
+  // NCHW stride: [w, hw, chw], NHWC stride: [c, wc, hwc]
+  int64_t const ld_input = ref_input.stride(1);
+  int64_t const ld_output = ref_output.stride(0);
+
+  int64_t const slices = int64_t(n) * h;
+  int workers = detail::host_worker_count(
+    thread_count, slices * w * c, detail::kMinTransposeElementsPerThread);
+
+  detail::host_parallel_for(workers, slices, [&](int64_t slice_begin, int64_t slice_end) {
+    for (int64_t slice = slice_begin; slice < slice_end; ++slice) {
+      int ni = int(slice / h);
+      int hi = int(slice % h);
+      detail::host_transpose(
+        ref_input.data() + ref_input.offset({ni, hi, 0, 0}), ld_input,
+        ref_output.data() + ref_output.offset({ni, hi, 0, 0}), ld_output,
+        c, w);
+    }
+  });
+
+  return Status::kSuccess;
+}
+
+/// Converts an NHWC tensor to NCHW. As on the device, `input_tensor_size` holds the NHWC extent
+/// (N, H, W, C) and `output_tensor_size` the NCHW extent (N, C, H, W) in the (n, h, w, c)
+/// fields. Returns kErrorInvalidProblem if the two extents are inconsistent.
+template <typename T>
+Status nhwc_to_nchw(cutlass::Tensor4DCoord input_tensor_size,
+                    cutlass::Tensor4DCoord output_tensor_size,
+                    TensorRef<T, layout::TensorNHWC> ref_input,
+                    TensorRef<T, layout::TensorNCHW> ref_output,
+                    int thread_count = 0) {
+
+  if (input_tensor_size.n() != output_tensor_size.n() ||
+      input_tensor_size.c() != output_tensor_size.h() ||
+      input_tensor_size.h() != output_tensor_size.w() ||
+      input_tensor_size.w() != output_tensor_size.c()) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  int const n = input_tensor_size.n();
+  int const h = input_tensor_size.h();
+  int const w = input_tensor_size.w();
+  int const c = input_tensor_size.c();
+
+  int64_t const ld_input = ref_input.stride(0);
+  int64_t const ld_output = ref_output.stride(1);
+
+  int64_t const slices = int64_t(n) * h;
+  int workers = detail::host_worker_count(
+    thread_count, slices * w * c, detail::kMinTransposeElementsPerThread);
+
+  detail::host_parallel_for(workers, slices, [&](int64_t slice_begin, int64_t slice_end) {
+    for (int64_t slice = slice_begin; slice < slice_end; ++slice) {
+      int ni = int(slice / h);
+      int hi = int(slice % h);
+      detail::host_transpose(
+        ref_input.data() + ref_input.offset({ni, hi, 0, 0}), ld_input,
+        ref_output.data() + ref_output.offset({ni, hi, 0, 0}), ld_output,
+        w, c);
+    }
+  });
+
+  return Status::kSuccess;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
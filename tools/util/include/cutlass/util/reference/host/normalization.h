@@ -0,0 +1,260 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host reference implementations of layernorm, rmsnorm and groupnorm.
+
+    The functions mirror the device utilities in device_layernorm.h, device_rmsnorm.h and
+    device_groupnorm.h, without the stream argument. Rows (or groups) are distributed over host
+    threads; statistics are accumulated in double with two passes over the data.
+*/
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/matrix_coord.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+
+#include "cutlass/util/reference/detail/host_parallel_for.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Rows or groups are not distributed unless each thread receives at least this many elements
+constexpr int64_t kMinNormElementsPerThread = int64_t(1) << 15;
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Layernorm over the rows of a RowMajor tensor:
+///   output[m, n] = (input[m, n] - mean[m]) / sqrt(var[m] + 1e-5) * gamma[n] + beta[n]
+template <typename T>
+void layernorm(cutlass::MatrixCoord tensor_size,
+               TensorRef<T, layout::RowMajor> ref_output,
+               TensorRef<T, layout::RowMajor> ref_input,
+               TensorRef<T, layout::RowMajor> ref_gamma,
+               TensorRef<T, layout::RowMajor> ref_beta,
+               int thread_count = 0) {
+
+  int const M = tensor_size.row();
+  int const N = tensor_size.column();
+  double const kEpsilon = 1e-5;
+
+  if (M <= 0 || N <= 0) {
+    return;
+  }
+
+  std::vector<double> gamma(N), beta(N);
+  for (int n = 0; n < N; ++n) {
+    gamma[n] = static_cast<double>(static_cast<float>(ref_gamma.data()[n]));
+    beta[n] = static_cast<double>(static_cast<float>(ref_beta.data()[n]));
+  }
+
+  int workers = detail::host_worker_count(
+    thread_count, int64_t(M) * N, detail::kMinNormElementsPerThread);
+
+  detail::host_parallel_for(workers, M, [&](int64_t row_begin, int64_t row_end) {
+    std::vector<double> row(N);
+
+    for (int64_t m = row_begin; m < row_end; ++m) {
+      T const *input = ref_input.data() + ref_input.offset({int(m), 0});
+      T *output = ref_output.data() + ref_output.offset({int(m), 0});
+
+      double sum = 0;
+      for (int n = 0; n < N; ++n) {
+        row[n] = static_cast<double>(static_cast<float>(input[n]));
+        sum += row[n];
+      }
+      double mean = sum / N;
+
+      double sum_sq = 0;
+      for (int n = 0; n < N; ++n) {
+        double d = row[n] - mean;
+        sum_sq += d * d;
+      }
+      double inv_std = 1.0 / std::sqrt(sum_sq / N + kEpsilon);
+
+      for (int n = 0; n < N; ++n) {
+        output[n] = T(static_cast<float>((row[n] - mean) * inv_std * gamma[n] + beta[n]));
+      }
+    }
+  });
+}
+
+/// RMSNorm over the rows of a RowMajor tensor:
+///   output[m, n] = input[m, n] / sqrt(mean(input[m, :]^2) + epsilon) * weight[n]
+template <typename T>
+void rmsnorm(cutlass::MatrixCoord tensor_size,
+             TensorRef<T, layout::RowMajor> ref_output,
+             TensorRef<T, layout::RowMajor> ref_input,
+             TensorRef<T, layout::RowMajor> ref_weight,
+             float epsilon = 1e-5f,
+             int thread_count = 0) {
+
+  int const M = tensor_size.row();
+  int const N = tensor_size.column();
+
+  if (M <= 0 || N <= 0) {
+    return;
+  }
+
+  std::vector<double> weight(N);
+  for (int n = 0; n < N; ++n) {
+    weight[n] = static_cast<double>(static_cast<float>(ref_weight.data()[n]));
+  }
+
+  int workers = detail::host_worker_count(
+    thread_count, int64_t(M) * N, detail::kMinNormElementsPerThread);
+
+  detail::host_parallel_for(workers, M, [&](int64_t row_begin, int64_t row_end) {
+    std::vector<double> row(N);
+
+    for (int64_t m = row_begin; m < row_end; ++m) {
+      T const *input = ref_input.data() + ref_input.offset({int(m), 0});
+      T *output = ref_output.data() + ref_output.offset({int(m), 0});
+
+      double sum_sq = 0;
+      for (int n = 0; n < N; ++n) {
+        row[n] = static_cast<double>(static_cast<float>(input[n]));
+        sum_sq += row[n] * row[n];
+      }
+      double inv_rms = 1.0 / std::sqrt(sum_sq / N + double(epsilon));
+
+      for (int n = 0; n < N; ++n) {
+        output[n] = T(static_cast<float>(row[n] * inv_rms * weight[n]));
+      }
+    }
+  });
+}
+
+/// Groupnorm over an NHWC tensor whose C channels are split into `num_groups` groups. Each
+/// (n, group) pair is normalized over its H x W x (C / num_groups) elements, then scaled by
+/// gamma[c] and shifted by beta[c]. Returns kErrorInvalidProblem if C is not a multiple of
+/// num_groups.
+template <typename T>
+Status groupnorm(cutlass::Tensor4DCoord input_size,
+                 const int num_groups,
+                 const float eps,
+                 TensorRef<T, layout::TensorNHWC> ref_output,
+                 TensorRef<T, layout::TensorNHWC> ref_input,
+                 TensorRef<T, layout::TensorNHWC> ref_gamma,
+                 TensorRef<T, layout::TensorNHWC> ref_beta,
+                 int thread_count = 0) {
+
+  int const N = input_size.n();
+  int const H = input_size.h();
+  int const W = input_size.w();
+  int const C = input_size.c();
+
+  if (num_groups <= 0 || C % num_groups != 0) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  int const group_channels = C / num_groups;
+  int64_t const group_elements = int64_t(H) * W * group_channels;
+
+  if (N <= 0 || group_elements == 0) {
+    return Status::kSuccess;
+  }
+
+  std::vector<double> gamma(C), beta(C);
+  for (int c = 0; c < C; ++c) {
+    gamma[c] = static_cast<double>(static_cast<float>(ref_gamma.data()[c]));
+    beta[c] = static_cast<double>(static_cast<float>(ref_beta.data()[c]));
+  }
+
+  int64_t const group_count = int64_t(N) * num_groups;
+  int workers = detail::host_worker_count(
+    thread_count, group_count * group_elements, detail::kMinNormElementsPerThread);
+
+  detail::host_parallel_for(workers, group_count, [&](int64_t group_begin, int64_t group_end) {
+    for (int64_t group_idx = group_begin; group_idx < group_end; ++group_idx) {
+      int n = int(group_idx / num_groups);
+      int c_begin = int(group_idx % num_groups) * group_channels;
+
+      // Visits the channels of the group at each (h, w), which are contiguous in NHWC
+      auto for_each_pixel = [&](auto &&fn) {
+        for (int h = 0; h < H; ++h) {
+          for (int w = 0; w < W; ++w) {
+            fn(ref_input.data() + ref_input.offset({n, h, w, c_begin}),
+               ref_output.data() + ref_output.offset({n, h, w, c_begin}));
+          }
+        }
+      };
+
+      double sum = 0;
+      for_each_pixel([&](T const *input, T *) {
+        for (int c = 0; c < group_channels; ++c) {
+          sum += static_cast<double>(static_cast<float>(input[c]));
+        }
+      });
+      double mean = sum / group_elements;
+
+      double sum_sq = 0;
+      for_each_pixel([&](T const *input, T *) {
+        for (int c = 0; c < group_channels; ++c) {
+          double d = static_cast<double>(static_cast<float>(input[c])) - mean;
+          sum_sq += d * d;
+        }
+      });
+      double inv_std = 1.0 / std::sqrt(sum_sq / group_elements + double(eps));
+
+      for_each_pixel([&](T const *input, T *output) {
+        for (int c = 0; c < group_channels; ++c) {
+          double x = static_cast<double>(static_cast<float>(input[c]));
+          output[c] = T(static_cast<float>(
+            (x - mean) * inv_std * gamma[c_begin + c] + beta[c_begin + c]));
+        }
+      });
+    }
+  });
+
+  return Status::kSuccess;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,155 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host reference implementation of average and max pooling on NHWC tensors.
+
+    Mirrors pooling_nhwc() in device_nhwc_pooling.h, without the stream argument. Output rows
+    are distributed over host threads and the innermost loops run over contiguous channels.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/matrix_coord.h"
+#include "cutlass/tensor_coord.h"
+#include "cutlass/tensor_ref.h"
+
+#include "cutlass/util/reference/detail/host_parallel_for.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Average (poolingType == 0) or max (poolingType == 1) pooling of an NHWC tensor.
+///
+/// As on the device, averages divide by kernel_H * kernel_W regardless of padding, and output
+/// pixels whose window lies entirely in the padding hold -FLT_MAX for max pooling. Returns
+/// kErrorInvalidProblem if the output extent does not match the pooling parameters.
+template <typename T>
+Status pooling_nhwc(cutlass::Tensor4DCoord input_tensor_size,
+                    cutlass::Tensor4DCoord filter_tensor_size,
+                    cutlass::Tensor4DCoord output_tensor_size,
+                    cutlass::Tensor4DCoord padding,
+                    cutlass::MatrixCoord stride,
+                    TensorRef<T, layout::TensorNHWC> ref_input,
+                    TensorRef<T, layout::TensorNHWC> ref_output,
+                    int poolingType, //0 for avg pooling ; 1 for max pooling
+                    int thread_count = 0) {
+
+  int const N = input_tensor_size.n();
+  int const H = input_tensor_size.h();
+  int const W = input_tensor_size.w();
+  int const C = input_tensor_size.c();
+  int const padding_H = padding.h();
+  int const padding_W = padding.w();
+  int const kernel_H = filter_tensor_size.h();
+  int const kernel_W = filter_tensor_size.w();
+  int const stride_H = stride.row();
+  int const stride_W = stride.column();
+
+  if (kernel_H <= 0 || kernel_W <= 0 || stride_H <= 0 || stride_W <= 0) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  int const output_H = (H + 2 * padding_H - kernel_H) / stride_H + 1;
+  int const output_W = (W + 2 * padding_W - kernel_W) / stride_W + 1;
+
+  if (output_tensor_size.n() != N || output_tensor_size.c() != C ||
+      output_tensor_size.h() != output_H || output_tensor_size.w() != output_W) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  bool const is_avg_pooling = (poolingType == 0);
+  float const kernel_size2 = float(kernel_H * kernel_W);
+
+  int64_t const output_rows = int64_t(N) * output_H;
+  int workers = detail::host_worker_count(
+    thread_count,
+    output_rows * output_W * C * kernel_H * kernel_W,
+    int64_t(1) << 16);
+
+  detail::host_parallel_for(workers, output_rows, [&](int64_t row_begin, int64_t row_end) {
+    std::vector<float> pooling(C);
+
+    for (int64_t row = row_begin; row < row_end; ++row) {
+      int n = int(row / output_H);
+      int output_h_idx = int(row % output_H);
+
+      int h_start_idx = std::max(output_h_idx * stride_H - padding_H, 0);
+      int h_end_idx = std::min(output_h_idx * stride_H - padding_H + kernel_H, H);
+
+      for (int output_w_idx = 0; output_w_idx < output_W; ++output_w_idx) {
+        int w_start_idx = std::max(output_w_idx * stride_W - padding_W, 0);
+        int w_end_idx = std::min(output_w_idx * stride_W - padding_W + kernel_W, W);
+
+        std::fill(pooling.begin(), pooling.end(), is_avg_pooling ? 0.0f : -FLT_MAX);
+
+        for (int h = h_start_idx; h < h_end_idx; ++h) {
+          for (int w = w_start_idx; w < w_end_idx; ++w) {
+            T const *input = ref_input.data() + ref_input.offset({n, h, w, 0});
+            if (is_avg_pooling) {
+              for (int c = 0; c < C; ++c) {
+                pooling[c] += static_cast<float>(input[c]);
+              }
+            }
+            else {
+              for (int c = 0; c < C; ++c) {
+                pooling[c] = std::max(pooling[c], static_cast<float>(input[c]));
+              }
+            }
+          }
+        }
+
+        T *output = ref_output.data() + ref_output.offset({n, output_h_idx, output_w_idx, 0});
+        for (int c = 0; c < C; ++c) {
+          output[c] = T(is_avg_pooling ? pooling[c] / kernel_size2 : pooling[c]);
+        }
+      }
+    }
+  });
+
+  return Status::kSuccess;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,10 +35,12 @@
 #pragma once
 
 // Standard Library includes
+#include <type_traits>
 #include <utility>
 
 // Cutlass includes
 #include "cutlass/cutlass.h"
+#include "cutlass/util/host_subbyte.hpp"
 #include "tensor_foreach.h"
 
 namespace cutlass {
@@ -205,6 +207,16 @@ void TensorCopy(
   TensorView<DstElement, DstLayout> dst,
   TensorView<SrcElement, SrcLayout> src) {
 
+  // Dense sub-byte tensors with the same layout and extent are copied a byte at a time
+  if constexpr (std::is_same_v<DstElement, SrcElement> && std::is_same_v<DstLayout, SrcLayout> &&
+                sizeof_bits<DstElement>::value < 8) {
+    if (dst.extent() == src.extent() && dst.stride() == src.stride() &&
+        size_t(dst.size()) == dst.capacity()) {
+      subbyte_copy(dst.data(), src.data(), dst.capacity());
+      return;
+    }
+  }
+
   detail::TrivialConvert<DstElement, SrcElement> convert;
 
   TensorCopy(dst, src, convert);
@@ -53,6 +53,7 @@
 #include "cutlass/blas3.h"
 
 #include "cutlass/util/distribution.h"
+#include "cutlass/util/host_subbyte.hpp"
 #include "tensor_foreach.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +126,14 @@ void TensorFill(
   TensorView<Element, Layout> dst,    ///< destination tensor 
   Element val = Element(0)) {               ///< value to uniformly fill it with
 
+  // Dense sub-byte tensors are filled a byte at a time
+  if constexpr (sizeof_bits<Element>::value < 8) {
+    if (size_t(dst.size()) == dst.capacity()) {
+      subbyte_fill(dst.data(), dst.capacity(), val);
+      return;
+    }
+  }
+
   detail::TensorFillFunc<Element, Layout> func(dst, val);
 
   TensorForEach(
@@ -567,8 +576,13 @@ void BlockFillRandomGaussian(
 
   detail::RandomGaussianFunc<Element> random_func(seed, mean, stddev, bits, pnz);
 
-  for (size_t i = 0; i < capacity; ++i) {
-    ReferenceFactory<Element>::get(ptr, i) = random_func();
+  if constexpr (sizeof_bits<Element>::value < 8) {
+    subbyte_generate(ptr, capacity, random_func);
+  }
+  else {
+    for (size_t i = 0; i < capacity; ++i) {
+      ReferenceFactory<Element>::get(ptr, i) = random_func();
+    }
   }
 }
 
@@ -1098,8 +1112,13 @@ void BlockFill(
   size_t capacity,
   Element val
   ) {                                       
-  for (size_t i = 0; i < capacity; ++i) {
-    ReferenceFactory<Element>::get(ptr, i) = val;
+  if constexpr (sizeof_bits<Element>::value < 8) {
+    subbyte_fill(ptr, capacity, val);
+  }
+  else {
+    for (size_t i = 0; i < capacity; ++i) {
+      ReferenceFactory<Element>::get(ptr, i) = val;
+    }
   }
 }
 
@@ -1119,8 +1138,13 @@ void BlockFillRandomUniform(
   double pnan = 0) {                      ///< Percentage of NaN elements.
   detail::RandomUniformFunc<Element> random_func(seed, max, min, bits, pnan);
 
-  for (size_t i = 0; i < capacity; ++i) {
-    ReferenceFactory<Element>::get(ptr, i) = random_func();
+  if constexpr (sizeof_bits<Element>::value < 8) {
+    subbyte_generate(ptr, capacity, random_func);
+  }
+  else {
+    for (size_t i = 0; i < capacity; ++i) {
+      ReferenceFactory<Element>::get(ptr, i) = random_func();
+    }
   }
 }
 
@@ -31,11 +31,15 @@
 #pragma once
 
 #include <cmath>
+#include <stdexcept>
 
 #include "cutlass/cutlass.h"
 #include "cutlass/complex.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
 #include "cutlass/tensor_ref.h"
 
+#include "cutlass/util/reference/detail/host_reduce.h"
 #include "cutlass/util/reference/detail/linear_to_coordinate.h"
 #include "cutlass/core_io.h"
 
@@ -45,8 +49,11 @@ namespace host {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Transform-reduce operation over the elements of a tensor. This helper allocates the device-side
-/// workspace
+/// Transform-reduce operation over the elements of a tensor.
+///
+/// Unless `options.order` is ReductionOrder::kSerial, the reduction runs on several host threads
+/// and assumes `reduce` is associative and commutative; `reduce` and `transform` must be safe to
+/// call concurrently. Packed views are traversed in memory order rather than by coordinate.
 template <
   typename Element,
   typename Layout,
@@ -58,24 +65,32 @@ ComputeType TensorTransformReduce(
   TensorView<Element, Layout> view,
   ComputeType identity,
   ReduceOp reduce,
-  TransformOp transform
+  TransformOp transform,
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
-  for (int64_t idx = 0; idx < int64_t(view.size()); ++idx) {
+  int64_t count = int64_t(view.size());
+
+  auto element_at_coord = [&](int64_t idx) {
     typename Layout::TensorCoord coord;
     cutlass::reference::detail::LinearToCoordinate<Layout::kRank>()(coord, idx, view.extent());
-
-    if (view.contains(coord)) {
-      Element x = view.at(coord);
-      identity = reduce(identity, transform(x));
-    }
+    Element x = view.at(coord);
+    return transform(x);
+  };
+
+  if (options.order != ReductionOrder::kSerial && int64_t(view.capacity()) == count) {
+    auto element_at_offset = [&](int64_t idx) {
+      Element x = view.data(idx);
+      return transform(x);
+    };
+    return detail::host_transform_reduce(count, identity, reduce, element_at_offset, options);
   }
 
-  return identity;
+  return detail::host_transform_reduce(count, identity, reduce, element_at_coord, options);
 }
 
-/// Transform-reduce operation over the elements of a tensor. This helper allocates the device-side
-/// workspace
+/// Transform-reduce operation over the elements of two tensors of matching extent, applying
+/// `transform(a, b)` to corresponding elements. See the single-tensor overload for `options`.
 template <
   typename Element,
   typename Layout,
@@ -88,25 +103,36 @@ ComputeType TensorTransformReduce(
   TensorView<Element, Layout> view_B,
   ComputeType identity,
   ReduceOp reduce,
-  TransformOp transform) {
+  TransformOp transform,
+  TensorReduceOptions const &options = TensorReduceOptions()) {
   
   if (view_A.extent() != view_B.extent()) {
     throw std::runtime_error("Tensor extents must match.");
   }
 
-  for (int64_t idx = 0; idx < int64_t(view_A.size()); ++idx) {
+  int64_t count = int64_t(view_A.size());
 
+  auto element_at_coord = [&](int64_t idx) {
     typename Layout::TensorCoord coord;
     cutlass::reference::detail::LinearToCoordinate<Layout::kRank>()(coord, idx, view_A.extent());
-
-    if (view_A.contains(coord)) {
-      Element a = view_A.at(coord);
-      Element b = view_B.at(coord);
-      identity = reduce(identity, transform(a, b));
-    }
+    Element a = view_A.at(coord);
+    Element b = view_B.at(coord);
+    return transform(a, b);
+  };
+
+  if (options.order != ReductionOrder::kSerial &&
+      int64_t(view_A.capacity()) == count &&
+      view_A.stride() == view_B.stride()) {
+
+    auto element_at_offset = [&](int64_t idx) {
+      Element a = view_A.data(idx);
+      Element b = view_B.data(idx);
+      return transform(a, b);
+    };
+    return detail::host_transform_reduce(count, identity, reduce, element_at_offset, options);
   }
 
-  return identity;
+  return detail::host_transform_reduce(count, identity, reduce, element_at_coord, options);
 }
 
 /// Helper to compute the sum of the elements of a tensor
@@ -117,14 +143,15 @@ template <
 >
 ComputeType TensorSum(
   TensorView<Element, Layout> view,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
   plus<ComputeType> reduce;
   NumericConverter<ComputeType, Element> transform;
 
   return TensorTransformReduce(
-    view, identity, reduce, transform);
+    view, identity, reduce, transform, options);
 }
 
 /// Helper to compute the sum of the squares of the elements of a tensor
@@ -135,14 +162,15 @@ template <
 >
 ComputeType TensorSumSq(
   TensorView<Element, Layout> view,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
   plus<ComputeType> reduce;
   magnitude_squared<Element, ComputeType> transform;
 
   return TensorTransformReduce(
-    view, identity, reduce, transform);
+    view, identity, reduce, transform, options);
 }
 
 /// Helper to compute the norm of the elements of a tensor.
@@ -153,10 +181,11 @@ template <
 >
 ComputeType TensorNorm(
   TensorView<Element, Layout> view,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
-  return std::sqrt(TensorSumSq(view, identity));
+  return std::sqrt(TensorSumSq(view, identity, options));
 }
 
 /// Helper to compute the sum of the squares of the differences of two tensors
@@ -168,14 +197,15 @@ template <
 ComputeType TensorSumSqDiff(
   TensorView<Element, Layout> view_A,
   TensorView<Element, Layout> view_B,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
   plus<ComputeType> reduce;
   magnitude_squared_difference<Element, ComputeType> transform;
 
   return TensorTransformReduce(
-    view_A, view_B, identity, reduce, transform);
+    view_A, view_B, identity, reduce, transform, options);
 }
 
 
@@ -188,10 +218,31 @@ template <
 ComputeType TensorNormDiff(
   TensorView<Element, Layout> view_A,
   TensorView<Element, Layout> view_B,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
+) {
+
+  return std::sqrt(TensorSumSqDiff(view_A, view_B, identity, options));
+}
+
+/// Helper to compute the largest magnitude of the elements of a tensor (e.g., the amax used to
+/// derive FP8 scale factors)
+template <
+  typename Element,
+  typename Layout,
+  typename ComputeType = float
+>
+ComputeType TensorAbsMax(
+  TensorView<Element, Layout> view,
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
-  return std::sqrt(TensorSumSqDiff(view_A, view_B, identity));
+  maximum<ComputeType> reduce;
+  NumericConverter<ComputeType, Element> convert;
+  absolute_value_op<ComputeType> abs_op;
+
+  return TensorTransformReduce(
+    view, ComputeType(0), reduce, [&](Element x) { return abs_op(convert(x)); }, options);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,8 @@
 #include <utility>
 #include <cstdlib>
 #include <cmath>
+#include <stdexcept>
+#include <type_traits>
 
 // Cute includes
 #include "cute/tensor.hpp"
@@ -50,6 +52,7 @@
 #include "cutlass/quaternion.h"
 #include "cutlass/array.h"
 #include "cutlass/numeric_types.h"
+#include "cutlass/util/reference/detail/host_reduce.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -57,14 +60,29 @@ namespace cutlass {
 namespace reference {
 namespace host {
 
+namespace detail {
+
+/// True if elements of the tensor may be addressed as `view.data()[idx]`
+template <typename Tensor>
+constexpr bool is_compact_pointer_tensor() {
+  using Iterator = cute::remove_cvref_t<decltype(cute::declval<Tensor>().data())>;
+  return std::is_pointer<Iterator>::value &&
+         cute::sizeof_bits_v<typename Tensor::value_type> % 8 == 0;
+}
+
+} // namespace detail
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Tensor reductions
 //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Transform-reduce operation over the elements of a tensor. This helper allocates the device-side
-/// workspace
+/// Transform-reduce operation over the elements of a tensor.
+///
+/// Unless `options.order` is ReductionOrder::kSerial, the reduction runs on several host threads
+/// and assumes `reduce` is associative and commutative; `reduce` and `transform` must be safe to
+/// call concurrently. Compact tensors backed by a raw pointer are traversed in memory order.
 template <
   typename Tensor,
   typename ComputeType,
@@ -75,41 +93,53 @@ ComputeType TensorTransformReduce(
   Tensor view,
   ComputeType identity,
   ReduceOp reduce,
-  TransformOp transform
+  TransformOp transform,
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
-  for (int64_t idx = 0; idx < cute::size(view); ++idx) {
-    identity = reduce(identity, transform(view(idx)));
+  int64_t count = int64_t(cute::size(view));
+
+  if constexpr (detail::is_compact_pointer_tensor<Tensor>()) {
+    if (options.order != ReductionOrder::kSerial && int64_t(cute::cosize(view.layout())) == count) {
+      auto element_at_offset = [&](int64_t idx) {
+        return transform(view.data()[idx]);
+      };
+      return detail::host_transform_reduce(count, identity, reduce, element_at_offset, options);
+    }
   }
 
-  return identity;
+  auto element = [&](int64_t idx) {
+    return transform(view(idx));
+  };
+  return detail::host_transform_reduce(count, identity, reduce, element, options);
 }
 
-/// Transform-reduce operation over the elements of a tensor. This helper allocates the device-side
-/// workspace
+/// Transform-reduce operation over the elements of two tensors of matching size, applying
+/// `transform(a, b)` to corresponding elements. See the single-tensor overload for `options`.
 template <
   typename TensorA,
   typename TensorB,
   typename ComputeType,
   typename ReduceOp,
-  typename TransformOp
+  typename TransformOp,
+  typename = std::enable_if_t<cute::is_tensor<TensorB>::value>
 >
 ComputeType TensorTransformReduce(
   TensorA view_A,
   TensorB view_B,
   ComputeType identity,
   ReduceOp reduce,
-  TransformOp transform) {
+  TransformOp transform,
+  TensorReduceOptions const &options = TensorReduceOptions()) {
   
   if (cute::size(view_A) != cute::size(view_B)) {
     throw std::runtime_error("Tensor sizes must match.");
   }
 
-  for (int64_t idx = 0; idx < cute::size(view_A); ++idx) {
-    identity = reduce(identity, transform(view_A(idx), view_B(idx)));
-  }
-
-  return identity;
+  auto element = [&](int64_t idx) {
+    return transform(view_A(idx), view_B(idx));
+  };
+  return detail::host_transform_reduce(int64_t(cute::size(view_A)), identity, reduce, element, options);
 }
 
 /// Helper to compute the sum of the elements of a tensor
@@ -119,14 +149,15 @@ template <
 >
 ComputeType TensorSum(
   Tensor view,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
   plus<ComputeType> reduce;
   NumericConverter<ComputeType, typename Tensor::value_type> transform;
 
   return TensorTransformReduce(
-    view, identity, reduce, transform);
+    view, identity, reduce, transform, options);
 }
 
 /// Helper to compute the sum of the squares of the elements of a tensor
@@ -136,14 +167,15 @@ template <
 >
 ComputeType TensorSumSq(
   Tensor view,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
   plus<ComputeType> reduce;
   magnitude_squared<typename Tensor::value_type, ComputeType> transform;
 
   return TensorTransformReduce(
-    view, identity, reduce, transform);
+    view, identity, reduce, transform, options);
 }
 
 /// Helper to compute the norm of the elements of a tensor.
@@ -153,10 +185,11 @@ template <
 >
 ComputeType TensorNorm(
   Tensor view,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
-  return std::sqrt(TensorSumSq(view, identity));
+  return std::sqrt(TensorSumSq(view, identity, options));
 }
 
 /// Helper to compute the sum of the squares of the differences of two tensors
@@ -168,14 +201,15 @@ template <
 ComputeType TensorSumSqDiff(
   TensorA view_A,
   TensorB view_B,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
   plus<ComputeType> reduce;
   magnitude_squared_difference<typename TensorA::value_type, ComputeType> transform;
 
   return TensorTransformReduce(
-    view_A, view_B, identity, reduce, transform);
+    view_A, view_B, identity, reduce, transform, options);
 }
 
 
@@ -188,10 +222,32 @@ template <
 ComputeType TensorNormDiff(
   TensorA view_A,
   TensorB view_B,
-  ComputeType identity = ComputeType()
+  ComputeType identity = ComputeType(),
+  TensorReduceOptions const &options = TensorReduceOptions()
 ) {
 
-  return std::sqrt(TensorSumSqDiff(view_A, view_B, identity));
+  return std::sqrt(TensorSumSqDiff(view_A, view_B, identity, options));
+}
+
+/// Helper to compute the largest magnitude of the elements of a tensor (e.g., the amax used to
+/// derive FP8 scale factors)
+template <
+  typename Tensor,
+  typename ComputeType = float
+>
+ComputeType TensorAbsMax(
+  Tensor view,
+  TensorReduceOptions const &options = TensorReduceOptions()
+) {
+
+  using Element = typename Tensor::value_type;
+
+  maximum<ComputeType> reduce;
+  NumericConverter<ComputeType, Element> convert;
+  absolute_value_op<ComputeType> abs_op;
+
+  return TensorTransformReduce(
+    view, ComputeType(0), reduce, [&](Element const &x) { return abs_op(convert(x)); }, options);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,466 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host-side simulation of the SM90 persistent and stream-K tile schedulers.
+
+    The simulator runs the schedulers' own parameter setup (grid shape, swizzle, rasterization and
+    the stream-K decomposition heuristic) followed by their work-assignment logic for every
+    persistent CTA of the launch. This exposes the decomposition chosen for a problem without
+    requiring a GPU: which output tiles and K ranges each CTA computes, how many data-parallel,
+    split-K and stream-K units are used, how many peers must reduce into each output tile and how
+    evenly mainloop iterations are spread across CTAs.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cutlass/gemm_coord.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_stream_k.hpp"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tile schedulers supported by TileSchedulerSimulator
+enum class SimulatedTileScheduler {
+  kPersistent,      ///< PersistentTileSchedulerSm90
+  kStreamK          ///< PersistentTileSchedulerSm90StreamK
+};
+
+/// Simulates the assignment of output tiles to persistent CTAs
+class TileSchedulerSimulator {
+public:
+
+  using RasterOrder = gemm::kernel::detail::RasterOrder;
+  using RasterOrderOptions = gemm::kernel::detail::RasterOrderOptions;
+  using DecompositionMode = gemm::kernel::detail::DecompositionMode;
+  using ReductionMode = gemm::kernel::detail::ReductionMode;
+
+  using PersistentScheduler = gemm::kernel::detail::PersistentTileSchedulerSm90;
+  using PersistentParams = gemm::kernel::detail::PersistentTileSchedulerSm90Params;
+
+  // Work assignment in the stream-K scheduler depends only on its runtime parameters, so any
+  // tile and cluster shape may be used to name the scheduler type.
+  using StreamKScheduler = gemm::kernel::detail::PersistentTileSchedulerSm90StreamK<
+    cute::Shape<cute::_128, cute::_128, cute::_64>, cute::Shape<cute::_1, cute::_1, cute::_1>>;
+  using StreamKParams = gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams;
+
+  /// Problem and scheduler configuration
+  struct Arguments {
+    SimulatedTileScheduler scheduler = SimulatedTileScheduler::kStreamK;
+
+    gemm::BatchedGemmCoord problem_size{4096, 4096, 4096, 1};
+    gemm::GemmCoord tile_shape{128, 128, 64};
+    gemm::GemmCoord cluster_shape{1, 1, 1};
+
+    /// Number of SMs available to the kernel. Must be positive: no device is queried.
+    int sm_count = 132;
+
+    /// Result of cudaOccupancyMaxActiveClusters(), or zero to use the scheduler's own estimate
+    int max_active_clusters = 0;
+
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+
+    // Stream-K scheduler only
+    DecompositionMode decomposition_mode = DecompositionMode::Heuristic;
+    ReductionMode reduction_mode = ReductionMode::Deterministic;
+    int splits = 1;
+
+    /// Forces separate reduction with this many epilogue subtiles per stream-K tile. The scheduler's
+    /// heuristic never selects separate reduction at the moment, so 0 keeps its choice.
+    uint32_t separate_reduction_subtiles = 0;
+
+    /// Records every (CTA, output tile) visit in Result::work. Disable for fast sweeps.
+    bool record_work = true;
+  };
+
+  /// Portion of one output tile computed by a CTA
+  struct Work {
+    uint32_t cta = 0;                 ///< linear index of the persistent CTA
+    uint64_t unit = 0;                ///< scheduler work unit (linear work index)
+    int32_t m = 0;                    ///< output tile coordinates, in units of CTA tiles
+    int32_t n = 0;
+    int32_t l = 0;
+    uint32_t k_begin = 0;             ///< first K tile computed
+    uint32_t k_tiles = 0;             ///< number of K tiles computed
+    bool separate_reduction = false;  ///< unit only reduces partials and runs the epilogue
+  };
+
+  /// Per-CTA totals
+  struct Cta {
+    uint32_t units = 0;               ///< work units started by the CTA
+    uint32_t tiles = 0;               ///< output tile visits (epilogues or partial stores)
+    uint64_t k_tiles = 0;             ///< mainloop iterations
+  };
+
+  /// Outcome of a simulation
+  struct Result {
+    dim3 grid{0, 0, 0};                     ///< launch grid (one CTA per SM slot)
+    dim3 output_tiles_mnl{0, 0, 0};         ///< output tiles after padding to cluster and swizzle
+    dim3 problem_tiles_mnl{0, 0, 0};        ///< output tiles covering the problem itself
+    uint32_t k_tiles_per_output_tile = 0;
+
+    RasterOrder raster_order = RasterOrder::AlongN;
+    int log_swizzle_size = 0;
+
+    DecompositionMode decomposition = DecompositionMode::DataParallel;
+    uint32_t splits = 1;
+    uint64_t units = 0;                     ///< total work units
+    uint64_t sk_units = 0;
+    uint64_t sk_tiles = 0;
+    uint64_t dp_units = 0;
+    uint64_t reduction_units = 0;           ///< separate-reduction units, included in units
+    uint32_t sk_groups = 1;
+    uint32_t big_units = 0;
+
+    std::vector<Cta> ctas;                  ///< indexed by linear CTA index
+    std::vector<Work> work;                 ///< populated when Arguments::record_work is set
+
+    std::vector<uint32_t> tile_peers;       ///< units computing K tiles of each output tile
+    std::vector<uint64_t> tile_k_tiles;     ///< K tiles computed for each output tile
+
+    /// Number of CTAs in the launch grid
+    uint64_t grid_ctas() const {
+      return uint64_t(grid.x) * grid.y * grid.z;
+    }
+
+    /// Number of output tiles, including padding
+    uint64_t output_tiles() const {
+      return uint64_t(output_tiles_mnl.x) * output_tiles_mnl.y * output_tiles_mnl.z;
+    }
+
+    /// Linear index of output tile (m, n, l) within tile_peers and tile_k_tiles
+    uint64_t tile_index(int32_t m, int32_t n, int32_t l) const {
+      return (uint64_t(l) * output_tiles_mnl.x + uint64_t(m)) * output_tiles_mnl.y + uint64_t(n);
+    }
+
+    /// Number of waves needed to issue every work unit once per CTA
+    uint64_t waves() const {
+      uint64_t ctas = grid_ctas();
+      return ctas ? (units + ctas - 1) / ctas : 0;
+    }
+
+    /// Fraction of CTA slots occupied by a purely data-parallel schedule of the output tiles
+    double data_parallel_wave_efficiency() const {
+      uint64_t ctas = grid_ctas();
+      if (!ctas || !output_tiles()) {
+        return 0;
+      }
+      uint64_t waves = (output_tiles() + ctas - 1) / ctas;
+      return double(output_tiles()) / double(waves * ctas);
+    }
+
+    /// Largest number of mainloop iterations computed by any CTA
+    uint64_t max_cta_k_tiles() const {
+      uint64_t result = 0;
+      for (Cta const &cta : ctas) {
+        result = std::max(result, cta.k_tiles);
+      }
+      return result;
+    }
+
+    /// Average number of mainloop iterations per CTA
+    double mean_cta_k_tiles() const {
+      if (ctas.empty()) {
+        return 0;
+      }
+      uint64_t total = 0;
+      for (Cta const &cta : ctas) {
+        total += cta.k_tiles;
+      }
+      return double(total) / double(ctas.size());
+    }
+
+    /// Ratio of the busiest CTA's mainloop iterations to the average (1.0 is perfectly balanced)
+    double load_imbalance() const {
+      double mean = mean_cta_k_tiles();
+      return mean > 0 ? double(max_cta_k_tiles()) / mean : 0;
+    }
+
+    /// Largest number of units reducing into a single output tile
+    uint32_t max_peers() const {
+      uint32_t result = 0;
+      for (uint32_t peers : tile_peers) {
+        result = std::max(result, peers);
+      }
+      return result;
+    }
+
+    /// Number of output tiles computed by more than one unit
+    uint64_t split_tiles() const {
+      return std::count_if(tile_peers.begin(), tile_peers.end(), [](uint32_t peers) { return peers > 1; });
+    }
+
+    /// Returns true if every output tile's K extent was computed exactly once
+    bool coverage_ok() const {
+      return std::all_of(tile_k_tiles.begin(), tile_k_tiles.end(),
+        [this](uint64_t k_tiles) { return k_tiles == k_tiles_per_output_tile; });
+    }
+  };
+
+  /// Runs the simulation
+  static Result run(Arguments const &args) {
+
+    Result result;
+
+    KernelHardwareInfo hw_info;
+    hw_info.sm_count = args.sm_count;
+    hw_info.max_active_clusters = args.max_active_clusters;
+
+    dim3 problem_blocks = PersistentParams::get_tiled_cta_shape_mnl(
+      args.problem_size, args.tile_shape, args.cluster_shape);
+
+    result.problem_tiles_mnl = dim3(
+      ceil_div(args.problem_size.m(), args.tile_shape.m()),
+      ceil_div(args.problem_size.n(), args.tile_shape.n()),
+      args.problem_size.batch());
+    result.k_tiles_per_output_tile = ceil_div(args.problem_size.k(), args.tile_shape.k());
+
+    result.log_swizzle_size = PersistentParams::get_log_swizzle_size(
+      problem_blocks.x, problem_blocks.y, args.max_swizzle_size);
+    result.output_tiles_mnl = dim3(
+      round_up(problem_blocks.x, (1 << result.log_swizzle_size) * args.cluster_shape.m()),
+      round_up(problem_blocks.y, (1 << result.log_swizzle_size) * args.cluster_shape.n()),
+      problem_blocks.z);
+
+    result.tile_peers.assign(result.output_tiles(), 0);
+    result.tile_k_tiles.assign(result.output_tiles(), 0);
+
+    if (args.scheduler == SimulatedTileScheduler::kPersistent) {
+      run_persistent_(args, hw_info, problem_blocks, result);
+    }
+    else {
+      run_stream_k_(args, hw_info, problem_blocks, result);
+    }
+
+    return result;
+  }
+
+private:
+
+  /// Initial linear work index of the CTA at (x, y) in the launch grid, as computed by the
+  /// scheduler constructors
+  static uint64_t cta_linear_idx_(
+    dim3 grid, RasterOrder raster_order, uint32_t x, uint32_t y) {
+
+    if (raster_order == RasterOrder::AlongN) {
+      return uint64_t(x) + uint64_t(y) * uint64_t(grid.x);
+    }
+    return uint64_t(x) * uint64_t(grid.y) + uint64_t(y);
+  }
+
+  static void record_(
+    Result &result,
+    bool record_work,
+    Work const &work) {
+
+    Cta &cta = result.ctas.at(work.cta);
+    ++cta.tiles;
+    cta.k_tiles += work.k_tiles;
+
+    if (work.m >= 0 && work.n >= 0 && work.l >= 0) {
+      uint64_t tile = result.tile_index(work.m, work.n, work.l);
+      // Separate-reduction units only reduce the partials of the tile's peers
+      if (tile < result.output_tiles() && !work.separate_reduction) {
+        ++result.tile_peers[tile];
+        result.tile_k_tiles[tile] += work.k_tiles;
+      }
+    }
+
+    if (record_work) {
+      result.work.push_back(work);
+    }
+  }
+
+  static void run_persistent_(
+    Arguments const &args,
+    KernelHardwareInfo const &hw_info,
+    dim3 problem_blocks,
+    Result &result) {
+
+    PersistentParams params;
+    params.initialize(
+      problem_blocks, args.cluster_shape, hw_info, args.max_swizzle_size, args.raster_order);
+
+    result.grid = PersistentParams::get_grid_shape(
+      problem_blocks, args.cluster_shape, hw_info, args.max_swizzle_size, args.raster_order);
+    result.raster_order = params.raster_order_;
+    result.decomposition = DecompositionMode::DataParallel;
+    result.units = params.blocks_per_problem_;
+    result.dp_units = params.blocks_per_problem_;
+    result.ctas.assign(result.grid_ctas(), Cta{});
+
+    uint64_t grid_ctas = result.grid_ctas();
+
+    for (uint32_t y = 0; y < result.grid.y; ++y) {
+      for (uint32_t x = 0; x < result.grid.x; ++x) {
+
+        uint64_t cta_idx = cta_linear_idx_(result.grid, params.raster_order_, x, y);
+        uint64_t cta_m_in_cluster = x % args.cluster_shape.m();
+        uint64_t cta_n_in_cluster = y % args.cluster_shape.n();
+
+        // Mirrors StaticPersistentTileScheduler::get_current_work_for_linear_idx()
+        for (uint64_t linear_idx = cta_idx; linear_idx < params.blocks_per_problem_; linear_idx += grid_ctas) {
+          uint64_t work_idx_l, remainder;
+          params.divmod_batch_(work_idx_l, remainder, linear_idx);
+
+          uint64_t blk_per_grid_dim = params.divmod_cluster_shape_minor_.divide(remainder);
+
+          auto [work_idx_m, work_idx_n] = PersistentScheduler::get_work_idx_m_and_n(
+            blk_per_grid_dim,
+            params.divmod_cluster_shape_major_,
+            params.divmod_cluster_shape_minor_,
+            params.divmod_cluster_blk_major_,
+            params.log_swizzle_size_,
+            params.raster_order_,
+            cta_m_in_cluster,
+            cta_n_in_cluster);
+
+          Work work;
+          work.cta = static_cast<uint32_t>(cta_idx);
+          work.unit = linear_idx;
+          work.m = work_idx_m;
+          work.n = work_idx_n;
+          work.l = static_cast<int32_t>(work_idx_l);
+          work.k_tiles = result.k_tiles_per_output_tile;
+
+          ++result.ctas[cta_idx].units;
+          record_(result, args.record_work, work);
+        }
+      }
+    }
+  }
+
+  static void run_stream_k_(
+    Arguments const &args,
+    KernelHardwareInfo const &hw_info,
+    dim3 problem_blocks,
+    Result &result) {
+
+    using WorkTileInfo = typename StreamKScheduler::WorkTileInfo;
+
+    StreamKParams params;
+    params.initialize(
+      problem_blocks,
+      result.k_tiles_per_output_tile,
+      args.cluster_shape,
+      hw_info,
+      args.splits,
+      args.max_swizzle_size,
+      args.raster_order,
+      args.reduction_mode,
+      args.decomposition_mode,
+      nullptr);
+
+    // Each stream-K tile is reduced by one unit per epilogue subtile, issued after all stream-K and
+    // data-parallel units
+    if (args.separate_reduction_subtiles > 0 && params.sk_units_ > 0) {
+      params.divmod_epilogue_subtile_ = FastDivmodU64(args.separate_reduction_subtiles);
+      params.separate_reduction_units_ = params.sk_tiles_ * args.separate_reduction_subtiles;
+    }
+
+    result.grid = StreamKParams::get_grid_shape(
+      problem_blocks, args.cluster_shape, hw_info, args.max_swizzle_size, args.raster_order);
+    result.raster_order = params.raster_order_;
+    result.splits = static_cast<uint32_t>(params.divmod_splits_.divisor);
+    result.units = params.units_per_problem_ * params.divmod_splits_.divisor + params.separate_reduction_units_;
+    result.sk_units = params.sk_units_;
+    result.sk_tiles = params.sk_tiles_;
+    result.reduction_units = params.separate_reduction_units_;
+    result.dp_units = result.splits > 1 ? 0 : params.units_per_problem_ - params.sk_units_;
+    result.sk_groups = static_cast<uint32_t>(params.divmod_sk_groups_.divisor);
+    result.big_units = params.big_units_;
+
+    if (result.splits > 1) {
+      result.decomposition = DecompositionMode::SplitK;
+    }
+    else if (params.sk_units_ > 0) {
+      result.decomposition = DecompositionMode::StreamK;
+    }
+    else {
+      result.decomposition = DecompositionMode::DataParallel;
+    }
+
+    result.ctas.assign(result.grid_ctas(), Cta{});
+
+    uint64_t grid_ctas = result.grid_ctas();
+
+    for (uint32_t y = 0; y < result.grid.y; ++y) {
+      for (uint32_t x = 0; x < result.grid.x; ++x) {
+
+        uint64_t cta_idx = cta_linear_idx_(result.grid, params.raster_order_, x, y);
+        dim3 block_id_in_cluster(x % args.cluster_shape.m(), y % args.cluster_shape.n(), 0);
+
+        // Same sequence of calls as the kernel's initial_work_tile_info() / fetch_next_work() loop
+        for (uint64_t linear_idx = cta_idx; ; linear_idx += grid_ctas) {
+          uint32_t unit_iter_start = 0;
+          WorkTileInfo work_tile_info = StreamKScheduler::get_current_work_for_linear_idx(
+            unit_iter_start, linear_idx, block_id_in_cluster, params);
+
+          if (!work_tile_info.is_valid()) {
+            break;
+          }
+
+          ++result.ctas[cta_idx].units;
+
+          do {
+            Work work;
+            work.cta = static_cast<uint32_t>(cta_idx);
+            work.unit = linear_idx;
+            work.m = work_tile_info.M_idx;
+            work.n = work_tile_info.N_idx;
+            work.l = work_tile_info.L_idx;
+            work.separate_reduction = work_tile_info.is_separate_reduction;
+            work.k_begin = work.separate_reduction ? 0 : static_cast<uint32_t>(work_tile_info.K_idx);
+            work.k_tiles = work_tile_info.k_tile_count;
+
+            record_(result, args.record_work, work);
+          } while (StreamKScheduler::continue_current_work_for_linear_idx(
+            linear_idx, unit_iter_start, block_id_in_cluster, work_tile_info, params));
+        }
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////